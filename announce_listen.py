@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+#
+# Listen for ratgdo LAN state announcements, report loss and resync from
+# /status.json when a gap in sequence numbers is seen...
+#
+#   python3 announce_listen.py
+#
+# or measure delivery latency by toggling the garage light and timing how long
+# until the announcement of the new state arrives...
+#
+#   python3 announce_listen.py --bench <ip-address> [--count 20] [--user admin --password password]
+#
+# Latency includes the round trip to the garage door opener, as the light state
+# is only announced once the opener reports it has changed.
+#
+# Copyright (c) 2024 David Kerr, https://github.com/dkerr64
+#
+import argparse
+import json
+import socket
+import struct
+import time
+import urllib.parse
+import urllib.request
+
+ANNOUNCE_GROUP = "239.255.71.68"
+ANNOUNCE_PORT = 5768
+
+
+def open_socket():
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(("", ANNOUNCE_PORT))
+    mreq = struct.pack("4sl", socket.inet_aton(ANNOUNCE_GROUP), socket.INADDR_ANY)
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, mreq)
+    return sock
+
+
+def opener(host, user, password):
+    handlers = []
+    if user:
+        mgr = urllib.request.HTTPPasswordMgrWithDefaultRealm()
+        mgr.add_password(None, "http://" + host, user, password)
+        handlers.append(urllib.request.HTTPDigestAuthHandler(mgr))
+    return urllib.request.build_opener(*handlers)
+
+
+class Receiver:
+    def __init__(self, user=None, password=None):
+        self.sock = open_socket()
+        self.user = user
+        self.password = password
+        self.hosts = {}  # source address -> (boot, seq)
+        self.received = 0
+        self.lost = 0
+        self.resyncs = 0
+
+    def resync(self, addr):
+        url = "http://%s/status.json" % addr
+        try:
+            with opener(addr, self.user, self.password).open(url, timeout=5) as r:
+                status = json.load(r)
+            self.resyncs += 1
+            print("%s resync: door %s, light %s" % (addr, status.get("garageDoorState"), status.get("garageLightOn")))
+        except OSError as e:
+            print("%s resync failed: %s" % (addr, e))
+
+    def receive(self, timeout=None):
+        self.sock.settimeout(timeout)
+        data, (addr, _) = self.sock.recvfrom(1500)
+        at = time.monotonic()
+        msg = json.loads(data)
+        self.received += 1
+        boot, seq = self.hosts.get(addr, (None, None))
+        if boot != msg["boot"]:
+            if boot is not None:
+                print("%s rebooted" % addr)
+            self.resync(addr)
+        elif msg["seq"] != seq + 1:
+            missed = msg["seq"] - seq - 1
+            self.lost += max(missed, 0)
+            print("%s missed %d announcement(s)" % (addr, missed))
+            self.resync(addr)
+        self.hosts[addr] = (msg["boot"], msg["seq"])
+        return addr, at, msg
+
+
+def listen(args):
+    rx = Receiver(args.user, args.password)
+    print("Listening on %s:%d" % (ANNOUNCE_GROUP, ANNOUNCE_PORT))
+    try:
+        while True:
+            addr, _, msg = rx.receive()
+            print("%s seq %d%s: door %s, light %s, lock %s, motion %s, obstructed %s, vehicle %s" % (
+                addr, msg["seq"], " (heartbeat)" if msg["heartbeat"] else "", msg["garageDoorState"],
+                msg["garageLightOn"], msg["garageLockState"], msg["garageMotion"],
+                msg["garageObstructed"], msg["vehicleStatus"] or "-"))
+    except KeyboardInterrupt:
+        pass
+    print("Received %d, lost %d, resyncs %d" % (rx.received, rx.lost, rx.resyncs))
+
+
+def bench(args):
+    rx = Receiver(args.user, args.password)
+    http = opener(args.bench, args.user, args.password)
+    with http.open("http://%s/status.json" % args.bench, timeout=5) as r:
+        light = json.load(r)["garageLightOn"]
+
+    latencies = []
+    timeouts = 0
+    for _ in range(args.count):
+        light = not light
+        body = urllib.parse.urlencode({"garageLightOn": "1" if light else "0"}).encode()
+        start = time.monotonic()
+        http.open("http://%s/setgdo" % args.bench, data=body, timeout=5).close()
+        deadline = start + args.timeout
+        while True:
+            try:
+                addr, at, msg = rx.receive(max(deadline - time.monotonic(), 0.001))
+            except socket.timeout:
+                timeouts += 1
+                print("timeout waiting for light %s" % ("on" if light else "off"))
+                break
+            if addr == args.bench and not msg["heartbeat"] and msg["garageLightOn"] == light:
+                latencies.append((at - start) * 1000)
+                break
+        time.sleep(args.interval)
+
+    print("Sent %d, received %d, timeouts %d, announcements lost %d" % (
+        args.count, len(latencies), timeouts, rx.lost))
+    if latencies:
+        latencies.sort()
+        p95 = latencies[min(len(latencies) - 1, int(len(latencies) * 0.95))]
+        print("Latency ms: min %.1f, avg %.1f, p95 %.1f, max %.1f" % (
+            latencies[0], sum(latencies) / len(latencies), p95, latencies[-1]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="ratgdo LAN announcement listener and benchmark")
+    parser.add_argument("--bench", metavar="IP", help="toggle light on this ratgdo and measure latency")
+    parser.add_argument("--count", type=int, default=20, help="number of light toggles (default 20)")
+    parser.add_argument("--interval", type=float, default=2.0, help="seconds between toggles (default 2)")
+    parser.add_argument("--timeout", type=float, default=5.0, help="seconds to wait for each announcement")
+    parser.add_argument("--user", help="web page username, if password required")
+    parser.add_argument("--password", help="web page password")
+    args = parser.parse_args()
+    if args.bench:
+        bench(args)
+    else:
+        listen(args)
+
+
+if __name__ == "__main__":
+    main()
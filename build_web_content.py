@@ -8,15 +8,305 @@
 # 
 # Copyright (c) 2023 David Kerr, https://github.com/dkerr64
 #
+# HTML, CSS and JavaScript are minified first (comments and surplus whitespace
+# removed), set RATGDO_NO_MINIFY=1 in the environment to ship them as written.
+#
 import os
+import sys
 import shutil
 import base64
 import zlib
 import gzip
+import re
+import subprocess
+from html.parser import HTMLParser
 
 sourcepath = "src/www"
 targetpath = sourcepath + "/build"
 
+
+# --- Minification -------------------------------------------------------------
+#
+# Deliberately conservative, tokens are copied unchanged and only comments and
+# whitespace between them are removed. A line break is kept wherever the source
+# had one unless it is next to punctuation that makes it redundant, so JavaScript
+# automatic semicolon insertion is not affected. After minifying, the token
+# sequence is compared against the original and the build fails if they differ.
+# Comments that contain a copyright notice are kept.
+
+class MinifyError(Exception):
+    pass
+
+
+JS_WORD = re.compile(r"[A-Za-z0-9_$\\]+")
+# A "/" after one of these starts a regular expression, otherwise it is division
+JS_REGEX_AFTER_PUNCT = set("(,=:[!&|?{};+-*%<>~^")
+JS_REGEX_AFTER_WORD = {"return", "typeof", "case", "do", "else", "in", "of", "new", "delete",
+                       "void", "throw", "instanceof", "yield", "await"}
+
+
+def keep_comment(text):
+    return "Copyright" in text
+
+
+def js_tokens(src):
+    """Split JavaScript into (kind, text), kind is ws, comment, str, regex, word or punct."""
+    out = []
+    i = 0
+    n = len(src)
+    braces = []  # "{" for a block, "`" for a template ${ } substitution
+    last = None  # last significant token
+
+    def scan_template(i):
+        # i is just after the opening ` or the } that closes a substitution
+        while i < n:
+            c = src[i]
+            if c == "\\":
+                i += 2
+            elif c == "`":
+                return i + 1, False
+            elif src.startswith("${", i):
+                return i + 2, True
+            else:
+                i += 1
+        raise MinifyError("unterminated template literal")
+
+    while i < n:
+        c = src[i]
+        start = i
+        if c.isspace():
+            while i < n and src[i].isspace():
+                i += 1
+            out.append(("ws", src[start:i]))
+            continue
+        if src.startswith("//", i):
+            i = src.find("\n", i)
+            i = n if i < 0 else i
+            out.append(("comment", src[start:i]))
+            continue
+        if src.startswith("/*", i):
+            i = src.find("*/", i + 2)
+            if i < 0:
+                raise MinifyError("unterminated comment")
+            i += 2
+            out.append(("comment", src[start:i]))
+            continue
+        if c in "'\"":
+            i += 1
+            while i < n and src[i] != c:
+                if src[i] == "\n":
+                    raise MinifyError("unterminated string")
+                i += 2 if src[i] == "\\" else 1
+            if i >= n:
+                raise MinifyError("unterminated string")
+            i += 1
+            tok = ("str", src[start:i])
+        elif c == "`" or (c == "}" and braces and braces[-1] == "`"):
+            if c == "}":
+                braces.pop()
+            i, subst = scan_template(i + 1)
+            if subst:
+                braces.append("`")
+            tok = ("str", src[start:i])
+        elif c == "/" and (last is None or (last[0] == "punct" and last[1] in JS_REGEX_AFTER_PUNCT) or
+                           (last[0] == "word" and last[1] in JS_REGEX_AFTER_WORD)):
+            i += 1
+            in_class = False
+            while i < n and (in_class or src[i] != "/"):
+                if src[i] == "\n":
+                    raise MinifyError("unterminated regular expression")
+                if src[i] == "\\":
+                    i += 1
+                elif src[i] == "[":
+                    in_class = True
+                elif src[i] == "]":
+                    in_class = False
+                i += 1
+            i += 1
+            while i < n and (src[i].isalnum()):
+                i += 1
+            tok = ("regex", src[start:i])
+        else:
+            m = JS_WORD.match(src, i)
+            if m:
+                i = m.end()
+                tok = ("word", m.group())
+            else:
+                if c == "{":
+                    braces.append("{")
+                elif c == "}" and braces:
+                    braces.pop()
+                i += 1
+                tok = ("punct", c)
+        out.append(tok)
+        last = tok
+    return out
+
+
+# Characters either side of a removed space that would join into a different token
+def needs_space(a, b):
+    if JS_WORD.match(a[-1]) and JS_WORD.match(b[0]):
+        return True
+    return (a[-1] + b[0]) in ("++", "--", "+-", "-+", "//", "/*", "*/") or (a[-1] == "." and b[0].isdigit())
+
+
+def join_tokens(tokens, newline_ok_before, newline_ok_after):
+    out = []
+    gap = ""  # whitespace seen since last token: "", " " or "\n"
+    for kind, text in tokens:
+        if kind == "ws" or (kind == "comment" and not keep_comment(text)):
+            if "\n" in text or text.startswith("//"):
+                gap = "\n"
+            elif not gap:
+                gap = " "
+            continue
+        if out and gap:
+            prev = out[-1]
+            if gap == "\n" and not (prev[-1] in newline_ok_after or text[0] in newline_ok_before):
+                out.append("\n")
+            elif needs_space(prev, text):
+                out.append(" ")
+        out.append(text)
+        if kind == "comment":
+            out.append("\n")
+        gap = ""
+    return "".join(out)
+
+
+def significant(tokens):
+    return [t for t in tokens if t[0] != "ws" and t[0] != "comment"]
+
+
+def check_node(js, name):
+    # Full syntax check if Node.js is installed, the token comparison below always runs
+    node = shutil.which("node")
+    if not node:
+        return
+    r = subprocess.run([node, "--check", "--input-type=commonjs", "-"], input=js.encode(), capture_output=True)
+    if r.returncode != 0:
+        raise MinifyError("minified JavaScript does not parse:\n" + r.stderr.decode()[-2000:])
+
+
+def minify_js(src, name):
+    tokens = js_tokens(src)
+    out = join_tokens(tokens, ")]},;", ";{,([=:&|?")
+    if significant(js_tokens(out)) != significant(tokens):
+        raise MinifyError("JavaScript tokens changed by minify")
+    check_node(out, name)
+    return out
+
+
+def css_tokens(src):
+    out = []
+    for m in re.finditer(r"\s+|/\*.*?\*/|\"(?:\\.|[^\"\\])*\"|'(?:\\.|[^'\\])*'|[A-Za-z0-9_\-#.%!@]+|.", src, re.S):
+        t = m.group()
+        kind = "ws" if t.isspace() else "comment" if t.startswith("/*") else "tok"
+        if kind == "comment" and not t.endswith("*/"):
+            raise MinifyError("unterminated comment")
+        out.append((kind, t))
+    return out
+
+
+def minify_css(src, name):
+    tokens = css_tokens(src)
+    out = []
+    gap = False
+    for kind, text in tokens:
+        if kind == "ws" or (kind == "comment" and not keep_comment(text)):
+            gap = True
+            continue
+        # Space before ":" is kept, in a selector it means something different
+        if gap and out and out[-1][-1] not in "{};,>:" and text[0] not in "{};,>":
+            out.append(" ")
+        if text == "}" and out and out[-1] == ";":
+            out.pop()
+        out.append(text)
+        gap = False
+    result = "".join(out)
+    if result.count("{") != result.count("}"):
+        raise MinifyError("unbalanced braces in CSS")
+    strip = lambda toks: [t for t in significant(toks) if t[1] != ";"]
+    if strip(css_tokens(result)) != strip(tokens):
+        raise MinifyError("CSS tokens changed by minify")
+    return result
+
+
+class TagSequence(HTMLParser):
+    """Collect tags, attributes and whitespace-normalized text, to compare before and after."""
+
+    def __init__(self):
+        super().__init__(convert_charrefs=False)
+        self.items = []
+        self.raw = None
+
+    def handle_starttag(self, tag, attrs):
+        self.items.append(("start", tag, tuple(attrs)))
+        self.raw = tag if tag in ("script", "style") else None
+
+    def handle_endtag(self, tag):
+        self.items.append(("end", tag))
+        self.raw = None
+
+    def handle_data(self, data):
+        if self.raw is None and data.split():
+            self.items.append(("text", " ".join(data.split())))
+
+
+HTML_RAW = re.compile(r"<(pre|textarea|script|style)\b[^>]*>(.*?)</\1\s*>", re.S | re.I)
+HTML_PART = re.compile(r"<!--.*?-->|<[^>]*>|[^<]+|<", re.S)
+
+
+def minify_html(src, name):
+    out = []
+    pos = 0
+
+    def text_part(chunk):
+        # drop comments first so that whitespace either side of them is merged
+        chunk = re.sub(r"<!--.*?-->", lambda c: c.group() if keep_comment(c.group()) else "", chunk, flags=re.S)
+        for m in HTML_PART.finditer(chunk):
+            t = m.group()
+            if t.startswith("<"):
+                out.append(t)
+            else:
+                out.append(re.sub(r"\s+", lambda w: "\n" if "\n" in w.group() else " ", t))
+
+    for m in HTML_RAW.finditer(src):
+        text_part(src[pos:m.start()])
+        tag = m.group(1).lower()
+        body = m.group(2)
+        open_tag = src[m.start():m.start(2)]
+        if tag == "script" and body.strip():
+            body = minify_js(body, name)
+        elif tag == "style":
+            body = minify_css(body, name)
+        out.append(open_tag + body + src[m.end(2):m.end()])
+        pos = m.end()
+    text_part(src[pos:])
+    result = "".join(out)
+
+    before, after = TagSequence(), TagSequence()
+    before.feed(src)
+    after.feed(result)
+    if before.items != after.items:
+        raise MinifyError("HTML structure changed by minify")
+    return result
+
+
+MINIFIERS = {"html": minify_html, "htm": minify_html, "js": minify_js, "css": minify_css}
+
+
+def minify(file, data):
+    t = file.rpartition(".")[-1]
+    if t not in MINIFIERS or os.environ.get("RATGDO_NO_MINIFY"):
+        return data
+    try:
+        return MINIFIERS[t](data.decode("utf-8"), file).encode("utf-8")
+    except MinifyError as e:
+        sys.exit("Minify of %s failed: %s" % (file, e))
+
+
+# --- Build ---------------------------------------------------------------------
+
 filenames = next(os.walk(sourcepath), (None, None, []))[2]
 print("Compressing and converting files from " + sourcepath + " into " + targetpath)
 
@@ -30,6 +320,8 @@ os.mkdir(targetpath)
 # calculate a CRC32 for each file and base64 encode it, this will change if the
 # file contents are changed.  We use this to control browser caching.
 file_crc = {}
+file_data = {}
+file_size = {}
 for file in filenames:
     # skip hidden files
     if file[0] == ".":
@@ -41,15 +333,19 @@ for file in filenames:
 
     with open(sourcepath + "/" + file, "rb") as f:
         # read contents of the file
-        data = f.read()
-        crc32 = (
-            base64.urlsafe_b64encode(zlib.crc32(data).to_bytes(4, byteorder="big"))
-            .decode()
-            .replace("=", "")
-        )
+        source = f.read()
         f.close()
-        file_crc[file] = crc32
-        print("CRC: " + crc32 + " (" + file + ")")
+    # minify before the CRC, so it reflects what is served
+    data = minify(file, source)
+    file_data[file] = data
+    file_size[file] = len(source)
+    crc32 = (
+        base64.urlsafe_b64encode(zlib.crc32(data).to_bytes(4, byteorder="big"))
+        .decode()
+        .replace("=", "")
+    )
+    file_crc[file] = crc32
+    print("CRC: " + crc32 + " (" + file + ")")
 
 # Open webcontent file and write warning header...
 wf = open(targetpath + "/webcontent.h", "w")
@@ -61,6 +357,7 @@ wf.write("#include <string>\n")
 wf.flush()
 
 varnames = []
+sizes = []
 # now loop through each file...
 for file in filenames:
     # skip hidden files
@@ -78,21 +375,17 @@ for file in filenames:
     # get file type
     t = file.rpartition(".")[-1]
     # if file matches, add true crc to ?v=CRC-32 marker and create the gzip
+    data = file_data[file]
     if (t == "html") or (t == "htm") or (t == "js"):
-        with open(sourcepath + "/" + file, 'rb') as f_in, gzip.open(gzfile, 'wb') as f_out:
-            # read contents of the file
-            data = f_in.read()
-            # loop through each file that could be referenced
-            for f_name, crc32 in file_crc.items():
-                # Replace the target string with real crc
-                data = data.replace(bytes(f_name + "?v=CRC-32", 'utf-8'), bytes(f_name + "?v=" + crc32, 'utf-8'))
-            f_out.write(data)
-            f_out.close()
-    else :
-        with open(sourcepath + "/" + file, 'rb') as f_in, gzip.open(gzfile, 'wb') as f_out:
-            f_out.writelines(f_in)
-            f_out.close()
-   
+        # loop through each file that could be referenced
+        for f_name, crc32 in file_crc.items():
+            # Replace the target string with real crc
+            data = data.replace(bytes(f_name + "?v=CRC-32", 'utf-8'), bytes(f_name + "?v=" + crc32, 'utf-8'))
+    with gzip.open(gzfile, 'wb') as f_out:
+        f_out.write(data)
+        f_out.close()
+    sizes.append((file, file_size[file], len(data), os.path.getsize(gzfile)))
+
     # create the 'c' code
     # const unsigned char src_www_build_apple_touch_icon_png_gz[] PROGMEM = {
     # const unsigned int src_www_build_apple_touch_icon_png_gz_len = 2721;
@@ -158,3 +451,7 @@ wf.write("\n};\n")
 wf.close()
 
 print("processed " + str(len(varnames)) + " files")
+print("%-24s %9s %9s %9s" % ("File", "Source", "Minified", "Gzipped"))
+for file, source, minified, gzipped in sizes:
+    print("%-24s %9d %9d %9d" % (file, source, minified, gzipped))
+print("%-24s %9d %9d %9d" % ("Total", sum(x[1] for x in sizes), sum(x[2] for x in sizes), sum(x[3] for x in sizes)))
@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+#
+# Turn the crash summary from a ratgdo into function names and source lines,
+# using the .elf of the firmware that crashed...
+#
+#   python3 decode_crash.py <ip-address> [--user admin --password password]
+#   python3 decode_crash.py crashlog.txt
+#
+# The .elf is found by matching the ELF SHA256 in the summary against the files in
+# docs/firmware and .pio/build, or can be given with --elf. addr2line from the
+# PlatformIO Xtensa toolchain is used, unless another is given with --addr2line.
+#
+# --raw coredump.bin also downloads the full core dump, which can be examined
+# with esp-coredump (pip install esp-coredump)...
+#
+#   esp-coredump info_corefile -t raw -c coredump.bin <firmware.elf>
+#
+# Copyright (c) 2024 David Kerr, https://github.com/dkerr64
+#
+import argparse
+import glob
+import hashlib
+import os
+import re
+import shutil
+import subprocess
+import sys
+import urllib.request
+
+ELF_DIRS = ["docs/firmware", ".pio/build/*"]
+ADDR2LINE = "xtensa-esp32-elf-addr2line"
+
+# Xtensa EXCCAUSE values most often seen
+EXCEPTION_CAUSES = {
+    0: "IllegalInstruction",
+    2: "InstructionFetchError",
+    3: "LoadStoreError",
+    6: "IntegerDivideByZero",
+    9: "LoadStoreAlignment",
+    28: "LoadProhibited",
+    29: "StoreProhibited",
+}
+
+
+def opener(host, user, password):
+    handlers = []
+    if user:
+        mgr = urllib.request.HTTPPasswordMgrWithDefaultRealm()
+        mgr.add_password(None, "http://" + host, user, password)
+        handlers.append(urllib.request.HTTPDigestAuthHandler(mgr))
+    return urllib.request.build_opener(*handlers)
+
+
+def fetch(args, query=""):
+    with opener(args.source, args.user, args.password).open(
+            "http://%s/crashlog%s" % (args.source, query), timeout=30) as r:
+        return r.read()
+
+
+def parse(text):
+    summary = {}
+    for line in text.splitlines():
+        key, sep, value = line.partition(": ")
+        if sep:
+            summary[key.strip()] = value.strip()
+    return summary
+
+
+def find_elf(sha):
+    here = os.path.dirname(os.path.abspath(__file__))
+    for pattern in ELF_DIRS:
+        for path in sorted(glob.glob(os.path.join(here, pattern, "*.elf"))):
+            with open(path, "rb") as f:
+                if hashlib.sha256(f.read()).hexdigest().startswith(sha):
+                    return path
+    return None
+
+
+def find_addr2line(path):
+    if path:
+        return path
+    found = shutil.which(ADDR2LINE)
+    if found:
+        return found
+    pio = os.path.expanduser("~/.platformio/packages/toolchain-xtensa-esp32/bin/" + ADDR2LINE)
+    return pio if os.path.exists(pio) else None
+
+
+def main():
+    parser = argparse.ArgumentParser(description="symbolize a ratgdo crash summary")
+    parser.add_argument("source", help="ratgdo IP address, or file holding the /crashlog output")
+    parser.add_argument("--elf", help="firmware .elf, default is found by ELF SHA256")
+    parser.add_argument("--addr2line", help="path to xtensa-esp32-elf-addr2line")
+    parser.add_argument("--raw", metavar="FILE", help="also save full core dump to FILE")
+    parser.add_argument("--user", help="web page username, if password required")
+    parser.add_argument("--password", help="web page password")
+    args = parser.parse_args()
+
+    from_device = not os.path.exists(args.source)
+    if from_device:
+        text = fetch(args).decode(errors="replace")
+    else:
+        with open(args.source) as f:
+            text = f.read()
+    summary = parse(text)
+    if "PC" not in summary:
+        print(text.strip() or "No crash summary found")
+        return 1
+
+    print("Crashed task %s, firmware ELF SHA256 %s (running firmware %s)" % (
+        summary.get("Crashed task", "?"), summary.get("ELF SHA256", "?"), summary.get("Running firmware", "?")))
+    if "Exception cause" in summary:
+        cause = int(summary["Exception cause"])
+        print("Exception %d (%s), fault address %s" % (
+            cause, EXCEPTION_CAUSES.get(cause, "see Xtensa ISA EXCCAUSE"), summary.get("Fault address", "?")))
+
+    if args.raw:
+        if not from_device:
+            print("--raw needs the ratgdo IP address, not a file")
+        else:
+            with open(args.raw, "wb") as f:
+                f.write(fetch(args, "?raw=1"))
+            print("Core dump saved to %s" % args.raw)
+
+    sha = summary.get("ELF SHA256", "")
+    elf = args.elf or (find_elf(sha) if sha else None)
+    addr2line = find_addr2line(args.addr2line)
+    addresses = [summary["PC"]] + re.findall(r"0x[0-9a-fA-F]+", summary.get("Backtrace", ""))
+    if not elf or not addr2line:
+        print("No %s, addresses are..." % ("firmware .elf with SHA256 " + sha if not elf else ADDR2LINE))
+        print("  " + " ".join(addresses))
+        return 1
+
+    print("Using %s" % os.path.relpath(elf))
+    out = subprocess.run([addr2line, "-pfiaC", "-e", elf] + addresses, capture_output=True, text=True, check=True)
+    for i, line in enumerate(out.stdout.splitlines()):
+        print(("PC:  " if i == 0 else "     ") + line)
+    if "corrupted" in summary.get("Backtrace", ""):
+        print("Backtrace is corrupted, it may be incomplete")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,124 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+
+struct Edge
+{
+    uint32_t at;   // timestamp, in same units as the debounce settle time
+    uint8_t level; // input level after the edge
+};
+
+/*
+ * Ring of timestamped edges, filled from an interrupt handler and drained by the
+ * main loop. Single producer, single consumer, neither side blocks. If the ring is
+ * full the new edge is dropped and counted, consumer should resync from the pin.
+ */
+template <uint8_t N>
+class EdgeRing
+{
+    static_assert((N & (N - 1)) == 0, "EdgeRing size must be power of two");
+
+private:
+    Edge m_edges[N];
+    std::atomic<uint8_t> m_head{0}; // written by producer
+    std::atomic<uint8_t> m_tail{0}; // written by consumer
+    std::atomic<uint32_t> m_overflows{0};
+
+public:
+    // Producer side, safe to call from ISR
+    bool push(uint32_t at, uint8_t level)
+    {
+        uint8_t head = m_head.load(std::memory_order_relaxed);
+        if ((uint8_t)(head - m_tail.load(std::memory_order_acquire)) >= N)
+        {
+            m_overflows.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        m_edges[head & (N - 1)] = {at, level};
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side
+    bool pop(Edge &edge)
+    {
+        uint8_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_head.load(std::memory_order_acquire))
+            return false;
+        edge = m_edges[tail & (N - 1)];
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    uint32_t overflows() { return m_overflows.load(std::memory_order_relaxed); }
+};
+
+/*
+ * Debounce state machine driven by edge timestamps rather than by when it is
+ * polled. Input is stable once no edge has been seen for the settle time, the
+ * result is the same however late edges are processed, as long as they are
+ * processed in order.
+ */
+class Debouncer
+{
+private:
+    uint32_t m_settle;
+    uint32_t m_lastEdge = 0;
+    uint32_t m_firstEdge = 0;
+    uint32_t m_changedAt = 0;
+    uint32_t m_bounces = 0;
+    bool m_stable;
+    bool m_raw;
+    bool m_pending = false;
+
+public:
+    Debouncer(uint32_t settle, bool initial) : m_settle(settle), m_stable(initial), m_raw(initial) {}
+
+    // Feed an edge, returns true if this edge proves the previous level had settled
+    // into a new stable state.
+    bool edge(bool level, uint32_t at)
+    {
+        bool changed = update(at);
+        if (m_pending)
+            m_bounces++;
+        else
+            m_firstEdge = at;
+        m_raw = level;
+        m_lastEdge = at;
+        m_pending = true;
+        return changed;
+    }
+
+    // Evaluate at given time, returns true if stable state changed
+    bool update(uint32_t now)
+    {
+        if (!m_pending || ((now - m_lastEdge) < m_settle))
+            return false;
+
+        m_pending = false;
+        if (m_raw == m_stable)
+            return false; // bounced back to where it started
+
+        m_stable = m_raw;
+        m_changedAt = m_firstEdge;
+        return true;
+    }
+
+    // Debounced state
+    bool state() { return m_stable; }
+    // Time of first edge of the burst that led to current stable state
+    uint32_t changedAt() { return m_changedAt; }
+    // Edges seen while waiting for input to settle
+    uint32_t bounces() { return m_bounces; }
+};
@@ -0,0 +1,313 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ * Improv WiFi serial protocol, see https://www.improv-wifi.com/serial/
+ *
+ */
+#pragma once
+
+#include <initializer_list>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Frame is "IMPROV", version, type, length, up to 255 bytes of data, checksum
+#define IMPROV_HEADER_LEN 9
+#define IMPROV_MAX_DATA 255
+#define IMPROV_MAX_FRAME (IMPROV_HEADER_LEN + IMPROV_MAX_DATA + 1)
+
+namespace improv
+{
+    static const uint8_t IMPROV_SERIAL_VERSION = 1;
+    static const char IMPROV_HEADER[] = "IMPROV";
+
+    enum ImprovSerialType : uint8_t
+    {
+        TYPE_CURRENT_STATE = 0x01,
+        TYPE_ERROR_STATE = 0x02,
+        TYPE_RPC = 0x03,
+        TYPE_RPC_RESPONSE = 0x04,
+    };
+
+    enum State : uint8_t
+    {
+        STATE_STOPPED = 0x00,
+        STATE_AWAITING_AUTHORIZATION = 0x01,
+        STATE_AUTHORIZED = 0x02,
+        STATE_PROVISIONING = 0x03,
+        STATE_PROVISIONED = 0x04,
+    };
+
+    enum Error : uint8_t
+    {
+        ERROR_NONE = 0x00,
+        ERROR_INVALID_RPC = 0x01,
+        ERROR_UNKNOWN_RPC = 0x02,
+        ERROR_UNABLE_TO_CONNECT = 0x03,
+        ERROR_NOT_AUTHORIZED = 0x04,
+        ERROR_UNKNOWN = 0xFF,
+    };
+
+    enum Command : uint8_t
+    {
+        UNKNOWN = 0x00,
+        WIFI_SETTINGS = 0x01,
+        GET_CURRENT_STATE = 0x02,
+        GET_DEVICE_INFO = 0x03,
+        GET_WIFI_NETWORKS = 0x04,
+    };
+
+    struct ImprovCommand
+    {
+        Command command;
+        char ssid[33];
+        char password[65];
+    };
+
+    /*
+     * Builds one frame at a time into a fixed buffer, checksum is accumulated as
+     * bytes are added. Length fields are patched in, and added to checksum, when
+     * the frame is finished.
+     */
+    class ImprovFrame
+    {
+    private:
+        uint8_t m_buf[IMPROV_MAX_FRAME];
+        uint16_t m_len = 0;
+        uint8_t m_sum = 0;
+        bool m_rpc = false;
+        bool m_overflow = false;
+
+        void put(uint8_t b)
+        {
+            m_buf[m_len++] = b;
+            m_sum += b;
+        }
+
+        void begin(ImprovSerialType type)
+        {
+            m_len = 0;
+            m_sum = 0;
+            m_rpc = false;
+            m_overflow = false;
+            for (uint8_t i = 0; i < 6; i++)
+                put(IMPROV_HEADER[i]);
+            put(IMPROV_SERIAL_VERSION);
+            put(type);
+            put(0); // length, set by finish()
+        }
+
+        uint16_t dataLen() { return m_len - IMPROV_HEADER_LEN; }
+
+    public:
+        ImprovFrame() = default;
+
+        const uint8_t *data() const { return m_buf; }
+        size_t size() const { return m_len; }
+        // True if a string did not fit in the frame and was left out
+        bool overflow() { return m_overflow; }
+
+        const ImprovFrame &state(State state)
+        {
+            begin(TYPE_CURRENT_STATE);
+            put(state);
+            finish();
+            return *this;
+        }
+
+        const ImprovFrame &error(Error error)
+        {
+            begin(TYPE_ERROR_STATE);
+            put(error);
+            finish();
+            return *this;
+        }
+
+        // Start an RPC response, add strings then finish()
+        void rpc(Command command)
+        {
+            begin(TYPE_RPC_RESPONSE);
+            put(command);
+            put(0); // RPC data length, set by finish()
+            m_rpc = true;
+        }
+
+        bool add(const char *str, size_t len)
+        {
+            if ((len > IMPROV_MAX_DATA) || (dataLen() + 1 + len > IMPROV_MAX_DATA))
+            {
+                m_overflow = true;
+                return false;
+            }
+            put(len);
+            for (size_t i = 0; i < len; i++)
+                put(str[i]);
+            return true;
+        }
+
+        bool add(const char *str) { return add(str, strlen(str)); }
+
+        void finish()
+        {
+            uint8_t len = dataLen();
+            m_buf[8] = len;
+            m_sum += len;
+            if (m_rpc)
+            {
+                m_buf[IMPROV_HEADER_LEN + 1] = len - 2;
+                m_sum += len - 2;
+            }
+            m_buf[m_len++] = m_sum; // checksum is not part of the sum
+        }
+
+        const ImprovFrame &rpc(Command command, std::initializer_list<const char *> strings)
+        {
+            rpc(command);
+            for (const char *s : strings)
+                add(s);
+            finish();
+            return *this;
+        }
+    };
+
+    enum ParseResult : uint8_t
+    {
+        PARSE_NONE,    // need more bytes, or frame was not an RPC command
+        PARSE_COMMAND, // complete command available from command()
+        PARSE_ERROR,   // malformed frame, error code from error()
+    };
+
+    /*
+     * Byte at a time parser. Anything that is not an Improv frame is skipped, so it
+     * can share a serial port with other traffic. Checksum is accumulated as bytes
+     * arrive.
+     */
+    class ImprovParser
+    {
+    private:
+        uint8_t m_data[IMPROV_MAX_DATA];
+        uint16_t m_pos = 0;
+        uint8_t m_type = 0;
+        uint8_t m_len = 0;
+        uint8_t m_sum = 0;
+        ImprovCommand m_command = {};
+        Error m_error = ERROR_NONE;
+        uint32_t m_frames = 0;
+        uint32_t m_errors = 0;
+
+        void restart(uint8_t b)
+        {
+            // mismatched byte may be start of a new frame
+            m_pos = 0;
+            m_sum = 0;
+            if (b == IMPROV_HEADER[0])
+            {
+                m_pos = 1;
+                m_sum = b;
+            }
+        }
+
+        bool copyString(const uint8_t *&p, const uint8_t *end, char *dst, size_t max)
+        {
+            if (p >= end)
+                return false;
+            uint8_t len = *p++;
+            if ((len >= max) || (len > end - p))
+                return false;
+            memcpy(dst, p, len);
+            dst[len] = 0;
+            p += len;
+            return true;
+        }
+
+        ParseResult decode()
+        {
+            m_frames++;
+            if (m_type != TYPE_RPC)
+                return PARSE_NONE;
+
+            memset(&m_command, 0, sizeof(m_command));
+            // RPC data is command, length, then command specific data
+            if ((m_len < 2) || (m_data[1] > m_len - 2))
+                return fail(ERROR_INVALID_RPC);
+
+            m_command.command = (Command)m_data[0];
+            if (m_command.command == WIFI_SETTINGS)
+            {
+                const uint8_t *p = &m_data[2];
+                const uint8_t *end = p + m_data[1];
+                if (!copyString(p, end, m_command.ssid, sizeof(m_command.ssid)) ||
+                    !copyString(p, end, m_command.password, sizeof(m_command.password)))
+                    return fail(ERROR_INVALID_RPC);
+            }
+            return PARSE_COMMAND;
+        }
+
+        ParseResult fail(Error error)
+        {
+            m_error = error;
+            m_errors++;
+            return PARSE_ERROR;
+        }
+
+    public:
+        ImprovParser() = default;
+
+        ParseResult push_byte(uint8_t b)
+        {
+            if (m_pos < 6)
+            {
+                if (b != (uint8_t)IMPROV_HEADER[m_pos])
+                {
+                    restart(b);
+                    return PARSE_NONE;
+                }
+            }
+            else if (m_pos == 6)
+            {
+                if (b != IMPROV_SERIAL_VERSION)
+                {
+                    restart(b);
+                    return PARSE_NONE;
+                }
+            }
+            else if (m_pos == 7)
+            {
+                m_type = b;
+            }
+            else if (m_pos == 8)
+            {
+                m_len = b;
+            }
+            else if (m_pos < IMPROV_HEADER_LEN + m_len)
+            {
+                m_data[m_pos - IMPROV_HEADER_LEN] = b;
+            }
+            else
+            {
+                // checksum
+                bool good = (b == m_sum);
+                m_pos = 0;
+                m_sum = 0;
+                if (!good)
+                    return fail(ERROR_INVALID_RPC);
+                return decode();
+            }
+            m_pos++;
+            m_sum += b;
+            return PARSE_NONE;
+        }
+
+        const ImprovCommand &command() { return m_command; }
+        Error error() { return m_error; }
+        // Number of complete frames received, and number rejected as malformed
+        uint32_t frames() { return m_frames; }
+        uint32_t errors() { return m_errors; }
+    };
+} // namespace improv
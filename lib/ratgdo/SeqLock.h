@@ -0,0 +1,81 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+
+/*
+ * Sequence lock for publishing a small struct from one writer to any number of
+ * readers on other tasks or cores. Writer never blocks, readers never take a lock
+ * but retry if a write happened while they were copying. Sequence is odd while a
+ * write is in progress.
+ *
+ * There must only ever be one writer.
+ */
+template <typename T>
+class SeqLock
+{
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock requires trivially copyable type");
+
+private:
+    std::atomic<uint32_t> m_seq{0};
+    std::atomic<uint32_t> m_retries{0};
+    T m_data{};
+
+public:
+    SeqLock() = default;
+
+    void write(const T &value)
+    {
+        uint32_t seq = m_seq.load(std::memory_order_relaxed);
+        m_seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy((void *)&m_data, &value, sizeof(T));
+        m_seq.store(seq + 2, std::memory_order_release);
+    }
+
+    // Write only if value differs from what was last published, returns true if written
+    bool publish(const T &value)
+    {
+        if (memcmp((const void *)&m_data, &value, sizeof(T)) == 0)
+            return false;
+
+        write(value);
+        return true;
+    }
+
+    T read()
+    {
+        T value;
+        uint32_t before, after;
+        do
+        {
+            before = m_seq.load(std::memory_order_acquire);
+            memcpy(&value, (const void *)&m_data, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = m_seq.load(std::memory_order_relaxed);
+            if ((before & 1) || (before != after))
+            {
+                m_retries.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            return value;
+        } while (true);
+    }
+
+    // Number of writes published
+    uint32_t writes() { return m_seq.load(std::memory_order_relaxed) / 2; }
+    // Number of times a reader had to retry because it overlapped a write
+    uint32_t retries() { return m_retries.load(std::memory_order_relaxed); }
+};
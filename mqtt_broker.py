@@ -0,0 +1,257 @@
+#!/usr/bin/env python3
+#
+# Local MQTT broker stand-in, to measure how ratgdo publishes. Prints each
+# message ratgdo publishes, acknowledges QoS 1 messages, and on exit reports
+# messages and bytes received, how they were grouped into batches and the
+# highest rate seen in any one second...
+#
+#   python3 mqtt_broker.py [--port 1883] [--ack-delay 0.5] [--no-ack 30]
+#
+# then enable MQTT on the ratgdo settings page with this host as the broker.
+# --ack-delay holds each PUBACK for that many seconds, and --no-ack stops
+# acknowledging for that many seconds after ratgdo connects, so that its outbox
+# fills and publishes are held back (mqttHeld in /metrics).
+#
+# or measure latency from a command to the state publish that answers it, by
+# toggling the garage light...
+#
+#   python3 mqtt_broker.py --bench 20
+#
+# Latency includes the round trip to the garage door opener, as the light state
+# is only published once the opener reports it has changed. Publish to PUBACK
+# latency as ratgdo sees it is in the metrics topic, printed every minute.
+#
+# Only what ratgdo uses of MQTT 3.1.1 is implemented, retained messages are not
+# kept and nothing is forwarded between clients.
+#
+# Copyright (c) 2024 David Kerr, https://github.com/dkerr64
+#
+import argparse
+import socketserver
+import struct
+import threading
+import time
+
+CONNECT, CONNACK, PUBLISH, PUBACK = 1, 2, 3, 4
+SUBSCRIBE, SUBACK, UNSUBSCRIBE, UNSUBACK = 8, 9, 10, 11
+PINGREQ, PINGRESP, DISCONNECT = 12, 13, 14
+
+# Publishes closer together than this are counted as one batch (seconds)
+BATCH_GAP = 0.05
+
+
+def string(data, at):
+    n = struct.unpack_from("!H", data, at)[0]
+    return data[at + 2:at + 2 + n].decode(errors="replace"), at + 2 + n
+
+
+def packet(kind, flags, body):
+    n = len(body)
+    header = bytearray([(kind << 4) | flags])
+    while True:
+        byte = n & 0x7F
+        n >>= 7
+        header.append(byte | (0x80 if n else 0))
+        if not n:
+            return bytes(header) + body
+
+
+class Stats:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.messages = 0
+        self.bytes = 0
+        self.batches = 0
+        self.batch_max = 0
+        self.batch_size = 0
+        self.last = 0.0
+        self.second = 0
+        self.second_count = 0
+        self.rate_max = 0
+
+    def add(self, size):
+        now = time.monotonic()
+        with self.lock:
+            self.messages += 1
+            self.bytes += size
+            if now - self.last > BATCH_GAP:
+                self.batches += 1
+                self.batch_size = 0
+            self.batch_size += 1
+            self.batch_max = max(self.batch_max, self.batch_size)
+            self.last = now
+            if int(now) != self.second:
+                self.second = int(now)
+                self.second_count = 0
+            self.second_count += 1
+            self.rate_max = max(self.rate_max, self.second_count)
+
+    def report(self, elapsed):
+        print("Received %d messages, %d bytes, in %d batches (largest %d), %.1f msg/s average, %d msg/s peak" %
+              (self.messages, self.bytes, self.batches, self.batch_max,
+               self.messages / elapsed if elapsed else 0, self.rate_max))
+
+
+class Handler(socketserver.BaseRequestHandler):
+    def read(self, n):
+        data = b""
+        while len(data) < n:
+            chunk = self.request.recv(n - len(data))
+            if not chunk:
+                raise ConnectionError("closed")
+            data += chunk
+        return data
+
+    def read_packet(self):
+        first = self.read(1)[0]
+        n, shift = 0, 0
+        while True:
+            byte = self.read(1)[0]
+            n |= (byte & 0x7F) << shift
+            shift += 7
+            if not byte & 0x80:
+                break
+        return first >> 4, first & 0x0F, self.read(n)
+
+    def send(self, data):
+        with self.send_lock:
+            self.request.sendall(data)
+
+    def puback(self, packet_id, delay):
+        if delay:
+            time.sleep(delay)
+        try:
+            self.send(packet(PUBACK, 0, struct.pack("!H", packet_id)))
+        except OSError:
+            pass
+
+    def handle(self):
+        broker = self.server.broker
+        args = broker.args
+        self.send_lock = threading.Lock()
+        name = self.client_address[0]
+        no_ack_until = 0
+        try:
+            while True:
+                kind, flags, body = self.read_packet()
+                if kind == CONNECT:
+                    at = string(body, 0)[1] + 4
+                    name = "%s (%s)" % (string(body, at)[0], self.client_address[0])
+                    print("Connected %s" % name)
+                    no_ack_until = time.monotonic() + args.no_ack
+                    self.send(packet(CONNACK, 0, b"\x00\x00"))
+                elif kind == PUBLISH:
+                    qos = (flags >> 1) & 3
+                    topic, at = string(body, 0)
+                    if qos:
+                        packet_id = struct.unpack_from("!H", body, at)[0]
+                        at += 2
+                    payload = body[at:].decode(errors="replace")
+                    broker.stats.add(len(body))
+                    print("%s %s%s" % (topic, payload, " (retain)" if flags & 1 else ""))
+                    broker.received(self, topic, payload)
+                    if qos and time.monotonic() >= no_ack_until:
+                        threading.Thread(target=self.puback, args=(packet_id, args.ack_delay), daemon=True).start()
+                elif kind == SUBSCRIBE:
+                    packet_id = struct.unpack_from("!H", body, 0)[0]
+                    at, granted = 2, b""
+                    while at < len(body):
+                        topic, at = string(body, at)
+                        granted += bytes([min(body[at], 1)])
+                        at += 1
+                        print("Subscribed %s" % topic)
+                    self.send(packet(SUBACK, 0, struct.pack("!H", packet_id) + granted))
+                elif kind == UNSUBSCRIBE:
+                    self.send(packet(UNSUBACK, 0, body[:2]))
+                elif kind == PINGREQ:
+                    self.send(packet(PINGRESP, 0, b""))
+                elif kind == DISCONNECT:
+                    break
+        except (ConnectionError, OSError):
+            pass
+        broker.disconnected(self)
+        print("Disconnected %s" % name)
+
+
+class Broker:
+    def __init__(self, args):
+        self.args = args
+        self.stats = Stats()
+        self.lock = threading.Condition()
+        self.device = None  # handler of the client that published a status topic
+        self.prefix = None
+        self.light = None
+        self.light_at = 0.0
+
+    def received(self, handler, topic, payload):
+        with self.lock:
+            if topic.endswith("/status") and payload == "online":
+                self.device = handler
+                self.prefix = topic[:-len("/status")]
+            elif self.prefix and topic == self.prefix + "/light":
+                self.light = payload
+                self.light_at = time.monotonic()
+            self.lock.notify_all()
+
+    def disconnected(self, handler):
+        with self.lock:
+            if self.device is handler:
+                self.device = None
+            self.lock.notify_all()
+
+    def command(self, field, value):
+        topic = ("%s/command/%s" % (self.prefix, field)).encode()
+        self.device.send(packet(PUBLISH, 0, struct.pack("!H", len(topic)) + topic + value.encode()))
+
+    def bench(self, count):
+        with self.lock:
+            print("Waiting for ratgdo to connect and publish light state...")
+            self.lock.wait_for(lambda: self.device and self.light in ("on", "off"))
+        times = []
+        for _ in range(count):
+            with self.lock:
+                want = "off" if self.light == "on" else "on"
+                sent = time.monotonic()
+                self.command("light", want)
+                if self.lock.wait_for(lambda: self.light == want, timeout=5):
+                    times.append((self.light_at - sent) * 1000)
+                else:
+                    print("No light %s published within 5s" % want)
+            time.sleep(1)
+        if times:
+            times.sort()
+            print("Command to publish latency over %d toggles: min %.1fms avg %.1fms p95 %.1fms max %.1fms" %
+                  (len(times), times[0], sum(times) / len(times), times[int(0.95 * (len(times) - 1))], times[-1]))
+
+
+class Server(socketserver.ThreadingTCPServer):
+    allow_reuse_address = True
+    daemon_threads = True
+
+
+def main():
+    parser = argparse.ArgumentParser(description="ratgdo MQTT broker stand-in")
+    parser.add_argument("--port", type=int, default=1883)
+    parser.add_argument("--ack-delay", type=float, default=0.0, help="seconds to delay each PUBACK")
+    parser.add_argument("--no-ack", type=float, default=0.0, help="seconds to not acknowledge after connect")
+    parser.add_argument("--bench", type=int, default=0, help="toggle the light this many times and time the publish")
+    args = parser.parse_args()
+
+    server = Server(("", args.port), Handler)
+    server.broker = Broker(args)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    print("MQTT broker stand-in listening on port %d" % args.port)
+    start = time.monotonic()
+    try:
+        if args.bench:
+            server.broker.bench(args.bench)
+        else:
+            while True:
+                time.sleep(1)
+    except KeyboardInterrupt:
+        pass
+    server.broker.stats.report(time.monotonic() - start)
+
+
+if __name__ == "__main__":
+    main()
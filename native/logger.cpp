@@ -0,0 +1,15 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ * ESP-IDF runs static constructors in reverse link order, so on the device the
+ * logger is constructed before the config.cpp singletons that log from their
+ * constructors. Linux runs them in link order, so the native build compiles
+ * log.cpp from here, PlatformIO links ../native ahead of src.
+ */
+#include "log.cpp"
@@ -0,0 +1,258 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ * Benchmark runner for the native build...
+ *
+ *   pio run -e native -t exec
+ *   .pio/build/native/program [--runs N] [--json] [--log]
+ *
+ * --runs multiplies the number of runs of each benchmark, --log shows firmware
+ * log lines (on stderr, with the rest of the serial port output).
+ *
+ * Times the code the main loop runs most on the host CPU. Host figures are not
+ * device figures (see /selftest/bench for those) but compare like for like
+ * between two versions of the code. Time seen by the firmware is the virtual
+ * clock in native.h, so protocol timing is repeatable whatever the host.
+ */
+
+// C/C++ language includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+
+// Arduino includes
+#include <Arduino.h>
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "config.h"
+#include "console.h"
+#include "comms.h"
+#include "vehicle.h"
+#include "timerwheel.h"
+#include "protocol.h"
+#include "gzip.h"
+
+// Native shims
+#include "native.h"
+
+// Unit tests have their own main()
+#ifndef PIO_UNIT_TESTING
+
+extern uint32_t native_sse_count;
+
+struct benchResult
+{
+    const char *name;
+    uint32_t runs;
+    uint64_t minNs;
+    uint64_t maxNs;
+    uint64_t totalNs;
+};
+
+#define BENCH_TESTS 12
+static benchResult results[BENCH_TESTS];
+static uint8_t resultCount = 0;
+static uint32_t scale = 1;
+
+class countPrint : public Print
+{
+public:
+    uint32_t count = 0;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override
+    {
+        count += size;
+        return size;
+    }
+    using Print::write;
+};
+static uint32_t gzipIn = 0;
+static uint32_t gzipOut = 0;
+
+static uint64_t now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+template <typename F>
+static void bench(const char *name, uint32_t runs, F fn)
+{
+    benchResult &r = results[resultCount++];
+    runs *= scale;
+    r = {name, runs, UINT64_MAX, 0, 0};
+    for (uint32_t i = 0; i < runs; i++)
+    {
+        uint64_t start = now_ns();
+        fn(i);
+        uint64_t ns = now_ns() - start;
+        r.minNs = std::min(r.minNs, ns);
+        r.maxNs = std::max(r.maxNs, ns);
+        r.totalNs += ns;
+    }
+}
+
+// Status packet as the door opener sends it
+static void status_packet(uint8_t *wire, uint32_t rolling, DoorState door)
+{
+    PacketData d;
+    d.type = PacketDataType::Status;
+    d.value.status = StatusCommandData(0);
+    d.value.status.door = door;
+    Packet pkt(PacketCommand::Status, d, 0x5A5A5A);
+    pkt.encode(rolling, wire);
+}
+
+static void run_benchmarks()
+{
+    uint8_t wire[SECPLUS2_CODE_LEN];
+
+    PacketData d;
+    d.type = PacketDataType::NoData;
+    d.value.no_data = NoData();
+    Packet pkt(PacketCommand::GetStatus, d, 0x539);
+    bench("packetEncode", 10000, [&](uint32_t i)
+          { pkt.encode(i, wire); });
+    bench("packetDecode", 10000, [&](uint32_t i)
+          { Packet p(wire); asm volatile("" : : "r"(&p) : "memory"); });
+
+    // Whole receive path, byte at a time through comms_loop as on the device,
+    // door alternating between open and closed so each packet changes state.
+    // Replies are sent to the shim serial port and discarded.
+    uint8_t status[2][SECPLUS2_CODE_LEN];
+    status_packet(status[0], 1000, DoorState::Open);
+    status_packet(status[1], 1001, DoorState::Closed);
+    bench("commsRxStatus", 2000, [&](uint32_t i)
+          {
+              native_serial_inject(status[i & 1], SECPLUS2_CODE_LEN);
+              for (uint8_t b = 0; b < SECPLUS2_CODE_LEN; b++)
+                  comms_loop();
+              // and once more to send anything queued in reply
+              comms_loop();
+              native_serial_sent(NULL, SIZE_MAX);
+              native_clock_advance(50 * 1000); });
+
+    // Security+ 1.0 on its own, a door status poll and the opener's reply, door
+    // changing every other reply as it must be seen twice before it is accepted.
+    static SecPlus1Protocol sec1;
+    sec1.setup();
+    bench("sec1RxStatus", 2000, [](uint32_t i)
+          {
+              uint8_t msg[2] = {0x38, (uint8_t)(((i / 2) & 1) ? 0x55 : 0x52)};
+              native_serial_inject(msg, sizeof(msg));
+              sec1.loop();
+              sec1.loop();
+              native_serial_sent(NULL, SIZE_MAX);
+              native_clock_advance(50 * 1000); });
+
+    bench("logToBuffer", 10000, [](uint32_t i)
+          { RINFO("ratgdo-bench", "Benchmark log line %lu", (unsigned long)i); });
+    // Message log as /showlog sends it, to a Print that only counts
+    bench("gzipLog", 1000, [](uint32_t i)
+          {
+              countPrint count;
+              GzipPrint gz(count, NULL, true);
+              ratgdoLogger->printMessageLog(gz);
+              gz.end();
+              gzipIn = gz.bytesIn();
+              gzipOut = count.count; });
+
+    bench("settingsGet", 100000, [](uint32_t i)
+          { auto v = userConfig->get(cfg_deviceName); asm volatile("" : : "r"(&v) : "memory"); });
+    bench("nvsRead", 10000, [](uint32_t i)
+          { nvRam->read(nvram_rolling); });
+    bench("nvsWrite", 10000, [](uint32_t i)
+          { nvRam->write(nvram_bench, (int32_t)i); });
+    nvRam->erase(nvram_bench);
+
+    // Car parked under the sensor, then driving away, one reading per loop
+    bench("vehiclePresence", 10000, [](uint32_t i)
+          {
+              native_tof_distance = ((i / 500) & 1) ? 2500 : 600;
+              vehicle_loop();
+              native_clock_advance(10 * 1000); });
+    native_tof_distance = 0;
+
+    static WheelTimer timers[64];
+    bench("timerArmDetach", 10000, [](uint32_t i)
+          {
+              WheelTimer &t = timers[i % 64];
+              t.once_ms(100 + (i % 5000), []() {});
+              if (i % 3 == 0)
+                  t.detach(); });
+    bench("timerWheelLoop", 10000, [](uint32_t i)
+          {
+              native_clock_advance(WHEEL_TICK_MS * 1000);
+              timer_wheel_loop(); });
+}
+
+static void print_results(bool json)
+{
+    if (json)
+    {
+        printf("{\n\"scale\": %lu,\n\"gzipLogIn\": %lu,\n\"gzipLogOut\": %lu,\n\"results\": [",
+               (unsigned long)scale, (unsigned long)gzipIn, (unsigned long)gzipOut);
+        for (uint8_t i = 0; i < resultCount; i++)
+        {
+            benchResult &r = results[i];
+            printf("%s\n{\"name\": \"%s\", \"runs\": %lu, \"minNs\": %llu, \"avgNs\": %llu, \"maxNs\": %llu}",
+                   i ? "," : "", r.name, (unsigned long)r.runs, (unsigned long long)r.minNs,
+                   (unsigned long long)(r.totalNs / r.runs), (unsigned long long)r.maxNs);
+        }
+        printf("\n]\n}\n");
+        return;
+    }
+    printf("%-18s %8s %10s %10s %10s\n", "benchmark", "runs", "min ns", "avg ns", "max ns");
+    for (uint8_t i = 0; i < resultCount; i++)
+    {
+        benchResult &r = results[i];
+        printf("%-18s %8lu %10llu %10llu %10llu\n", r.name, (unsigned long)r.runs, (unsigned long long)r.minNs,
+               (unsigned long long)(r.totalNs / r.runs), (unsigned long long)r.maxNs);
+    }
+    printf("%lu status broadcasts, door %s\n", (unsigned long)native_sse_count, DOOR_STATE(garage_door.current_state));
+    printf("gzipLog %lu bytes to %lu bytes\n", (unsigned long)gzipIn, (unsigned long)gzipOut);
+}
+
+int main(int argc, char **argv)
+{
+    bool json = false;
+    bool log = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--runs") && (i + 1 < argc))
+            scale = std::max(1, atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--json"))
+            json = true;
+        else if (!strcmp(argv[i], "--log"))
+            log = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [--runs N] [--json] [--log]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    // Start the virtual clock well after boot, as if the device had been running
+    native_clock_set(60ULL * 1000 * 1000);
+    setup_console();
+    suppressSerialLog = !log;
+    userConfig->load();
+    doorControlType = 2; // Security+ 2.0
+    setup_comms();
+    setup_vehicle();
+
+    run_benchmarks();
+    print_results(json);
+    return 0;
+}
+#endif // PIO_UNIT_TESTING
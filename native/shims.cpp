@@ -0,0 +1,509 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ * Implementation of the native (Linux) shims for the Arduino core, ESP-IDF
+ * and FreeRTOS, see native/shims.
+ */
+
+// C/C++ language includes
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+#include <time.h>
+
+// ESP system includes
+#include <esp_timer.h>
+#include <nvs.h>
+#include <nvs_flash.h>
+#include <driver/gpio.h>
+
+// Arduino includes
+#include <Arduino.h>
+#include <Network.h>
+#include <Wire.h>
+#include <SoftwareSerial.h>
+#include <vl53l4cx_class.h>
+
+// Native shims
+#include "native.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+NetworkClass Network;
+WiFiClass WiFi;
+TwoWire Wire;
+int16_t native_tof_distance = 0;
+
+/****************************************************************************
+ * Virtual clock and esp_timer
+ */
+struct esp_timer
+{
+    esp_timer_cb_t callback;
+    void *arg;
+    uint64_t due;
+    uint64_t period; // zero if one-shot
+    bool active;
+};
+
+static uint64_t clockUs = 0;
+static bool clockReal = false;
+static uint64_t realBase = 0;
+static std::vector<esp_timer *> timers;
+
+static uint64_t host_us()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+uint64_t native_clock_us()
+{
+    return clockReal ? clockUs + (host_us() - realBase) : clockUs;
+}
+
+// Run timers due at or before now, earliest first
+static void run_timers(uint64_t now)
+{
+    while (true)
+    {
+        esp_timer *next = NULL;
+        for (esp_timer *t : timers)
+        {
+            if (t->active && (t->due <= now) && (!next || t->due < next->due))
+                next = t;
+        }
+        if (!next)
+            return;
+        if (!clockReal)
+            clockUs = next->due;
+        if (next->period)
+            next->due += next->period;
+        else
+            next->active = false;
+        next->callback(next->arg);
+    }
+}
+
+void native_clock_set(uint64_t us)
+{
+    clockUs = us;
+    realBase = host_us();
+}
+
+void native_clock_advance(uint64_t us)
+{
+    if (clockReal)
+    {
+        struct timespec ts = {(time_t)(us / 1000000), (long)(us % 1000000) * 1000};
+        nanosleep(&ts, NULL);
+        run_timers(native_clock_us());
+        return;
+    }
+    uint64_t until = clockUs + us;
+    run_timers(until);
+    clockUs = until;
+}
+
+void native_clock_real(bool real)
+{
+    if (real == clockReal)
+        return;
+    clockUs = native_clock_us();
+    realBase = host_us();
+    clockReal = real;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    native_clock_advance((uint64_t)ticks * portTICK_PERIOD_MS * 1000);
+}
+
+TickType_t xTaskGetTickCount()
+{
+    return native_clock_us() / (portTICK_PERIOD_MS * 1000);
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out_handle)
+{
+    if (!args || !args->callback || !out_handle)
+        return ESP_ERR_INVALID_ARG;
+    esp_timer *t = new esp_timer{args->callback, args->arg, 0, 0, false};
+    timers.push_back(t);
+    *out_handle = t;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
+{
+    timer->due = native_clock_us() + timeout_us;
+    timer->period = 0;
+    timer->active = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period)
+{
+    if (!period)
+        return ESP_ERR_INVALID_ARG;
+    timer->due = native_clock_us() + period;
+    timer->period = period;
+    timer->active = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+    timer->active = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer)
+{
+    timers.erase(std::remove(timers.begin(), timers.end(), timer), timers.end());
+    delete timer;
+    return ESP_OK;
+}
+
+bool esp_timer_is_active(esp_timer_handle_t timer)
+{
+    return timer->active;
+}
+
+/****************************************************************************
+ * GPIO
+ */
+#define NATIVE_PINS 64
+static uint8_t pinLevel[NATIVE_PINS];
+static void (*pinIsr[NATIVE_PINS])(void);
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+
+int digitalRead(uint8_t pin)
+{
+    return (pin < NATIVE_PINS) ? pinLevel[pin] : LOW;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+    if (pin < NATIVE_PINS)
+        pinLevel[pin] = val ? HIGH : LOW;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    if (gpio_num < 0 || gpio_num >= NATIVE_PINS)
+        return ESP_ERR_INVALID_ARG;
+    pinLevel[gpio_num] = level ? HIGH : LOW;
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t gpio_num)
+{
+    return digitalRead(gpio_num);
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode)
+{
+    if (pin < NATIVE_PINS)
+        pinIsr[pin] = isr;
+}
+
+void detachInterrupt(uint8_t pin)
+{
+    if (pin < NATIVE_PINS)
+        pinIsr[pin] = NULL;
+}
+
+void native_gpio_set_input(uint8_t pin, int level)
+{
+    digitalWrite(pin, level);
+}
+
+int native_gpio_output(uint8_t pin)
+{
+    return digitalRead(pin);
+}
+
+void native_gpio_interrupt(uint8_t pin)
+{
+    if (pin < NATIVE_PINS && pinIsr[pin])
+        pinIsr[pin]();
+}
+
+/****************************************************************************
+ * SoftwareSerial
+ */
+static std::deque<uint8_t> serialRx;
+static std::vector<uint8_t> serialTx;
+
+int SoftwareSerial::available()
+{
+    return serialRx.size();
+}
+
+int SoftwareSerial::read()
+{
+    if (serialRx.empty())
+        return -1;
+    uint8_t c = serialRx.front();
+    serialRx.pop_front();
+    return c;
+}
+
+int SoftwareSerial::peek()
+{
+    return serialRx.empty() ? -1 : serialRx.front();
+}
+
+size_t SoftwareSerial::write(const uint8_t *buffer, size_t size)
+{
+    serialTx.insert(serialTx.end(), buffer, buffer + size);
+    return size;
+}
+
+void native_serial_inject(const uint8_t *data, size_t len)
+{
+    serialRx.insert(serialRx.end(), data, data + len);
+}
+
+size_t native_serial_sent(uint8_t *data, size_t len)
+{
+    len = std::min(len, serialTx.size());
+    if (data && len)
+        memcpy(data, serialTx.data(), len);
+    serialTx.clear();
+    return len;
+}
+
+/****************************************************************************
+ * FreeRTOS queues
+ */
+QueueHandle_t xQueueCreateStatic(UBaseType_t length, UBaseType_t itemSize, uint8_t *storage, StaticQueue_t *queue)
+{
+    *queue = {storage, length, itemSize, 0, 0};
+    return queue;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize)
+{
+    return xQueueCreateStatic(length, itemSize, new uint8_t[length * itemSize], new StaticQueue_t);
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t q, const void *item, TickType_t wait)
+{
+    if (q->count == q->length)
+        return errQUEUE_FULL;
+    memcpy(q->storage + ((q->head + q->count) % q->length) * q->itemSize, item, q->itemSize);
+    q->count++;
+    return pdTRUE;
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t q, const void *item, TickType_t wait)
+{
+    if (q->count == q->length)
+        return errQUEUE_FULL;
+    q->head = (q->head + q->length - 1) % q->length;
+    memcpy(q->storage + q->head * q->itemSize, item, q->itemSize);
+    q->count++;
+    return pdTRUE;
+}
+
+BaseType_t xQueuePeek(QueueHandle_t q, void *item, TickType_t wait)
+{
+    if (!q->count)
+        return pdFALSE;
+    memcpy(item, q->storage + q->head * q->itemSize, q->itemSize);
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t wait)
+{
+    if (!xQueuePeek(q, item, wait))
+        return pdFALSE;
+    q->head = (q->head + 1) % q->length;
+    q->count--;
+    return pdTRUE;
+}
+
+BaseType_t xQueueReset(QueueHandle_t q)
+{
+    q->head = q->count = 0;
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q)
+{
+    return q->count;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t q)
+{
+    return q->length - q->count;
+}
+
+/****************************************************************************
+ * NVS, one namespace, values kept as their bytes
+ */
+#define NATIVE_NVS_ENTRIES 630 // about what the 20KB partition holds
+struct nvsValue
+{
+    enum
+    {
+        I32,
+        STR,
+        BLOB,
+    } type;
+    std::string data;
+};
+static std::map<std::string, nvsValue> nvsStore;
+
+static esp_err_t nvs_get(const char *key, int type, nvsValue *&value)
+{
+    auto it = nvsStore.find(key);
+    if (it == nvsStore.end() || it->second.type != type)
+        return ESP_ERR_NVS_NOT_FOUND;
+    value = &it->second;
+    return ESP_OK;
+}
+
+static esp_err_t nvs_set(const char *key, int type, const void *data, size_t len)
+{
+    if (!key || strlen(key) >= NVS_KEY_NAME_MAX_SIZE)
+        return ESP_ERR_INVALID_ARG;
+    nvsStore[key] = {(decltype(nvsValue::type))type, std::string((const char *)data, len)};
+    return ESP_OK;
+}
+
+esp_err_t nvs_flash_init()
+{
+    return ESP_OK;
+}
+
+esp_err_t nvs_flash_erase()
+{
+    nvsStore.clear();
+    return ESP_OK;
+}
+
+esp_err_t nvs_open(const char *name, nvs_open_mode_t mode, nvs_handle_t *handle)
+{
+    *handle = 1;
+    return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle) {}
+
+esp_err_t nvs_get_i32(nvs_handle_t handle, const char *key, int32_t *value)
+{
+    nvsValue *v;
+    esp_err_t err = nvs_get(key, nvsValue::I32, v);
+    if (err == ESP_OK)
+        memcpy(value, v->data.data(), sizeof(int32_t));
+    return err;
+}
+
+esp_err_t nvs_set_i32(nvs_handle_t handle, const char *key, int32_t value)
+{
+    return nvs_set(key, nvsValue::I32, &value, sizeof(value));
+}
+
+esp_err_t nvs_get_str(nvs_handle_t handle, const char *key, char *value, size_t *length)
+{
+    nvsValue *v;
+    esp_err_t err = nvs_get(key, nvsValue::STR, v);
+    if (err != ESP_OK)
+        return err;
+    size_t need = v->data.size() + 1;
+    if (value && *length < need)
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    if (value)
+        memcpy(value, v->data.c_str(), need);
+    *length = need;
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_str(nvs_handle_t handle, const char *key, const char *value)
+{
+    return nvs_set(key, nvsValue::STR, value, strlen(value));
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *value, size_t *length)
+{
+    nvsValue *v;
+    esp_err_t err = nvs_get(key, nvsValue::BLOB, v);
+    if (err != ESP_OK)
+        return err;
+    if (value && *length < v->data.size())
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    if (value)
+        memcpy(value, v->data.data(), v->data.size());
+    *length = v->data.size();
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length)
+{
+    return nvs_set(key, nvsValue::BLOB, value, length);
+}
+
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char *key)
+{
+    return nvsStore.erase(key) ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_erase_all(nvs_handle_t handle)
+{
+    nvsStore.clear();
+    return ESP_OK;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle)
+{
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_stats(const char *part_name, nvs_stats_t *stats)
+{
+    // Each entry is 32 bytes, strings and blobs take one more per 32 bytes of data
+    size_t used = 1;
+    for (auto &it : nvsStore)
+        used += 1 + ((it.second.type == nvsValue::I32) ? 0 : (it.second.data.size() + 31) / 32);
+    stats->used_entries = std::min(used, (size_t)NATIVE_NVS_ENTRIES);
+    stats->free_entries = NATIVE_NVS_ENTRIES - stats->used_entries;
+    stats->available_entries = stats->free_entries;
+    stats->total_entries = NATIVE_NVS_ENTRIES;
+    stats->namespace_count = 1;
+    return ESP_OK;
+}
+
+/****************************************************************************
+ * C library functions in newlib but not older glibc
+ */
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+size_t strlcpy(char *dst, const char *src, size_t size)
+{
+    size_t len = strlen(src);
+    if (size)
+    {
+        size_t n = std::min(len, size - 1);
+        memcpy(dst, src, n);
+        dst[n] = 0;
+    }
+    return len;
+}
+
+size_t strlcat(char *dst, const char *src, size_t size)
+{
+    size_t len = strnlen(dst, size);
+    return (len == size) ? len + strlen(src) : len + strlcpy(dst + len, src, size - len);
+}
+#endif
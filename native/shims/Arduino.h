@@ -0,0 +1,118 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ * Native build shim for the Arduino core, only what the firmware uses.
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <vector>
+
+// ESP system includes
+#include "freertos/FreeRTOS.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+
+// Native shims
+#include "Print.h"
+#include "WString.h"
+#include "native.h"
+
+using std::max;
+using std::min;
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (s)
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+#define ARDUINO_RUNNING_CORE 1
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define ESP_LOGE(tag, format, ...) ((void)0)
+#define ESP_LOGW(tag, format, ...) ((void)0)
+#define ESP_LOGI(tag, format, ...) ((void)0)
+#define ESP_LOGD(tag, format, ...) ((void)0)
+#define ESP_LOGV(tag, format, ...) ((void)0)
+typedef uint8_t byte;
+typedef bool boolean;
+
+inline unsigned long millis() { return native_clock_us() / 1000; }
+inline unsigned long micros() { return native_clock_us(); }
+inline void delay(uint32_t ms) { native_clock_advance((uint64_t)ms * 1000); }
+inline void delayMicroseconds(uint32_t us) { native_clock_advance(us); }
+inline void yield() {}
+
+extern void pinMode(uint8_t pin, uint8_t mode);
+extern int digitalRead(uint8_t pin);
+extern void digitalWrite(uint8_t pin, uint8_t val);
+extern void attachInterrupt(uint8_t pin, void (*isr)(void), int mode);
+extern void detachInterrupt(uint8_t pin);
+inline bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution) { return true; }
+inline bool ledcWrite(uint8_t pin, uint32_t duty) { return true; }
+inline void tone(uint8_t pin, unsigned int frequency, unsigned long duration = 0) {}
+inline void noTone(uint8_t pin) {}
+
+inline long random(long howbig) { return howbig ? rand() % howbig : 0; }
+inline long random(long howsmall, long howbig) { return (howsmall < howbig) ? howsmall + random(howbig - howsmall) : howsmall; }
+inline uint32_t getCpuFrequencyMhz() { return 240; }
+inline void configTzTime(const char *tz, const char *server1, const char *server2 = NULL, const char *server3 = NULL)
+{
+    setenv("TZ", tz, 1);
+    tzset();
+}
+
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+extern size_t strlcpy(char *dst, const char *src, size_t size);
+extern size_t strlcat(char *dst, const char *src, size_t size);
+#endif
+
+class EspClass
+{
+public:
+    uint32_t getFreeHeap() { return 200000; }
+    uint32_t getMinFreeHeap() { return 200000; }
+    uint32_t getMaxAllocHeap() { return 100000; }
+    void restart() { exit(0); }
+};
+extern EspClass ESP;
+
+class HardwareSerial : public Print
+{
+public:
+    size_t setTxBufferSize(size_t size) { return size; }
+    void begin(unsigned long baud) {}
+    operator bool() const { return true; }
+    int available() { return 0; }
+    int read() { return -1; }
+    // never backed up, writes go straight to stderr
+    int availableForWrite() { return INT32_MAX; }
+    // stderr, so that it does not mix with what the native program prints
+    size_t write(uint8_t c) override { return fwrite(&c, 1, 1, stderr); }
+    size_t write(const uint8_t *buffer, size_t size) override { return fwrite(buffer, 1, size, stderr); }
+    using Print::write;
+};
+extern HardwareSerial Serial;
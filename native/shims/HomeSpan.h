@@ -0,0 +1,88 @@
+/****************************************************************************
+ * Native build shim for HomeSpan, just the service and characteristic types
+ * the firmware headers name. HomeKit itself is not built off-target.
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+
+struct SpanCharacteristic
+{
+};
+
+struct SpanService
+{
+};
+
+namespace Characteristic
+{
+    struct CurrentDoorState : SpanCharacteristic
+    {
+        enum
+        {
+            OPEN = 0,
+            CLOSED = 1,
+            OPENING = 2,
+            CLOSING = 3,
+            STOPPED = 4,
+        };
+    };
+    struct TargetDoorState : SpanCharacteristic
+    {
+        enum
+        {
+            OPEN = 0,
+            CLOSED = 1,
+        };
+    };
+    struct LockCurrentState : SpanCharacteristic
+    {
+        enum
+        {
+            UNLOCKED = 0,
+            LOCKED = 1,
+            JAMMED = 2,
+            UNKNOWN = 3,
+        };
+    };
+    struct LockTargetState : SpanCharacteristic
+    {
+        enum
+        {
+            UNLOCK = 0,
+            LOCK = 1,
+        };
+    };
+    struct ObstructionDetected : SpanCharacteristic
+    {
+    };
+    struct On : SpanCharacteristic
+    {
+    };
+    struct MotionDetected : SpanCharacteristic
+    {
+    };
+    struct OccupancyDetected : SpanCharacteristic
+    {
+    };
+}
+
+namespace Service
+{
+    struct GarageDoorOpener : SpanService
+    {
+    };
+    struct AccessoryInformation : SpanService
+    {
+    };
+    struct LightBulb : SpanService
+    {
+    };
+    struct MotionSensor : SpanService
+    {
+    };
+    struct OccupancySensor : SpanService
+    {
+    };
+}
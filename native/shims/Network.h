@@ -0,0 +1,55 @@
+/****************************************************************************
+ * Native build shim for Arduino networking, never connected
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+
+// Native shims
+#include "Arduino.h"
+
+typedef enum
+{
+    WIFI_AUTH_OPEN = 0,
+    WIFI_AUTH_WEP,
+    WIFI_AUTH_WPA_PSK,
+    WIFI_AUTH_WPA2_PSK,
+    WIFI_AUTH_WPA_WPA2_PSK,
+    WIFI_AUTH_WPA3_PSK = 6,
+} wifi_auth_mode_t;
+
+class IPAddress
+{
+public:
+    IPAddress() {}
+    IPAddress(uint32_t addr) : addr(addr) {}
+    operator uint32_t() const { return addr; }
+    String toString() const
+    {
+        char s[16];
+        snprintf(s, sizeof(s), "%u.%u.%u.%u", addr & 0xff, (addr >> 8) & 0xff, (addr >> 16) & 0xff, addr >> 24);
+        return String(s);
+    }
+
+private:
+    uint32_t addr = 0;
+};
+
+class NetworkClass
+{
+public:
+    void macAddress(uint8_t *mac) { memset(mac, 0, 6); }
+};
+extern NetworkClass Network;
+
+class WiFiClass
+{
+public:
+    bool isConnected() { return false; }
+    IPAddress localIP() { return IPAddress(); }
+    String macAddress() { return String("00:00:00:00:00:00"); }
+    int8_t RSSI() { return 0; }
+    void setTxPower(int power) {}
+};
+extern WiFiClass WiFi;
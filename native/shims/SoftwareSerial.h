@@ -0,0 +1,33 @@
+/****************************************************************************
+ * Native build shim for (ratgdo) espsoftwareserial. Bytes received come from
+ * native_serial_inject(), bytes sent are kept for native_serial_sent().
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+#include <stddef.h>
+
+// Native shims
+#include "Print.h"
+
+enum SoftwareSerialConfig
+{
+    SWSERIAL_8N1 = 0x1c,
+    SWSERIAL_8E1 = 0x3c,
+};
+
+class SoftwareSerial : public Print
+{
+public:
+    void begin(uint32_t baud, SoftwareSerialConfig config, int8_t rxPin, int8_t txPin, bool invert) {}
+    void enableIntTx(bool on) {}
+    void enableAutoBaud(bool on) {}
+    void enableRx(bool on) {}
+    int available();
+    int read();
+    int peek();
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+};
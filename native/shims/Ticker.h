@@ -0,0 +1,49 @@
+/****************************************************************************
+ * Native build shim for Arduino Ticker, callbacks run from esp_timer on the
+ * virtual clock.
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+
+// Native shims
+#include "esp_timer.h"
+
+class Ticker
+{
+public:
+    typedef void (*callback_t)(void);
+    ~Ticker() { detach(); }
+    void once_ms(uint32_t ms, callback_t cb) { attach(ms, cb, false); }
+    void attach_ms(uint32_t ms, callback_t cb) { attach(ms, cb, true); }
+    void once(float seconds, callback_t cb) { attach(seconds * 1000, cb, false); }
+    void attach(float seconds, callback_t cb) { attach(seconds * 1000, cb, true); }
+    void detach()
+    {
+        if (timer)
+        {
+            esp_timer_stop(timer);
+            esp_timer_delete(timer);
+            timer = NULL;
+        }
+    }
+    bool active() const { return timer && esp_timer_is_active(timer); }
+
+private:
+    esp_timer_handle_t timer = NULL;
+    callback_t callback = NULL;
+
+    static void fire(void *arg) { ((Ticker *)arg)->callback(); }
+    void attach(uint32_t ms, callback_t cb, bool repeat)
+    {
+        detach();
+        callback = cb;
+        esp_timer_create_args_t args = {fire, this, ESP_TIMER_TASK, "ticker", false};
+        esp_timer_create(&args, &timer);
+        if (repeat)
+            esp_timer_start_periodic(timer, (uint64_t)ms * 1000);
+        else
+            esp_timer_start_once(timer, (uint64_t)ms * 1000);
+    }
+};
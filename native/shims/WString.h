@@ -0,0 +1,23 @@
+/****************************************************************************
+ * Native build shim for Arduino String, only what the firmware uses
+ */
+#pragma once
+
+// C/C++ language includes
+#include <string>
+
+class String : public std::string
+{
+public:
+    String() {}
+    String(const char *s) : std::string(s ? s : "") {}
+    String(const std::string &s) : std::string(s) {}
+    String(int n) : std::string(std::to_string(n)) {}
+    String(unsigned int n) : std::string(std::to_string(n)) {}
+    String(long n) : std::string(std::to_string(n)) {}
+    String(unsigned long n) : std::string(std::to_string(n)) {}
+    unsigned int length() const { return size(); }
+    bool isEmpty() const { return empty(); }
+    int toInt() const { return atoi(c_str()); }
+    bool equals(const String &s) const { return *this == s; }
+};
@@ -0,0 +1,24 @@
+/****************************************************************************
+ * Native build shim for Arduino WiFiUDP, packets are discarded
+ */
+#pragma once
+
+// Native shims
+#include "Network.h"
+
+class WiFiUDP : public Print
+{
+public:
+    uint8_t begin(uint16_t port) { return 1; }
+    void stop() {}
+    int beginPacket(const char *host, uint16_t port) { return 1; }
+    int beginPacket(IPAddress ip, uint16_t port) { return 1; }
+    int endPacket() { return 1; }
+    int parsePacket() { return 0; }
+    int read(uint8_t *buffer, size_t len) { return 0; }
+    IPAddress remoteIP() { return IPAddress(); }
+    uint16_t remotePort() { return 0; }
+    size_t write(uint8_t c) override { return 1; }
+    size_t write(const uint8_t *buffer, size_t size) override { return size; }
+    using Print::write;
+};
@@ -0,0 +1,15 @@
+/****************************************************************************
+ * Native build shim for Arduino Wire (I2C), no devices attached
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+
+class TwoWire
+{
+public:
+    bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) { return true; }
+    void setClock(uint32_t frequency) {}
+};
+extern TwoWire Wire;
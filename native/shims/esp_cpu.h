@@ -0,0 +1,15 @@
+/****************************************************************************
+ * Native build shim, CPU cycles are counted as nanoseconds of host time
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+#include <time.h>
+
+inline uint32_t esp_cpu_get_cycle_count()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
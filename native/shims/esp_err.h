@@ -0,0 +1,33 @@
+/****************************************************************************
+ * Native build shim for ESP-IDF error codes
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+#include <stdio.h>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_NO_MEM 0x101
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_SIZE 0x104
+#define ESP_ERR_NOT_FOUND 0x105
+#define ESP_ERR_NVS_BASE 0x1100
+#define ESP_ERR_NVS_NOT_FOUND (ESP_ERR_NVS_BASE + 0x02)
+#define ESP_ERR_NVS_INVALID_LENGTH (ESP_ERR_NVS_BASE + 0x0c)
+#define ESP_ERR_NVS_NO_FREE_PAGES (ESP_ERR_NVS_BASE + 0x0d)
+#define ESP_ERR_NVS_NEW_VERSION_FOUND (ESP_ERR_NVS_BASE + 0x10)
+
+inline const char *esp_err_to_name(esp_err_t code) { return code == ESP_OK ? "ESP_OK" : "ESP_ERR"; }
+// Reported but not fatal, there is nothing to abort to off-target
+#define ESP_ERROR_CHECK_WITHOUT_ABORT(x)                                          \
+    ({                                                                            \
+        esp_err_t err_rc_ = (x);                                                  \
+        if (err_rc_ != ESP_OK)                                                    \
+            fprintf(stderr, "ESP_ERROR_CHECK failed: %d at %s:%d\n", err_rc_,    \
+                    __FILE__, __LINE__);                                          \
+        err_rc_;                                                                  \
+    })
+#define ESP_ERROR_CHECK(x) ((void)ESP_ERROR_CHECK_WITHOUT_ABORT(x))
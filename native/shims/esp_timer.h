@@ -0,0 +1,37 @@
+/****************************************************************************
+ * Native build shim for esp_timer, driven by the virtual clock in native.h
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+
+// Native shims
+#include "esp_err.h"
+#include "native.h"
+
+typedef void (*esp_timer_cb_t)(void *arg);
+typedef enum
+{
+    ESP_TIMER_TASK,
+    ESP_TIMER_ISR,
+} esp_timer_dispatch_t;
+
+typedef struct
+{
+    esp_timer_cb_t callback;
+    void *arg;
+    esp_timer_dispatch_t dispatch_method;
+    const char *name;
+    bool skip_unhandled_events;
+} esp_timer_create_args_t;
+
+typedef struct esp_timer *esp_timer_handle_t;
+
+inline int64_t esp_timer_get_time() { return native_clock_us(); }
+extern esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out_handle);
+extern esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us);
+extern esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period);
+extern esp_err_t esp_timer_stop(esp_timer_handle_t timer);
+extern esp_err_t esp_timer_delete(esp_timer_handle_t timer);
+extern bool esp_timer_is_active(esp_timer_handle_t timer);
@@ -0,0 +1,31 @@
+/****************************************************************************
+ * Native build shim for FreeRTOS queues, fixed size items copied in and out
+ * of caller supplied storage as on the device. Calls never block.
+ */
+#pragma once
+
+// Native shims
+#include "freertos/FreeRTOS.h"
+
+typedef struct
+{
+    uint8_t *storage;
+    UBaseType_t length;
+    UBaseType_t itemSize;
+    UBaseType_t head;
+    UBaseType_t count;
+} StaticQueue_t;
+typedef StaticQueue_t *QueueHandle_t;
+
+extern QueueHandle_t xQueueCreateStatic(UBaseType_t length, UBaseType_t itemSize, uint8_t *storage, StaticQueue_t *queue);
+extern QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+extern BaseType_t xQueueSendToBack(QueueHandle_t queue, const void *item, TickType_t wait);
+extern BaseType_t xQueueSendToFront(QueueHandle_t queue, const void *item, TickType_t wait);
+extern BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t wait);
+extern BaseType_t xQueuePeek(QueueHandle_t queue, void *item, TickType_t wait);
+extern BaseType_t xQueueReset(QueueHandle_t queue);
+extern UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+extern UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue);
+#define xQueueSend xQueueSendToBack
+#define xQueueSendFromISR(q, item, woken) xQueueSendToBack(q, item, 0)
+#define xQueueReceiveFromISR(q, item, woken) xQueueReceive(q, item, 0)
@@ -0,0 +1,30 @@
+/****************************************************************************
+ * Native build shim for FreeRTOS semaphores. Single threaded, so a take
+ * always succeeds.
+ */
+#pragma once
+
+// Native shims
+#include "freertos/FreeRTOS.h"
+
+typedef struct
+{
+    int count;
+} StaticSemaphore_t;
+typedef StaticSemaphore_t *SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t *buffer) { return buffer; }
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutexStatic(StaticSemaphore_t *buffer) { return buffer; }
+inline SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *buffer) { return buffer; }
+inline SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    static StaticSemaphore_t buffer;
+    return &buffer;
+}
+#define xSemaphoreCreateRecursiveMutex xSemaphoreCreateMutex
+#define xSemaphoreCreateBinary xSemaphoreCreateMutex
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t wait) { return pdTRUE; }
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t s) { return pdTRUE; }
+inline BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t s, TickType_t wait) { return pdTRUE; }
+inline BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t s) { return pdTRUE; }
+#define xSemaphoreGiveFromISR(s, woken) xSemaphoreGive(s)
@@ -0,0 +1,26 @@
+/****************************************************************************
+ * Native build shim for FreeRTOS tasks. Tasks are not run, creating one fails.
+ */
+#pragma once
+
+// Native shims
+#include "freertos/FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void *);
+typedef struct tskTaskControlBlock *TaskHandle_t;
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                                          UBaseType_t priority, TaskHandle_t *handle, BaseType_t core)
+{
+    return pdFAIL;
+}
+inline BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                              UBaseType_t priority, TaskHandle_t *handle)
+{
+    return pdFAIL;
+}
+inline void vTaskDelete(TaskHandle_t task) {}
+extern void vTaskDelay(TickType_t ticks);
+extern TickType_t xTaskGetTickCount();
+inline TaskHandle_t xTaskGetCurrentTaskHandle() { return NULL; }
+inline UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) { return 0; }
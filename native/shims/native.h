@@ -0,0 +1,43 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Hooks into the native (Linux) shims, for use by code that drives the firmware
+ * off-target. Nothing here exists in the ESP32 build.
+ *
+ * Time is virtual: millis(), micros() and esp_timer_get_time() return the clock
+ * below, which only moves when told to, so runs are repeatable. delay() moves it
+ * forward. Timers created with esp_timer fire as it passes their deadline.
+ */
+extern void native_clock_set(uint64_t us);
+extern void native_clock_advance(uint64_t us);
+extern uint64_t native_clock_us();
+// Follow the host monotonic clock instead, for timing real work
+extern void native_clock_real(bool real);
+
+// Bytes for SoftwareSerial to receive, and bytes it has sent
+extern void native_serial_inject(const uint8_t *data, size_t len);
+extern size_t native_serial_sent(uint8_t *data, size_t len);
+
+// Level read back by digitalRead(), and last level written to a pin
+extern void native_gpio_set_input(uint8_t pin, int level);
+extern int native_gpio_output(uint8_t pin);
+
+// Fire interrupt handler attached to pin with attachInterrupt()
+extern void native_gpio_interrupt(uint8_t pin);
+
+// Distance the time-of-flight sensor measures, millimeters, 0 for nothing in range
+extern int16_t native_tof_distance;
@@ -0,0 +1,43 @@
+/****************************************************************************
+ * Native build shim for ESP-IDF NVS, an in memory store that is lost when
+ * the process exits.
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+#include <stddef.h>
+
+// Native shims
+#include "esp_err.h"
+
+#define NVS_KEY_NAME_MAX_SIZE 16
+
+typedef uint32_t nvs_handle_t;
+typedef enum
+{
+    NVS_READONLY,
+    NVS_READWRITE,
+} nvs_open_mode_t;
+
+typedef struct
+{
+    size_t used_entries;
+    size_t free_entries;
+    size_t available_entries;
+    size_t total_entries;
+    size_t namespace_count;
+} nvs_stats_t;
+
+extern esp_err_t nvs_open(const char *name, nvs_open_mode_t mode, nvs_handle_t *handle);
+extern void nvs_close(nvs_handle_t handle);
+extern esp_err_t nvs_get_i32(nvs_handle_t handle, const char *key, int32_t *value);
+extern esp_err_t nvs_set_i32(nvs_handle_t handle, const char *key, int32_t value);
+extern esp_err_t nvs_get_str(nvs_handle_t handle, const char *key, char *value, size_t *length);
+extern esp_err_t nvs_set_str(nvs_handle_t handle, const char *key, const char *value);
+extern esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *value, size_t *length);
+extern esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length);
+extern esp_err_t nvs_erase_key(nvs_handle_t handle, const char *key);
+extern esp_err_t nvs_erase_all(nvs_handle_t handle);
+extern esp_err_t nvs_commit(nvs_handle_t handle);
+extern esp_err_t nvs_get_stats(const char *part_name, nvs_stats_t *stats);
@@ -0,0 +1,10 @@
+/****************************************************************************
+ * Native build shim for ESP-IDF NVS flash
+ */
+#pragma once
+
+// Native shims
+#include "nvs.h"
+
+extern esp_err_t nvs_flash_init();
+extern esp_err_t nvs_flash_erase();
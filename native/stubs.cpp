@@ -0,0 +1,108 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ * Stand-ins for the parts of the firmware not built natively (HomeKit, web
+ * server, main loop, WiFi) that the native build calls into.
+ */
+
+// C/C++ language includes
+#include <ctype.h>
+#include <time.h>
+
+// Arduino includes
+#include <Arduino.h>
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "homekit.h"
+#include "utilities.h"
+#include "watchdog.h"
+#include "web.h"
+#include "webhook.h"
+
+// ratgdo.cpp
+GarageDoor garage_door;
+SeqLock<GarageDoor> door_state;
+uint32_t door_state_read_cycles = 0;
+bool status_done = false;
+
+// utilities.cpp
+motionTriggersUnion motionTriggers = {0};
+bool clockSet = false;
+bool enableNTP = false;
+
+void sync_and_restart()
+{
+    RINFO("native", "Restart requested, exiting");
+    exit(0);
+}
+
+char *make_rfc952(char *dest, const char *src, int size)
+{
+    int i = 0;
+    while (i < std::min(24, size - 1) && src[i] != 0)
+    {
+        dest[i] = isspace((unsigned char)src[i]) ? '-' : src[i];
+        i++;
+    }
+    while (i > 0 && (dest[i - 1] == '-' || dest[i - 1] == '.'))
+        i--;
+    dest[i] = 0;
+    return dest;
+}
+
+char *timeString(time_t reqTime, bool syslog)
+{
+    static char tBuffer[32];
+    time_t tTime = ((reqTime == 0) && clockSet) ? time(NULL) : reqTime;
+    tm tmTime;
+    tBuffer[0] = 0;
+    if (tTime != 0)
+    {
+        localtime_r(&tTime, &tmTime);
+        strftime(tBuffer, sizeof(tBuffer), syslog ? "%Y-%m-%dT%H:%M:%S.000%z" : "%Y-%m-%d %H:%M:%S %Z", &tmTime);
+    }
+    return tBuffer;
+}
+
+// heap.cpp
+uint32_t free_heap = (1024 * 1024);
+uint32_t min_heap = (1024 * 1024);
+
+// watchdog.cpp
+const wdtTracePoint *volatile wdtTrace = nullptr;
+TaskHandle_t wdtTask = NULL;
+
+// announce.cpp
+bool announceEn = false;
+
+// webhook.cpp
+void webhook_configure() {}
+
+// web.cpp, messages are counted rather than sent
+uint32_t native_sse_count = 0;
+
+void SSEBroadcastState(const char *data, BroadcastType type)
+{
+    native_sse_count++;
+}
+
+// homekit.cpp
+void notify_homekit_target_door_state_change() {}
+void notify_homekit_current_door_state_change() {}
+void notify_homekit_target_lock() {}
+void notify_homekit_current_lock() {}
+void notify_homekit_obstruction() {}
+void notify_homekit_light() {}
+void enable_service_homekit_motion() {}
+void notify_homekit_motion() {}
+void notify_homekit_vehicle_occupancy(bool vehicleDetected) {}
+void notify_homekit_vehicle_arriving(bool vehicleArriving) {}
+void notify_homekit_vehicle_departing(bool vehicleDeparting) {}
+void enable_service_homekit_vehicle() {}
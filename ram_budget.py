@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+#
+# Print a table of how much static RAM each ratgdo subsystem reserves, from the
+# symbol table of the firmware ELF. Runs automatically after each PlatformIO build
+# (see extra_scripts in platformio.ini), or can be run by hand...
+#
+#   python3 ram_budget.py .pio/build/ratgdo_esp32dev/firmware.elf [path-to-nm]
+#
+# Each subsystem is a source file in src/ or lib/ratgdo, everything else (framework,
+# HomeSpan and other libraries) is summed together. Heap is not included, that
+# is reported at runtime in /metrics.
+#
+# Copyright (c) 2024 David Kerr, https://github.com/dkerr64
+#
+import os
+import subprocess
+import sys
+
+# ESP32 memory regions that hold RAM variables
+RAM_REGIONS = [
+    ("DRAM", 0x3FFAE000, 0x40000000),
+    ("RTC fast", 0x3FF80000, 0x3FF82000),
+    ("RTC slow", 0x50000000, 0x50002000),
+]
+PROJECT_DIRS = (os.sep + "src" + os.sep, os.sep + "lib" + os.sep + "ratgdo" + os.sep)
+
+
+def region_of(address):
+    for name, start, end in RAM_REGIONS:
+        if start <= address < end:
+            return name
+    return None
+
+
+def subsystem_of(location):
+    # nm -l appends "path/file.cpp:line" when there is debug info
+    path = location.rsplit(":", 1)[0]
+    if any(d in path for d in PROJECT_DIRS):
+        return os.path.splitext(os.path.basename(path))[0]
+    return None
+
+
+def ram_budget(elf, nm="nm", run_env=None):
+    try:
+        out = subprocess.run([nm, "-S", "-l", "-C", "-t", "d", elf], capture_output=True,
+                             text=True, check=True, env=run_env).stdout
+    except (OSError, subprocess.CalledProcessError) as e:
+        print("ram_budget: unable to read symbols from %s: %s" % (elf, e))
+        return
+
+    table = {}
+    other = {"data": 0, "bss": 0, "rtc": 0}
+    for line in out.splitlines():
+        location = ""
+        if "\t" in line:
+            line, location = line.split("\t", 1)
+        fields = line.split(None, 3)
+        if len(fields) != 4:
+            continue
+        address, size, kind, name = int(fields[0]), int(fields[1]), fields[2].lower(), fields[3]
+        region = region_of(address)
+        if region is None or kind not in ("b", "d"):
+            continue
+        column = "rtc" if region.startswith("RTC") else ("bss" if kind == "b" else "data")
+        subsystem = subsystem_of(location)
+        if subsystem is None:
+            other[column] += size
+            continue
+        entry = table.setdefault(subsystem, {"data": 0, "bss": 0, "rtc": 0, "largest": ("", 0)})
+        entry[column] += size
+        if size > entry["largest"][1]:
+            entry["largest"] = (name, size)
+
+    def total(e):
+        return e["data"] + e["bss"] + e["rtc"]
+
+    print("")
+    print("RAM budget (static allocation, bytes)")
+    print("%-16s %8s %8s %8s %8s  %s" % ("Subsystem", "data", "bss", "rtc", "total", "largest symbol"))
+    print("-" * 90)
+    project = {"data": 0, "bss": 0, "rtc": 0}
+    for subsystem, e in sorted(table.items(), key=lambda kv: -total(kv[1])):
+        for k in project:
+            project[k] += e[k]
+        print("%-16s %8d %8d %8d %8d  %s (%d)" % (subsystem, e["data"], e["bss"], e["rtc"], total(e),
+                                                 e["largest"][0][:32], e["largest"][1]))
+    print("-" * 90)
+    print("%-16s %8d %8d %8d %8d" % ("ratgdo total", project["data"], project["bss"], project["rtc"], total(project)))
+    print("%-16s %8d %8d %8d %8d" % ("framework/libs", other["data"], other["bss"], other["rtc"], total(other)))
+    print("")
+
+
+def post_build(source, target, env):
+    nm = env.subst("$CC").replace("gcc", "nm")
+    ram_budget(str(target[0]), nm, env["ENV"])
+
+
+try:
+    Import("env")
+    env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", post_build)
+except NameError:
+    if __name__ == "__main__":
+        if len(sys.argv) < 2:
+            print("usage: ram_budget.py firmware.elf [path-to-nm]")
+            sys.exit(1)
+        ram_budget(sys.argv[1], sys.argv[2] if len(sys.argv) > 2 else "nm")
@@ -0,0 +1,152 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+
+// C/C++ language includes
+#include <algorithm>
+
+// ESP system includes
+#include <esp_random.h>
+#include <esp_timer.h>
+
+// Arduino includes
+#include <WiFi.h>
+#include <WiFiUdp.h>
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "config.h"
+#include "vehicle.h"
+#include "announce.h"
+
+// Logger tag
+static const char *TAG = "ratgdo-announce";
+
+/*
+ * State is multicast as one JSON datagram, using the same names as status.json,
+ * whenever it changes and as a heartbeat when it does not. Every datagram carries
+ * the next sequence number, so a receiver that sees a gap (or a new boot id) knows
+ * it missed something and should fetch /status.json once to resync.
+ */
+bool announceEn = false;
+
+struct announceState
+{
+    bool active;
+    uint8_t door;
+    uint8_t lock;
+    bool light;
+    bool motion;
+    bool obstructed;
+    char vehicle[16];
+};
+
+static WiFiUDP udp;
+static IPAddress group;
+static announceState lastSent;
+static bool started = false;
+static uint32_t bootId = 0;
+static uint32_t seq = 0;
+static uint32_t lastSendAt = 0;
+
+static uint32_t changeCount = 0;
+static uint32_t heartbeatCount = 0;
+static uint32_t errorCount = 0;
+static uint32_t sendMax = 0; // microseconds to build and send a datagram
+
+static void snapshot(announceState &s)
+{
+    // zero whole struct, including padding, so it can be compared with memcmp
+    memset(&s, 0, sizeof(s));
+    s.active = garage_door.active;
+    s.door = garage_door.current_state;
+    s.lock = garage_door.current_lock;
+    s.light = garage_door.light;
+    s.motion = garage_door.motion;
+    s.obstructed = garage_door.obstructed;
+    if (garage_door.has_distance_sensor)
+        strlcpy(s.vehicle, vehicleStatus, sizeof(s.vehicle));
+}
+
+static void send(const announceState &s, bool heartbeat)
+{
+    static char buf[320];
+    int64_t start = esp_timer_get_time();
+    int len = snprintf(buf, sizeof(buf),
+                       "{\"seq\": %lu, \"boot\": %lu, \"host\": \"%s\", \"upTime\": %lu, \"heartbeat\": %s, "
+                       "\"garageDoorState\": \"%s\", \"garageLockState\": \"%s\", \"garageLightOn\": %s, "
+                       "\"garageMotion\": %s, \"garageObstructed\": %s, \"vehicleStatus\": \"%s\"}",
+                       ++seq, bootId, device_name_rfc952, millis(), heartbeat ? "true" : "false",
+                       s.active ? DOOR_STATE(s.door) : DOOR_STATE(255), LOCK_STATE(s.lock),
+                       s.light ? "true" : "false", s.motion ? "true" : "false",
+                       s.obstructed ? "true" : "false", s.vehicle);
+    len = std::min(len, (int)sizeof(buf) - 1);
+    if (!udp.beginPacket(group, ANNOUNCE_PORT) || (udp.write((uint8_t *)buf, len) != (size_t)len) || !udp.endPacket())
+        errorCount++;
+
+    lastSent = s;
+    lastSendAt = millis();
+    heartbeat ? heartbeatCount++ : changeCount++;
+    sendMax = std::max(sendMax, (uint32_t)(esp_timer_get_time() - start));
+}
+
+static bool ready()
+{
+    if (!announceEn || !WiFi.isConnected())
+        return false;
+    if (!started)
+    {
+        RINFO(TAG, "=== Start LAN announcements to %s:%d", ANNOUNCE_GROUP, ANNOUNCE_PORT);
+        group.fromString(ANNOUNCE_GROUP);
+        bootId = esp_random();
+        started = true;
+    }
+    return true;
+}
+
+/****************************************************************************
+ * Called by main loop when door state snapshot is published, sends straight away
+ * if any announced field changed.
+ */
+void announce_state()
+{
+    if (!ready())
+        return;
+
+    announceState s;
+    snapshot(s);
+    if ((lastSendAt == 0) || (memcmp(&s, &lastSent, sizeof(s)) != 0))
+        send(s, false);
+}
+
+void announce_loop()
+{
+    if (!ready())
+        return;
+
+    // Vehicle status is not part of door state, so also check for changes here
+    announceState s;
+    snapshot(s);
+    if ((lastSendAt == 0) || (memcmp(&s, &lastSent, sizeof(s)) != 0))
+        send(s, false);
+    else if (millis() - lastSendAt >= ANNOUNCE_HEARTBEAT_MS)
+        send(s, true);
+}
+
+// Print announcement statistics as JSON object members (caller provides the braces)
+void announce_print_metrics(Print &out)
+{
+    if (!started)
+        return;
+
+    out.printf("\"announceSeq\": %lu,\n\"announceChanges\": %lu,\n\"announceHeartbeats\": %lu,\n"
+               "\"announceErrors\": %lu,\n\"announceSendMaxUs\": %lu,\n",
+               seq, changeCount, heartbeatCount, errorCount, sendMax);
+}
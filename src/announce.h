@@ -0,0 +1,32 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+
+// Arduino includes
+#include <Print.h>
+
+// RATGDO project includes
+// none
+
+// State datagrams are multicast to this group and port, TTL 1 so they stay on the LAN
+#define ANNOUNCE_GROUP "239.255.71.68"
+#define ANNOUNCE_PORT 5768
+// Unchanged state is repeated this often so receivers can detect loss (milliseconds)
+#define ANNOUNCE_HEARTBEAT_MS 10000
+
+extern bool announceEn;
+
+extern void announce_state();
+extern void announce_loop();
+extern void announce_print_metrics(Print &out);
@@ -0,0 +1,179 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+
+// C/C++ language includes
+#include <algorithm>
+
+// ESP system includes
+#include <esp_cpu.h>
+#include <esp_timer.h>
+
+// Arduino includes
+// none
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "config.h"
+#include "web.h"
+#include "Packet.h"
+#include "gzip.h"
+#include "bench.h"
+
+// Logger tag
+static const char *TAG = "ratgdo-bench";
+
+/*
+ * Micro-benchmarks of the code the main loop runs most, for comparing firmware
+ * builds (compiler options, sdkconfig, board) on the device itself. Runs on its
+ * own task at idle priority, pinned to the main loop core, so that it only uses
+ * time the rest of the firmware does not want. Each run is timed in CPU cycles;
+ * min is the figure to compare, avg and max include any time the task was
+ * pre-empted.
+ */
+struct benchResult
+{
+    const char *name;
+    uint32_t runs;
+    uint32_t minCycles;
+    uint32_t maxCycles;
+    uint64_t totalCycles;
+};
+
+#define BENCH_TESTS 9
+static benchResult results[BENCH_TESTS];
+static uint8_t resultCount = 0;
+static volatile bool running = false;
+static uint32_t durationMs = 0;
+static uint32_t cpuMHz = 0;
+
+#define BENCH_STACK_SIZE 6144
+
+// Counts what is written to it, for timing output without sending it anywhere
+class countPrint : public Print
+{
+public:
+    uint32_t count = 0;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override
+    {
+        count += size;
+        return size;
+    }
+    using Print::write;
+};
+static uint32_t gzipIn = 0;
+static uint32_t gzipOut = 0;
+
+template <typename F>
+static void bench(const char *name, uint32_t runs, F fn)
+{
+    benchResult &r = results[resultCount++];
+    r = {name, runs, UINT32_MAX, 0, 0};
+    for (uint32_t i = 0; i < runs; i++)
+    {
+        uint32_t start = esp_cpu_get_cycle_count();
+        fn(i);
+        uint32_t cycles = esp_cpu_get_cycle_count() - start;
+        r.minCycles = std::min(r.minCycles, cycles);
+        r.maxCycles = std::max(r.maxCycles, cycles);
+        r.totalCycles += cycles;
+    }
+}
+
+static void bench_task(void *args)
+{
+    int64_t start = esp_timer_get_time();
+    cpuMHz = getCpuFrequencyMhz();
+    resultCount = 0;
+
+    // Packet encode and decode each log a line, as they do in comms_loop
+    PacketData d;
+    d.type = PacketDataType::NoData;
+    d.value.no_data = NoData();
+    Packet pkt(PacketCommand::GetStatus, d, 0x539);
+    uint8_t wire[SECPLUS2_CODE_LEN];
+    bench("packetEncode", 50, [&](uint32_t i)
+          { pkt.encode(i, wire); });
+    bench("packetDecode", 50, [&](uint32_t i)
+          { Packet p(wire); asm volatile("" : : "r"(&p) : "memory"); });
+    bench("logToBuffer", 50, [](uint32_t i)
+          { RINFO(TAG, "Benchmark log line %lu", i); });
+    bench("statusJson", 20, [](uint32_t i)
+          { bench_status_json(); });
+    bench("settingsGet", 1000, [](uint32_t i)
+          { auto v = userConfig->get(cfg_deviceName); asm volatile("" : : "r"(&v) : "memory"); });
+    bench("nvsRead", 100, [](uint32_t i)
+          { nvRam->read(nvram_rolling); });
+    // Kept short, each write is a flash write
+    bench("nvsWrite", 10, [](uint32_t i)
+          { nvRam->write(nvram_bench, (int32_t)i); });
+    nvRam->erase(nvram_bench);
+    // One event, as sent to each subscribed browser, sent nowhere
+    bench("sseBroadcast", 20, [](uint32_t i)
+          {
+              countPrint count;
+              bench_sse_send(count, "{\n\"benchmark\": true\n}"); });
+    // As /showlog sends it
+    bench("gzipLog", 10, [](uint32_t i)
+          {
+              countPrint count;
+              GzipPrint gz(count, NULL, true);
+              ratgdoLogger->printMessageLog(gz);
+              gz.end();
+              gzipIn = gz.bytesIn();
+              gzipOut = count.count; });
+
+    durationMs = (esp_timer_get_time() - start) / 1000;
+    RINFO(TAG, "Benchmark finished in %lu ms", durationMs);
+    running = false;
+    vTaskDelete(NULL);
+}
+
+/****************************************************************************
+ * Start a run in the background, false if one is already running
+ */
+bool bench_start()
+{
+    if (running)
+        return false;
+    running = true;
+    // Created only when asked for, so its stack is not held the rest of the time
+    if (xTaskCreatePinnedToCore(bench_task, "bench", BENCH_STACK_SIZE, NULL, tskIDLE_PRIORITY, NULL, ARDUINO_RUNNING_CORE) != pdPASS)
+    {
+        RERROR(TAG, "Failed to start benchmark task");
+        running = false;
+        return false;
+    }
+    RINFO(TAG, "Benchmark started");
+    return true;
+}
+
+bool bench_running()
+{
+    return running;
+}
+
+// Print results of the last run as JSON
+void bench_print(Print &out)
+{
+    out.printf("{\n\"running\": %s,\n\"firmwareVersion\": \"%s\",\n\"cpuMHz\": %lu,\n\"durationMs\": %lu,\n",
+               running ? "true" : "false", AUTO_VERSION, cpuMHz, durationMs);
+    // Bytes in and out of the last gzipLog run
+    out.printf("\"gzipLogIn\": %lu,\n\"gzipLogOut\": %lu,\n\"results\": [", gzipIn, gzipOut);
+    for (uint8_t i = 0; !running && (i < resultCount); i++)
+    {
+        benchResult &r = results[i];
+        out.printf("%s\n{\"name\": \"%s\", \"runs\": %lu, \"minUs\": %.2f, \"avgUs\": %.2f, \"maxUs\": %.2f, \"minCycles\": %lu}",
+                   i ? "," : "", r.name, r.runs, (float)r.minCycles / cpuMHz, (float)(r.totalCycles / r.runs) / cpuMHz,
+                   (float)r.maxCycles / cpuMHz, r.minCycles);
+    }
+    out.print("\n]\n}\n");
+}
@@ -0,0 +1,24 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+#pragma once
+
+// C/C++ language includes
+// none
+
+// Arduino includes
+#include <Print.h>
+
+// RATGDO project includes
+// none
+
+extern bool bench_start();
+extern bool bench_running();
+extern void bench_print(Print &out);
@@ -37,3 +37,4 @@ extern void reset_door();
 
 extern uint32_t doorControlType;
 extern DoorState doorState;
+extern int32_t openingsCount;
@@ -13,6 +13,9 @@
  *
  */
 
+// C/C++ language includes
+#include <algorithm>
+
 // ESP system files
 #include <Network.h>
 #include <nvs_flash.h>
@@ -27,6 +30,9 @@
 #include "led.h"
 #include "homekit.h"
 #include "vehicle.h"
+#include "heap.h"
+#include "announce.h"
+#include "webhook.h"
 
 // Logger tag
 static const char *TAG = "ratgdo-config";
@@ -40,6 +46,8 @@ userSettings *userSettings::instancePtr = new userSettings();
 userSettings *userConfig = userSettings::getInstance();
 nvRamClass *nvRamClass::instancePtr = new nvRamClass();
 nvRamClass *nvRam = nvRamClass::getInstance();
+// Writes that failed to set or commit, most likely because NVS is full
+static uint32_t nvramWriteErrors = 0;
 
 bool setDeviceName(const std::string &key, const std::string &name, configSetting *action)
 {
@@ -167,12 +175,36 @@ bool helperVehicleThreshold(const std::string &key, const std::string &value, co
     return true;
 }
 
+bool helperDCPulseMs(const std::string &key, const std::string &value, configSetting *action)
+{
+    // clamp, too long a pulse holds the door opener button down
+    userConfig->set(key, std::min(std::max(atoi(value.c_str()), DC_PULSE_MIN_MS), DC_PULSE_MAX_MS));
+    return true;
+}
+
+bool helperAnnounceEn(const std::string &key, const std::string &value, configSetting *action)
+{
+    userConfig->set(key, value);
+    // set global so takes effect immediately
+    announceEn = userConfig->getAnnounceEn();
+    return true;
+}
+
+bool helperWebhookURL(const std::string &key, const std::string &value, configSetting *action)
+{
+    userConfig->set(key, value);
+    // copy to webhook task so takes effect immediately
+    webhook_configure();
+    return true;
+}
+
 /****************************************************************************
  * User settings class
  */
 userSettings::userSettings()
 {
-    mutex = xSemaphoreCreateMutex(); // need to serialize set's
+    static StaticSemaphore_t mutexBuffer;
+    mutex = xSemaphoreCreateMutexStatic(&mutexBuffer); // need to serialize set's
     configFile = "/user_config";
     uint8_t mac[6];
     Network.macAddress(mac);
@@ -210,6 +242,17 @@ userSettings::userSettings()
         {cfg_syslogIP, {false, false, "0.0.0.0", NULL}},
         {cfg_syslogPort, {false, false, 514, NULL}},
         {cfg_vehicleThreshold, {false, false, 100, helperVehicleThreshold}}, // call fn to set globals
+        {cfg_dcPulseMs, {false, false, 500, helperDCPulseMs}}, // dry contact toggle pulse width, call fn to clamp
+        {cfg_dcPulseGapMs, {false, false, 1000, NULL}}, // minimum time between dry contact pulses
+        {cfg_mqttEn, {true, false, false, NULL}}, // MQTT client is configured at boot
+        {cfg_mqttServer, {true, false, "", NULL}},
+        {cfg_mqttPort, {true, false, 1883, NULL}},
+        {cfg_mqttUser, {true, false, "", NULL}},
+        {cfg_mqttPassword, {true, false, "", NULL}},
+        {cfg_mqttTopic, {true, false, "ratgdo", NULL}}, // topics are <mqttTopic>/<device name>/...
+        {cfg_announceEn, {false, false, false, helperAnnounceEn}}, // call fn to set global
+        {cfg_webhookURL1, {false, false, "", helperWebhookURL}},    // call fn to update webhook targets
+        {cfg_webhookURL2, {false, false, "", helperWebhookURL}},
     };
 }
 
@@ -253,6 +296,7 @@ void userSettings::toFile(Print &file)
 
 void userSettings::save()
 {
+    HEAP_SCOPE(heapSiteConfig);
     RINFO(TAG, "Writing user configuration to NVRAM");
     for (const auto &it : settings)
     {
@@ -273,6 +317,7 @@ void userSettings::save()
 
 void userSettings::load()
 {
+    HEAP_SCOPE(heapSiteConfig);
     nvs_stats_t nvs_stats;
     nvs_get_stats(NULL, &nvs_stats);
     RINFO(TAG, "NVRAM Used Entries: (%lu), Free Entries: (%lu), Total Entries: (%lu), Namespace Count: (%lu)",
@@ -313,6 +358,7 @@ configSetting userSettings::getDetail(const std::string &key)
 bool userSettings::set(const std::string &key, const bool value)
 {
     bool rc = false;
+    HEAP_SCOPE(heapSiteConfig);
     xSemaphoreTake(mutex, portMAX_DELAY);
     if (settings.count(key))
     {
@@ -330,6 +376,7 @@ bool userSettings::set(const std::string &key, const bool value)
 bool userSettings::set(const std::string &key, const int value)
 {
     bool rc = false;
+    HEAP_SCOPE(heapSiteConfig);
     xSemaphoreTake(mutex, portMAX_DELAY);
     if (settings.count(key))
     {
@@ -353,6 +400,7 @@ bool userSettings::set(const std::string &key, const int value)
 bool userSettings::set(const std::string &key, const std::string &value)
 {
     bool rc = false;
+    HEAP_SCOPE(heapSiteConfig);
     xSemaphoreTake(mutex, portMAX_DELAY);
     if (settings.count(key))
     {
@@ -417,6 +465,15 @@ void nvRamClass::checkStats()
           nvs_stats.used_entries, nvs_stats.free_entries, nvs_stats.total_entries, nvs_stats.namespace_count);
 }
 
+// Print NVS statistics as JSON object members (caller provides the braces)
+void nvram_print_metrics(Print &out)
+{
+    nvs_stats_t nvs_stats = {};
+    nvs_get_stats(NULL, &nvs_stats);
+    out.printf("\"nvsUsedEntries\": %lu,\n\"nvsFreeEntries\": %lu,\n\"nvsTotalEntries\": %lu,\n\"nvsWriteErrors\": %lu,\n",
+               nvs_stats.used_entries, nvs_stats.free_entries, nvs_stats.total_entries, nvramWriteErrors);
+}
+
 int32_t nvRamClass::read(const std::string &constKey, const int32_t dflt)
 {
     std::string key = constKey;
@@ -467,11 +524,18 @@ bool nvRamClass::write(const std::string &constKey, const int32_t value, bool co
     if (err != ESP_OK)
     {
         RERROR(TAG, "NVRAM set error for: %s (%s)", key.c_str(), esp_err_to_name(err));
+        nvramWriteErrors++;
         return false;
     }
     if (commit)
     {
-        ESP_ERROR_CHECK_WITHOUT_ABORT(nvs_commit(nvHandle));
+        err = nvs_commit(nvHandle);
+        if (err != ESP_OK)
+        {
+            RERROR(TAG, "NVRAM commit error for: %s (%s)", key.c_str(), esp_err_to_name(err));
+            nvramWriteErrors++;
+            return false;
+        }
     }
     return true;
 }
@@ -501,11 +565,18 @@ bool nvRamClass::writeBlob(const std::string &constKey, const char *value, size_
     if (err != ESP_OK)
     {
         RERROR(TAG, "NVRAM set error for: %s (%s)", key.c_str(), esp_err_to_name(err));
+        nvramWriteErrors++;
         return false;
     }
     if (commit)
     {
-        ESP_ERROR_CHECK_WITHOUT_ABORT(nvs_commit(nvHandle));
+        err = nvs_commit(nvHandle);
+        if (err != ESP_OK)
+        {
+            RERROR(TAG, "NVRAM commit error for: %s (%s)", key.c_str(), esp_err_to_name(err));
+            nvramWriteErrors++;
+            return false;
+        }
     }
     return true;
 }
@@ -520,11 +591,18 @@ bool nvRamClass::write(const std::string &constKey, const std::string &value, bo
     if (err != ESP_OK)
     {
         RERROR(TAG, "NVRAM set error for: %s (%s)", key.c_str(), esp_err_to_name(err));
+        nvramWriteErrors++;
         return false;
     }
     if (commit)
     {
-        ESP_ERROR_CHECK_WITHOUT_ABORT(nvs_commit(nvHandle));
+        err = nvs_commit(nvHandle);
+        if (err != ESP_OK)
+        {
+            RERROR(TAG, "NVRAM commit error for: %s (%s)", key.c_str(), esp_err_to_name(err));
+            nvramWriteErrors++;
+            return false;
+        }
     }
     return true;
 }
@@ -32,6 +32,9 @@
 #define DEVICE_NAME_SIZE 32
 // TODO support WiFi TX Power... adjust max value if necessary (on ESP32 const are defined)
 #define WIFI_POWER_MAX 20
+// Dry contact toggle pulse width limits, in milliseconds
+#define DC_PULSE_MIN_MS 10
+#define DC_PULSE_MAX_MS 2000
 
 extern char default_device_name[DEVICE_NAME_SIZE];
 extern char device_name[DEVICE_NAME_SIZE];
@@ -66,6 +69,17 @@ constexpr char cfg_syslogEn[] = "syslogEn";
 constexpr char cfg_syslogIP[] = "syslogIP";
 constexpr char cfg_syslogPort[] = "syslogPort";
 constexpr char cfg_vehicleThreshold[] = "vehicleThreshold";
+constexpr char cfg_dcPulseMs[] = "dcPulseMs";
+constexpr char cfg_dcPulseGapMs[] = "dcPulseGapMs";
+constexpr char cfg_mqttEn[] = "mqttEn";
+constexpr char cfg_mqttServer[] = "mqttServer";
+constexpr char cfg_mqttPort[] = "mqttPort";
+constexpr char cfg_mqttUser[] = "mqttUser";
+constexpr char cfg_mqttPassword[] = "mqttPassword";
+constexpr char cfg_mqttTopic[] = "mqttTopic";
+constexpr char cfg_announceEn[] = "announceEn";
+constexpr char cfg_webhookURL1[] = "webhookURL1";
+constexpr char cfg_webhookURL2[] = "webhookURL2";
 
 constexpr char nvram_messageLog[] = "messageLog";
 constexpr char nvram_id_code[] = "id_code";
@@ -73,6 +87,11 @@ constexpr char nvram_rolling[] = "rolling";
 constexpr char nvram_has_motion[] = "has_motion";
 constexpr char nvram_ratgdo_pw[] = "ratgdo_pw";
 constexpr char nvram_has_distance[] = "has_distance";
+constexpr char nvram_wifi_cache[] = "wifi_cache";
+constexpr char nvram_webhook_q[] = "webhook_q";
+constexpr char nvram_history[] = "history";
+constexpr char nvram_usage[] = "usage";
+constexpr char nvram_bench[] = "bench";
 
 struct configSetting
 {
@@ -132,6 +151,17 @@ public:
     std::string getSyslogIP() { return std::get<std::string>(get(cfg_syslogIP)); };
     int getSyslogPort() { return std::get<int>(get(cfg_syslogPort)); };
     int getVehicleThreshold() { return std::get<int>(get(cfg_vehicleThreshold)); };
+    int getDCPulseMs() { return std::get<int>(get(cfg_dcPulseMs)); };
+    int getDCPulseGapMs() { return std::get<int>(get(cfg_dcPulseGapMs)); };
+    bool getMqttEn() { return std::get<bool>(get(cfg_mqttEn)); };
+    std::string getMqttServer() { return std::get<std::string>(get(cfg_mqttServer)); };
+    int getMqttPort() { return std::get<int>(get(cfg_mqttPort)); };
+    std::string getMqttUser() { return std::get<std::string>(get(cfg_mqttUser)); };
+    std::string getMqttPassword() { return std::get<std::string>(get(cfg_mqttPassword)); };
+    std::string getMqttTopic() { return std::get<std::string>(get(cfg_mqttTopic)); };
+    bool getAnnounceEn() { return std::get<bool>(get(cfg_announceEn)); };
+    std::string getWebhookURL1() { return std::get<std::string>(get(cfg_webhookURL1)); };
+    std::string getWebhookURL2() { return std::get<std::string>(get(cfg_webhookURL2)); };
 };
 extern userSettings *userConfig;
 
@@ -161,4 +191,5 @@ public:
     void erase();
 };
 
-extern nvRamClass *nvRam;
\ No newline at end of file
+extern nvRamClass *nvRam;
+extern void nvram_print_metrics(Print &out);
\ No newline at end of file
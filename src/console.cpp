@@ -0,0 +1,82 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+
+// C/C++ language includes
+#include <string.h>
+
+// ESP system includes
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Arduino includes
+#include <Arduino.h>
+
+// RATGDO project includes
+#include "log.h"
+#include "console.h"
+
+consoleStats_t consoleStats = {0, 0};
+
+static bool console_ready = false;
+
+// Logger writes from its constructor, before static initialization of this file
+// is guaranteed, so the mutex is created on first use.
+static SemaphoreHandle_t console_mutex()
+{
+    static StaticSemaphore_t mutexBuffer;
+    static SemaphoreHandle_t mutex = xSemaphoreCreateMutexStatic(&mutexBuffer);
+    return mutex;
+}
+
+void setup_console()
+{
+    // TX buffer size must be set before the UART driver is installed by begin()
+    Serial.setTxBufferSize(CONSOLE_TX_BUFFER_SIZE);
+    Serial.begin(115200);
+    while (!Serial)
+        ; // Wait for serial port to open
+    console_ready = true;
+}
+
+void console_write(ConsoleChannel channel, const uint8_t *data, size_t len)
+{
+    // Nothing is written before the port is open, the log buffer still has it
+    if (!console_ready || len == 0)
+        return;
+
+    xSemaphoreTake(console_mutex(), portMAX_DELAY);
+    if (channel == CONSOLE_LOG)
+    {
+        // Once Improv is in use, nothing else may be written to the serial port
+        if (!suppressSerialLog)
+        {
+            if ((size_t)Serial.availableForWrite() >= len)
+            {
+                Serial.write(data, len);
+            }
+            else
+            {
+                consoleStats.logDropped++;
+                consoleStats.logDroppedBytes += len;
+            }
+        }
+    }
+    else
+    {
+        Serial.write(data, len);
+    }
+    xSemaphoreGive(console_mutex());
+}
+
+void console_print(ConsoleChannel channel, const char *str)
+{
+    console_write(channel, (const uint8_t *)str, strlen(str));
+}
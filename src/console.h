@@ -0,0 +1,45 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+#include <stddef.h>
+
+// Arduino includes
+// none
+
+// RATGDO project includes
+// none
+
+// UART transmit ring buffer, drained by the UART interrupt. Writes that fit
+// are a memory copy and return immediately.
+#define CONSOLE_TX_BUFFER_SIZE 4096
+
+// Everything we write to the serial port says what it is. Each write goes out
+// whole, so an Improv frame is never broken up by a log line or vice versa.
+enum ConsoleChannel : uint8_t
+{
+    CONSOLE_LOG,    // dropped, and counted, if it does not fit in the TX buffer
+    CONSOLE_IMPROV, // never dropped, waits for space in the TX buffer
+};
+
+struct consoleStats_t
+{
+    uint32_t logDropped;      // log writes dropped because TX buffer was full
+    uint32_t logDroppedBytes; // and how many bytes that was
+};
+
+extern consoleStats_t consoleStats;
+
+extern void setup_console();
+extern void console_write(ConsoleChannel channel, const uint8_t *data, size_t len);
+extern void console_print(ConsoleChannel channel, const char *str);
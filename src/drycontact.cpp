@@ -12,11 +12,21 @@
  *
  */
 
+// C/C++ language includes
+#include <algorithm>
+
+// ESP system includes
+#include <esp_timer.h>
+#include <hal/gpio_ll.h>
+
 // RATGDO project includes
 #include "ratgdo.h"
 #include "config.h"
 #include "comms.h"
 #include "drycontact.h"
+#include "history.h"
+#include "scheduler.h"
+#include "Debounce.h"
 
 // Logger tag
 static const char *TAG = "ratgdo-drycontact";
@@ -28,14 +38,37 @@ void onCloseSwitchPress();
 void onOpenSwitchRelease();
 void onCloseSwitchRelease();
 
-// Define OneButton objects for open/close pins
-OneButton buttonOpen(DRY_CONTACT_OPEN_PIN, true, true); // Active low, with internal pull-up
-OneButton buttonClose(DRY_CONTACT_CLOSE_PIN, true, true);
+// Limit switch edges are timestamped by GPIO interrupt (in microseconds) and
+// debounced in the main loop using those timestamps, so the result does not depend
+// on how promptly the loop gets around to looking at them.
+#define EDGE_RING_SIZE 16
+struct dryContactInput
+{
+    gpio_num_t pin;
+    const char *name;
+    void (*onPress)();
+    void (*onRelease)();
+    EdgeRing<EDGE_RING_SIZE> edges;
+    Debouncer debounce;
+    uint32_t overflows;
+    uint32_t maxLatency; // microseconds from first edge to reporting change
+};
+static dryContactInput inputOpen = {DRY_CONTACT_OPEN_PIN, "Open", onOpenSwitchPress, onOpenSwitchRelease, {}, {DRY_CONTACT_DEBOUNCE_MS * 1000, false}, 0, 0};
+static dryContactInput inputClose = {DRY_CONTACT_CLOSE_PIN, "Close", onCloseSwitchPress, onCloseSwitchRelease, {}, {DRY_CONTACT_DEBOUNCE_MS * 1000, false}, 0, 0};
+
 bool dryContactDoorOpen = false;
 bool dryContactDoorClose = false;
 bool previousDryContactDoorOpen = false;
 bool previousDryContactDoorClose = false;
 
+static void IRAM_ATTR isr_drycontact(void *arg)
+{
+    dryContactInput *input = (dryContactInput *)arg;
+    // Active low, with internal pull-up. Record level as "pressed"
+    input->edges.push((uint32_t)esp_timer_get_time(), !gpio_ll_get_level(&GPIO, input->pin));
+    scheduler_wake_from_isr();
+}
+
 void setup_drycontact()
 {
     RINFO(TAG, "=== Setting up dry contact protocol");
@@ -54,23 +87,57 @@ void setup_drycontact()
     pinMode(DRY_CONTACT_OPEN_PIN, INPUT_PULLUP);
     pinMode(DRY_CONTACT_CLOSE_PIN, INPUT_PULLUP);
 
-    // Attach OneButton handlers
-    buttonOpen.attachPress(onOpenSwitchPress);
-    buttonClose.attachPress(onCloseSwitchPress);
-    buttonOpen.attachLongPressStop(onOpenSwitchRelease);
-    buttonClose.attachLongPressStop(onCloseSwitchRelease);
+    // A switch that is already closed at boot is reported as a press
+    for (dryContactInput *input : {&inputOpen, &inputClose})
+    {
+        if (!digitalRead(input->pin))
+            input->edges.push((uint32_t)esp_timer_get_time(), true);
+        attachInterruptArg(input->pin, isr_drycontact, input, CHANGE);
+    }
 
     drycontact_setup_done = true;
 }
 
+static void drycontact_report(dryContactInput &input)
+{
+    input.maxLatency = std::max(input.maxLatency, (uint32_t)esp_timer_get_time() - input.debounce.changedAt());
+    if (input.debounce.state())
+        input.onPress();
+    else
+        input.onRelease();
+}
+
+// Run the debounce state machine over all edges received, then check whether the
+// last one has now settled.
+static void drycontact_input(dryContactInput &input)
+{
+    Edge edge;
+    while (input.edges.pop(edge))
+    {
+        if (input.debounce.edge(edge.level, edge.at))
+            drycontact_report(input);
+    }
+
+    if (input.edges.overflows() != input.overflows)
+    {
+        // Lost edges, resync from the pin itself
+        input.overflows = input.edges.overflows();
+        RERROR(TAG, "%s switch edge ring overflow", input.name);
+        if (input.debounce.edge(!digitalRead(input.pin), (uint32_t)esp_timer_get_time()))
+            drycontact_report(input);
+    }
+
+    if (input.debounce.update((uint32_t)esp_timer_get_time()))
+        drycontact_report(input);
+}
+
 void drycontact_loop()
 {
     if (!drycontact_setup_done)
         return;
 
-    // Poll OneButton objects
-    buttonOpen.tick();
-    buttonClose.tick();
+    drycontact_input(inputOpen);
+    drycontact_input(inputClose);
 
     if (doorControlType == 3)
     {
@@ -112,13 +179,14 @@ void drycontact_loop()
         // are using Sec+ 1.0 or Sec+ 2.0 door control type
         if (dryContactDoorOpen)
         {
+            history_command(CMD_OPEN, SRC_DRYCONTACT);
             open_door();
             dryContactDoorOpen = false;
         }
 
         if (dryContactDoorClose)
         {
-
+            history_command(CMD_CLOSE, SRC_DRYCONTACT);
             close_door();
             dryContactDoorClose = false;
         }
@@ -150,3 +218,12 @@ void onCloseSwitchRelease()
     dryContactDoorClose = false;
     RINFO(TAG, "Close switch released");
 }
+
+// Print dry contact statistics as JSON object members (caller provides the braces)
+void drycontact_print_metrics(Print &out)
+{
+    out.printf("\"dryContactBounces\": %lu,\n\"dryContactOverflows\": %lu,\n\"dryContactLatencyMax\": %lu,\n",
+               inputOpen.debounce.bounces() + inputClose.debounce.bounces(),
+               inputOpen.edges.overflows() + inputClose.edges.overflows(),
+               std::max(inputOpen.maxLatency, inputClose.maxLatency));
+}
@@ -14,10 +14,17 @@
 #pragma once
 
 // C/C++ language includes
+// none
+
+// Arduino includes
+#include <Print.h>
 
 // RATGDO project includes
-#include <OneButton.h>
+// none
 
+// Limit switch must be stable this long before a change is reported (milliseconds)
+#define DRY_CONTACT_DEBOUNCE_MS 50
 
 extern void setup_drycontact();
 extern void drycontact_loop();
+extern void drycontact_print_metrics(Print &out);
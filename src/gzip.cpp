@@ -0,0 +1,367 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+
+// C/C++ language includes
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+// ESP system includes
+#include <esp_timer.h>
+#include <esp_rom_crc.h>
+
+// Arduino includes
+// none
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "gzip.h"
+
+// Logger tag
+static const char *TAG = "ratgdo-gzip";
+
+/*
+ * Deflate (RFC 1951) with the fixed Huffman codes, inside a gzip (RFC 1952)
+ * wrapper. Matches are found through a hash of the next three bytes, following
+ * a short chain of earlier strings with the same hash, within GZIP_WINDOW_SIZE.
+ * ESP32 ROM has miniz tdefl, but it needs over 300KB of state. Dynamic Huffman
+ * codes would save a little more at a cost of CPU and memory; our responses are
+ * log lines and JSON, where most of the win is in the repeated strings.
+ */
+#define GZIP_MIN_MATCH 3
+#define GZIP_MAX_MATCH 258
+
+struct gzipWork
+{
+    uint8_t buf[GZIP_BUFFER_SIZE];           // window followed by look-ahead
+    uint16_t head[1 << GZIP_HASH_BITS];      // position + 1 of latest string with hash, 0 if none
+    uint16_t prev[GZIP_BUFFER_SIZE];         // position + 1 of previous string with same hash
+    uint8_t outBuf[GZIP_OUT_SIZE];
+    uint16_t fill;                           // bytes in buf
+    uint16_t pos;                            // next byte to compress
+    uint16_t outLen;
+};
+
+gzipStats_t gzipStats = {0, 0, 0, 0, 0};
+
+static const uint16_t lengthBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                        35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const uint8_t lengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                        3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const uint16_t distBase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129,
+                                      193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097,
+                                      6145, 8193, 12289, 16385, 24577};
+static const uint8_t distExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6,
+                                      6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+static inline uint16_t gzip_hash(const uint8_t *p)
+{
+    uint32_t v = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+    return (v * 2654435761u) >> (32 - GZIP_HASH_BITS);
+}
+
+static inline void gzip_insert(gzipWork *w, uint16_t p)
+{
+    uint16_t h = gzip_hash(&w->buf[p]);
+    w->prev[p] = w->head[h];
+    w->head[h] = p + 1;
+}
+
+GzipPrint::GzipPrint(Print &out, const char *header, bool compress) : out(out), header(header)
+{
+    mode = GZ_PLAIN;
+    if (compress)
+    {
+        // Only held while the response is sent
+        work = (gzipWork *)malloc(sizeof(gzipWork));
+        if (work)
+        {
+            memset(work->head, 0, sizeof(work->head));
+            work->fill = 0;
+            work->pos = 0;
+            work->outLen = 0;
+            mode = GZ_PENDING;
+        }
+        else
+        {
+            RERROR(TAG, "No memory to compress response, sending as is");
+        }
+    }
+    if (mode == GZ_PLAIN)
+        write_header(false);
+}
+
+GzipPrint::~GzipPrint()
+{
+    end();
+}
+
+size_t GzipPrint::write(const uint8_t *data, size_t size)
+{
+    if (mode == GZ_PLAIN)
+        return out.write(data, size);
+    if (mode == GZ_DONE)
+        return 0;
+
+    size_t left = size;
+    while (left > 0)
+    {
+        if (work->fill == GZIP_BUFFER_SIZE)
+        {
+            // Buffer full, so well over threshold
+            int64_t start = esp_timer_get_time();
+            writeUs = 0;
+            if (mode == GZ_PENDING)
+                start_gzip();
+            compress(false);
+            gzipStats.cpuUs += (esp_timer_get_time() - start) - writeUs;
+        }
+        size_t chunk = std::min(left, (size_t)(GZIP_BUFFER_SIZE - work->fill));
+        memcpy(&work->buf[work->fill], data, chunk);
+        crc = esp_rom_crc32_le(crc, data, chunk);
+        work->fill += chunk;
+        total += chunk;
+        data += chunk;
+        left -= chunk;
+    }
+    return size;
+}
+
+void GzipPrint::end()
+{
+    if (mode == GZ_DONE)
+        return;
+
+    if (mode == GZ_PLAIN)
+    {
+        gzipStats.plain++;
+    }
+    else if ((mode == GZ_PENDING) && (total < GZIP_THRESHOLD))
+    {
+        // Small enough to send as it is
+        write_header(false);
+        out.write(work->buf, work->fill);
+        gzipStats.plain++;
+    }
+    else
+    {
+        int64_t start = esp_timer_get_time();
+        writeUs = 0;
+        if (mode == GZ_PENDING)
+            start_gzip();
+        compress(true);
+        put_literal(256);
+        // Block we were in could not be marked final when it started, so end with an empty one
+        put_bits(1, 1);
+        put_bits(1, 2);
+        put_literal(256);
+        if (bitCount)
+            put_bits(0, 8 - bitCount);
+        for (uint8_t i = 0; i < 32; i += 8)
+            put_byte(crc >> i);
+        for (uint8_t i = 0; i < 32; i += 8)
+            put_byte(total >> i);
+        flush_out();
+        gzipStats.cpuUs += (esp_timer_get_time() - start) - writeUs;
+        gzipStats.responses++;
+        gzipStats.bytesIn += total;
+    }
+    free(work);
+    work = NULL;
+    mode = GZ_DONE;
+}
+
+void GzipPrint::write_header(bool gzip)
+{
+    if (!header)
+        return;
+
+    size_t len = strlen(header);
+    if (gzip)
+    {
+        // insert before the blank line that ends the header
+        out.write((const uint8_t *)header, len - 1);
+        out.print("Content-Encoding: gzip\n\n");
+    }
+    else
+    {
+        out.write((const uint8_t *)header, len);
+    }
+}
+
+void GzipPrint::start_gzip()
+{
+    // magic, deflate, no flags, no time, no extra flags, unknown OS
+    static const uint8_t gzipHeader[10] = {0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff};
+
+    write_header(true);
+    for (uint8_t i = 0; i < sizeof(gzipHeader); i++)
+        put_byte(gzipHeader[i]);
+    // one block, not final, fixed Huffman codes, for the whole body
+    put_bits(0, 1);
+    put_bits(1, 2);
+    mode = GZ_GZIP;
+}
+
+/****************************************************************************
+ * Compress what is in the buffer. Unless flushing, stop with enough look-ahead
+ * for a longest match, and slide the window down to make room for more input.
+ */
+void GzipPrint::compress(bool flush)
+{
+    gzipWork *w = work;
+    while ((w->pos < w->fill) && (flush || (w->fill - w->pos >= GZIP_MAX_MATCH)))
+    {
+        const uint8_t *cur = &w->buf[w->pos];
+        uint16_t avail = w->fill - w->pos;
+        uint16_t bestLen = 0;
+        uint16_t bestDist = 0;
+        if (avail >= GZIP_MIN_MATCH)
+        {
+            uint16_t maxLen = std::min(avail, (uint16_t)GZIP_MAX_MATCH);
+            uint16_t candidate = w->head[gzip_hash(cur)];
+            for (uint8_t chain = 0; candidate && (chain < GZIP_MAX_CHAIN); chain++)
+            {
+                uint16_t c = candidate - 1;
+                uint16_t dist = w->pos - c;
+                if (dist > GZIP_WINDOW_SIZE)
+                    break;
+                const uint8_t *match = &w->buf[c];
+                // cannot beat best so far unless it matches at that length
+                if (match[bestLen] == cur[bestLen])
+                {
+                    uint16_t len = 0;
+                    while ((len < maxLen) && (match[len] == cur[len]))
+                        len++;
+                    if (len > bestLen)
+                    {
+                        bestLen = len;
+                        bestDist = dist;
+                        if (len == maxLen)
+                            break;
+                    }
+                }
+                candidate = w->prev[c];
+            }
+            gzip_insert(w, w->pos);
+        }
+
+        if (bestLen >= GZIP_MIN_MATCH)
+        {
+            put_match(bestLen, bestDist);
+            for (uint16_t i = 1; i < bestLen; i++)
+            {
+                if (w->fill - (w->pos + i) >= GZIP_MIN_MATCH)
+                    gzip_insert(w, w->pos + i);
+            }
+            w->pos += bestLen;
+        }
+        else
+        {
+            put_literal(*cur);
+            w->pos++;
+        }
+    }
+
+    if (!flush && (w->pos > GZIP_WINDOW_SIZE))
+    {
+        uint16_t shift = w->pos - GZIP_WINDOW_SIZE;
+        uint16_t keep = w->fill - shift;
+        memmove(w->buf, &w->buf[shift], keep);
+        memmove(w->prev, &w->prev[shift], keep * sizeof(uint16_t));
+        for (uint16_t i = 0; i < (1 << GZIP_HASH_BITS); i++)
+            w->head[i] = (w->head[i] > shift) ? w->head[i] - shift : 0;
+        for (uint16_t i = 0; i < keep; i++)
+            w->prev[i] = (w->prev[i] > shift) ? w->prev[i] - shift : 0;
+        w->fill = keep;
+        w->pos -= shift;
+    }
+}
+
+// Deflate packs bits starting from the least significant bit of each byte
+void GzipPrint::put_bits(uint32_t value, uint8_t count)
+{
+    bitBuf |= value << bitCount;
+    bitCount += count;
+    while (bitCount >= 8)
+    {
+        put_byte(bitBuf & 0xff);
+        bitBuf >>= 8;
+        bitCount -= 8;
+    }
+}
+
+// ...except Huffman codes, which are packed most significant bit first
+void GzipPrint::put_huffman(uint32_t code, uint8_t count)
+{
+    uint32_t reversed = 0;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        reversed = (reversed << 1) | (code & 1);
+        code >>= 1;
+    }
+    put_bits(reversed, count);
+}
+
+void GzipPrint::put_literal(uint16_t symbol)
+{
+    // Fixed literal/length code, RFC 1951 section 3.2.6
+    if (symbol < 144)
+        put_huffman(0x30 + symbol, 8);
+    else if (symbol < 256)
+        put_huffman(0x190 + symbol - 144, 9);
+    else if (symbol < 280)
+        put_huffman(symbol - 256, 7);
+    else
+        put_huffman(0xc0 + symbol - 280, 8);
+}
+
+void GzipPrint::put_match(uint16_t length, uint16_t distance)
+{
+    uint8_t code = 28;
+    while (lengthBase[code] > length)
+        code--;
+    put_literal(257 + code);
+    if (lengthExtra[code])
+        put_bits(length - lengthBase[code], lengthExtra[code]);
+
+    code = 29;
+    while (distBase[code] > distance)
+        code--;
+    put_huffman(code, 5);
+    if (distExtra[code])
+        put_bits(distance - distBase[code], distExtra[code]);
+}
+
+void GzipPrint::put_byte(uint8_t b)
+{
+    work->outBuf[work->outLen++] = b;
+    if (work->outLen == GZIP_OUT_SIZE)
+        flush_out();
+}
+
+void GzipPrint::flush_out()
+{
+    if (work->outLen == 0)
+        return;
+
+    int64_t start = esp_timer_get_time();
+    out.write(work->outBuf, work->outLen);
+    writeUs += esp_timer_get_time() - start;
+    gzipStats.bytesOut += work->outLen;
+    work->outLen = 0;
+}
+
+void gzip_print_metrics(Print &out)
+{
+    out.printf("\"gzipResponses\": %lu,\n\"gzipPlain\": %lu,\n\"gzipBytesIn\": %lu,\n\"gzipBytesOut\": %lu,\n\"gzipCpuUs\": %lu,\n",
+               gzipStats.responses, gzipStats.plain, gzipStats.bytesIn, gzipStats.bytesOut, gzipStats.cpuUs);
+}
@@ -0,0 +1,95 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+
+// Arduino includes
+#include <Print.h>
+
+// RATGDO project includes
+// none
+
+// Bodies smaller than this are sent as they are, not worth the CPU time
+#define GZIP_THRESHOLD 512
+// How far back a match may reach, and input buffer that holds it plus look-ahead
+#define GZIP_WINDOW_SIZE 2048
+#define GZIP_BUFFER_SIZE 4096
+#define GZIP_HASH_BITS 10
+#define GZIP_MAX_CHAIN 8
+#define GZIP_OUT_SIZE 512
+
+struct gzipStats_t
+{
+    uint32_t responses; // bodies sent compressed
+    uint32_t plain;     // bodies sent as they are, small, not accepted or no memory
+    uint32_t bytesIn;   // before and after compression
+    uint32_t bytesOut;
+    uint32_t cpuUs;     // time spent compressing, not counting time writing to client
+};
+
+extern gzipStats_t gzipStats;
+
+struct gzipWork;
+
+/*
+ * Print that gzips what is written to it on the way to another Print, for
+ * streaming a response body to a client. Writes the HTTP header too, adding
+ * Content-Encoding if the body is compressed, as that is only known once
+ * GZIP_THRESHOLD bytes have been written or end() is called. The header must
+ * end with the blank line (as response200 does), NULL to write no header.
+ * Work area (about 15KB) is allocated only while in use, if it cannot be the
+ * body is sent as it is. Call end() after the last write.
+ */
+class GzipPrint : public Print
+{
+public:
+    GzipPrint(Print &out, const char *header, bool compress);
+    ~GzipPrint();
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+    void end();
+    uint32_t bytesIn() const { return total; }
+
+private:
+    enum gzipMode : uint8_t
+    {
+        GZ_PENDING, // buffering, not yet decided
+        GZ_PLAIN,
+        GZ_GZIP,
+        GZ_DONE,
+    };
+
+    Print &out;
+    const char *header;
+    gzipWork *work = NULL;
+    gzipMode mode;
+    uint32_t total = 0;
+    uint32_t crc = 0;
+    uint32_t bitBuf = 0;
+    uint8_t bitCount = 0;
+    uint32_t writeUs = 0;
+
+    void write_header(bool gzip);
+    void start_gzip();
+    void compress(bool flush);
+    void put_bits(uint32_t value, uint8_t count);
+    void put_huffman(uint32_t code, uint8_t count);
+    void put_literal(uint16_t symbol);
+    void put_match(uint16_t length, uint16_t distance);
+    void put_byte(uint8_t b);
+    void flush_out();
+};
+
+extern void gzip_print_metrics(Print &out);
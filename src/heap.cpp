@@ -0,0 +1,152 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+
+// C/C++ language includes
+#include <algorithm>
+
+// ESP system includes
+#include <esp_heap_caps.h>
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "heap.h"
+
+// Logger tag
+static const char *TAG = "ratgdo-heap";
+
+// Track our memory usage
+uint32_t free_heap = (1024 * 1024);
+uint32_t min_heap = (1024 * 1024);
+uint32_t largest_block = (1024 * 1024);
+uint32_t min_largest_block = (1024 * 1024);
+uint8_t heap_fragmentation = 0;
+uint8_t max_heap_fragmentation = 0;
+
+static heapSample trend[HEAP_TREND_SIZE];
+static uint8_t trendHead = 0;
+static uint8_t trendCount = 0;
+static uint32_t trendSeconds = HEAP_TREND_PERIOD; // take first sample right away
+
+#ifdef HEAP_TRACKING
+heapSite heapSiteLog = {"log", 0, 0};
+heapSite heapSiteConfig = {"config", 0, 0};
+static heapSite *sites[HEAP_MAX_SITES] = {&heapSiteLog, &heapSiteConfig};
+static uint8_t siteCount = 2;
+static uint32_t baselineHeap = 0;
+static TaskHandle_t loopTaskHandle = NULL;
+static HeapScope *currentScope = NULL;
+
+void heap_register_site(heapSite *site)
+{
+    if (siteCount < HEAP_MAX_SITES)
+        sites[siteCount++] = site;
+    else
+        RERROR(TAG, "No free heap tracking slot for: %s", site->name);
+}
+
+HeapScope::HeapScope(heapSite &site) : site(site), parent(NULL), nested(0)
+{
+    // Nothing is charged until we have a baseline to calculate residual from. Only
+    // the main loop task can nest scopes, anything else is charged in full.
+    tracking = (loopTaskHandle != NULL);
+    onLoopTask = tracking && (xTaskGetCurrentTaskHandle() == loopTaskHandle);
+    if (onLoopTask)
+    {
+        parent = currentScope;
+        currentScope = this;
+    }
+    start = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+}
+
+HeapScope::~HeapScope()
+{
+    if (!tracking)
+        return;
+
+    int32_t delta = (int32_t)(start - heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+    __atomic_fetch_add(&site.net, delta - nested, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&site.calls, 1, __ATOMIC_RELAXED);
+    if (onLoopTask)
+    {
+        if (parent)
+            parent->nested += delta;
+        currentScope = parent;
+    }
+}
+#endif // HEAP_TRACKING
+
+/****************************************************************************
+ * Heap check, called once a second from the main loop
+ */
+void heap_check_loop()
+{
+#ifdef HEAP_TRACKING
+    if (!loopTaskHandle)
+    {
+        loopTaskHandle = xTaskGetCurrentTaskHandle();
+        baselineHeap = ESP.getFreeHeap();
+    }
+#endif
+    free_heap = ESP.getFreeHeap();
+    largest_block = ESP.getMaxAllocHeap();
+    heap_fragmentation = (free_heap > 0) ? 100 - (uint8_t)(((uint64_t)largest_block * 100) / free_heap) : 0;
+
+    if (free_heap < min_heap)
+    {
+        min_heap = free_heap;
+        RINFO(TAG, "Free heap dropped to %d", min_heap);
+    }
+    if (largest_block < min_largest_block)
+    {
+        min_largest_block = largest_block;
+        RINFO(TAG, "Largest free heap block dropped to %d", min_largest_block);
+    }
+    max_heap_fragmentation = std::max(max_heap_fragmentation, heap_fragmentation);
+
+    if (++trendSeconds >= HEAP_TREND_PERIOD)
+    {
+        trendSeconds = 0;
+        trend[trendHead] = {free_heap, largest_block};
+        trendHead = (trendHead + 1) % HEAP_TREND_SIZE;
+        trendCount = std::min(trendCount + 1, HEAP_TREND_SIZE);
+    }
+}
+
+/****************************************************************************
+ * Print heap telemetry as JSON object members (caller provides the braces)
+ */
+void heap_print_metrics(Print &out)
+{
+    out.printf("\"freeHeap\": %lu,\n\"minHeap\": %lu,\n\"largestBlock\": %lu,\n\"minLargestBlock\": %lu,\n",
+               free_heap, min_heap, largest_block, min_largest_block);
+    out.printf("\"heapFrag\": %d,\n\"maxHeapFrag\": %d,\n\"heapTrendPeriod\": %d,\n",
+               heap_fragmentation, max_heap_fragmentation, HEAP_TREND_PERIOD);
+    // Oldest sample first
+    uint8_t first = (trendHead + HEAP_TREND_SIZE - trendCount) % HEAP_TREND_SIZE;
+    out.printf("\"heapTrend\": [");
+    for (uint8_t i = 0; i < trendCount; i++)
+    {
+        heapSample &s = trend[(first + i) % HEAP_TREND_SIZE];
+        out.printf("%s[%lu,%lu]", (i > 0) ? "," : "", s.freeHeap, s.largestBlock);
+    }
+    out.printf("],\n");
+#ifdef HEAP_TRACKING
+    int32_t charged = 0;
+    out.printf("\"heapSites\": [");
+    for (uint8_t i = 0; i < siteCount; i++)
+    {
+        charged += sites[i]->net;
+        out.printf("%s\n{\"name\": \"%s\", \"net\": %ld, \"calls\": %lu}",
+                   (i > 0) ? "," : "", sites[i]->name, sites[i]->net, sites[i]->calls);
+    }
+    out.printf("\n],\n\"heapResidual\": %ld,\n", (int32_t)(baselineHeap - free_heap) - charged);
+#endif
+}
@@ -0,0 +1,78 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+
+// Arduino includes
+#include <Print.h>
+
+// RATGDO project includes
+// none
+
+// Number of samples kept in the heap trend ring, and seconds between samples
+#define HEAP_TREND_SIZE 60
+#define HEAP_TREND_PERIOD 60
+
+struct heapSample
+{
+    uint32_t freeHeap;
+    uint32_t largestBlock;
+};
+
+// free_heap and min_heap are declared in ratgdo.h
+extern uint32_t largest_block;
+extern uint32_t min_largest_block;
+extern uint8_t heap_fragmentation; // percent of free heap not in largest free block
+extern uint8_t max_heap_fragmentation;
+
+extern void heap_check_loop();
+extern void heap_print_metrics(Print &out);
+
+#ifdef HEAP_TRACKING
+// Allocation site tracking. Net change in free heap across a HEAP_SCOPE is charged
+// to its site. Scopes nest on the main loop task, so a site is only charged for
+// what it allocates itself and not for nested sites. Whatever is not charged to a
+// site (HomeSpan, WiFi, other tasks) is reported as residual.
+#define HEAP_MAX_SITES 24
+
+struct heapSite
+{
+    const char *name;
+    int32_t net; // bytes allocated and not yet freed, may be negative
+    uint32_t calls;
+};
+
+class HeapScope
+{
+public:
+    HeapScope(heapSite &site);
+    ~HeapScope();
+
+private:
+    heapSite &site;
+    HeapScope *parent;
+    uint32_t start;
+    int32_t nested;
+    bool tracking;
+    bool onLoopTask;
+};
+
+extern heapSite heapSiteLog;
+extern heapSite heapSiteConfig;
+
+extern void heap_register_site(heapSite *site);
+
+#define HEAP_SCOPE(site) HeapScope _heapScope(site)
+#else
+#define HEAP_SCOPE(site)
+#endif
@@ -0,0 +1,329 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+
+// C/C++ language includes
+#include <algorithm>
+#include <time.h>
+
+// ESP system includes
+// none
+
+// Arduino includes
+// none
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "config.h"
+#include "utilities.h"
+#include "vehicle.h"
+#include "history.h"
+
+// Logger tag
+static const char *TAG = "ratgdo-history";
+
+/*
+ * Journal of door events, four bytes each. Each event holds the seconds since
+ * the previous one, absolute time is kept in a separate table of anchors, one at
+ * least every HISTORY_BLOCK events and whenever the delta would not fit (boot,
+ * clock set, long gap). Time is seconds since epoch once NTP has set the clock,
+ * before that seconds since boot.
+ *
+ * Events are numbered with an ever increasing sequence number, event n is in
+ * records[n % HISTORY_LEN].
+ */
+enum historyType : uint8_t
+{
+    HIST_BOOT,
+    HIST_DOOR,
+    HIST_LIGHT,
+    HIST_LOCK,
+    HIST_OBSTRUCTION,
+    HIST_MOTION,
+    HIST_VEHICLE,
+    HIST_COMMAND,
+};
+
+struct historyRecord
+{
+    uint16_t delta; // seconds since previous event, zero if this event has an anchor
+    uint8_t type : 4;
+    uint8_t value : 4;
+    uint8_t source : 4;
+    uint8_t spare : 4;
+};
+static_assert(sizeof(historyRecord) == 4, "history record must pack into 4 bytes");
+
+struct historyAnchor
+{
+    uint32_t seq;
+    uint32_t time;
+};
+
+#define HISTORY_MAGIC 0x48535431
+struct historyStore
+{
+    uint32_t magic;
+    uint32_t nextSeq;
+    uint32_t nextAnchor;
+    historyAnchor anchors[HISTORY_ANCHORS];
+    historyRecord records[HISTORY_LEN];
+};
+
+// RAM copy is the live journal, flash copy is written from a snapshot so that
+// events can still be added (from HomeKit task) while it is saved.
+static historyStore store;
+static historyStore saveBuffer;
+static portMUX_TYPE historyMux = portMUX_INITIALIZER_UNLOCKED;
+
+static bool anchorNeeded = true;
+static bool lastEpoch = false;
+static uint32_t lastTime = 0;
+static bool dirty = false;
+static uint32_t lastSave = 0;
+static uint32_t saveCount = 0;
+
+static const char *const typeNames[] = {"boot", "door", "light", "lock", "obstruction", "motion", "vehicle", "command"};
+static const char *const sourceNames[] = {"opener", "homekit", "web", "mqtt", "drycontact"};
+static const char *const commandNames[] = {"open", "close", "lightOn", "lightOff", "lock", "unlock"};
+static const char *const vehicleNames[] = {"Away", "Parked", "Arriving", "Departing"};
+
+static uint8_t vehicle_value(const char *status)
+{
+    for (uint8_t i = 1; i < sizeof(vehicleNames) / sizeof(vehicleNames[0]); i++)
+    {
+        if (strcmp(status, vehicleNames[i]) == 0)
+            return i;
+    }
+    return 0;
+}
+
+// Oldest anchor that still has all of its events in the ring, caller holds mutex
+static uint32_t oldest_anchor()
+{
+    uint32_t first = (store.nextAnchor > HISTORY_ANCHORS) ? store.nextAnchor - HISTORY_ANCHORS : 0;
+    uint32_t oldestSeq = (store.nextSeq > HISTORY_LEN) ? store.nextSeq - HISTORY_LEN : 0;
+    while ((first < store.nextAnchor) && (store.anchors[first % HISTORY_ANCHORS].seq < oldestSeq))
+        first++;
+    return first;
+}
+
+static void add(historyType type, uint8_t value, historySource source)
+{
+    bool epoch = clockSet;
+    uint32_t now = epoch ? time(NULL) : millis() / 1000;
+
+    portENTER_CRITICAL(&historyMux);
+    uint32_t seq = store.nextSeq;
+    uint32_t sinceAnchor = store.nextAnchor ? seq - store.anchors[(store.nextAnchor - 1) % HISTORY_ANCHORS].seq : 0;
+    historyRecord &r = store.records[seq % HISTORY_LEN];
+    if (anchorNeeded || (epoch != lastEpoch) || (now < lastTime) || (now - lastTime > UINT16_MAX) ||
+        (sinceAnchor >= HISTORY_BLOCK) || (store.nextAnchor == 0))
+    {
+        store.anchors[store.nextAnchor % HISTORY_ANCHORS] = {seq, now};
+        store.nextAnchor++;
+        anchorNeeded = false;
+        r.delta = 0;
+    }
+    else
+    {
+        r.delta = now - lastTime;
+    }
+    r.type = type;
+    r.value = value;
+    r.source = source;
+    r.spare = 0;
+    store.nextSeq++;
+    lastTime = now;
+    lastEpoch = epoch;
+    dirty = true;
+    portEXIT_CRITICAL(&historyMux);
+}
+
+/****************************************************************************
+ * Record a command and where it came from, callable from any task
+ */
+void history_command(historyCommand cmd, historySource source)
+{
+    add(HIST_COMMAND, cmd, source);
+}
+
+void setup_history()
+{
+    RINFO(TAG, "=== Setup event history");
+    if (!nvRam->readBlob(nvram_history, (char *)&store, sizeof(store)) || (store.magic != HISTORY_MAGIC))
+    {
+        memset(&store, 0, sizeof(store));
+        store.magic = HISTORY_MAGIC;
+    }
+    RINFO(TAG, "Event history holds %lu events", store.nextSeq - store.anchors[oldest_anchor() % HISTORY_ANCHORS].seq);
+    // Time since boot does not follow on from last event before reboot, so always anchor
+    anchorNeeded = true;
+    add(HIST_BOOT, 0, SRC_OPENER);
+}
+
+/****************************************************************************
+ * Write journal to flash, called periodically and before a planned reboot
+ */
+void history_save()
+{
+    if (!dirty)
+        return;
+
+    portENTER_CRITICAL(&historyMux);
+    saveBuffer = store;
+    dirty = false;
+    portEXIT_CRITICAL(&historyMux);
+    lastSave = millis();
+    if (!nvRam->writeBlob(nvram_history, (const char *)&saveBuffer, sizeof(saveBuffer)))
+    {
+        // Tried again next time
+        RERROR(TAG, "Failed to save %u bytes of event history", sizeof(saveBuffer));
+        dirty = true;
+        return;
+    }
+    saveCount++;
+}
+
+/****************************************************************************
+ * Main loop, save journal to flash periodically
+ */
+void history_loop()
+{
+    if ((millis() - lastSave) >= HISTORY_SAVE_MS)
+        history_save();
+}
+
+/****************************************************************************
+ * Turn state changes into events, called from main loop when door state is published
+ */
+void history_door_changed(const GarageDoor &from, const GarageDoor &to)
+{
+    if (!to.active)
+        return;
+
+    // First time door is active record state found at boot
+    bool baseline = !from.active;
+    if (baseline || (to.current_state != from.current_state))
+        add(HIST_DOOR, to.current_state, SRC_OPENER);
+    if (baseline || (to.light != from.light))
+        add(HIST_LIGHT, to.light, SRC_OPENER);
+    if (baseline || (to.current_lock != from.current_lock))
+        add(HIST_LOCK, to.current_lock, SRC_OPENER);
+    if (baseline || (to.obstructed != from.obstructed))
+        add(HIST_OBSTRUCTION, to.obstructed, SRC_OPENER);
+    if (!baseline && (to.motion != from.motion))
+        add(HIST_MOTION, to.motion, SRC_OPENER);
+    if (baseline && to.has_distance_sensor)
+        add(HIST_VEHICLE, vehicle_value(vehicleStatus), SRC_OPENER);
+}
+
+void history_vehicle_changed(const char *status)
+{
+    add(HIST_VEHICLE, vehicle_value(status), SRC_OPENER);
+}
+
+static void print_value(Print &out, const historyRecord &r)
+{
+    switch (r.type)
+    {
+    case HIST_DOOR:
+        out.print(DOOR_STATE(r.value));
+        break;
+    case HIST_LIGHT:
+        out.print(r.value ? "on" : "off");
+        break;
+    case HIST_LOCK:
+        out.print(LOCK_STATE(r.value));
+        break;
+    case HIST_OBSTRUCTION:
+        out.print(r.value ? "obstructed" : "clear");
+        break;
+    case HIST_MOTION:
+        out.print(r.value ? "detected" : "clear");
+        break;
+    case HIST_VEHICLE:
+        out.print(vehicleNames[r.value & 3]);
+        break;
+    case HIST_COMMAND:
+        if (r.value < sizeof(commandNames) / sizeof(commandNames[0]))
+            out.print(commandNames[r.value]);
+        break;
+    default:
+        break;
+    }
+}
+
+/****************************************************************************
+ * Print events with time in [from, to] and sequence number at or after start,
+ * oldest first, as JSON. Works through the journal one anchor block at a time so
+ * nothing more than a block is copied, and the mutex is not held while printing.
+ * If there are more than limit events "next" is the start for the next page.
+ */
+void history_print(Print &out, uint32_t from, uint32_t to, uint32_t start, uint16_t limit)
+{
+    historyRecord block[HISTORY_BLOCK];
+    uint16_t count = 0;
+    bool more = false;
+    uint32_t nextStart = 0;
+
+    portENTER_CRITICAL(&historyMux);
+    uint32_t anchor = oldest_anchor();
+    uint32_t oldest = store.anchors[anchor % HISTORY_ANCHORS].seq;
+    uint32_t newest = store.nextSeq;
+    portEXIT_CRITICAL(&historyMux);
+
+    out.print("{\n\"events\": [");
+    for (; !more; anchor++)
+    {
+        portENTER_CRITICAL(&historyMux);
+        // Stop at end of journal, or if the block was overwritten since we started
+        bool valid = (anchor < store.nextAnchor) && (anchor >= oldest_anchor());
+        historyAnchor a = store.anchors[anchor % HISTORY_ANCHORS];
+        uint32_t end = (anchor + 1 < store.nextAnchor) ? store.anchors[(anchor + 1) % HISTORY_ANCHORS].seq : store.nextSeq;
+        uint8_t n = valid ? std::min(end - a.seq, (uint32_t)HISTORY_BLOCK) : 0;
+        for (uint8_t i = 0; i < n; i++)
+            block[i] = store.records[(a.seq + i) % HISTORY_LEN];
+        portEXIT_CRITICAL(&historyMux);
+        if (!valid)
+            break;
+
+        uint32_t t = a.time;
+        for (uint8_t i = 0; i < n; i++)
+        {
+            t += block[i].delta;
+            uint32_t seq = a.seq + i;
+            if ((seq < start) || (t < from) || (t > to))
+                continue;
+            if (count >= limit)
+            {
+                more = true;
+                nextStart = seq;
+                break;
+            }
+            out.printf("%s\n{\"seq\": %lu, \"time\": %lu, \"type\": \"%s\", \"value\": \"", count ? "," : "", seq, t,
+                       typeNames[block[i].type & 7]);
+            print_value(out, block[i]);
+            out.printf("\", \"source\": \"%s\"}", (block[i].source < sizeof(sourceNames) / sizeof(sourceNames[0])) ? sourceNames[block[i].source] : "");
+            count++;
+        }
+    }
+    out.printf("\n],\n\"count\": %u,\n\"oldest\": %lu,\n\"newest\": %lu,\n", count, oldest, newest - 1);
+    if (more)
+        out.printf("\"next\": %lu\n}\n", nextStart);
+    else
+        out.print("\"next\": null\n}\n");
+}
+
+// Print history statistics as JSON object members (caller provides the braces)
+void history_print_metrics(Print &out)
+{
+    out.printf("\"historyEvents\": %lu,\n\"historySaves\": %lu,\n", store.nextSeq, saveCount);
+}
@@ -0,0 +1,59 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+
+// Arduino includes
+#include <Print.h>
+
+// RATGDO project includes
+#include "ratgdo.h"
+
+// Number of events kept, oldest are overwritten
+#define HISTORY_LEN 256
+// Absolute time is recorded at least every this many events, others hold the
+// time since the previous event
+#define HISTORY_BLOCK 32
+#define HISTORY_ANCHORS (HISTORY_LEN / HISTORY_BLOCK + 8)
+// Changes are mirrored to flash no more often than this (milliseconds)
+#define HISTORY_SAVE_MS (10 * 60 * 1000)
+// Most events returned by one /history request
+#define HISTORY_LIMIT_MAX 500
+
+enum historySource : uint8_t
+{
+    SRC_OPENER, // reported by door opener, wall button or remote
+    SRC_HOMEKIT,
+    SRC_WEB,
+    SRC_MQTT,
+    SRC_DRYCONTACT,
+};
+
+enum historyCommand : uint8_t
+{
+    CMD_OPEN,
+    CMD_CLOSE,
+    CMD_LIGHT_ON,
+    CMD_LIGHT_OFF,
+    CMD_LOCK,
+    CMD_UNLOCK,
+};
+
+extern void setup_history();
+extern void history_loop();
+extern void history_door_changed(const GarageDoor &from, const GarageDoor &to);
+extern void history_vehicle_changed(const char *status);
+extern void history_command(historyCommand cmd, historySource source);
+extern void history_save();
+extern void history_print(Print &out, uint32_t from, uint32_t to, uint32_t start, uint16_t limit);
+extern void history_print_metrics(Print &out);
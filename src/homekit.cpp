@@ -29,6 +29,10 @@
 #include "led.h"
 #include "vehicle.h"
 #include "drycontact.h"
+#include "scheduler.h"
+#include "mqtt.h"
+#include "webhook.h"
+#include "history.h"
 
 // Logger tag
 static const char *TAG = "ratgdo-homekit";
@@ -41,17 +45,128 @@ static DEV_Motion *departing;
 static DEV_Occupancy *vehicle;
 static DEV_Light *assistLaser;
 
+// One statically allocated event queue for each of the services above
+#define EVENT_QUEUE_POOL 7
+#define EVENT_QUEUE_LENGTH 5
+static StaticQueue_t eventQueueBuffer[EVENT_QUEUE_POOL];
+static uint8_t eventQueueStorage[EVENT_QUEUE_POOL][EVENT_QUEUE_LENGTH * sizeof(GDOEvent)];
+static uint8_t eventQueueCount = 0;
+
 static bool isPaired = false;
 static bool rebooting = false;
 
+uint32_t bootToIP = 0;
+uint32_t bootToDoorReady = 0;
+bool wifiFastConnect = false;
+
+// Access point and lease from last successful connection. We use the BSSID and
+// channel to connect without a full scan. The lease is recorded but not reused,
+// the ESP-IDF DHCP client always starts from DISCOVER (unless built with
+// CONFIG_LWIP_DHCP_RESTORE_LAST_IP), so we only skip DHCP if static IP is set.
+#define WIFI_CACHE_VERSION 1
+#define FAST_CONNECT_TIMEOUT 5000
+struct wifiCache
+{
+    uint32_t version;
+    char ssid[33];
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t mask;
+    uint32_t dns;
+};
+static wifiCache cache;
+static bool cacheValid = false;
+static char beginSSID[33];
+static char beginPassword[65];
+static volatile uint32_t fastConnectStart = 0; // millis() when fast connect started, zero if not trying
+
 /****************************************************************************
  * Callback functions, notify us of significant events
  */
+/****************************************************************************
+ * Called by HomeSpan in place of WiFi.begin(). Try the cached access point first.
+ */
+void wifiBegin(const char *ssid, const char *pwd)
+{
+    strlcpy(beginSSID, ssid, sizeof(beginSSID));
+    strlcpy(beginPassword, pwd, sizeof(beginPassword));
+    if (cacheValid && !strcmp(cache.ssid, ssid))
+    {
+        RINFO(TAG, "WiFi fast connect to %s at %02x:%02x:%02x:%02x:%02x:%02x, channel %d", ssid,
+              cache.bssid[0], cache.bssid[1], cache.bssid[2], cache.bssid[3], cache.bssid[4], cache.bssid[5], cache.channel);
+        fastConnectStart = millis() | 1; // never zero
+        WiFi.begin(ssid, pwd, cache.channel, cache.bssid);
+    }
+    else
+    {
+        WiFi.begin(ssid, pwd);
+    }
+}
+
+// Fall back to a full scan if directed connect has not succeeded in time
+void wifi_fast_connect_loop()
+{
+    uint32_t started = fastConnectStart;
+    if (!started || (millis() - started < FAST_CONNECT_TIMEOUT))
+        return;
+
+    fastConnectStart = 0;
+    cacheValid = false;
+    if (WiFi.status() == WL_CONNECTED)
+        return;
+
+    RERROR(TAG, "WiFi fast connect failed, reconnect with full scan");
+    nvRam->erase(nvram_wifi_cache);
+    WiFi.disconnect();
+    WiFi.begin(beginSSID, beginPassword);
+}
+
+static void wifi_cache_load()
+{
+    cacheValid = nvRam->readBlob(nvram_wifi_cache, (char *)&cache, sizeof(cache)) &&
+                 (cache.version == WIFI_CACHE_VERSION);
+}
+
+// Only written when something changed, to save flash wear
+static void wifi_cache_save()
+{
+    wifiCache now = {};
+    now.version = WIFI_CACHE_VERSION;
+    strlcpy(now.ssid, WiFi.SSID().c_str(), sizeof(now.ssid));
+    memcpy(now.bssid, WiFi.BSSID(), sizeof(now.bssid));
+    now.channel = WiFi.channel();
+    now.ip = WiFi.localIP();
+    now.gateway = WiFi.gatewayIP();
+    now.mask = WiFi.subnetMask();
+    now.dns = WiFi.dnsIP();
+    if (cacheValid && (cache.ip != now.ip) && !userConfig->getStaticIP())
+    {
+        RINFO(TAG, "DHCP assigned new address, previous lease was %s", IPAddress(cache.ip).toString().c_str());
+    }
+    if (!cacheValid || memcmp(&cache, &now, sizeof(now)))
+    {
+        nvRam->writeBlob(nvram_wifi_cache, (const char *)&now, sizeof(now));
+    }
+    cache = now;
+    cacheValid = true;
+}
+
 void wifiCallbackAll(int count)
 {
     if (rebooting)
         return;
 
+    wifiFastConnect = (fastConnectStart != 0);
+    fastConnectStart = 0;
+    if (bootToIP == 0)
+    {
+        bootToIP = millis();
+        RINFO(TAG, "Boot to IP address: %lums%s", bootToIP, wifiFastConnect ? " (fast connect)" : "");
+    }
+    wifi_cache_save();
+
     RINFO(TAG, "WiFi established, count: %d, IP: %s, Mask: %s, Gateway: %s, DNS: %s", count, WiFi.localIP().toString().c_str(),
           WiFi.subnetMask().toString().c_str(), WiFi.gatewayIP().toString().c_str(), WiFi.dnsIP().toString().c_str());
     userConfig->set(cfg_localIP, WiFi.localIP().toString().c_str());
@@ -69,6 +184,8 @@ void wifiCallbackAll(int count)
         setup_comms();
         setup_drycontact();
         setup_web();
+        setup_mqtt();
+        setup_webhook();
     }
     // beep on completing startup.
     tone(BEEPER_PIN, 2000, 500);
@@ -110,10 +227,12 @@ void statusCallback(HS_STATUS status)
     case HS_PAIRING_NEEDED:
         RINFO(TAG, "Status: Need to pair");
         isPaired = false;
+        led.play(LED_PAIRING);
         break;
     case HS_PAIRED:
         RINFO(TAG, "Status: Paired");
         isPaired = true;
+        led.stop(LED_PAIRING);
         break;
     case HS_REBOOTING:
         rebooting = true;
@@ -149,6 +268,17 @@ void printTaskInfo(const char *buf)
 };
 #endif
 
+void printLoopProfile(const char *buf)
+{
+    if (strstr(buf, "reset"))
+    {
+        scheduler_profile_reset();
+        Serial.printf("Main loop profile reset\n");
+        return;
+    }
+    scheduler_print_profile(Serial);
+}
+
 /****************************************************************************
  * Initialize HomeKit (with HomeSpan)
  */
@@ -223,6 +353,8 @@ void setup_homekit()
                                          // access for "unauthorized" third parties.
 
     homeSpan.setWifiCallbackAll(wifiCallbackAll);
+    wifi_cache_load();
+    homeSpan.setWifiBegin(wifiBegin);
     homeSpan.setStatusCallback(statusCallback);
 
     homeSpan.begin(Category::Bridges, device_name, device_name_rfc952, "ratgdo-ESP32");
@@ -230,6 +362,7 @@ void setup_homekit()
 #ifdef CONFIG_FREERTOS_USE_TRACE_FACILITY
     new SpanUserCommand('t', "print FreeRTOS task info", printTaskInfo);
 #endif
+    new SpanUserCommand('p', "print main loop profile, 'p reset' to clear", printLoopProfile);
     // Define a bridge (as more than 3 accessories)
     new SpanAccessory();
     new DEV_Info(default_device_name);
@@ -283,6 +416,17 @@ void setup_homekit()
     homeSpan.autoPoll((1024 * 16), 1, 0);
 }
 
+QueueHandle_t createEventQueue()
+{
+    if (eventQueueCount >= EVENT_QUEUE_POOL)
+    {
+        RERROR(TAG, "Static event queue pool exhausted, allocating from heap");
+        return xQueueCreate(EVENT_QUEUE_LENGTH, sizeof(GDOEvent));
+    }
+    uint8_t i = eventQueueCount++;
+    return xQueueCreateStatic(EVENT_QUEUE_LENGTH, sizeof(GDOEvent), eventQueueStorage[i], &eventQueueBuffer[i]);
+}
+
 void queueSendHelper(QueueHandle_t q, GDOEvent e, const char *txt)
 {
     if (!q || xQueueSend(q, &e, 0) == errQUEUE_FULL)
@@ -397,7 +541,7 @@ void notify_homekit_obstruction()
 DEV_GarageDoor::DEV_GarageDoor() : Service::GarageDoorOpener()
 {
     RINFO(TAG, "Configuring HomeKit Garage Door Service");
-    event_q = xQueueCreate(5, sizeof(GDOEvent));
+    event_q = createEventQueue();
     current = new Characteristic::CurrentDoorState(current->CLOSED);
     target = new Characteristic::TargetDoorState(target->CLOSED);
     obstruction = new Characteristic::ObstructionDetected(obstruction->NOT_DETECTED);
@@ -422,6 +566,8 @@ boolean DEV_GarageDoor::update()
     if (target->getNewVal() == target->OPEN)
     {
         RINFO(TAG, "Opening Garage Door");
+        if (target->updated())
+            history_command(CMD_OPEN, SRC_HOMEKIT);
         current->setVal(current->OPENING);
         obstruction->setVal(false);
         open_door();
@@ -429,6 +575,8 @@ boolean DEV_GarageDoor::update()
     else
     {
         RINFO(TAG, "Closing Garage Door");
+        if (target->updated())
+            history_command(CMD_CLOSE, SRC_HOMEKIT);
         current->setVal(current->CLOSING);
         obstruction->setVal(false);
         close_door();
@@ -440,11 +588,15 @@ boolean DEV_GarageDoor::update()
         if (lockTarget->getNewVal() == lockTarget->LOCK)
         {
             RINFO(TAG, "Locking Garage Door Remotes");
+            if (lockTarget->updated())
+                history_command(CMD_LOCK, SRC_HOMEKIT);
             set_lock(lockTarget->LOCK);
         }
         else
         {
             RINFO(TAG, "Unlocking Garage Door Remotes");
+            if (lockTarget->updated())
+                history_command(CMD_UNLOCK, SRC_HOMEKIT);
             set_lock(lockTarget->UNLOCK);
         }
     }
@@ -503,7 +655,7 @@ DEV_Light::DEV_Light(Light_t type) : Service::LightBulb()
         RINFO(TAG, "Configuring HomeKit Light Service for GDO Light");
     else if (type == Light_t::ASSIST_LASER)
         RINFO(TAG, "Configuring HomeKit Light Service for Laser");
-    event_q = xQueueCreate(5, sizeof(GDOEvent));
+    event_q = createEventQueue();
     DEV_Light::on = new Characteristic::On(DEV_Light::on->OFF);
 }
 
@@ -512,6 +664,7 @@ boolean DEV_Light::update()
     if (this->type == Light_t::GDO_LIGHT)
     {
         RINFO(TAG, "Turn light %s", on->getNewVal<bool>() ? "on" : "off");
+        history_command(on->getNewVal<bool>() ? CMD_LIGHT_ON : CMD_LIGHT_OFF, SRC_HOMEKIT);
         set_light(DEV_Light::on->getNewVal<bool>());
     }
     else if (this->type == Light_t::ASSIST_LASER)
@@ -591,7 +744,7 @@ void notify_homekit_vehicle_departing(bool vehicleDeparting)
 DEV_Motion::DEV_Motion(const char *name) : Service::MotionSensor()
 {
     RINFO(TAG, "Configuring HomeKit Motion Service for %s", name);
-    event_q = xQueueCreate(5, sizeof(GDOEvent));
+    event_q = createEventQueue();
     strlcpy(this->name, name, sizeof(this->name));
     DEV_Motion::motion = new Characteristic::MotionDetected(motion->NOT_DETECTED);
 }
@@ -623,7 +776,7 @@ void notify_homekit_vehicle_occupancy(bool vehicleDetected)
 DEV_Occupancy::DEV_Occupancy() : Service::OccupancySensor()
 {
     RINFO(TAG, "Configuring HomeKit Occupancy Service");
-    event_q = xQueueCreate(5, sizeof(GDOEvent));
+    event_q = createEventQueue();
     DEV_Occupancy::occupied = new Characteristic::OccupancyDetected(occupied->NOT_DETECTED);
 }
 
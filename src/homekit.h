@@ -32,6 +32,12 @@ enum Light_t : uint8_t
 
 void setup_homekit();
 
+// Boot timing, milliseconds from boot, zero until reached
+extern uint32_t bootToIP;
+extern uint32_t bootToDoorReady;
+extern bool wifiFastConnect; // true if connected using cached access point
+extern void wifi_fast_connect_loop();
+
 extern void notify_homekit_target_door_state_change();
 extern void notify_homekit_current_door_state_change();
 extern void notify_homekit_target_lock();
@@ -23,10 +23,21 @@ static const char *TAG = "ratgdo-led";
 LED led(LED_BUILTIN);
 LED laser(LASER_PIN);
 
-void LEDtimerCallback(LED *led)
-{
-    led->idle();
-}
+static portMUX_TYPE ledMux = portMUX_INITIALIZER_UNLOCKED;
+
+/****************************************************************************
+ * Patterns
+ */
+#define PATTERN(name, repeat, ...)                       \
+    static const ledStep name##_steps[] = {__VA_ARGS__}; \
+    const ledPattern name = {name##_steps, sizeof(name##_steps) / sizeof(ledStep), repeat}
+
+// Gap after activity blink means continuous activity still blinks rather than
+// holding the LED solid.
+PATTERN(LED_ACTIVITY, false, {255, false, FLASH_MS}, {0, false, 100});
+PATTERN(LED_ERROR, false, {255, false, 100}, {0, false, 100}, {255, false, 100}, {0, false, 100}, {255, false, 100}, {0, false, 500});
+PATTERN(LED_PAIRING, true, {255, true, 1000}, {0, true, 1000});
+PATTERN(LED_SOFTAP, true, {255, false, 100}, {0, false, 100}, {255, false, 100}, {0, false, 1700});
 
 // Constructor for LED class
 LED::LED(uint8_t gpio_num, uint8_t state)
@@ -36,25 +47,64 @@ LED::LED(uint8_t gpio_num, uint8_t state)
     // off is opposite of on, which can be zero or one.
     currentState = offState = (onState == 1) ? 0 : 1;
     idleState = (activeState == 1) ? 0 : 1;
-    LEDtimer = Ticker();
+    // PWM is attached on first use, until then hold pin in off state.
     pinMode(pin, OUTPUT);
 }
 
+// Convert pattern level to PWM duty, taking account of idle and active states
+uint8_t LED::levelDuty(uint8_t lvl)
+{
+    int idle = idleState ? 255 : 0;
+    int active = activeState ? 255 : 0;
+    return idle + ((active - idle) * lvl) / 255;
+}
+
+void LED::write(uint8_t newDuty)
+{
+    if (!attached)
+    {
+        if (!ledcAttach(pin, LED_PWM_FREQ, LED_PWM_BITS))
+        {
+            RERROR(TAG, "Unable to attach PWM to pin %d", pin);
+            return;
+        }
+        attached = true;
+    }
+    if (newDuty != duty)
+    {
+        ledcWrite(pin, newDuty);
+        duty = newDuty;
+    }
+}
+
 void LED::on()
 {
-    digitalWrite(pin, onState);
+    portENTER_CRITICAL(&ledMux);
+    foreground = nullptr;
+    holding = true;
+    holdUntil = 0;
+    holdDuty = onState ? 255 : 0;
     currentState = onState;
+    portEXIT_CRITICAL(&ledMux);
 }
 
 void LED::off()
 {
-    digitalWrite(pin, offState);
+    portENTER_CRITICAL(&ledMux);
+    foreground = nullptr;
+    holding = true;
+    holdUntil = 0;
+    holdDuty = offState ? 255 : 0;
     currentState = offState;
+    portEXIT_CRITICAL(&ledMux);
 }
 
 void LED::idle()
 {
-    digitalWrite(pin, idleState);
+    portENTER_CRITICAL(&ledMux);
+    foreground = nullptr;
+    holding = false;
+    portEXIT_CRITICAL(&ledMux);
 }
 
 void LED::setIdleState(uint8_t state)
@@ -76,6 +126,120 @@ void LED::setIdleState(uint8_t state)
 
 void LED::flash(unsigned long ms)
 {
-    digitalWrite(pin, activeState);
-    LEDtimer.once_ms(ms, LEDtimerCallback, this);
+    portENTER_CRITICAL(&ledMux);
+    foreground = nullptr;
+    holding = true;
+    holdUntil = (millis() + ms) | 1; // never zero
+    holdDuty = activeState ? 255 : 0;
+    portEXIT_CRITICAL(&ledMux);
+}
+
+void LED::play(const ledPattern &pattern)
+{
+    portENTER_CRITICAL(&ledMux);
+    if (pattern.repeat)
+    {
+        background = &pattern;
+    }
+    else
+    {
+        foreground = &pattern;
+        holding = false;
+    }
+    step = 0;
+    stepFrom = level;
+    stepStart = millis();
+    portEXIT_CRITICAL(&ledMux);
+}
+
+void LED::stop(const ledPattern &pattern)
+{
+    portENTER_CRITICAL(&ledMux);
+    if (background == &pattern)
+        background = nullptr;
+    if (foreground == &pattern)
+        foreground = nullptr;
+    step = 0;
+    stepFrom = level;
+    stepStart = millis();
+    portEXIT_CRITICAL(&ledMux);
+}
+
+/****************************************************************************
+ * Work out level the LED should be at now, called from main loop
+ */
+void LED::loop(uint32_t now)
+{
+    portENTER_CRITICAL(&ledMux);
+    bool activity = activityPending;
+    activityPending = false;
+
+    if (holding && holdUntil && ((int32_t)(now - holdUntil) >= 0))
+        holding = false;
+
+    // Activity is merged into the blink already playing, and is not shown over
+    // a timed flash or a background pattern.
+    if (activity && !foreground && !background && !(holding && holdUntil))
+    {
+        foreground = &LED_ACTIVITY;
+        holding = false;
+        step = 0;
+        stepFrom = level;
+        stepStart = now;
+    }
+
+    const ledPattern *pattern = foreground ? foreground : (holding ? nullptr : background);
+    if (pattern)
+    {
+        // If we fell a long way behind, don't replay all the steps we missed
+        if ((now - stepStart) > 10000)
+            stepStart = now;
+
+        while ((now - stepStart) >= pattern->steps[step].ms)
+        {
+            stepFrom = pattern->steps[step].level;
+            stepStart += pattern->steps[step].ms;
+            if (++step < pattern->count)
+                continue;
+
+            step = 0;
+            if (!pattern->repeat)
+            {
+                // Foreground pattern done, resume background from the start
+                foreground = nullptr;
+                stepStart = now;
+                pattern = holding ? nullptr : background;
+                if (!pattern)
+                    break;
+            }
+        }
+    }
+
+    uint8_t newDuty;
+    if (pattern)
+    {
+        const ledStep &s = pattern->steps[step];
+        level = s.fade ? stepFrom + (((int)s.level - stepFrom) * (int)(now - stepStart)) / s.ms : s.level;
+        newDuty = levelDuty(level);
+    }
+    else if (holding)
+    {
+        newDuty = holdDuty;
+        level = (holdDuty == levelDuty(255)) ? 255 : 0;
+    }
+    else
+    {
+        level = 0;
+        newDuty = levelDuty(0);
+    }
+    portEXIT_CRITICAL(&ledMux);
+
+    write(newDuty);
+}
+
+void led_loop()
+{
+    uint32_t now = millis();
+    led.loop(now);
+    laser.loop(now);
 }
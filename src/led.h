@@ -14,12 +14,40 @@
 #include <stdint.h>
 
 // Arduino includes
-#include <Ticker.h>
+// none
 
 // RATGDO project includes
 // none
 
-#define FLASH_MS 500 // default flash period, 500ms
+#define FLASH_MS 500    // default flash period, 500ms
+#define LED_TICK_MS 20  // how often the LED engine runs from the main loop
+#define LED_PWM_FREQ 5000
+#define LED_PWM_BITS 8
+
+/*
+ * Patterns are a list of steps, each of which sets the LED to a level between
+ * idle (0) and active (255) for a time. A fade step ramps from the previous level
+ * instead of switching. Repeating patterns play in the background until stopped,
+ * others play once on top of whatever is in the background.
+ */
+struct ledStep
+{
+    uint8_t level;
+    bool fade;
+    uint16_t ms;
+};
+
+struct ledPattern
+{
+    const ledStep *steps;
+    uint8_t count;
+    bool repeat;
+};
+
+extern const ledPattern LED_ACTIVITY; // single blink, activity within the blink is merged into it
+extern const ledPattern LED_ERROR;    // short burst of fast blinks
+extern const ledPattern LED_PAIRING;  // slow breathing while waiting to be paired with HomeKit
+extern const ledPattern LED_SOFTAP;   // double blink while in soft AP mode
 
 class LED
 {
@@ -30,7 +58,23 @@ private:
     uint8_t activeState = 1;
     uint8_t idleState = 0; // opposite of active
     uint8_t currentState = 0;
-    Ticker LEDtimer;
+    bool attached = false;
+    volatile bool activityPending = false;
+
+    // Engine state, protected by ledMux as it may be changed from other tasks
+    const ledPattern *background = nullptr;
+    const ledPattern *foreground = nullptr;
+    uint8_t step = 0;
+    uint8_t stepFrom = 0; // level at start of step, to fade from
+    uint32_t stepStart = 0;
+    uint32_t holdUntil = 0; // millis() when on/off/flash hold ends, zero if none
+    bool holding = false;
+    uint8_t holdDuty = 0;
+    uint8_t level = 0;
+    int16_t duty = -1; // last duty written to pin
+
+    uint8_t levelDuty(uint8_t lvl);
+    void write(uint8_t newDuty);
 
 public:
     LED(uint8_t gpio_num, uint8_t state = 1);
@@ -39,9 +83,16 @@ public:
     void idle();
     bool state() { return (currentState == onState); };
     void flash(unsigned long ms = FLASH_MS);
+    // Signal activity, cheap enough to call from anywhere and as often as you like
+    void activity() { activityPending = true; };
+    void play(const ledPattern &pattern);
+    void stop(const ledPattern &pattern);
     void setIdleState(uint8_t state);
     uint8_t getIdleState() { return idleState; };
+    void loop(uint32_t now);
 };
 
 extern LED led;
 extern LED laser;
+
+extern void led_loop();
@@ -27,6 +27,8 @@
 #include "secplus2.h"
 // #include "comms.h"
 #include "web.h"
+#include "heap.h"
+#include "console.h"
 
 // Logger tag
 static const char *TAG = "ratgdo-logger";
@@ -57,49 +59,40 @@ bool suppressSerialLog = false;
 // Constructor for LOG class
 LOG::LOG()
 {
-    logMutex = xSemaphoreCreateRecursiveMutex();
-    msgBuffer = (logBuffer *)malloc(sizeof(logBuffer));
+    // Log buffers and mutex are statically allocated, they live for ever.
+    static StaticSemaphore_t logMutexBuffer;
+    static logBuffer msgBufferStorage;
+    static char lineBufferStorage[LINE_BUFFER_SIZE];
+    logMutex = xSemaphoreCreateRecursiveMutexStatic(&logMutexBuffer);
+    msgBuffer = &msgBufferStorage;
     // Fill the buffer with space chars... because if we crash and dump buffer before it fills
     // up, we want blank space not garbage!
     memset(msgBuffer->buffer, 0x20, sizeof(msgBuffer->buffer));
     msgBuffer->wrapped = 0;
     msgBuffer->head = 0;
-    lineBuffer = (char *)malloc(LINE_BUFFER_SIZE);
+    lineBuffer = lineBufferStorage;
 }
 
 void LOG::logToBuffer(const char *fmt, ...)
 {
-    if (!lineBuffer)
-    {
-        static char buf[LINE_BUFFER_SIZE];
-        // parse the format string into lineBuffer
-        va_list args;
-        va_start(args, fmt);
-        vsnprintf(buf, LINE_BUFFER_SIZE, fmt, args);
-        va_end(args);
-        // print line to the serial port
-        if (!suppressSerialLog)
-            Serial.print(buf);
-        return;
-    }
-
     xSemaphoreTakeRecursive(logMutex, portMAX_DELAY);
+    HEAP_SCOPE(heapSiteLog);
     // parse the format string into lineBuffer
     va_list args;
     va_start(args, fmt);
     vsnprintf(lineBuffer, LINE_BUFFER_SIZE, fmt, args);
     va_end(args);
-    // print line to the serial port
-    if (!suppressSerialLog)
-        Serial.print(lineBuffer);
+    // print line to the serial port, copied into the UART TX buffer
+    console_print(CONSOLE_LOG, lineBuffer);
 
     // copy the line into the message save buffer
     size_t len = strlen(lineBuffer);
     size_t available = sizeof(msgBuffer->buffer) - msgBuffer->head;
     memcpy(&msgBuffer->buffer[msgBuffer->head], lineBuffer, min(available, len));
-    if (available < len)
+    if (available <= len)
     {
-        // we wrapped on the available buffer space
+        // we wrapped on the available buffer space, including a line that exactly
+        // fills it, as the null terminator must still fit
         msgBuffer->wrapped = 1;
         msgBuffer->head = len - available;
         memcpy(msgBuffer->buffer, &lineBuffer[available], msgBuffer->head);
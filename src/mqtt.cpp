@@ -0,0 +1,449 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+
+// C/C++ language includes
+#include <algorithm>
+#include <strings.h>
+
+// ESP system includes
+#include <esp_timer.h>
+#include <mqtt_client.h>
+
+// Arduino includes
+#include <WiFi.h>
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "config.h"
+#include "comms.h"
+#include "vehicle.h"
+#include "scheduler.h"
+#include "mqtt.h"
+#include "history.h"
+
+// Logger tag
+static const char *TAG = "ratgdo-mqtt";
+
+/*
+ * Each state field is published to a retained topic <mqttTopic>/<device>/<field>.
+ * Main loop compares current state with what was last handed to the client, so
+ * any number of changes between batches result in one publish of the latest value.
+ * Commands are received on <mqttTopic>/<device>/command/<field>.
+ */
+enum mqttField : uint8_t
+{
+    MQTT_DOOR,
+    MQTT_OBSTRUCTION,
+    MQTT_LIGHT,
+    MQTT_LOCK,
+    MQTT_MOTION,
+    MQTT_VEHICLE,
+    MQTT_FIELDS,
+};
+static const char *const fieldTopic[MQTT_FIELDS] = {"door", "obstruction", "light", "lock", "motion", "vehicle"};
+static char published[MQTT_FIELDS][16]; // empty string forces a publish
+
+struct mqttCommand
+{
+    mqttField field;
+    bool value; // open, on or lock
+};
+
+#define MQTT_CMD_QUEUE_LEN 4
+static StaticQueue_t cmdQueueBuffer;
+static uint8_t cmdQueueStorage[MQTT_CMD_QUEUE_LEN * sizeof(mqttCommand)];
+static QueueHandle_t cmdQueue = NULL;
+
+// Publish to PUBACK latency is measured for QoS 1 messages
+#define MQTT_PENDING_MAX 8
+struct pendingPublish
+{
+    int msgId;
+    int64_t sent;
+};
+static pendingPublish pending[MQTT_PENDING_MAX];
+static portMUX_TYPE mqttMux = portMUX_INITIALIZER_UNLOCKED;
+
+static esp_mqtt_client_handle_t client = NULL;
+static char prefix[64];
+static char statusTopic[72];
+static char commandTopic[80];
+static char topic[96];
+
+// Set by MQTT task, acted on by main loop
+static volatile bool connected = false;
+static volatile bool connectedEvent = false;
+
+static bool wasConnected = false;
+static bool batchOpen = false;
+static uint32_t batchStart = 0;
+static uint32_t nextMetrics = 0;
+static uint32_t nextAttempt = 0;
+static uint32_t backoff = MQTT_BACKOFF_MIN_MS;
+
+static uint32_t msgCount = 0;
+static uint32_t batchCount = 0;
+static uint32_t heldCount = 0;
+static uint32_t failCount = 0;
+static uint32_t commandCount = 0;
+static uint32_t commandDrops = 0;
+static uint32_t reconnectCount = 0;
+static uint32_t ackCount = 0;
+static uint64_t latencyTotal = 0; // microseconds
+static uint32_t latencyMax = 0;
+
+static const char *field_value(uint8_t field)
+{
+    switch (field)
+    {
+    case MQTT_DOOR:
+        if (!garage_door.active)
+            return "unknown";
+        switch (garage_door.current_state)
+        {
+        case CURR_OPEN:
+            return "open";
+        case CURR_CLOSED:
+            return "closed";
+        case CURR_OPENING:
+            return "opening";
+        case CURR_CLOSING:
+            return "closing";
+        default:
+            return "stopped";
+        }
+    case MQTT_OBSTRUCTION:
+        return garage_door.obstructed ? "obstructed" : "clear";
+    case MQTT_LIGHT:
+        return garage_door.light ? "on" : "off";
+    case MQTT_LOCK:
+        return (garage_door.current_lock == CURR_LOCKED) ? "locked" : "unlocked";
+    case MQTT_MOTION:
+        return garage_door.motion ? "detected" : "clear";
+    case MQTT_VEHICLE:
+        return garage_door.has_distance_sensor ? vehicleStatus : "";
+    default:
+        return "";
+    }
+}
+
+static bool payload_is(const char *data, int len, const char *word)
+{
+    return (len == (int)strlen(word)) && (strncasecmp(data, word, len) == 0);
+}
+
+/****************************************************************************
+ * Runs on the MQTT client task. Must not touch garage_door, commands are queued
+ * for the main loop.
+ */
+static void mqtt_event(void *args, esp_event_base_t base, int32_t id, void *data)
+{
+    esp_mqtt_event_handle_t event = (esp_mqtt_event_handle_t)data;
+    switch ((esp_mqtt_event_id_t)id)
+    {
+    case MQTT_EVENT_CONNECTED:
+        esp_mqtt_client_subscribe_single(client, commandTopic, 1);
+        esp_mqtt_client_enqueue(client, statusTopic, "online", 0, 1, true, true);
+        connected = true;
+        connectedEvent = true;
+        scheduler_wake();
+        break;
+
+    case MQTT_EVENT_DISCONNECTED:
+        connected = false;
+        scheduler_wake();
+        break;
+
+    case MQTT_EVENT_PUBLISHED:
+    {
+        int64_t now = esp_timer_get_time();
+        portENTER_CRITICAL(&mqttMux);
+        for (uint8_t i = 0; i < MQTT_PENDING_MAX; i++)
+        {
+            if (pending[i].sent && (pending[i].msgId == event->msg_id))
+            {
+                uint32_t latency = now - pending[i].sent;
+                pending[i].sent = 0;
+                ackCount++;
+                latencyTotal += latency;
+                latencyMax = std::max(latencyMax, latency);
+                break;
+            }
+        }
+        portEXIT_CRITICAL(&mqttMux);
+        break;
+    }
+
+    case MQTT_EVENT_DATA:
+    {
+        // Commands are short, ignore anything that arrives in fragments
+        size_t len = strlen(commandTopic) - 1; // without the trailing wildcard
+        if ((event->data_len != event->total_data_len) || (event->topic_len <= (int)len) ||
+            (strncmp(event->topic, commandTopic, len) != 0))
+            break;
+
+        const char *name = event->topic + len;
+        int nameLen = event->topic_len - len;
+        mqttCommand cmd;
+        if (payload_is(name, nameLen, fieldTopic[MQTT_DOOR]) &&
+            (payload_is(event->data, event->data_len, "open") || payload_is(event->data, event->data_len, "close")))
+        {
+            cmd = {MQTT_DOOR, payload_is(event->data, event->data_len, "open")};
+        }
+        else if (payload_is(name, nameLen, fieldTopic[MQTT_LIGHT]) &&
+                 (payload_is(event->data, event->data_len, "on") || payload_is(event->data, event->data_len, "off")))
+        {
+            cmd = {MQTT_LIGHT, payload_is(event->data, event->data_len, "on")};
+        }
+        else if (payload_is(name, nameLen, fieldTopic[MQTT_LOCK]) &&
+                 (payload_is(event->data, event->data_len, "lock") || payload_is(event->data, event->data_len, "unlock")))
+        {
+            cmd = {MQTT_LOCK, payload_is(event->data, event->data_len, "lock")};
+        }
+        else
+        {
+            break;
+        }
+        if (xQueueSend(cmdQueue, &cmd, 0) != pdTRUE)
+            commandDrops++;
+        scheduler_wake();
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+/****************************************************************************
+ * Hand a message to the client, which sends it from its own task. Returns false
+ * if it was not accepted, caller keeps the value dirty and tries again later.
+ */
+static bool mqtt_publish(const char *field, const char *value, int qos)
+{
+    if (esp_mqtt_client_get_outbox_size(client) > MQTT_OUTBOX_MAX)
+    {
+        // Broker is not keeping up, hold back rather than grow the queue
+        heldCount++;
+        return false;
+    }
+    snprintf(topic, sizeof(topic), "%s/%s", prefix, field);
+    int64_t sent = esp_timer_get_time();
+    int msgId = esp_mqtt_client_enqueue(client, topic, value, 0, qos, true, true);
+    if (msgId < 0)
+    {
+        failCount++;
+        return false;
+    }
+    msgCount++;
+    if (qos > 0)
+    {
+        // Use a free slot, or replace the oldest if its ack was missed
+        portENTER_CRITICAL(&mqttMux);
+        uint8_t slot = 0;
+        for (uint8_t i = 0; i < MQTT_PENDING_MAX && pending[slot].sent; i++)
+        {
+            if (pending[i].sent < pending[slot].sent)
+                slot = i;
+        }
+        pending[slot] = {msgId, sent};
+        portEXIT_CRITICAL(&mqttMux);
+    }
+    return true;
+}
+
+static void mqtt_publish_metrics()
+{
+    char buf[256];
+    portENTER_CRITICAL(&mqttMux);
+    uint32_t latencyAvg = ackCount ? latencyTotal / ackCount : 0;
+    uint32_t latencyWorst = latencyMax;
+    portEXIT_CRITICAL(&mqttMux);
+    snprintf(buf, sizeof(buf),
+             "{\"upTime\": %lu, \"freeHeap\": %lu, \"minHeap\": %lu, \"loopIdle\": %d, \"rssi\": %d, "
+             "\"published\": %lu, \"batches\": %lu, \"latencyAvgUs\": %lu, \"latencyMaxUs\": %lu}",
+             millis(), free_heap, min_heap, loopStats.idlePercent, WiFi.RSSI(),
+             msgCount, batchCount, latencyAvg, latencyWorst);
+    mqtt_publish("metrics", buf, 0);
+}
+
+static void mqtt_commands()
+{
+    mqttCommand cmd;
+    while (xQueueReceive(cmdQueue, &cmd, 0) == pdTRUE)
+    {
+        RINFO(TAG, "Command %s: %s", fieldTopic[cmd.field], cmd.value ? "on" : "off");
+        commandCount++;
+        switch (cmd.field)
+        {
+        case MQTT_DOOR:
+            history_command(cmd.value ? CMD_OPEN : CMD_CLOSE, SRC_MQTT);
+            cmd.value ? open_door() : close_door();
+            break;
+        case MQTT_LIGHT:
+            history_command(cmd.value ? CMD_LIGHT_ON : CMD_LIGHT_OFF, SRC_MQTT);
+            set_light(cmd.value);
+            break;
+        case MQTT_LOCK:
+            history_command(cmd.value ? CMD_LOCK : CMD_UNLOCK, SRC_MQTT);
+            set_lock(cmd.value ? TGT_LOCKED : TGT_UNLOCKED);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+/****************************************************************************
+ * Connect to broker, called once WiFi is up
+ */
+void setup_mqtt()
+{
+    if (client || !userConfig->getMqttEn() || userConfig->getMqttServer().empty())
+        return;
+
+    RINFO(TAG, "=== Setup MQTT client, broker %s:%d", userConfig->getMqttServer().c_str(), userConfig->getMqttPort());
+    snprintf(prefix, sizeof(prefix), "%s/%s", userConfig->getMqttTopic().c_str(), device_name_rfc952);
+    snprintf(statusTopic, sizeof(statusTopic), "%s/status", prefix);
+    snprintf(commandTopic, sizeof(commandTopic), "%s/command/+", prefix);
+    cmdQueue = xQueueCreateStatic(MQTT_CMD_QUEUE_LEN, sizeof(mqttCommand), cmdQueueStorage, &cmdQueueBuffer);
+
+    // Client copies all the strings
+    std::string server = userConfig->getMqttServer();
+    std::string user = userConfig->getMqttUser();
+    std::string password = userConfig->getMqttPassword();
+    esp_mqtt_client_config_t cfg = {};
+    cfg.broker.address.hostname = server.c_str();
+    cfg.broker.address.port = userConfig->getMqttPort();
+    cfg.broker.address.transport = MQTT_TRANSPORT_OVER_TCP;
+    cfg.credentials.client_id = device_name_rfc952;
+    if (!user.empty())
+    {
+        cfg.credentials.username = user.c_str();
+        cfg.credentials.authentication.password = password.c_str();
+    }
+    cfg.session.keepalive = 30;
+    cfg.session.last_will.topic = statusTopic;
+    cfg.session.last_will.msg = "offline";
+    cfg.session.last_will.qos = 1;
+    cfg.session.last_will.retain = true;
+    // We reconnect from the main loop with backoff
+    cfg.network.disable_auto_reconnect = true;
+    cfg.task.stack_size = 4096;
+
+    client = esp_mqtt_client_init(&cfg);
+    if (!client)
+    {
+        RERROR(TAG, "Unable to create MQTT client");
+        return;
+    }
+    esp_mqtt_client_register_event(client, MQTT_EVENT_ANY, mqtt_event, NULL);
+    esp_mqtt_client_start(client);
+    nextAttempt = millis() + backoff;
+}
+
+void mqtt_loop()
+{
+    if (!client)
+        return;
+
+    uint32_t now = millis();
+    mqtt_commands();
+
+    if (!connected)
+    {
+        if (wasConnected)
+        {
+            RINFO(TAG, "Disconnected from broker");
+            wasConnected = false;
+            nextAttempt = now + backoff;
+        }
+        else if ((int32_t)(now - nextAttempt) >= 0)
+        {
+            // Fails if client is not waiting to reconnect (still connecting), try again later
+            if (esp_mqtt_client_reconnect(client) == ESP_OK)
+            {
+                reconnectCount++;
+                backoff = std::min(backoff * 2, (uint32_t)MQTT_BACKOFF_MAX_MS);
+            }
+            nextAttempt = now + backoff;
+        }
+        return;
+    }
+
+    if (connectedEvent)
+    {
+        // Broker may have lost retained messages, publish everything again
+        connectedEvent = false;
+        wasConnected = true;
+        backoff = MQTT_BACKOFF_MIN_MS;
+        RINFO(TAG, "Connected to broker, publishing to %s", prefix);
+        for (uint8_t i = 0; i < MQTT_FIELDS; i++)
+            published[i][0] = 0;
+        portENTER_CRITICAL(&mqttMux);
+        memset(pending, 0, sizeof(pending));
+        portEXIT_CRITICAL(&mqttMux);
+        nextMetrics = now;
+    }
+
+    bool dirty = false;
+    for (uint8_t i = 0; i < MQTT_FIELDS && !dirty; i++)
+        dirty = (strcmp(field_value(i), published[i]) != 0);
+
+    if (dirty && !batchOpen)
+    {
+        batchOpen = true;
+        batchStart = now;
+    }
+    if (batchOpen && (now - batchStart >= MQTT_BATCH_MS))
+    {
+        batchOpen = false;
+        batchCount++;
+        for (uint8_t i = 0; i < MQTT_FIELDS; i++)
+        {
+            const char *value = field_value(i);
+            if (!value[0] || (strcmp(value, published[i]) == 0))
+                continue;
+            if (mqtt_publish(fieldTopic[i], value, 1))
+                strlcpy(published[i], value, sizeof(published[i]));
+        }
+    }
+
+    if ((int32_t)(now - nextMetrics) >= 0)
+    {
+        nextMetrics = now + MQTT_METRICS_MS;
+        mqtt_publish_metrics();
+    }
+}
+
+bool mqtt_connected()
+{
+    return connected;
+}
+
+// Print MQTT statistics as JSON object members (caller provides the braces)
+void mqtt_print_metrics(Print &out)
+{
+    if (!client)
+        return;
+
+    portENTER_CRITICAL(&mqttMux);
+    uint32_t acks = ackCount;
+    uint32_t latencyAvg = ackCount ? latencyTotal / ackCount : 0;
+    uint32_t latencyWorst = latencyMax;
+    portEXIT_CRITICAL(&mqttMux);
+    out.printf("\"mqttConnected\": %s,\n\"mqttPublished\": %lu,\n\"mqttBatches\": %lu,\n\"mqttHeld\": %lu,\n\"mqttFailed\": %lu,\n",
+               connected ? "true" : "false", msgCount, batchCount, heldCount, failCount);
+    out.printf("\"mqttAcked\": %lu,\n\"mqttLatencyAvgUs\": %lu,\n\"mqttLatencyMaxUs\": %lu,\n",
+               acks, latencyAvg, latencyWorst);
+    out.printf("\"mqttCommands\": %lu,\n\"mqttCommandDrops\": %lu,\n\"mqttReconnects\": %lu,\n",
+               commandCount, commandDrops, reconnectCount);
+}
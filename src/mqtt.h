@@ -0,0 +1,35 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+
+// Arduino includes
+#include <Print.h>
+
+// RATGDO project includes
+// none
+
+// State changes seen within this window are coalesced into one batch of publishes (milliseconds)
+#define MQTT_BATCH_MS 100
+// How often metrics are published (milliseconds)
+#define MQTT_METRICS_MS (60 * 1000)
+// Reconnect backoff doubles from minimum to maximum (milliseconds)
+#define MQTT_BACKOFF_MIN_MS 1000
+#define MQTT_BACKOFF_MAX_MS (60 * 1000)
+// Publishes are held back, not queued, while the client outbox holds more than this (bytes)
+#define MQTT_OUTBOX_MAX 2048
+
+extern void setup_mqtt();
+extern void mqtt_loop();
+extern bool mqtt_connected();
+extern void mqtt_print_metrics(Print &out);
@@ -0,0 +1,192 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ * Contributions acknowledged from
+ * Thomas Hagan...     https://github.com/tlhagan
+ * Brandon Matthews... https://github.com/thenewwazoo
+ * Jonathan Stroud...  https://github.com/jgstroud
+ *
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+
+// ESP system includes
+#include <esp_timer.h>
+
+// Arduino includes
+#include "SoftwareSerial.h"
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "Packet.h"
+#include "Reader.h"
+
+/*
+ * Each way of talking to the door opener is a class behind this interface.
+ * setup_comms() constructs the one configured, in storage shared by all of
+ * them, and comms.cpp calls it from then on. Protocols not in use hold no
+ * state. A protocol can also be constructed on its own, e.g. in the native
+ * build, as long as only one runs at a time (they share the serial port).
+ */
+class GDOProtocol
+{
+public:
+    virtual ~GDOProtocol() {}
+
+    virtual void setup() = 0;
+    virtual void loop() = 0;
+    virtual void door_command(DoorAction action) = 0;
+    virtual void set_light(bool value) = 0;
+    virtual void set_lock(uint8_t value) = 0;
+    // Ask door opener for its current state, if protocol can
+    virtual void get_status() {}
+    // Save anything needed after a reboot
+    virtual void save() {}
+    // Forget the door opener, called by reset_door()
+    virtual void reset() {}
+};
+
+struct PacketAction
+{
+    Packet pkt;
+    bool inc_counter;
+    uint32_t delay;
+};
+
+// Packet queue is part of the protocol object, so statically allocated
+#define PKT_QUEUE_LENGTH 5
+#define MAX_COMMS_RETRY 10
+
+// Security+ 1.0 and 2.0 both send packets from a queue over the serial port
+class SecPlusProtocol : public GDOProtocol
+{
+public:
+    SecPlusProtocol();
+
+protected:
+    SoftwareSerial sw_serial;
+    QueueHandle_t pkt_q;
+    uint16_t retryCount = 0;
+
+    void queue(const PacketAction &pkt_ac, const char *what);
+    // Send now, false if bus was busy and packet should be retried
+    virtual bool transmit(PacketAction &pkt_ac) = 0;
+    bool process_PacketAction(PacketAction &pkt_ac);
+
+private:
+    StaticQueue_t pktQueueBuffer;
+    uint8_t pktQueueStorage[PKT_QUEUE_LENGTH * sizeof(PacketAction)];
+};
+
+class SecPlus1Protocol : public SecPlusProtocol
+{
+public:
+    void setup() override;
+    void loop() override;
+    void door_command(DoorAction action) override;
+    void set_light(bool value) override;
+    void set_lock(uint8_t value) override;
+
+private:
+    bool wallplateBooting = false;
+    bool wallPanelDetected = false;
+    uint8_t lightState = 2;
+    uint8_t lockState = 2;
+    unsigned long last_rx = 0;
+    unsigned long last_tx = 0;
+    unsigned long cmdDelay = 0;
+
+    // Receive
+    static const uint8_t RX_LENGTH = 2;
+    bool reading_msg = false;
+    uint16_t byte_count = 0;
+    uint8_t rx_packet[RX_LENGTH * 4];
+    // Last reported, door status must be seen twice in a row to be accepted
+    uint8_t prevDoor = 0;
+    GarageDoorCurrentState gd_currentstate = CURR_OPEN;
+    GarageDoorTargetState gd_TargetState = TGT_OPEN;
+    uint8_t lastLightState = 0xff;
+    uint8_t lastLockState = 0xff;
+
+    // Wall panel emulation
+    unsigned long lastRequestMillis = 0;
+    bool emulateWallPanel = false;
+    unsigned long serialDetected = 0;
+    uint8_t stateIndex = 0;
+
+    bool transmit(PacketAction &pkt_ac) override;
+    bool transmitSec1(uint8_t toSend);
+    void wallPlate_Emulation();
+    void receive(uint8_t key, uint8_t val);
+};
+
+class SecPlus2Protocol : public SecPlusProtocol
+{
+public:
+    void setup() override;
+    void loop() override;
+    void door_command(DoorAction action) override;
+    void set_light(bool value) override;
+    void set_lock(uint8_t value) override;
+    void get_status() override;
+    void save() override;
+    void reset() override;
+
+private:
+    SecPlus2Reader reader;
+    uint32_t id_code = 0;
+    uint32_t rolling_code = 0;
+    uint32_t last_saved_code = 0;
+
+    bool transmit(PacketAction &pkt_ac) override;
+    void receive(Packet &pkt);
+    void sync();
+    void get_openings();
+};
+
+class DryContactProtocol : public GDOProtocol
+{
+public:
+    void setup() override;
+    void loop() override;
+    void door_command(DoorAction action) override;
+    // Door opener has no light or lock we can control
+    void set_light(bool value) override {}
+    void set_lock(uint8_t value) override {}
+
+private:
+    // Toggle pulse is generated by a one-shot esp_timer so that door_command()
+    // returns immediately. After each pulse we hold off for a guard time, a
+    // request that arrives during a pulse or guard time is held and sent when
+    // the guard expires.
+    enum dcPulseState : uint8_t
+    {
+        DC_IDLE,
+        DC_PULSE,
+        DC_GUARD,
+    };
+    esp_timer_handle_t dcPulseTimer = NULL;
+    volatile dcPulseState dcState = DC_IDLE;
+    volatile bool dcPending = false;
+    uint32_t dcPulseMs = 500;
+    uint32_t dcPulseGapMs = 1000;
+    portMUX_TYPE dcMux = portMUX_INITIALIZER_UNLOCKED;
+    DoorState previousDoorState = DoorState::Unknown;
+
+    static void dc_pulse_timer(void *arg);
+    void dc_pulse_start();
+    void dc_pulse();
+};
+
+// Shared by all protocols, in comms.cpp
+extern bool status_done;
+extern void manual_recovery();
+extern void ttc_door_closing();
@@ -0,0 +1,165 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ * Contributions acknowledged from
+ * Thomas Hagan...     https://github.com/tlhagan
+ * Brandon Matthews... https://github.com/thenewwazoo
+ * Jonathan Stroud...  https://github.com/jgstroud
+ *
+ */
+
+// C/C++ language includes
+#include <algorithm>
+
+// ESP system includes
+#include <esp_timer.h>
+#include <driver/gpio.h>
+
+// Arduino includes
+// none
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "homekit.h"
+#include "utilities.h"
+#include "comms.h"
+#include "config.h"
+#include "protocol.h"
+
+static const char *TAG = "ratgdo-comms";
+
+void DryContactProtocol::setup()
+{
+    RINFO(TAG, "=== Setting up comms for dry contact protocol");
+    pinMode(UART_TX_PIN, OUTPUT);
+    digitalWrite(UART_TX_PIN, LOW);
+    const esp_timer_create_args_t timerArgs = {
+        .callback = dc_pulse_timer,
+        .arg = this,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "dcPulse",
+        .skip_unhandled_events = false,
+    };
+    if (!dcPulseTimer)
+    {
+        ESP_ERROR_CHECK(esp_timer_create(&timerArgs, &dcPulseTimer));
+    }
+}
+
+void DryContactProtocol::loop()
+{
+    // Notify HomeKit when the door state changes
+    if (doorState != previousDoorState)
+    {
+        switch (doorState)
+        {
+        case DoorState::Open:
+            garage_door.current_state = GarageDoorCurrentState::CURR_OPEN;
+            garage_door.target_state = GarageDoorTargetState::TGT_OPEN;
+            break;
+        case DoorState::Closed:
+            garage_door.current_state = GarageDoorCurrentState::CURR_CLOSED;
+            garage_door.target_state = GarageDoorTargetState::TGT_CLOSED;
+            break;
+        case DoorState::Opening:
+            garage_door.current_state = GarageDoorCurrentState::CURR_OPENING;
+            garage_door.target_state = GarageDoorTargetState::TGT_OPEN;
+            break;
+        case DoorState::Closing:
+            garage_door.current_state = GarageDoorCurrentState::CURR_CLOSING;
+            garage_door.target_state = GarageDoorTargetState::TGT_CLOSED;
+            break;
+        default:
+            garage_door.current_state = GarageDoorCurrentState::CURR_STOPPED;
+            break;
+        }
+
+        notify_homekit_current_door_state_change();
+        notify_homekit_target_door_state_change();
+
+        previousDoorState = doorState;
+
+        // Log the state change for debugging
+        RINFO(TAG, "Door state updated: Current: %d, Target: %d", garage_door.current_state, garage_door.target_state);
+    }
+}
+
+/****************************************************************************
+ * Dry contact pulse generator. Timer callback runs on the esp_timer task.
+ */
+void DryContactProtocol::dc_pulse_start()
+{
+    // must be called with dcMux held
+    dcState = DC_PULSE;
+    gpio_set_level((gpio_num_t)UART_TX_PIN, 1);
+    esp_timer_start_once(dcPulseTimer, (uint64_t)dcPulseMs * 1000);
+}
+
+void DryContactProtocol::dc_pulse_timer(void *arg)
+{
+    DryContactProtocol *dc = (DryContactProtocol *)arg;
+
+    portENTER_CRITICAL(&dc->dcMux);
+    if (dc->dcState == DC_PULSE)
+    {
+        gpio_set_level((gpio_num_t)UART_TX_PIN, 0);
+        dc->dcState = DC_GUARD;
+        esp_timer_start_once(dc->dcPulseTimer, (uint64_t)dc->dcPulseGapMs * 1000);
+    }
+    else if (dc->dcPending)
+    {
+        dc->dcPending = false;
+        dc->dc_pulse_start();
+    }
+    else
+    {
+        dc->dcState = DC_IDLE;
+    }
+    portEXIT_CRITICAL(&dc->dcMux);
+}
+
+void DryContactProtocol::dc_pulse()
+{
+    if (!dcPulseTimer)
+        return;
+
+    // read settings outside of the critical section, takes effect on next idle start
+    uint32_t pulseMs = std::min(std::max(userConfig->getDCPulseMs(), DC_PULSE_MIN_MS), DC_PULSE_MAX_MS);
+    uint32_t gapMs = std::max(userConfig->getDCPulseGapMs(), 0);
+    bool dropped = false;
+    bool held = false;
+    portENTER_CRITICAL(&dcMux);
+    if (dcState == DC_IDLE)
+    {
+        dcPulseMs = pulseMs;
+        dcPulseGapMs = gapMs;
+        dc_pulse_start();
+    }
+    else if (!dcPending)
+    {
+        dcPending = held = true;
+    }
+    else
+    {
+        dropped = true;
+    }
+    portEXIT_CRITICAL(&dcMux);
+
+    if (held)
+        RINFO(TAG, "Dry contact pulse in progress, next pulse held for guard time");
+    if (dropped)
+        RERROR(TAG, "Dry contact pulse already pending, dropping door command");
+}
+
+void DryContactProtocol::door_command(DoorAction action)
+{
+    // Dry contact commands (only toggle functionality, open/close/toggle/stop -> toggle)
+    // Toggle signal
+    dc_pulse();
+}
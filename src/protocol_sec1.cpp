@@ -0,0 +1,769 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ * Contributions acknowledged from
+ * Thomas Hagan...     https://github.com/tlhagan
+ * Brandon Matthews... https://github.com/thenewwazoo
+ * Jonathan Stroud...  https://github.com/jgstroud
+ *
+ */
+
+// C/C++ language includes
+// none
+
+// ESP system includes
+// none
+
+// Arduino includes
+// none
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "homekit.h"
+#include "utilities.h"
+#include "comms.h"
+#include "led.h"
+#include "protocol.h"
+
+static const char *TAG = "ratgdo-comms";
+
+// keep this here incase at somepoint its needed
+// it is used for emulation of wall panel
+// byte secplus1States[19] = {0x35,0x35,0x35,0x35,0x33,0x33,0x53,0x53,0x38,0x3A,0x3A,0x3A,0x39,0x38,0x3A, 0x38,0x3A,0x39,0x3A};
+// this is what MY 889LM exhibited when powered up (release of all buttons, and then polls)
+static const byte secplus1States[] = {0x35, 0x35, 0x33, 0x33, 0x38, 0x3A, 0x39};
+
+// values for SECURITY+1.0 communication
+enum secplus1Codes : uint8_t
+{
+    DoorButtonPress = 0x30,
+    DoorButtonRelease = 0x31,
+    LightButtonPress = 0x32,
+    LightButtonRelease = 0x33,
+    LockButtonPress = 0x34,
+    LockButtonRelease = 0x35,
+
+    Unkown_0x36 = 0x36,
+    Unknown_0x37 = 0x37,
+
+    DoorStatus = 0x38,
+    ObstructionStatus = 0x39, // this is not proven
+    LightLockStatus = 0x3A,
+    Unknown = 0xFF
+};
+
+void SecPlus1Protocol::setup()
+{
+    RINFO(TAG, "=== Setting up comms for Secuirty+1.0 protocol");
+
+    sw_serial.begin(1200, SWSERIAL_8E1, UART_RX_PIN, UART_TX_PIN, true);
+
+    wallPanelDetected = false;
+    wallplateBooting = false;
+    doorState = DoorState::Unknown;
+    lightState = 2;
+    lockState = 2;
+}
+
+void SecPlus1Protocol::wallPlate_Emulation()
+{
+
+    if (wallPanelDetected)
+        return;
+
+    unsigned long currentMillis = millis();
+
+    if (!serialDetected)
+    {
+        if (sw_serial.available())
+        {
+            serialDetected = currentMillis;
+        }
+
+        return;
+    }
+
+    // wait up to 15 seconds to look for an existing wallplate or it could be booting, so need to wait
+    if (currentMillis - serialDetected < 15000 || wallplateBooting == true)
+    {
+        if (currentMillis - lastRequestMillis > 1000)
+        {
+            RINFO(TAG, "Looking for security+ 1.0 DIGITAL wall panel...");
+            lastRequestMillis = currentMillis;
+        }
+
+        if (!wallPanelDetected && (doorState != DoorState::Unknown || lightState != 2))
+        {
+            wallPanelDetected = true;
+            wallplateBooting = false;
+            RINFO(TAG, "DIGITAL Wall panel detected.");
+            return;
+        }
+    }
+    else
+    {
+        if (!emulateWallPanel && !wallPanelDetected)
+        {
+            emulateWallPanel = true;
+            RINFO(TAG, "No DIGITAL wall panel detected. Switching to emulation mode.");
+        }
+
+        // transmit every 250ms
+        if (emulateWallPanel && (currentMillis - lastRequestMillis) > 250)
+        {
+            lastRequestMillis = currentMillis;
+
+            byte secplus1ToSend = byte(secplus1States[stateIndex]);
+
+            // send through queue
+            PacketData data;
+            data.type = PacketDataType::Status;
+            data.value.cmd = secplus1ToSend;
+            Packet pkt = Packet(PacketCommand::GetStatus, data, 0);
+            PacketAction pkt_ac = {pkt, true, 20}; // 20ms delay for SECURITY1.0 (which is minimum delay)
+            queue(pkt_ac, "poll");
+
+            // send direct
+            // transmitSec1(secplus1ToSend);
+
+            stateIndex++;
+            if (stateIndex == sizeof(secplus1States))
+            {
+                stateIndex = sizeof(secplus1States) - 3;
+            }
+        }
+    }
+}
+
+void SecPlus1Protocol::loop()
+{
+    bool gotMessage = false;
+
+    if (sw_serial.available())
+    {
+        uint8_t ser_byte = sw_serial.read();
+        last_rx = millis();
+
+        if (!reading_msg)
+        {
+            // valid?
+            if (ser_byte >= 0x30 && ser_byte <= 0x3A)
+            {
+                byte_count = 0;
+                rx_packet[byte_count++] = ser_byte;
+                reading_msg = true;
+            }
+            // is it single byte command?
+            // really all commands are single byte
+            // is it a button push or release? (FROM WALL PANEL)
+            if (ser_byte >= 0x30 && ser_byte <= 0x37)
+            {
+                rx_packet[1] = 0;
+                reading_msg = false;
+                byte_count = 0;
+
+                gotMessage = true;
+            }
+        }
+        else
+        {
+            // save next byte
+            rx_packet[byte_count++] = ser_byte;
+
+            if (byte_count == RX_LENGTH)
+            {
+                reading_msg = false;
+                byte_count = 0;
+
+                gotMessage = true;
+            }
+
+            if (gotMessage == false && (millis() - last_rx) > 100)
+            {
+                RINFO(TAG, "RX message timeout");
+                // if we have a partial packet and it's been over 100ms since last byte was read,
+                // the rest is not coming (a full packet should be received in ~20ms),
+                // discard it so we can read the following packet correctly
+                reading_msg = false;
+                byte_count = 0;
+            }
+        }
+    }
+
+    // got data?
+    if (gotMessage)
+    {
+        // button press/release have no val, just a single byte
+        receive(rx_packet[0], rx_packet[1]);
+    }
+
+    //
+    // PROCESS TRANSMIT QUEUE
+    //
+    PacketAction pkt_ac;
+    unsigned long now;
+    bool okToSend = false;
+
+    if (uxQueueMessagesWaiting(pkt_q) > 0)
+    {
+        now = millis();
+
+        // if there is no wall panel, no need to check 200ms since last rx
+        // (yes some duped code here, but its clearer)
+        if (!wallPanelDetected)
+        {
+            // no wall panel
+            okToSend = (now - last_rx > 20);        // after 20ms since last rx
+            okToSend &= (now - last_tx > 20);       // after 20ms since last tx
+            okToSend &= (now - last_tx > cmdDelay); // after any command delays
+        }
+        else
+        {
+            // digitial wall pnael
+            okToSend = (now - last_rx > 20);        // after 20ms since last rx
+            okToSend &= (now - last_rx < 200);      // before 200ms since last rx
+            okToSend &= (now - last_tx > 20);       // after 20ms since last tx
+            okToSend &= (now - last_tx > cmdDelay); // after any command delays
+        }
+
+        // OK to send based on above rules
+        if (okToSend)
+        {
+
+            if (uxQueueMessagesWaiting(pkt_q) > 0)
+            {
+                ESP_LOGD(TAG, "packet ready for tx");
+                xQueueReceive(pkt_q, &pkt_ac, 0); // ignore errors
+                if (process_PacketAction(pkt_ac))
+                {
+                    // get next delay "between" transmits
+                    cmdDelay = pkt_ac.delay;
+                }
+                else
+                {
+                    cmdDelay = 0;
+                    if (retryCount++ < MAX_COMMS_RETRY)
+                    {
+                        RERROR(TAG, "transmit failed, will retry");
+                        xQueueSendToFront(pkt_q, &pkt_ac, 0); // ignore errors
+                    }
+                    else
+                    {
+                        RERROR(TAG, "transmit failed, exceeded max retry, aborting");
+                        led.play(LED_ERROR);
+                        retryCount = 0;
+                    }
+                }
+            }
+        }
+    }
+
+    // check for wall panel and provide emulator
+    wallPlate_Emulation();
+}
+
+void SecPlus1Protocol::receive(uint8_t key, uint8_t val)
+{
+    if (key == secplus1Codes::DoorButtonPress)
+    {
+        RINFO(TAG, "0x30 RX (door press)");
+        manual_recovery();
+        if (motionTriggers.bit.doorKey)
+        {
+            garage_door.motion_timer = millis() + MOTION_TIMER_DURATION;
+            garage_door.motion = true;
+            notify_homekit_motion();
+        }
+    }
+    // wall panel is sending out 0x31 (Door Button Release) when it starts up
+    // but also on release of door button
+    else if (key == secplus1Codes::DoorButtonRelease)
+    {
+        RINFO(TAG, "0x31 RX (door release)");
+
+        // Possible power up of 889LM
+        if ((DoorState)doorState == DoorState::Unknown)
+        {
+            wallplateBooting = true;
+        }
+    }
+    else if (key == secplus1Codes::LightButtonPress)
+    {
+        RINFO(TAG, "0x32 RX (light press)");
+        manual_recovery();
+    }
+    else if (key == secplus1Codes::LightButtonRelease)
+    {
+        RINFO(TAG, "0x33 RX (light release)");
+    }
+
+    // 2 byte status messages (0x38 - 0x3A)
+    // its the byte sent out by the wallplate + the byte transmitted by the opener
+    if (key == secplus1Codes::DoorStatus || key == secplus1Codes::ObstructionStatus || key == secplus1Codes::LightLockStatus)
+    {
+
+        // RINFO(TAG, "SEC1 STATUS MSG: %X%02X",key,val);
+
+        switch (key)
+        {
+        // door status
+        case secplus1Codes::DoorStatus:
+
+            // RINFO(TAG, "0x38 MSG: %02X",val);
+
+            // 0x5X = stopped
+            // 0x0X = moving
+            // best attempt to trap invalid values (due to collisions)
+            if (((val & 0xF0) != 0x00) && ((val & 0xF0) != 0x50) && ((val & 0xF0) != 0xB0))
+            {
+                RINFO(TAG, "0x38 val upper nible not 0x0 or 0x5 or 0xB: %02X", val);
+                break;
+            }
+
+            val = (val & 0x7);
+            // 000 0x0 stopped
+            // 001 0x1 opening
+            // 010 0x2 open
+            // 100 0x4 closing
+            // 101 0x5 closed
+            // 110 0x6 stopped
+
+            // sec+1 doors sometimes report wrong door status
+            // require two sequential matching door states
+            // I have not seen this to be the case on my unit (MJS)
+            if (prevDoor != val)
+            {
+                prevDoor = val;
+                break;
+            }
+
+            switch (val)
+            {
+            case 0x00:
+                doorState = DoorState::Stopped;
+                break;
+            case 0x01:
+                doorState = DoorState::Opening;
+                break;
+            case 0x02:
+                doorState = DoorState::Open;
+                break;
+            // no 0x03 known
+            case 0x04:
+                doorState = DoorState::Closing;
+                break;
+            case 0x05:
+                doorState = DoorState::Closed;
+                break;
+            case 0x06:
+                doorState = DoorState::Stopped;
+                break;
+            default:
+                doorState = DoorState::Unknown;
+                break;
+            }
+
+            // RINFO(TAG, "doorstate: %d", doorState);
+
+            switch (doorState)
+            {
+            case DoorState::Open:
+                garage_door.current_state = CURR_OPEN;
+                garage_door.target_state = TGT_OPEN;
+                break;
+            case DoorState::Closed:
+                garage_door.current_state = CURR_CLOSED;
+                garage_door.target_state = TGT_CLOSED;
+                break;
+            case DoorState::Stopped:
+                garage_door.current_state = CURR_STOPPED;
+                garage_door.target_state = TGT_OPEN;
+                break;
+            case DoorState::Opening:
+                garage_door.current_state = CURR_OPENING;
+                garage_door.target_state = TGT_OPEN;
+                break;
+            case DoorState::Closing:
+                garage_door.current_state = CURR_CLOSING;
+                garage_door.target_state = TGT_CLOSED;
+                break;
+            case DoorState::Unknown:
+                RERROR(TAG, "Got door state unknown");
+                break;
+            }
+
+            if (garage_door.current_state == CURR_CLOSING)
+                ttc_door_closing();
+
+            if (!garage_door.active)
+            {
+                RINFO(TAG, "activating door");
+                garage_door.active = true;
+                if (garage_door.current_state == CURR_OPENING || garage_door.current_state == CURR_OPEN)
+                {
+                    garage_door.target_state = TGT_OPEN;
+                }
+                else
+                {
+                    garage_door.target_state = TGT_CLOSED;
+                }
+            }
+
+            if (garage_door.current_state != gd_currentstate)
+            {
+                gd_currentstate = garage_door.current_state;
+
+                const char *l = "unknown door state";
+                switch (gd_currentstate)
+                {
+                case GarageDoorCurrentState::CURR_STOPPED:
+                    l = "Stopped";
+                    break;
+                case GarageDoorCurrentState::CURR_OPEN:
+                    l = "Open";
+                    break;
+                case GarageDoorCurrentState::CURR_OPENING:
+                    l = "Opening";
+                    break;
+                case GarageDoorCurrentState::CURR_CLOSED:
+                    l = "Closed";
+                    break;
+                case GarageDoorCurrentState::CURR_CLOSING:
+                    l = "Closing";
+                    break;
+                }
+                RINFO(TAG, "status DOOR: %s", l);
+
+                notify_homekit_current_door_state_change();
+            }
+
+            if (garage_door.target_state != gd_TargetState)
+            {
+                gd_TargetState = garage_door.target_state;
+                notify_homekit_target_door_state_change();
+            }
+
+            break;
+
+        // objstruction states (not confirmed)
+        case secplus1Codes::ObstructionStatus:
+            // currently not using
+            break;
+
+        // light & lock
+        case secplus1Codes::LightLockStatus:
+
+            // RINFO(TAG, "0x3A MSG: %X%02X",key,val);
+
+            // upper nibble must be 5
+            if ((val & 0xF0) != 0x50)
+            {
+                RINFO(TAG, "0x3A val upper nible not 5: %02X", val);
+                break;
+            }
+
+            lightState = bitRead(val, 2);
+            lockState = !bitRead(val, 3);
+
+            // light state change?
+            if (lightState != lastLightState)
+            {
+                RINFO(TAG, "status LIGHT: %s", lightState ? "On" : "Off");
+                lastLightState = lightState;
+
+                garage_door.light = (bool)lightState;
+                notify_homekit_light();
+                if (motionTriggers.bit.lightKey)
+                {
+                    garage_door.motion_timer = millis() + MOTION_TIMER_DURATION;
+                    garage_door.motion = true;
+                    notify_homekit_motion();
+                }
+            }
+
+            // lock state change?
+            if (lockState != lastLockState)
+            {
+                RINFO(TAG, "status LOCK: %s", lockState ? "Secured" : "Unsecured");
+                lastLockState = lockState;
+
+                if (lockState)
+                {
+                    garage_door.current_lock = CURR_LOCKED;
+                    garage_door.target_lock = TGT_LOCKED;
+                }
+                else
+                {
+                    garage_door.current_lock = CURR_UNLOCKED;
+                    garage_door.target_lock = TGT_UNLOCKED;
+                }
+                notify_homekit_target_lock();
+                notify_homekit_current_lock();
+                if (motionTriggers.bit.lockKey)
+                {
+                    garage_door.motion_timer = millis() + MOTION_TIMER_DURATION;
+                    garage_door.motion = true;
+                    notify_homekit_motion();
+                }
+            }
+
+            break;
+        }
+    }
+}
+
+bool SecPlus1Protocol::transmitSec1(uint8_t toSend)
+{
+
+    // safety
+    if (digitalRead(UART_RX_PIN) || sw_serial.available())
+    {
+        return false;
+    }
+
+    // sending a poll?
+    bool poll_cmd = (toSend == 0x38) || (toSend == 0x39) || (toSend == 0x3A);
+    // if not a poll command (and polls only with wall planel emulation),
+    // disable disable rx (allows for cleaner tx, and no echo)
+    if (!poll_cmd)
+    {
+        sw_serial.enableRx(false);
+    }
+
+    sw_serial.write(toSend);
+    last_tx = millis();
+
+    // RINFO(TAG, "SEC1 SEND BYTE: %02X",toSend);
+
+    // re-enable rx
+    if (!poll_cmd)
+    {
+        sw_serial.enableRx(true);
+    }
+
+    return true;
+}
+
+bool SecPlus1Protocol::transmit(PacketAction &pkt_ac)
+{
+    bool success = false;
+
+    // check which action
+    switch (pkt_ac.pkt.m_data.type)
+    {
+    // using this type for emaulation of wall panel
+    case PacketDataType::Status:
+    {
+        // 0x38 || 0x39 || 0x3A
+        if (pkt_ac.pkt.m_data.value.cmd)
+        {
+            success = transmitSec1(pkt_ac.pkt.m_data.value.cmd);
+            if (success)
+            {
+                last_tx = millis();
+                // RINFO(TAG, "sending 0x%02X query", pkt_ac.pkt.m_data.value.cmd);
+            }
+        }
+        break;
+    }
+    case PacketDataType::DoorAction:
+    {
+        if (pkt_ac.pkt.m_data.value.door_action.pressed == true)
+        {
+            success = transmitSec1(secplus1Codes::DoorButtonPress);
+            if (success)
+            {
+                last_tx = millis();
+                RINFO(TAG, "sending DOOR button press");
+            }
+        }
+        else
+        {
+            success = transmitSec1(secplus1Codes::DoorButtonRelease);
+            if (success)
+            {
+                last_tx = millis();
+                RINFO(TAG, "sending DOOR button release");
+            }
+        }
+
+        break;
+    }
+
+    case PacketDataType::Light:
+    {
+        if (pkt_ac.pkt.m_data.value.light.pressed == true)
+        {
+            success = transmitSec1(secplus1Codes::LightButtonPress);
+            if (success)
+            {
+                last_tx = millis();
+                RINFO(TAG, "sending LIGHT button press");
+            }
+        }
+        else
+        {
+            success = transmitSec1(secplus1Codes::LightButtonRelease);
+            if (success)
+            {
+                last_tx = millis();
+                RINFO(TAG, "Sending LIGHT button release");
+            }
+        }
+
+        break;
+    }
+
+    case PacketDataType::Lock:
+    {
+        if (pkt_ac.pkt.m_data.value.lock.pressed == true)
+        {
+            success = transmitSec1(secplus1Codes::LockButtonPress);
+            if (success)
+            {
+                last_tx = millis();
+                RINFO(TAG, "sending LOCK button press");
+            }
+        }
+        else
+        {
+            success = transmitSec1(secplus1Codes::LockButtonRelease);
+            if (success)
+            {
+                last_tx = millis();
+                RINFO(TAG, "sending LOCK button release");
+            }
+        }
+
+        break;
+    }
+
+    default:
+    {
+        RINFO(TAG, "pkt_ac.pkt.m_data.type=%d", pkt_ac.pkt.m_data.type);
+
+        break;
+    }
+    }
+
+    return success;
+}
+
+void SecPlus1Protocol::door_command(DoorAction action)
+{
+    PacketData data;
+    data.type = PacketDataType::DoorAction;
+    data.value.door_action.action = action;
+    data.value.door_action.pressed = true;
+    data.value.door_action.id = 1;
+
+    Packet pkt = Packet(PacketCommand::DoorAction, data, 0);
+    PacketAction pkt_ac = {pkt, false, 250}; // 250ms delay for SECURITY1.0
+    queue(pkt_ac, "door command pressed");
+
+    // do button release
+    pkt_ac.pkt.m_data.value.door_action.pressed = false;
+    pkt_ac.inc_counter = true;
+    pkt_ac.delay = 40; // 40ms delay for SECURITY1.0
+    queue(pkt_ac, "door command release");
+    // when observing wall panel 2 releases happen, so we do the same
+    queue(pkt_ac, "door command release");
+}
+
+void SecPlus1Protocol::set_lock(uint8_t value)
+{
+    PacketData data;
+    data.type = PacketDataType::Lock;
+    if (value)
+    {
+        data.value.lock.lock = LockState::On;
+        garage_door.target_lock = TGT_LOCKED;
+    }
+    else
+    {
+        data.value.lock.lock = LockState::Off;
+        garage_door.target_lock = TGT_UNLOCKED;
+    }
+
+    // safety, Sec+1.0 is a toggle...
+    if (data.value.lock.lock == LockState::On && door_state.read().current_lock == LockCurrentState::CURR_LOCKED)
+    {
+        RINFO(TAG, "Lock already Locked");
+        return;
+    }
+    if (data.value.lock.lock == LockState::Off && door_state.read().current_lock == LockCurrentState::CURR_UNLOCKED)
+    {
+        RINFO(TAG, "Lock already Unlocked");
+        return;
+    }
+
+    // this emulates the "look" button press+release
+    // - PRESS (0x34)
+    // - DELAY 3000ms
+    // - RELEASE (0x35)
+    // - DELAY 40ms
+    // - RELEASE (0x35)
+    // - DELAY 40ms
+
+    data.value.lock.pressed = true;
+    Packet pkt = Packet(PacketCommand::Lock, data, 0);
+    PacketAction pkt_ac = {pkt, true, 3000}; // 3000ms delay for SECURITY1.0
+    queue(pkt_ac, "lock");
+    // button release
+    pkt_ac.pkt.m_data.value.lock.pressed = false;
+    pkt_ac.delay = 40; // 40ms delay for SECURITY1.0
+                       // observed the wall plate does 2 releases, so we will too
+    queue(pkt_ac, "lock");
+    queue(pkt_ac, "lock");
+}
+
+void SecPlus1Protocol::set_light(bool value)
+{
+    PacketData data;
+    data.type = PacketDataType::Light;
+    if (value)
+    {
+        data.value.light.light = LightState::On;
+    }
+    else
+    {
+        data.value.light.light = LightState::Off;
+    }
+
+    // safety, Sec+1.0 is a toggle...
+    if (data.value.light.light == LightState::On && door_state.read().light == true)
+    {
+        RINFO(TAG, "Light already On");
+        return;
+    }
+    if (data.value.light.light == LightState::Off && door_state.read().light == false)
+    {
+        RINFO(TAG, "Light already Off");
+        return;
+    }
+
+    // this emulates the "light" button press+release
+    // - PRESS (0x32)
+    // - DELAY 250ms
+    // - RELEASE (0x33)
+    // - DELAY 40ms
+    // - RELEASE (0x33)
+    // - DELAY 40ms
+    data.value.light.pressed = true;
+
+    Packet pkt = Packet(PacketCommand::Light, data, 0);
+    PacketAction pkt_ac = {pkt, true, 250}; // 250ms delay for SECURITY1.0
+    queue(pkt_ac, "light");
+    // button release
+    pkt_ac.pkt.m_data.value.light.pressed = false;
+    pkt_ac.delay = 40; // 40ms delay for SECURITY1.0
+                       // observed the wall plate does 2 releases, so we will too
+    queue(pkt_ac, "light");
+    queue(pkt_ac, "light");
+}
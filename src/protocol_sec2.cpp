@@ -0,0 +1,501 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ * Contributions acknowledged from
+ * Thomas Hagan...     https://github.com/tlhagan
+ * Brandon Matthews... https://github.com/thenewwazoo
+ * Jonathan Stroud...  https://github.com/jgstroud
+ *
+ */
+
+// C/C++ language includes
+// none
+
+// ESP system includes
+// none
+
+// Arduino includes
+// none
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "secplus2.h"
+#include "homekit.h"
+#include "utilities.h"
+#include "comms.h"
+#include "config.h"
+#include "led.h"
+#include "protocol.h"
+
+static const char *TAG = "ratgdo-comms";
+
+#define MAX_CODES_WITHOUT_FLASH_WRITE 10
+
+void SecPlus2Protocol::setup()
+{
+    RINFO(TAG, "=== Setting up comms for Secuirty+2.0 protocol");
+
+    sw_serial.begin(9600, SWSERIAL_8N1, UART_RX_PIN, UART_TX_PIN, true);
+    sw_serial.enableIntTx(false);
+    sw_serial.enableAutoBaud(true); // found in ratgdo/espsoftwareserial branch autobaud
+
+    // read from flash, default of 0 if file not exist
+    id_code = nvRam->read(nvram_id_code);
+    if (!id_code)
+    {
+        RINFO(TAG, "id code not found");
+        id_code = (random(0x1, 0xFFF) << 12) | 0x539;
+        nvRam->write(nvram_id_code, id_code);
+    }
+    RINFO(TAG, "id code %lu (0x%02lX)", id_code, id_code);
+
+    // read from flash, default of 0 if file not exist
+    rolling_code = nvRam->read(nvram_rolling, 0);
+    // last saved rolling code may be behind what the GDO thinks, so bump it up so that it will
+    // always be ahead of what the GDO thinks it should be, and save it.
+    rolling_code = (rolling_code != 0) ? rolling_code + MAX_CODES_WITHOUT_FLASH_WRITE : 0;
+    save();
+    RINFO(TAG, "rolling code %lu (0x%02X)", rolling_code, rolling_code);
+    sync();
+
+    // Get the initial state of the door
+    if (!digitalRead(UART_RX_PIN))
+    {
+        get_status();
+    }
+}
+
+void SecPlus2Protocol::save()
+{
+    nvRam->write(nvram_rolling, rolling_code);
+    last_saved_code = rolling_code;
+}
+
+void SecPlus2Protocol::reset()
+{
+    rolling_code = 0; // because sync_and_reboot writes this.
+}
+
+void SecPlus2Protocol::loop()
+{
+    // no incoming data, check if we have command queued
+    if (!sw_serial.available())
+    {
+        PacketAction pkt_ac;
+
+        if (uxQueueMessagesWaiting(pkt_q) > 0)
+        {
+            ESP_LOGD(TAG, "packet ready for tx");
+            xQueueReceive(pkt_q, &pkt_ac, 0); // ignore errors
+            if (!process_PacketAction(pkt_ac))
+            {
+
+                if (retryCount++ < MAX_COMMS_RETRY)
+                {
+                    RERROR(TAG, "transmit failed, will retry");
+                    xQueueSendToFront(pkt_q, &pkt_ac, 0); // ignore errors
+                }
+                else
+                {
+                    RERROR(TAG, "transmit failed, exceeded max retry, aborting");
+                    led.play(LED_ERROR);
+                    retryCount = 0;
+                }
+            }
+        }
+    }
+    else
+    {
+        // spin on receiving data until the whole packet has arrived
+        uint8_t ser_data = sw_serial.read();
+        if (reader.push_byte(ser_data))
+        {
+            Packet pkt = Packet(reader.fetch_buf());
+            pkt.print();
+            receive(pkt);
+        }
+    }
+
+    // Save rolling code if we have exceeded max limit.
+    if (rolling_code >= (last_saved_code + MAX_CODES_WITHOUT_FLASH_WRITE))
+    {
+        save();
+    }
+}
+
+void SecPlus2Protocol::receive(Packet &pkt)
+{
+    switch (pkt.m_pkt_cmd)
+    {
+    case PacketCommand::Status:
+    {
+        GarageDoorCurrentState current_state = garage_door.current_state;
+        GarageDoorTargetState target_state = garage_door.target_state;
+        switch (pkt.m_data.value.status.door)
+        {
+        case DoorState::Open:
+            current_state = CURR_OPEN;
+            target_state = TGT_OPEN;
+            break;
+        case DoorState::Closed:
+            current_state = CURR_CLOSED;
+            target_state = TGT_CLOSED;
+            break;
+        case DoorState::Stopped:
+            current_state = CURR_STOPPED;
+            target_state = TGT_OPEN;
+            break;
+        case DoorState::Opening:
+            current_state = CURR_OPENING;
+            target_state = TGT_OPEN;
+            break;
+        case DoorState::Closing:
+            current_state = CURR_CLOSING;
+            target_state = TGT_CLOSED;
+            break;
+        case DoorState::Unknown:
+            RERROR(TAG, "Got door state unknown");
+            break;
+        }
+
+        if (current_state == CURR_CLOSING)
+            ttc_door_closing();
+
+        if (!garage_door.active)
+        {
+            RINFO(TAG, "activating door");
+            garage_door.active = true;
+            if (current_state == CURR_OPENING || current_state == CURR_OPEN)
+            {
+                target_state = TGT_OPEN;
+            }
+            else
+            {
+                target_state = TGT_CLOSED;
+            }
+        }
+
+        RINFO(TAG, "tgt %d curr %d", target_state, current_state);
+
+        if ((target_state != garage_door.target_state) ||
+            (current_state != garage_door.current_state))
+        {
+            if ((current_state == CURR_CLOSED) && (garage_door.current_state != CURR_CLOSED))
+            {
+                // Opener count goes up once per cycle, refresh it
+                get_openings();
+            }
+            garage_door.target_state = target_state;
+            garage_door.current_state = current_state;
+
+            notify_homekit_current_door_state_change();
+            notify_homekit_target_door_state_change();
+        }
+
+        if (pkt.m_data.value.status.light != garage_door.light)
+        {
+            RINFO(TAG, "Light Status %s", pkt.m_data.value.status.light ? "On" : "Off");
+            garage_door.light = pkt.m_data.value.status.light;
+            notify_homekit_light();
+        }
+
+        LockCurrentState current_lock;
+        LockTargetState target_lock;
+        if (pkt.m_data.value.status.lock)
+        {
+            current_lock = CURR_LOCKED;
+            target_lock = TGT_LOCKED;
+        }
+        else
+        {
+            current_lock = CURR_UNLOCKED;
+            target_lock = TGT_UNLOCKED;
+        }
+        if (current_lock != garage_door.current_lock)
+        {
+            garage_door.target_lock = target_lock;
+            garage_door.current_lock = current_lock;
+            notify_homekit_target_lock();
+            notify_homekit_current_lock();
+        }
+
+        status_done = true;
+        break;
+    }
+
+    case PacketCommand::Lock:
+    {
+        LockTargetState lock = garage_door.target_lock;
+        switch (pkt.m_data.value.lock.lock)
+        {
+        case LockState::Off:
+            lock = TGT_UNLOCKED;
+            break;
+        case LockState::On:
+            lock = TGT_LOCKED;
+            break;
+        case LockState::Toggle:
+            if (lock == TGT_LOCKED)
+            {
+                lock = TGT_UNLOCKED;
+            }
+            else
+            {
+                lock = TGT_LOCKED;
+            }
+            break;
+        }
+        if (lock != garage_door.target_lock)
+        {
+            RINFO(TAG, "Lock Cmd %d", lock);
+            garage_door.target_lock = lock;
+            notify_homekit_target_lock();
+            if (motionTriggers.bit.lockKey)
+            {
+                garage_door.motion_timer = millis() + MOTION_TIMER_DURATION;
+                garage_door.motion = true;
+                notify_homekit_motion();
+            }
+        }
+        // Send a get status to make sure we are in sync
+        get_status();
+        break;
+    }
+
+    case PacketCommand::Light:
+    {
+        bool l = garage_door.light;
+        if (pkt.m_data.value.light.light == LightState::Toggle ||
+            pkt.m_data.value.light.light == LightState::Toggle2)
+        {
+            manual_recovery();
+        }
+        switch (pkt.m_data.value.light.light)
+        {
+        case LightState::Off:
+            l = false;
+            break;
+        case LightState::On:
+            l = true;
+            break;
+        case LightState::Toggle:
+        case LightState::Toggle2:
+            l = !garage_door.light;
+            break;
+        }
+        if (l != garage_door.light)
+        {
+            RINFO(TAG, "Light Cmd %s", l ? "On" : "Off");
+            garage_door.light = l;
+            notify_homekit_light();
+            if (motionTriggers.bit.lightKey)
+            {
+                garage_door.motion_timer = millis() + MOTION_TIMER_DURATION;
+                garage_door.motion = true;
+                notify_homekit_motion();
+            }
+        }
+        // Send a get status to make sure we are in sync
+        // Should really only need to do this on a toggle,
+        // But safer to do it always
+        get_status();
+        break;
+    }
+
+    case PacketCommand::Motion:
+    {
+        RINFO(TAG, "Motion Detected");
+        // We got a motion message, so we know we have a motion sensor
+        // If it's not yet enabled, add the service
+        if (!garage_door.has_motion_sensor)
+        {
+            RINFO(TAG, "Detected new Motion Sensor. Enabling Service");
+            garage_door.has_motion_sensor = true;
+            motionTriggers.bit.motion = 1;
+            userConfig->set(cfg_motionTriggers, motionTriggers.asInt);
+            enable_service_homekit_motion();
+        }
+
+        /* When we get the motion detect message, notify HomeKit. Motion sensor
+            will continue to send motion messages every 5s until motion stops.
+            set a timer for 5 seconds to disable motion after the last message */
+        garage_door.motion_timer = millis() + MOTION_TIMER_DURATION;
+        if (!garage_door.motion)
+        {
+            garage_door.motion = true;
+            notify_homekit_motion();
+        }
+        // Update status because things like light may have changed states
+        get_status();
+        break;
+    }
+
+    case PacketCommand::Openings:
+    {
+        openingsCount = pkt.m_data.value.openings.count;
+        RINFO(TAG, "Opener reports %ld openings", openingsCount);
+        break;
+    }
+
+    case PacketCommand::DoorAction:
+    {
+        RINFO(TAG, "Door Action");
+        if (pkt.m_data.value.door_action.pressed &&
+            pkt.m_data.value.door_action.action == DoorAction::Toggle)
+        {
+            manual_recovery();
+        }
+        if (pkt.m_data.value.door_action.pressed && motionTriggers.bit.doorKey)
+        {
+            garage_door.motion_timer = millis() + MOTION_TIMER_DURATION;
+            garage_door.motion = true;
+            notify_homekit_motion();
+        }
+        break;
+    }
+
+    default:
+        RINFO(TAG, "Support for %s packet unimplemented. Ignoring.", PacketCommand::to_string(pkt.m_pkt_cmd));
+        break;
+    }
+}
+
+bool SecPlus2Protocol::transmit(PacketAction &pkt_ac)
+{
+    // inverted logic, so this pulls the bus low to assert it
+    digitalWrite(UART_TX_PIN, HIGH);
+    delayMicroseconds(1300);
+    digitalWrite(UART_TX_PIN, LOW);
+    delayMicroseconds(130);
+
+    // check to see if anyone else is continuing to assert the bus after we have released it
+    if (digitalRead(UART_RX_PIN))
+    {
+        RINFO(TAG, "Collision detected, waiting to send packet");
+        return false;
+    }
+    else
+    {
+        uint8_t buf[SECPLUS2_CODE_LEN];
+        if (pkt_ac.pkt.encode(rolling_code, buf) != 0)
+        {
+            RERROR(TAG, "Could not encode packet");
+            pkt_ac.pkt.print();
+        }
+        else
+        {
+            sw_serial.write(buf, SECPLUS2_CODE_LEN);
+            delayMicroseconds(100);
+        }
+
+        if (pkt_ac.inc_counter)
+        {
+            rolling_code = (rolling_code + 1) & 0xfffffff;
+        }
+    }
+
+    return true;
+}
+
+void SecPlus2Protocol::sync()
+{
+    // only for SECURITY2.0
+    // for exposition about this process, see docs/syncing.md
+    RINFO(TAG, "Syncing rolling code counter after reboot...");
+    PacketData d;
+    d.type = PacketDataType::NoData;
+    d.value.no_data = NoData();
+    Packet pkt = Packet(PacketCommand::GetOpenings, d, id_code);
+    PacketAction pkt_ac = {pkt, true};
+    process_PacketAction(pkt_ac);
+    delay(100);
+    pkt = Packet(PacketCommand::GetStatus, d, id_code);
+    pkt_ac.pkt = pkt;
+    process_PacketAction(pkt_ac);
+}
+
+void SecPlus2Protocol::door_command(DoorAction action)
+{
+    PacketData data;
+    data.type = PacketDataType::DoorAction;
+    data.value.door_action.action = action;
+    data.value.door_action.pressed = true;
+    data.value.door_action.id = 1;
+
+    Packet pkt = Packet(PacketCommand::DoorAction, data, id_code);
+    PacketAction pkt_ac = {pkt, false};
+    queue(pkt_ac, "door command pressed");
+
+    // do button release
+    pkt_ac.pkt.m_data.value.door_action.pressed = false;
+    pkt_ac.inc_counter = true;
+    queue(pkt_ac, "door command release");
+
+    get_status();
+}
+
+void SecPlus2Protocol::get_status()
+{
+    PacketData d;
+    d.type = PacketDataType::NoData;
+    d.value.no_data = NoData();
+    Packet pkt = Packet(PacketCommand::GetStatus, d, id_code);
+    PacketAction pkt_ac = {pkt, true};
+    queue(pkt_ac, "get status");
+}
+
+void SecPlus2Protocol::get_openings()
+{
+    PacketData d;
+    d.type = PacketDataType::NoData;
+    d.value.no_data = NoData();
+    Packet pkt = Packet(PacketCommand::GetOpenings, d, id_code);
+    PacketAction pkt_ac = {pkt, true};
+    queue(pkt_ac, "get openings");
+}
+
+void SecPlus2Protocol::set_lock(uint8_t value)
+{
+    PacketData data;
+    data.type = PacketDataType::Lock;
+    if (value)
+    {
+        data.value.lock.lock = LockState::On;
+        garage_door.target_lock = TGT_LOCKED;
+    }
+    else
+    {
+        data.value.lock.lock = LockState::Off;
+        garage_door.target_lock = TGT_UNLOCKED;
+    }
+
+    Packet pkt = Packet(PacketCommand::Lock, data, id_code);
+    PacketAction pkt_ac = {pkt, true};
+    queue(pkt_ac, "lock");
+    get_status();
+}
+
+void SecPlus2Protocol::set_light(bool value)
+{
+    PacketData data;
+    data.type = PacketDataType::Light;
+    if (value)
+    {
+        data.value.light.light = LightState::On;
+    }
+    else
+    {
+        data.value.light.light = LightState::Off;
+    }
+
+    Packet pkt = Packet(PacketCommand::Light, data, id_code);
+    PacketAction pkt_ac = {pkt, true};
+    queue(pkt_ac, "light");
+    get_status();
+}
@@ -18,15 +18,14 @@
 // Arduino includes
 // none
 
-// 3rd party includes
-#include <improv.h>
-
 // RATGDO project includes
 #include "ratgdo.h"
+#include "Improv.h"
 #include "provision.h"
 #include "softAP.h"
 #include "config.h"
 #include "utilities.h"
+#include "console.h"
 
 // Logger tag
 static const char *TAG = "ratgdo-improv";
@@ -58,63 +57,36 @@ void setup_improv()
     return;
 }
 
-void set_state(improv::State state)
-{
-
-    std::vector<uint8_t> data = {'I', 'M', 'P', 'R', 'O', 'V'};
-    data.resize(11);
-    data[6] = improv::IMPROV_SERIAL_VERSION;
-    data[7] = improv::TYPE_CURRENT_STATE;
-    data[8] = 1;
-    data[9] = state;
+// Frames are built one at a time in a static buffer, only used from main loop task.
+static improv::ImprovFrame frame;
+static improv::ImprovParser parser;
 
-    uint8_t checksum = 0x00;
-    for (uint8_t d : data)
-        checksum += d;
-    data[10] = checksum;
+static void send_frame(const improv::ImprovFrame &f)
+{
+    // Written whole so frame is not broken up by log output from other tasks
+    console_write(CONSOLE_IMPROV, f.data(), f.size());
+}
 
-    Serial.write(data.data(), data.size());
+void set_state(improv::State state)
+{
+    send_frame(frame.state(state));
 }
 
-void send_response(std::vector<uint8_t> &response)
+void send_response(improv::Command command, std::initializer_list<const char *> strings)
 {
-    std::vector<uint8_t> data = {'I', 'M', 'P', 'R', 'O', 'V'};
-    data.resize(9);
-    data[6] = improv::IMPROV_SERIAL_VERSION;
-    data[7] = improv::TYPE_RPC_RESPONSE;
-    data[8] = response.size();
-    data.insert(data.end(), response.begin(), response.end());
-
-    uint8_t checksum = 0x00;
-    for (uint8_t d : data)
-        checksum += d;
-    data.push_back(checksum);
-
-    Serial.write(data.data(), data.size());
+    send_frame(frame.rpc(command, strings));
 }
 
 void set_error(improv::Error error)
 {
-    std::vector<uint8_t> data = {'I', 'M', 'P', 'R', 'O', 'V'};
-    data.resize(11);
-    data[6] = improv::IMPROV_SERIAL_VERSION;
-    data[7] = improv::TYPE_ERROR_STATE;
-    data[8] = 1;
-    data[9] = error;
-
-    uint8_t checksum = 0x00;
-    for (uint8_t d : data)
-        checksum += d;
-    data[10] = checksum;
-
-    Serial.write(data.data(), data.size());
+    send_frame(frame.error(error));
 }
 
-bool connectWifi(std::string ssid, std::string password)
+bool connectWifi(const char *ssid, const char *password)
 {
     uint8_t count = 0;
 
-    WiFi.begin(ssid.c_str(), password.c_str());
+    WiFi.begin(ssid, password);
 
     while (WiFi.status() != WL_CONNECTED)
     {
@@ -130,35 +102,50 @@ bool connectWifi(std::string ssid, std::string password)
     return true;
 }
 
-std::vector<std::string> getLocalUrl()
+const char *getLocalUrl()
 {
-    return {
-        // URL where user can finish onboarding or use device
-        // Recommended to use website hosted by device
-        String("http://" + WiFi.localIP().toString()).c_str()};
+    // URL where user can finish onboarding or use device
+    // Recommended to use website hosted by device
+    static char url[24];
+    snprintf(url, sizeof(url), "http://%s", WiFi.localIP().toString().c_str());
+    return url;
 }
 
+// Scan runs in background, we respond from improv_loop() once it completes.
+static bool improvScanPending = false;
+static uint32_t improvScanCount = 0;
+
 void getAvailableWifiNetworks()
 {
-    wifi_scan();
-    String currentSSID = "";
-    for (wifiNet_t net : wifiNets)
+    improvScanCount = wifiScanCount;
+    improvScanPending = true;
+    if (!wifi_scan_start())
     {
+        // Could not scan, respond with what we have
+        improvScanCount--;
+    }
+}
+
+void sendAvailableWifiNetworks()
+{
+    improvScanPending = false;
+    const char *currentSSID = NULL;
+    for (uint8_t i = 0; i < wifiNetsCount; i++)
+    {
+        const wifiNet_t &net = wifiNets[i];
         // wifiNets may have multiple entries for a SSID sorted by RSSI,
         // we use the first (strongest signal) in the list.
-        if (currentSSID != net.ssid)
+        if (!currentSSID || strcmp(currentSSID, net.ssid))
         {
             currentSSID = net.ssid;
-            std::vector<uint8_t> data = improv::build_rpc_response(
-                improv::GET_WIFI_NETWORKS, {net.ssid, String(net.rssi), (net.encryptionType == WIFI_AUTH_OPEN ? "NO" : "YES")}, false);
-            send_response(data);
+            char rssi[8];
+            snprintf(rssi, sizeof(rssi), "%d", net.rssi);
+            send_response(improv::GET_WIFI_NETWORKS, {net.ssid, rssi, (net.encryptionType == WIFI_AUTH_OPEN ? "NO" : "YES")});
             delay(1);
         }
     }
     // final response
-    std::vector<uint8_t> data =
-        improv::build_rpc_response(improv::GET_WIFI_NETWORKS, std::vector<std::string>{}, false);
-    send_response(data);
+    send_response(improv::GET_WIFI_NETWORKS, {});
 }
 
 void onErrorCallback(improv::Error err)
@@ -166,7 +153,7 @@ void onErrorCallback(improv::Error err)
     blink_led(2000, 3);
 }
 
-bool onCommandCallback(improv::ImprovCommand cmd)
+bool onCommandCallback(const improv::ImprovCommand &cmd)
 {
     // As soon as we recognize an Improv command we must suppress any logging
     // to serial port so as not to interfere with Improv comms.
@@ -180,8 +167,7 @@ bool onCommandCallback(improv::ImprovCommand cmd)
         if ((WiFi.status() == WL_CONNECTED))
         {
             set_state(improv::State::STATE_PROVISIONED);
-            std::vector<uint8_t> data = improv::build_rpc_response(improv::GET_CURRENT_STATE, getLocalUrl(), false);
-            send_response(data);
+            send_response(improv::GET_CURRENT_STATE, {getLocalUrl()});
         }
         else
         {
@@ -193,7 +179,7 @@ bool onCommandCallback(improv::ImprovCommand cmd)
 
     case improv::Command::WIFI_SETTINGS:
     {
-        if (cmd.ssid.length() == 0)
+        if (strlen(cmd.ssid) == 0)
         {
             set_error(improv::Error::ERROR_INVALID_RPC);
             break;
@@ -206,15 +192,14 @@ bool onCommandCallback(improv::ImprovCommand cmd)
 
             blink_led(100, 3);
 
-            homeSpan.setWifiCredentials(cmd.ssid.c_str(), cmd.password.c_str());
+            homeSpan.setWifiCredentials(cmd.ssid, cmd.password);
             userConfig->set(cfg_staticIP, false);
             userConfig->set(cfg_wifiPower, WIFI_POWER_MAX);
             userConfig->set(cfg_wifiPhyMode, 0);
             userConfig->set(cfg_timeZone, "");
 
             set_state(improv::STATE_PROVISIONED);
-            std::vector<uint8_t> data = improv::build_rpc_response(improv::WIFI_SETTINGS, getLocalUrl(), false);
-            send_response(data);
+            send_response(improv::WIFI_SETTINGS, {getLocalUrl()});
             delay(100);
             sync_and_restart();
         }
@@ -229,17 +214,15 @@ bool onCommandCallback(improv::ImprovCommand cmd)
 
     case improv::Command::GET_DEVICE_INFO:
     {
-        std::vector<std::string> infos = {
-            // Firmware name
-            "HomeKit-ratgdo32",
-            // Firmware version
-            AUTO_VERSION,
-            // Hardware chip/variant
-            "ESP32",
-            // Device name
-            "Ratgdo32"};
-        std::vector<uint8_t> data = improv::build_rpc_response(improv::GET_DEVICE_INFO, infos, false);
-        send_response(data);
+        send_response(improv::GET_DEVICE_INFO, {
+                                                   // Firmware name
+                                                   "HomeKit-ratgdo32",
+                                                   // Firmware version
+                                                   AUTO_VERSION,
+                                                   // Hardware chip/variant
+                                                   "ESP32",
+                                                   // Device name
+                                                   "Ratgdo32"});
         break;
     }
 
@@ -261,23 +244,26 @@ bool onCommandCallback(improv::ImprovCommand cmd)
 
 void improv_loop()
 {
-    static uint8_t x_buffer[16];
-    static uint8_t x_position = 0;
-
     if (!improv_setup_done)
         return;
 
-    if (Serial.available() > 0)
-    {
-        uint8_t b = Serial.read();
+    if (improvScanPending && (wifiScanCount != improvScanCount))
+        sendAvailableWifiNetworks();
 
-        if (improv::parse_improv_serial_byte(x_position, b, x_buffer, onCommandCallback, onErrorCallback))
-        {
-            x_buffer[x_position++] = b;
-        }
-        else
+    // Called periodically, so drain everything that has arrived since last time
+    while (Serial.available() > 0)
+    {
+        switch (parser.push_byte(Serial.read()))
         {
-            x_position = 0;
+        case improv::PARSE_COMMAND:
+            onCommandCallback(parser.command());
+            break;
+        case improv::PARSE_ERROR:
+            set_error(parser.error());
+            onErrorCallback(parser.error());
+            break;
+        default:
+            break;
         }
     }
 }
@@ -18,6 +18,7 @@
 
 // ESP system includes
 #include <esp_core_dump.h>
+#include <esp_cpu.h>
 #include <ping/ping_sock.h>
 
 // RATGDO project includes
@@ -32,16 +33,23 @@
 #include "vehicle.h"
 #include "drycontact.h"
 #include "provision.h"
+#include "scheduler.h"
+#include "heap.h"
+#include "timerwheel.h"
+#include "watchdog.h"
+#include "mqtt.h"
+#include "announce.h"
+#include "webhook.h"
+#include "history.h"
+#include "usage.h"
+#include "console.h"
 
 // Logger tag
 static const char *TAG = "ratgdo-main";
 
 GarageDoor garage_door;
-
-// Track our memory usage
-uint32_t free_heap = (1024 * 1024);
-uint32_t min_heap = (1024 * 1024);
-unsigned long next_heap_check = 0;
+SeqLock<GarageDoor> door_state;
+uint32_t door_state_read_cycles = 0;
 
 bool status_done = false;
 unsigned long status_timeout;
@@ -55,6 +63,8 @@ static bool ping_timed_out = false;
 static esp_ping_handle_t ping;
 
 void service_timer_loop();
+void publish_door_state();
+void benchmark_door_state();
 
 /****************************************************************************
  * Initialize RATGDO
@@ -62,9 +72,7 @@ void service_timer_loop();
 void setup()
 {
     esp_core_dump_init();
-    Serial.begin(115200);
-    while (!Serial)
-        ; // Wait for serial port to open
+    setup_console();
 
     Serial.printf("\n\n\n=== R A T G D O ===\n");
 
@@ -77,7 +85,7 @@ void setup()
         {
             if (esp_core_dump_get_summary(summary) == ESP_OK)
             {
-                Serial.printf("Crash in task: %s\n", summary->exc_task);
+                Serial.printf("Crash in task: %s, PC: 0x%08lx\n", summary->exc_task, summary->exc_pc);
             }
         }
         free(summary);
@@ -88,6 +96,32 @@ void setup()
     led.on();
 
     load_all_config_settings();
+    benchmark_door_state();
+    setup_history();
+    setup_usage();
+
+    // Main loop work is run from the scheduler, each job at its own period. The
+    // loop functions check their own setup status so it is safe to register all of
+    // them before anything is initialized.
+    setup_scheduler();
+    setup_watchdog();
+    scheduler_add_periodic("comms", 1, comms_loop);
+    scheduler_add_periodic("web", 2, web_loop);
+    scheduler_add_periodic("softAP", 2, soft_ap_loop);
+    scheduler_add_periodic("drycontact", 5, drycontact_loop);
+    scheduler_add_periodic("doorState", 1, publish_door_state);
+    scheduler_add_periodic("timers", WHEEL_TICK_MS, timer_wheel_loop);
+    scheduler_add_periodic("improv", 5, improv_loop);
+    scheduler_add_periodic("vehicle", 20, vehicle_loop);
+    scheduler_add_periodic("led", LED_TICK_MS, led_loop);
+    scheduler_add_periodic("service", 100, service_timer_loop);
+    scheduler_add_periodic("wifiFast", 100, wifi_fast_connect_loop);
+    scheduler_add_periodic("heap", 1000, heap_check_loop);
+    scheduler_add_periodic("mqtt", 20, mqtt_loop);
+    scheduler_add_periodic("announce", 100, announce_loop);
+    scheduler_add_periodic("history", 100, history_loop);
+    scheduler_add_periodic("usage", 100, usage_loop);
+    scheduler_add_deadline("softAPtimeout", 10 * 60 * 1000, soft_ap_timeout);
 
     if (softAPmode)
     {
@@ -108,13 +142,55 @@ void setup()
  */
 void loop()
 {
-    comms_loop();
-    drycontact_loop();
-    web_loop();
-    soft_ap_loop();
-    improv_loop();
-    vehicle_loop();
-    service_timer_loop();
+    scheduler_loop();
+}
+
+/****************************************************************************
+ * Publish snapshot of door state for readers outside the main loop task
+ */
+void publish_door_state()
+{
+    // What was last published, so that those recording changes see before and after
+    static GarageDoor published = door_state.read();
+    static char publishedVehicle[16] = "";
+
+    if (door_state.publish(garage_door))
+    {
+        announce_state();
+        history_door_changed(published, garage_door);
+        usage_door_changed(published, garage_door);
+        webhook_door_changed(published, garage_door);
+        // Vehicle status found when door becomes active is not a change
+        if (garage_door.active && !published.active)
+            strlcpy(publishedVehicle, vehicleStatus, sizeof(publishedVehicle));
+        published = garage_door;
+    }
+    // Vehicle status is not part of door state, so check for changes here too
+    if (published.active && published.has_distance_sensor && (strcmp(vehicleStatus, publishedVehicle) != 0))
+    {
+        strlcpy(publishedVehicle, vehicleStatus, sizeof(publishedVehicle));
+        history_vehicle_changed(publishedVehicle);
+        webhook_vehicle_changed(publishedVehicle);
+    }
+    if ((bootToDoorReady == 0) && (doorState != DoorState::Unknown))
+    {
+        bootToDoorReady = millis();
+        RINFO(TAG, "Boot to door ready: %lums", bootToDoorReady);
+    }
+}
+
+void benchmark_door_state()
+{
+    const uint32_t count = 1000;
+    door_state.write(garage_door);
+    uint32_t start = esp_cpu_get_cycle_count();
+    for (uint32_t i = 0; i < count; i++)
+    {
+        GarageDoor door = door_state.read();
+        asm volatile("" : : "r"(&door) : "memory"); // don't let compiler optimize the read away
+    }
+    door_state_read_cycles = (esp_cpu_get_cycle_count() - start) / count;
+    RINFO(TAG, "Door state snapshot read takes %lu CPU cycles", door_state_read_cycles);
 }
 
 /****************************************************************************
@@ -205,18 +281,6 @@ void service_timer_loop()
     }
 #endif
 
-    // Check heap
-    if (current_millis > next_heap_check)
-    {
-        next_heap_check = current_millis + 1000;
-        free_heap = ESP.getFreeHeap();
-        if (free_heap < min_heap)
-        {
-            min_heap = free_heap;
-            RINFO(TAG, "Free heap dropped to %d", min_heap);
-        }
-    }
-
     if ((wifiConnectTimeout > 0) && (current_millis > wifiConnectTimeout))
     {
         bool connected = (WiFi.status() == WL_CONNECTED);
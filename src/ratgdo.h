@@ -26,6 +26,7 @@
 // RATGDO project includes
 #include "HomeSpan.h"
 #include "log.h"
+#include "SeqLock.h"
 
 #define DEVICE_NAME "homekit-grgdo1"
 #define MANUF_NAME "Geldius Research"
@@ -84,6 +85,16 @@ enum LockTargetState : uint8_t
     TGT_LOCKED = Characteristic::LockTargetState::LOCK,
 };
 
+// Names used in status JSON, web page and LAN announcements
+#define DOOR_STATE(s) (s == 0) ? "Open" : (s == 1) ? "Closed"  \
+                                      : (s == 2)   ? "Opening" \
+                                      : (s == 3)   ? "Closing" \
+                                      : (s == 4)   ? "Stopped" \
+                                                   : "Unknown"
+#define LOCK_STATE(s) (s == 0) ? "Unsecured" : (s == 1) ? "Secured" \
+                                           : (s == 2)   ? "Jammed"  \
+                                                        : "Unknown"
+
 #define MOTION_TIMER_DURATION 5000      // how long to keep HomeKit motion sensor active for
 
 struct GarageDoor
@@ -101,7 +112,12 @@ struct GarageDoor
     LockTargetState target_lock;
 };
 
+// garage_door is the working copy, only updated from the main loop task. Code
+// running in any other task (HomeSpan, Ticker callbacks) must read door_state,
+// a consistent snapshot published by the main loop.
 extern GarageDoor garage_door;
+extern SeqLock<GarageDoor> door_state;
+extern uint32_t door_state_read_cycles;
 
 struct ForceRecover
 {
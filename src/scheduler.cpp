@@ -0,0 +1,267 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+
+// C/C++ language includes
+#include <algorithm>
+
+// ESP system includes
+#include <esp_timer.h>
+#include <esp_cpu.h>
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "scheduler.h"
+#include "watchdog.h"
+
+// Logger tag
+static const char *TAG = "ratgdo-scheduler";
+
+// Jobs are only added, changed and run from within the main loop task. Other tasks
+// and interrupt handlers may only wake the main loop.
+static schedulerJob jobs[SCHEDULER_MAX_JOBS];
+static uint8_t jobCount = 0;
+static TaskHandle_t loopTaskHandle = NULL;
+static uint32_t cyclesPerUs = 240;
+
+schedulerStats loopStats = {0, 0, 0, 0};
+static int64_t statsStart = 0;
+static int64_t idleTime = 0;
+static uint64_t jitterSum = 0;
+static uint32_t jitterCount = 0;
+static uint32_t jitterMax = 0;
+static uint32_t passes = 0;
+
+/****************************************************************************
+ * Initialize scheduler, must be called from the main loop task.
+ */
+void setup_scheduler()
+{
+    RINFO(TAG, "=== Setup main loop scheduler");
+    loopTaskHandle = xTaskGetCurrentTaskHandle();
+    cyclesPerUs = ESP.getCpuFreqMHz();
+    statsStart = esp_timer_get_time();
+}
+
+static jobHandle add_job(const char *name, uint32_t period_us, uint32_t delay_us, schedulerFunction fn)
+{
+    if (jobCount >= SCHEDULER_MAX_JOBS)
+    {
+        RERROR(TAG, "No free scheduler slot for job: %s", name);
+        return -1;
+    }
+    jobHandle job = jobCount++;
+    jobs[job] = {name, fn, period_us, esp_timer_get_time() + delay_us, true, {}};
+#ifdef HEAP_TRACKING
+    jobs[job].heap = {name, 0, 0};
+    heap_register_site(&jobs[job].heap);
+#endif
+    return job;
+}
+
+jobHandle scheduler_add_periodic(const char *name, uint32_t period_ms, schedulerFunction fn)
+{
+    RINFO(TAG, "Add periodic job %s every %lums", name, period_ms);
+    return add_job(name, period_ms * 1000, 0, fn);
+}
+
+jobHandle scheduler_add_deadline(const char *name, uint32_t delay_ms, schedulerFunction fn)
+{
+    RINFO(TAG, "Add deadline job %s due in %lums", name, delay_ms);
+    return add_job(name, 0, delay_ms * 1000, fn);
+}
+
+void scheduler_set_deadline(jobHandle job, uint32_t delay_ms)
+{
+    if (job < 0 || job >= jobCount)
+        return;
+
+    jobs[job].deadline = esp_timer_get_time() + (int64_t)delay_ms * 1000;
+    jobs[job].active = true;
+}
+
+void scheduler_cancel(jobHandle job)
+{
+    if (job < 0 || job >= jobCount)
+        return;
+
+    jobs[job].active = false;
+}
+
+const char *scheduler_job_name(jobHandle job)
+{
+    if (job < 0 || job >= jobCount)
+        return "";
+
+    return jobs[job].name;
+}
+
+/****************************************************************************
+ * Job profiling. Each run is timed with the CPU cycle counter, which is cheap to
+ * read, and counted into a histogram with log2 buckets of microseconds.
+ */
+static inline void profile_run(jobProfile &profile, uint32_t cycles)
+{
+    uint32_t us = cycles / cyclesPerUs;
+    uint8_t bucket = (us == 0) ? 0 : std::min(32 - __builtin_clz(us), PROFILE_BUCKETS - 1);
+    profile.runs++;
+    profile.totalCycles += cycles;
+    profile.maxCycles = std::max(profile.maxCycles, cycles);
+    profile.histogram[bucket]++;
+}
+
+void scheduler_profile_reset()
+{
+    for (uint8_t i = 0; i < jobCount; i++)
+        jobs[i].profile = {};
+}
+
+// Upper bound (microseconds) of a histogram bucket, last bucket has no upper bound
+static uint32_t bucket_limit(uint8_t bucket)
+{
+    return (bucket < PROFILE_BUCKETS - 1) ? (1UL << bucket) : 0;
+}
+
+void scheduler_print_profile(Print &out)
+{
+    out.printf("Loop idle: %d%%, jitter max: %luus, avg: %luus, passes: %lu\n",
+               loopStats.idlePercent, loopStats.jitterMax, loopStats.jitterAvg, loopStats.passes);
+    out.printf("%-14s %10s %10s %10s  histogram (bucket limit us:count)\n", "job", "runs", "avg us", "max us");
+    for (uint8_t i = 0; i < jobCount; i++)
+    {
+        jobProfile &p = jobs[i].profile;
+        uint32_t avg = (p.runs > 0) ? (uint32_t)(p.totalCycles / p.runs / cyclesPerUs) : 0;
+        out.printf("%-14s %10lu %10lu %10lu ", jobs[i].name, p.runs, avg, p.maxCycles / cyclesPerUs);
+        for (uint8_t b = 0; b < PROFILE_BUCKETS; b++)
+        {
+            if (p.histogram[b] == 0)
+                continue;
+            if (bucket_limit(b))
+                out.printf(" <%lu:%lu", bucket_limit(b), p.histogram[b]);
+            else
+                out.printf(" >=%lu:%lu", 1UL << (b - 1), p.histogram[b]);
+        }
+        out.printf("\n");
+    }
+}
+
+// Prints JSON array of job profiles. Histogram is sent as an array of counts
+// indexed by bucket.
+void scheduler_print_metrics(Print &out)
+{
+    out.printf("[");
+    for (uint8_t i = 0; i < jobCount; i++)
+    {
+        jobProfile &p = jobs[i].profile;
+        uint32_t avg = (p.runs > 0) ? (uint32_t)(p.totalCycles / p.runs / cyclesPerUs) : 0;
+        out.printf("%s\n{\"name\": \"%s\", \"period\": %lu, \"runs\": %lu, \"avgUs\": %lu, \"maxUs\": %lu, \"histogram\": [",
+                   (i > 0) ? "," : "", jobs[i].name, jobs[i].period, p.runs, avg, p.maxCycles / cyclesPerUs);
+        for (uint8_t b = 0; b < PROFILE_BUCKETS; b++)
+            out.printf("%s%lu", (b > 0) ? "," : "", p.histogram[b]);
+        out.printf("]}");
+    }
+    out.printf("\n]");
+}
+
+/****************************************************************************
+ * Wake the main loop early, e.g. because an I/O event needs attention.
+ */
+void scheduler_wake()
+{
+    if (loopTaskHandle)
+        xTaskNotifyGive(loopTaskHandle);
+}
+
+void IRAM_ATTR scheduler_wake_from_isr()
+{
+    if (!loopTaskHandle)
+        return;
+
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(loopTaskHandle, &higherPriorityTaskWoken);
+    if (higherPriorityTaskWoken)
+        portYIELD_FROM_ISR();
+}
+
+/****************************************************************************
+ * Run all jobs that are due, then sleep until the next deadline or a wake up.
+ */
+static void update_stats(int64_t now)
+{
+    int64_t elapsed = now - statsStart;
+    if (elapsed < (SCHEDULER_STATS_PERIOD * 1000))
+        return;
+
+    loopStats.idlePercent = (uint8_t)((idleTime * 100) / elapsed);
+    loopStats.jitterMax = jitterMax;
+    loopStats.jitterAvg = (jitterCount > 0) ? (uint32_t)(jitterSum / jitterCount) : 0;
+    loopStats.passes = passes;
+    statsStart = now;
+    idleTime = 0;
+    jitterSum = 0;
+    jitterCount = 0;
+    jitterMax = 0;
+    passes = 0;
+}
+
+void scheduler_loop()
+{
+    int64_t now = esp_timer_get_time();
+    int64_t next = now + (SCHEDULER_MAX_SLEEP * 1000);
+
+    passes++;
+    for (uint8_t i = 0; i < jobCount; i++)
+    {
+        schedulerJob &job = jobs[i];
+        if (!job.active)
+            continue;
+
+        if (now >= job.deadline)
+        {
+            uint32_t lateness = (uint32_t)(now - job.deadline);
+            jitterSum += lateness;
+            jitterCount++;
+            jitterMax = std::max(jitterMax, lateness);
+
+            if (job.period == 0)
+                job.active = false; // one-shot, may be re-armed by the job itself
+            wdt_job_start(i, millis());
+            uint32_t start = esp_cpu_get_cycle_count();
+            {
+                HEAP_SCOPE(job.heap);
+                job.fn();
+            }
+            profile_run(job.profile, esp_cpu_get_cycle_count() - start);
+            wdt_job_end();
+            now = esp_timer_get_time();
+
+            if (job.period > 0)
+            {
+                job.deadline += job.period;
+                // If we fell behind, don't try and catch up with missed runs.
+                if (job.deadline <= now)
+                    job.deadline = now + job.period;
+            }
+        }
+        if (job.active && job.deadline < next)
+            next = job.deadline;
+    }
+
+    update_stats(now);
+
+    // Sleep until next job is due. Round up to whole ticks so we never wake early.
+    if (next > now)
+    {
+        const int64_t tickUs = portTICK_PERIOD_MS * 1000;
+        TickType_t ticks = (TickType_t)((next - now + tickUs - 1) / tickUs);
+        ulTaskNotifyTake(pdTRUE, ticks);
+        idleTime += esp_timer_get_time() - now;
+    }
+}
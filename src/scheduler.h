@@ -0,0 +1,83 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+
+// ESP system includes
+#include <esp_attr.h>
+
+// Arduino includes
+#include <Print.h>
+
+// RATGDO project includes
+#include "heap.h"
+
+// Maximum number of jobs that can be registered with the scheduler
+#define SCHEDULER_MAX_JOBS 24
+// Longest time main loop will sleep if nothing is due (milliseconds)
+#define SCHEDULER_MAX_SLEEP 100
+// Period over which idle percentage and jitter are calculated (milliseconds)
+#define SCHEDULER_STATS_PERIOD 5000
+// Number of log2 buckets in each job's run time histogram. Bucket 0 counts runs
+// under 1us, bucket n counts runs of [2^(n-1), 2^n) us, last bucket counts anything longer.
+#define PROFILE_BUCKETS 20
+
+typedef void (*schedulerFunction)();
+typedef int8_t jobHandle;
+
+struct jobProfile
+{
+    uint32_t runs;
+    uint64_t totalCycles;
+    uint32_t maxCycles; // held until profile is reset
+    uint32_t histogram[PROFILE_BUCKETS];
+};
+
+struct schedulerJob
+{
+    const char *name;
+    schedulerFunction fn;
+    uint32_t period;  // microseconds, zero for a one-shot deadline job
+    int64_t deadline; // esp_timer_get_time() at which job next due
+    bool active;
+    jobProfile profile;
+#ifdef HEAP_TRACKING
+    heapSite heap;
+#endif
+};
+
+struct schedulerStats
+{
+    uint8_t idlePercent;  // percentage of last stats period main loop spent asleep
+    uint32_t jitterMax;   // worst lateness of any job over last stats period (microseconds)
+    uint32_t jitterAvg;   // average lateness of jobs over last stats period (microseconds)
+    uint32_t passes;      // number of passes through the scheduler over last stats period
+};
+
+extern void setup_scheduler();
+extern void scheduler_loop();
+
+extern jobHandle scheduler_add_periodic(const char *name, uint32_t period_ms, schedulerFunction fn);
+extern jobHandle scheduler_add_deadline(const char *name, uint32_t delay_ms, schedulerFunction fn);
+extern void scheduler_set_deadline(jobHandle job, uint32_t delay_ms);
+extern void scheduler_cancel(jobHandle job);
+extern const char *scheduler_job_name(jobHandle job);
+
+extern void scheduler_profile_reset();
+extern void scheduler_print_profile(Print &out);
+extern void scheduler_print_metrics(Print &out);
+
+extern void scheduler_wake();
+extern void IRAM_ATTR scheduler_wake_from_isr();
+
+extern schedulerStats loopStats;
@@ -14,7 +14,7 @@
  */
 
 // C/C++ language includes
-// none
+#include <algorithm>
 
 // Arduino includes
 #include <WebServer.h>
@@ -27,6 +27,8 @@
 #include "web.h"
 #include "utilities.h"
 #include "provision.h"
+#include "led.h"
+#include "scheduler.h"
 
 // Logger tag
 static const char *TAG = "ratgdo-softAP";
@@ -38,6 +40,8 @@ static const char softAPtableHead[] = R"(
 <tr><th></th><th>SSID</th><th>RSSI</th><th>Chan</th><th>Hardware BSSID</th></tr>)";
 static const char softAPtableRow[] = R"(
 <tr %s><td><input type='radio' name='net' value='%d' %s></td><td>%s</td><td>%ddBm</td><td>%d</td><td>&nbsp;&nbsp;%02x:%02x:%02x:%02x:%02x:%02x</td></tr>)";
+static const char softAPtableScanning[] = R"(
+<tr id='scanning'><td colspan='5'>Scanning...</td></tr>)";
 static const char softAPtableLastRow[] = R"(
 <tr><td><input type='radio' name='net' value='%d'></td><td colspan='2'><input type='text' name='userSSID' placeholder='SSID' value='%s'></td></tr>)";
 
@@ -48,15 +52,15 @@ void handle_wifinets();
 extern WebServer server;
 
 #define MAX_ATTEMPTS_WIFI_CONNECTION 30
-#define TXT_BUFFER_SIZE 1024
+#define TXT_BUFFER_SIZE 512
 
 // support for scaning WiFi networks
-bool wifiNetsCmp(wifiNet_t a, wifiNet_t b)
-{
-    // Sorts first by SSID and then by RSSI so strongest signal first.
-    return (a.ssid < b.ssid) || ((a.ssid == b.ssid) && (a.rssi > b.rssi));
-}
-std::multiset<wifiNet_t, decltype(&wifiNetsCmp)> wifiNets(&wifiNetsCmp);
+wifiNet_t wifiNets[WIFI_NETS_MAX];
+uint8_t wifiNetsCount = 0;
+uint32_t wifiScanCount = 0;
+static volatile bool wifiScanning = false;
+static volatile bool wifiScanDone = false;
+static bool wifiScanEventRegistered = false;
 
 static bool softAPinitialized = false;
 
@@ -69,33 +73,116 @@ char *getServiceName(char *service_name, size_t max)
     return service_name;
 }
 
-void wifi_scan()
+// Sorts first by SSID and then by RSSI so strongest signal first.
+static bool wifiNetsBefore(const wifiNet_t &a, const char *ssid, int8_t rssi)
+{
+    int cmp = strcmp(a.ssid, ssid);
+    return (cmp < 0) || ((cmp == 0) && (a.rssi > rssi));
+}
+
+static void wifi_net_insert(const wifi_ap_record_t *ap)
+{
+    const char *ssid = (const char *)ap->ssid;
+    if (wifiNetsCount == WIFI_NETS_MAX)
+    {
+        // Table full, make room by dropping weakest network if this one is stronger
+        uint8_t weakest = 0;
+        for (uint8_t i = 1; i < wifiNetsCount; i++)
+        {
+            if (wifiNets[i].rssi < wifiNets[weakest].rssi)
+                weakest = i;
+        }
+        if (ap->rssi <= wifiNets[weakest].rssi)
+            return;
+        memmove(&wifiNets[weakest], &wifiNets[weakest + 1], (wifiNetsCount - weakest - 1) * sizeof(wifiNet_t));
+        wifiNetsCount--;
+    }
+
+    uint8_t pos = 0;
+    while ((pos < wifiNetsCount) && wifiNetsBefore(wifiNets[pos], ssid, ap->rssi))
+        pos++;
+    memmove(&wifiNets[pos + 1], &wifiNets[pos], (wifiNetsCount - pos) * sizeof(wifiNet_t));
+    wifiNet_t &net = wifiNets[pos];
+    strlcpy(net.ssid, ssid, sizeof(net.ssid));
+    net.rssi = ap->rssi;
+    net.channel = ap->primary;
+    memcpy(net.bssid, ap->bssid, sizeof(net.bssid));
+    net.encryptionType = ap->authmode;
+    wifiNetsCount++;
+}
+
+static void wifi_scan_done(arduino_event_id_t event, arduino_event_info_t info)
 {
-    // scan for networks
+    // Runs on the WiFi event task, results are collected by main loop
+    wifiScanDone = true;
+    scheduler_wake();
+}
+
+/****************************************************************************
+ * Start scanning for networks in background, previous results remain available
+ * until the scan completes. Returns false if unable to start a scan.
+ */
+bool wifi_scan_start()
+{
+    if (wifiScanning)
+        return true;
+
+    if (!wifiScanEventRegistered)
+    {
+        WiFi.onEvent(wifi_scan_done, ARDUINO_EVENT_WIFI_SCAN_DONE);
+        wifiScanEventRegistered = true;
+    }
+
     RINFO(TAG, "Scanning for networks...");
-    wifiNet_t wifiNet;
-    wifiNets.clear();
-    int nNets = std::min((int)WiFi.scanNetworks(), 127);
-    RINFO(TAG, "Found %d networks", nNets);
+    wifiScanDone = false;
+    if (WiFi.scanNetworks(true) != WIFI_SCAN_RUNNING)
+    {
+        RERROR(TAG, "Failed to start WiFi scan");
+        return false;
+    }
+    wifiScanning = true;
+    return true;
+}
+
+bool wifi_scan_running()
+{
+    return wifiScanning;
+}
+
+// Copy results of completed scan into our table
+static void wifi_scan_collect()
+{
+    if (!wifiScanDone)
+        return;
+
+    int16_t nNets = WiFi.scanComplete();
+    if (nNets == WIFI_SCAN_RUNNING)
+        return;
+
+    wifiScanDone = false;
+    wifiNetsCount = 0;
     for (int i = 0; i < nNets; i++)
     {
-        wifiNet.ssid = WiFi.SSID(i);
-        wifiNet.channel = WiFi.channel(i);
-        wifiNet.rssi = WiFi.RSSI(i);
-        memcpy(wifiNet.bssid, WiFi.BSSID(i), sizeof(wifiNet.bssid));
-        wifiNet.encryptionType = WiFi.encryptionType(i);
-        RINFO(TAG, "Network: %s (Ch:%d, %ddBm) AP: %s, Encryption: %d",
-              wifiNet.ssid.c_str(), wifiNet.channel, wifiNet.rssi, WiFi.BSSIDstr(i).c_str(), wifiNet.encryptionType);
-        wifiNets.insert(wifiNet);
+        const wifi_ap_record_t *ap = (const wifi_ap_record_t *)WiFi.getScanInfoByIndex(i);
+        if (!ap)
+            continue;
+        RINFO(TAG, "Network: %s (Ch:%d, %ddBm) AP: %02x:%02x:%02x:%02x:%02x:%02x, Encryption: %d",
+              (const char *)ap->ssid, ap->primary, ap->rssi,
+              ap->bssid[0], ap->bssid[1], ap->bssid[2], ap->bssid[3], ap->bssid[4], ap->bssid[5], ap->authmode);
+        wifi_net_insert(ap);
     }
+    RINFO(TAG, "Found %d networks, keeping %d", std::max((int)nNets, 0), wifiNetsCount);
     // delete scan from memory
     WiFi.scanDelete();
+    wifiScanCount++;
+    wifiScanning = false;
 }
 
 void start_soft_ap()
 {
     softAPmode = true;
     RINFO(TAG, "Start AP mode for: %s", device_name_rfc952);
+    led.play(LED_SOFTAP);
     WiFi.persistent(false);
     WiFi.setSleep(WIFI_PS_NONE); // Improves performance, at cost of power consumption
     bool apStarted = WiFi.softAP(device_name_rfc952);
@@ -112,7 +199,8 @@ void start_soft_ap()
     server.begin();
     RINFO(TAG, "Soft AP web server started");
     softAPinitialized = true;
-    // wifi_scan();
+    // Have list of networks ready for when the first browser connects
+    wifi_scan_start();
     // Allow improv WiFi provisioning when soft AP mode active.
     setup_improv();
 }
@@ -122,13 +210,20 @@ void soft_ap_loop()
     if (!softAPinitialized)
         return;
 
+    wifi_scan_collect();
     server.handleClient();
+}
 
-    if (softAPmode && (millis() > 10 * 60 * 1000))
+/****************************************************************************
+ * Deadline job, due 10 minutes after boot. Soft AP may be started from the HomeSpan
+ * task so job is registered at boot and only acts if we are in soft AP mode.
+ */
+void soft_ap_timeout()
+{
+    if (softAPmode)
     {
         RINFO(TAG, "In Soft Access Point mode for over 10 minutes, reboot");
         sync_and_restart();
-        return;
     }
 }
 
@@ -158,8 +253,10 @@ void handle_softAPweb()
 
 void handle_rescan()
 {
-    wifi_scan();
-    server.send_P(200, type_txt, "Scan complete.");
+    if (wifi_scan_start())
+        server.send_P(200, type_txt, "Scan started.");
+    else
+        server.send_P(500, type_txt, "Scan failed to start.");
 }
 
 void handle_wifiap()
@@ -176,20 +273,24 @@ void handle_wifinets()
     {
         previousSSID = WiFi.SSID();
     }
-    RINFO(TAG, "Number of WiFi networks: %d", wifiNets.size());
-    String currentSSID = "";
+    // Rows are streamed from the last completed scan, even if a rescan is underway.
+    RINFO(TAG, "Number of WiFi networks: %d%s", wifiNetsCount, wifiScanning ? " (scan in progress)" : "");
+    const char *currentSSID = NULL;
     server.client().setNoDelay(true);
     server.sendContent(softAPhttpPreamble, strlen(softAPhttpPreamble));
+    if (wifiScanning)
+        server.sendContent(softAPtableScanning, strlen(softAPtableScanning));
     server.sendContent(softAPtableHead, strlen(softAPtableHead));
     int i = 0;
-    char *txtBuffer = (char *)malloc(TXT_BUFFER_SIZE);
-    for (wifiNet_t net : wifiNets)
+    char txtBuffer[TXT_BUFFER_SIZE];
+    for (i = 0; i < wifiNetsCount; i++)
     {
+        const wifiNet_t &net = wifiNets[i];
         bool hide = true;
         bool matchSSID = (previousSSID == net.ssid);
         if (matchSSID)
             match = true;
-        if (currentSSID != net.ssid)
+        if (!currentSSID || strcmp(currentSSID, net.ssid))
         {
             currentSSID = net.ssid;
             hide = false;
@@ -199,17 +300,15 @@ void handle_wifinets()
             matchSSID = false;
         }
         snprintf(txtBuffer, TXT_BUFFER_SIZE, softAPtableRow, (hide) ? "class='adv'" : "", i, (matchSSID) ? "checked='checked'" : "",
-                 net.ssid.c_str(), net.rssi, net.channel,
+                 net.ssid, net.rssi, net.channel,
                  net.bssid[0], net.bssid[1], net.bssid[2], net.bssid[3], net.bssid[4], net.bssid[5]);
         server.sendContent(txtBuffer, strlen(txtBuffer));
-        i++;
     }
     // user entered value
     snprintf(txtBuffer, TXT_BUFFER_SIZE, softAPtableLastRow, i, (!match) ? previousSSID.c_str() : "");
     server.sendContent(txtBuffer, strlen(txtBuffer));
     server.sendContent("\n", 1);
     server.client().stop();
-    free(txtBuffer);
     return;
 }
 
@@ -227,10 +326,10 @@ void handle_setssid()
     bool advanced = server.arg("advanced") == "on";
     wifiNet_t wifiNet;
 
-    if (net < wifiNets.size())
+    if (net < wifiNetsCount)
     {
         // User selected network from within scanned range
-        wifiNet = *std::next(wifiNets.begin(), net);
+        wifiNet = wifiNets[net];
         ssid = wifiNet.ssid;
     }
     else
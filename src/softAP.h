@@ -15,26 +15,34 @@
 #pragma once
 
 // C/C++ language includes
-#include <set>
+// none
+
 // ESP system includes
 // #include <esp_wifi_types.h>
 
 // RATGDO project includes
 #include "ratgdo.h"
 
+// Scan results are kept in a fixed size table sorted by SSID and then by RSSI, so
+// strongest signal first. If there are more networks than fit, weakest are dropped.
+#define WIFI_NETS_MAX 32
 typedef struct
 {
-    String ssid;
-    int32_t rssi;
-    int32_t channel;
+    char ssid[33];
+    int8_t rssi;
+    uint8_t channel;
     uint8_t bssid[6];
     wifi_auth_mode_t encryptionType;
 } wifiNet_t;
-extern std::multiset<wifiNet_t, bool (*)(wifiNet_t, wifiNet_t)> wifiNets;
+extern wifiNet_t wifiNets[WIFI_NETS_MAX];
+extern uint8_t wifiNetsCount;
+extern uint32_t wifiScanCount; // incremented each time the table is refreshed
 
 extern void start_soft_ap();
+extern void soft_ap_timeout();
 extern void soft_ap_loop();
-extern void wifi_scan();
+extern bool wifi_scan_start();
+extern bool wifi_scan_running();
 
 extern void handle_setssid();
 extern void handle_rescan();
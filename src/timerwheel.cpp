@@ -0,0 +1,203 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+
+// C/C++ language includes
+#include <algorithm>
+
+// ESP system includes
+#include <esp_timer.h>
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "timerwheel.h"
+
+#define WHEEL_MASK (WHEEL_SLOTS - 1)
+#define WHEEL_MAX_TICKS ((1UL << (WHEEL_BITS * WHEEL_LEVELS)) - 1)
+#define WHEEL_TICK_US (WHEEL_TICK_MS * 1000)
+
+// Wheel ticks count from boot, tick n is due at n * WHEEL_TICK_US. Timers can be
+// armed before the main loop starts servicing the wheel, it catches up on first call.
+static WheelTimer *wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static uint32_t currentTick = 0;
+static int64_t nextTickAt = WHEEL_TICK_US;
+static portMUX_TYPE wheelMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Statistics
+static uint32_t timerCount = 0;
+static uint32_t maxTimerCount = 0;
+static uint32_t callbacks = 0;
+static uint64_t latencySum = 0;
+static uint32_t latencyMax = 0;
+
+/****************************************************************************
+ * Wheel manipulation, must be called with wheelMux held
+ */
+void timer_wheel_link(WheelTimer *t)
+{
+    uint32_t delta = t->expires - currentTick;
+    uint32_t expires = t->expires;
+    uint8_t level = 0;
+
+    if (delta > WHEEL_MAX_TICKS)
+    {
+        // Beyond the end of the wheel, park in top level and re-insert when cascaded
+        expires = currentTick + WHEEL_MAX_TICKS;
+        level = WHEEL_LEVELS - 1;
+    }
+    else
+    {
+        while ((level < WHEEL_LEVELS - 1) && (delta >= (1UL << (WHEEL_BITS * (level + 1)))))
+            level++;
+    }
+
+    t->slot = &wheel[level][(expires >> (WHEEL_BITS * level)) & WHEEL_MASK];
+    t->prev = NULL;
+    t->next = *t->slot;
+    if (t->next)
+        t->next->prev = t;
+    *t->slot = t;
+    timerCount++;
+}
+
+void timer_wheel_unlink(WheelTimer *t)
+{
+    if (!t->slot)
+        return;
+
+    if (t->prev)
+        t->prev->next = t->next;
+    else
+        *t->slot = t->next;
+    if (t->next)
+        t->next->prev = t->prev;
+    t->next = t->prev = NULL;
+    t->slot = NULL;
+    timerCount--;
+}
+
+// Move all timers in a slot of a higher level down to where they now belong
+void timer_wheel_cascade(uint8_t level)
+{
+    WheelTimer **slot = &wheel[level][(currentTick >> (WHEEL_BITS * level)) & WHEEL_MASK];
+    WheelTimer *t = *slot;
+    *slot = NULL;
+    while (t)
+    {
+        WheelTimer *next = t->next;
+        t->slot = NULL;
+        timerCount--;
+        timer_wheel_link(t);
+        t = next;
+    }
+}
+
+// Tick on which a timer due at given time expires. Always in the future, so a
+// callback that re-arms itself can't run again in same tick.
+static uint32_t expiry_tick(int64_t dueAt)
+{
+    return std::max<uint32_t>((uint32_t)((dueAt + WHEEL_TICK_US - 1) / WHEEL_TICK_US), currentTick + 1);
+}
+
+/****************************************************************************
+ * WheelTimer methods
+ */
+void WheelTimer::arm(uint32_t ms, bool repeat, callback_t callback, void *arg)
+{
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&wheelMux);
+    timer_wheel_unlink(this);
+    fn = callback;
+    fnArg = arg;
+    period = repeat ? ms : 0;
+    dueAt = now + (int64_t)ms * 1000;
+    expires = expiry_tick(dueAt);
+    timer_wheel_link(this);
+    maxTimerCount = std::max(maxTimerCount, timerCount);
+    portEXIT_CRITICAL(&wheelMux);
+}
+
+void WheelTimer::detach()
+{
+    portENTER_CRITICAL(&wheelMux);
+    timer_wheel_unlink(this);
+    portEXIT_CRITICAL(&wheelMux);
+}
+
+/****************************************************************************
+ * Advance the wheel one tick and run everything that is due. Callbacks are run
+ * without the lock held, so they are free to arm or detach any timer.
+ */
+void timer_wheel_tick()
+{
+    portENTER_CRITICAL(&wheelMux);
+    currentTick++;
+    // Find highest level due to cascade, then work down so that timers moving out
+    // of a higher level are cascaded again if they land in a lower level's current slot.
+    uint8_t level = 0;
+    while ((level < WHEEL_LEVELS - 1) && ((currentTick & ((1UL << (WHEEL_BITS * (level + 1))) - 1)) == 0))
+        level++;
+    for (; level > 0; level--)
+        timer_wheel_cascade(level);
+    portEXIT_CRITICAL(&wheelMux);
+
+    WheelTimer **slot = &wheel[0][currentTick & WHEEL_MASK];
+    while (true)
+    {
+        portENTER_CRITICAL(&wheelMux);
+        WheelTimer *t = *slot;
+        if (!t)
+        {
+            portEXIT_CRITICAL(&wheelMux);
+            break;
+        }
+        timer_wheel_unlink(t);
+        WheelTimer::callback_t fn = t->fn;
+        void *arg = t->fnArg;
+        int64_t dueAt = t->dueAt;
+        if (t->period > 0)
+        {
+            // Next due time is based on when it was due, not when it ran, so no drift
+            t->dueAt += (int64_t)t->period * 1000;
+            t->expires = expiry_tick(t->dueAt);
+            timer_wheel_link(t);
+        }
+        portEXIT_CRITICAL(&wheelMux);
+
+        int64_t late = esp_timer_get_time() - dueAt;
+        uint32_t latency = (late > 0) ? (uint32_t)late : 0;
+        latencySum += latency;
+        latencyMax = std::max(latencyMax, latency);
+        callbacks++;
+        fn(arg);
+    }
+}
+
+/****************************************************************************
+ * Called from main loop scheduler, catches up on any ticks we missed.
+ */
+void timer_wheel_loop()
+{
+    int64_t now = esp_timer_get_time();
+    while (now >= nextTickAt)
+    {
+        timer_wheel_tick();
+        nextTickAt += WHEEL_TICK_US;
+    }
+}
+
+// Print timer statistics as JSON object members (caller provides the braces)
+void timer_wheel_print_metrics(Print &out)
+{
+    uint32_t avg = (callbacks > 0) ? (uint32_t)(latencySum / callbacks) : 0;
+    out.printf("\"timers\": %lu,\n\"maxTimers\": %lu,\n\"timerCallbacks\": %lu,\n\"timerLatencyAvg\": %lu,\n\"timerLatencyMax\": %lu,\n",
+               timerCount, maxTimerCount, callbacks, avg, latencyMax);
+}
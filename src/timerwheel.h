@@ -0,0 +1,91 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+#include <stddef.h>
+
+// Arduino includes
+#include <Print.h>
+
+// RATGDO project includes
+// none
+
+// Resolution of the timing wheel, timers are rounded up to whole ticks (milliseconds)
+#define WHEEL_TICK_MS 10
+// Three levels of 64 slots cover 64^3 ticks (about 43 minutes), longer timers are
+// parked in the top level and re-inserted until due.
+#define WHEEL_BITS 6
+#define WHEEL_SLOTS (1 << WHEEL_BITS)
+#define WHEEL_LEVELS 3
+
+/*
+ * Drop in replacement for the parts of Ticker we use. All timers share one
+ * hierarchical timing wheel serviced from the main loop scheduler, so callbacks
+ * run on the main loop task rather than the esp_timer task. Timers may be armed
+ * and detached from any task, both are O(1).
+ */
+class WheelTimer
+{
+public:
+    typedef void (*callback_t)(void *);
+
+    WheelTimer() {}
+    // Copies are never armed, assigning to a timer detaches it.
+    WheelTimer(const WheelTimer &) {}
+    WheelTimer &operator=(const WheelTimer &)
+    {
+        detach();
+        return *this;
+    }
+    ~WheelTimer() { detach(); }
+
+    void once_ms(uint32_t ms, callback_t callback, void *arg) { arm(ms, false, callback, arg); }
+    void attach_ms(uint32_t ms, callback_t callback, void *arg) { arm(ms, true, callback, arg); }
+    void once_ms(uint32_t ms, void (*callback)()) { arm(ms, false, callNoArg, (void *)callback); }
+    void attach_ms(uint32_t ms, void (*callback)()) { arm(ms, true, callNoArg, (void *)callback); }
+
+    template <typename TArg>
+    void once_ms(uint32_t ms, void (*callback)(TArg *), TArg *arg)
+    {
+        arm(ms, false, reinterpret_cast<callback_t>(callback), (void *)arg);
+    }
+    template <typename TArg>
+    void attach_ms(uint32_t ms, void (*callback)(TArg *), TArg *arg)
+    {
+        arm(ms, true, reinterpret_cast<callback_t>(callback), (void *)arg);
+    }
+
+    void detach();
+    bool active() { return slot != NULL; }
+
+private:
+    static void callNoArg(void *arg) { ((void (*)())arg)(); }
+    void arm(uint32_t ms, bool repeat, callback_t callback, void *arg);
+
+    WheelTimer *next = NULL;
+    WheelTimer *prev = NULL;
+    WheelTimer **slot = NULL; // list head we are linked into, NULL if not armed
+    uint32_t expires = 0;     // wheel tick
+    uint32_t period = 0;      // milliseconds, zero if one-shot
+    int64_t dueAt = 0;        // esp_timer_get_time() when due, to measure latency
+    callback_t fn = NULL;
+    void *fnArg = NULL;
+
+    friend void timer_wheel_link(WheelTimer *t);
+    friend void timer_wheel_unlink(WheelTimer *t);
+    friend void timer_wheel_cascade(uint8_t level);
+    friend void timer_wheel_tick();
+};
+
+extern void timer_wheel_loop();
+extern void timer_wheel_print_metrics(Print &out);
@@ -0,0 +1,363 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+
+// C/C++ language includes
+#include <algorithm>
+#include <time.h>
+
+// ESP system includes
+// none
+
+// Arduino includes
+// none
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "config.h"
+#include "comms.h"
+#include "utilities.h"
+#include "usage.h"
+
+// Logger tag
+static const char *TAG = "ratgdo-usage";
+
+/*
+ * Round robin time series of door usage in three tiers, minutes, hours and days.
+ * Events are only ever added to the current minute. When a bucket is closed it
+ * is added into the current bucket of the next coarser tier, so each update is
+ * a handful of additions whatever the tier sizes. Buckets are aligned to UTC
+ * once NTP has set the clock, before that (or if NTP is disabled) to time since
+ * boot.
+ */
+struct usageBucket
+{
+    uint16_t openings;
+    uint16_t runTime; // seconds door was moving
+    uint16_t obstructions;
+};
+
+struct usageTier
+{
+    const char *name;
+    uint32_t period; // seconds
+    uint16_t len;
+    usageBucket *buckets;
+    uint32_t current; // time / period of the bucket being filled
+    bool started;
+};
+
+static usageBucket minutes[USAGE_MINUTES];
+static usageBucket hours[USAGE_HOURS];
+static usageBucket days[USAGE_DAYS];
+
+#define USAGE_TIERS 3
+static usageTier tiers[USAGE_TIERS] = {
+    {"minute", 60, USAGE_MINUTES, minutes, 0, false},
+    {"hour", 60 * 60, USAGE_HOURS, hours, 0, false},
+    {"day", 24 * 60 * 60, USAGE_DAYS, days, 0, false},
+};
+
+// Only the day tier is kept in flash, there is not enough room in NVS for the others.
+// It is only saved once aligned to UTC, days counted from boot mean nothing after a
+// reboot.
+#define USAGE_MAGIC 0x55534732
+struct usageStore
+{
+    uint32_t magic;
+    uint32_t current;
+    usageBucket days[USAGE_DAYS];
+};
+static usageStore saveBuffer;
+
+static bool dirty = false;
+static uint32_t lastSave = 0;
+
+static uint32_t movingSince;
+static uint32_t runCarry; // milliseconds not yet added as a whole second
+
+static inline void sat_add(uint16_t &v, uint32_t n)
+{
+    v = std::min(v + n, (uint32_t)UINT16_MAX);
+}
+
+static void add_bucket(usageBucket &to, const usageBucket &from)
+{
+    sat_add(to.openings, from.openings);
+    sat_add(to.runTime, from.runTime);
+    sat_add(to.obstructions, from.obstructions);
+}
+
+static inline usageBucket &current_bucket(usageTier &T)
+{
+    return T.buckets[T.current % T.len];
+}
+
+// Time buckets are aligned to, or false if we should wait for NTP
+static bool usage_time(uint32_t &now)
+{
+    if (clockSet)
+        now = time(NULL);
+    else if (!enableNTP)
+        now = millis() / 1000;
+    else
+        return false;
+    return true;
+}
+
+static void roll(uint8_t t, uint32_t now);
+
+static void fold(uint8_t t, uint32_t when, const usageBucket &b)
+{
+    roll(t, when);
+    add_bucket(current_bucket(tiers[t]), b);
+}
+
+// Move tier forward to the bucket that holds now, closing buckets on the way
+static void roll(uint8_t t, uint32_t now)
+{
+    usageTier &T = tiers[t];
+    uint32_t b = now / T.period;
+    if (!T.started || (b < T.current))
+    {
+        // First time, or clock went backwards. Can't tell where the bucket being
+        // filled belongs so keep it as the current one.
+        usageBucket pending = current_bucket(T);
+        current_bucket(T) = {};
+        T.current = b;
+        T.started = true;
+        current_bucket(T) = pending;
+        return;
+    }
+    while (T.current < b)
+    {
+        usageBucket &closing = current_bucket(T);
+        if ((t + 1 < USAGE_TIERS) && (closing.openings || closing.runTime || closing.obstructions))
+            fold(t + 1, T.current * T.period, closing);
+        T.current++;
+        if (b - T.current >= T.len)
+        {
+            // Gap longer than the whole tier
+            memset(T.buckets, 0, T.len * sizeof(usageBucket));
+            T.current = b;
+            break;
+        }
+        current_bucket(T) = {};
+    }
+}
+
+static void roll_all()
+{
+    uint32_t now;
+    if (!usage_time(now))
+        return;
+    for (uint8_t t = 0; t < USAGE_TIERS; t++)
+        roll(t, now);
+}
+
+static inline bool moving(GarageDoorCurrentState state)
+{
+    return (state == CURR_OPENING) || (state == CURR_CLOSING);
+}
+
+void setup_usage()
+{
+    RINFO(TAG, "=== Setup usage statistics");
+    // Saved days are aligned to UTC, so only of use if NTP will set the clock. Until
+    // it does the tiers wait, so restored days are not rolled against time since boot.
+    if (enableNTP && nvRam->readBlob(nvram_usage, (char *)&saveBuffer, sizeof(saveBuffer)) && (saveBuffer.magic == USAGE_MAGIC))
+    {
+        memcpy(days, saveBuffer.days, sizeof(days));
+        tiers[2].current = saveBuffer.current;
+        tiers[2].started = true;
+    }
+}
+
+/****************************************************************************
+ * Write daily totals to flash, including the hour and minute in progress.
+ * Called periodically and before a planned reboot.
+ */
+void usage_save()
+{
+    lastSave = millis();
+    if (!dirty)
+        return;
+
+    roll_all();
+    usageTier &D = tiers[2];
+    if (!D.started || !clockSet)
+        return;
+    saveBuffer.magic = USAGE_MAGIC;
+    saveBuffer.current = D.current;
+    memcpy(saveBuffer.days, days, sizeof(days));
+    usageBucket &today = saveBuffer.days[D.current % D.len];
+    add_bucket(today, current_bucket(tiers[1]));
+    add_bucket(today, current_bucket(tiers[0]));
+    if (!nvRam->writeBlob(nvram_usage, (const char *)&saveBuffer, sizeof(saveBuffer)))
+    {
+        // Left dirty, tried again next time
+        RERROR(TAG, "Failed to save %u bytes of daily usage", sizeof(saveBuffer));
+        return;
+    }
+    dirty = false;
+}
+
+/****************************************************************************
+ * Main loop, save to flash periodically and close buckets as time passes
+ */
+void usage_loop()
+{
+    if ((millis() - lastSave) >= USAGE_SAVE_MS)
+        usage_save();
+
+    roll_all();
+}
+
+/****************************************************************************
+ * Count openings, time the door is moving and obstructions, called from main
+ * loop when door state is published
+ */
+void usage_door_changed(const GarageDoor &from, const GarageDoor &to)
+{
+    if (!to.active)
+        return;
+
+    if (!from.active)
+    {
+        // State found at boot is not a change
+        movingSince = millis();
+        return;
+    }
+
+    roll_all();
+    usageBucket &b = current_bucket(tiers[0]);
+    if (to.current_state != from.current_state)
+    {
+        if (moving(from.current_state))
+        {
+            // Whole of a move is counted in the minute it finished
+            runCarry += millis() - movingSince;
+            sat_add(b.runTime, runCarry / 1000);
+            runCarry %= 1000;
+        }
+        if (moving(to.current_state))
+            movingSince = millis();
+        if (from.current_state == CURR_CLOSED)
+            sat_add(b.openings, 1);
+        dirty = true;
+    }
+    if (to.obstructed && !from.obstructed)
+    {
+        sat_add(b.obstructions, 1);
+        dirty = true;
+    }
+}
+
+/*
+ * Numbers are gathered into a small buffer rather than printed one at a time,
+ * as each print to a WiFiClient can be a TCP segment of its own.
+ */
+class usageWriter
+{
+public:
+    usageWriter(Print &out) : out(out) {}
+    ~usageWriter() { flush(); }
+
+    void print(const char *s)
+    {
+        size_t n = strlen(s);
+        if (len + n > sizeof(buf))
+            flush();
+        if (n > sizeof(buf))
+            out.print(s);
+        else
+        {
+            memcpy(buf + len, s, n);
+            len += n;
+        }
+    }
+
+    void number(long v, bool comma)
+    {
+        char s[16];
+        snprintf(s, sizeof(s), comma ? ",%ld" : "%ld", v);
+        print(s);
+    }
+
+    void flush()
+    {
+        if (len)
+            out.write((const uint8_t *)buf, len);
+        len = 0;
+    }
+
+private:
+    Print &out;
+    char buf[512];
+    size_t len = 0;
+};
+
+// Bucket of tier t, i buckets before the current one. The current bucket
+// includes what has not yet been added from finer tiers.
+static usageBucket bucket_at(uint8_t t, uint16_t i)
+{
+    usageTier &T = tiers[t];
+    if (i > 0)
+        return (T.current >= i) ? T.buckets[(T.current - i) % T.len] : usageBucket{};
+    usageBucket b = current_bucket(T);
+    for (uint8_t f = 0; f < t; f++)
+        add_bucket(b, current_bucket(tiers[f]));
+    return b;
+}
+
+/****************************************************************************
+ * Print all tiers as JSON, oldest bucket first, for download in one request.
+ */
+void usage_print(Print &out)
+{
+    static const char *const fields[] = {"openings", "runTime", "obstructions"};
+    static uint16_t usageBucket::*const members[] = {&usageBucket::openings, &usageBucket::runTime, &usageBucket::obstructions};
+    uint32_t now;
+    bool aligned = usage_time(now);
+
+    roll_all();
+    usageWriter w(out);
+    w.print("{\n\"time\": ");
+    w.number(aligned ? now : millis() / 1000, false);
+    w.print(clockSet ? ",\n\"clockSet\": true" : ",\n\"clockSet\": false");
+    w.print(",\n\"openerCount\": ");
+    if (openingsCount < 0)
+        w.print("null");
+    else
+        w.number(openingsCount, false);
+    w.print(",\n\"tiers\": [");
+    for (uint8_t t = 0; t < USAGE_TIERS; t++)
+    {
+        usageTier &T = tiers[t];
+        w.print(t ? ",\n{\"tier\": \"" : "\n{\"tier\": \"");
+        w.print(T.name);
+        w.print("\", \"period\": ");
+        w.number(T.period, false);
+        w.print(", \"start\": ");
+        // Time of oldest bucket, may be before boot if not aligned to UTC
+        w.number((int64_t)T.current * T.period - (int64_t)(T.len - 1) * T.period, false);
+        for (uint8_t f = 0; f < 3; f++)
+        {
+            w.print(", \"");
+            w.print(fields[f]);
+            w.print("\": [");
+            for (int i = T.len - 1; i >= 0; i--)
+                w.number(bucket_at(t, i).*members[f], i < T.len - 1);
+            w.print("]");
+        }
+        w.print("}");
+    }
+    w.print("\n]\n}\n");
+}
@@ -0,0 +1,33 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+
+// Arduino includes
+#include <Print.h>
+
+// RATGDO project includes
+#include "ratgdo.h"
+
+// Buckets kept in each tier, a day of minutes, a month of hours, a year of days
+#define USAGE_MINUTES 1440
+#define USAGE_HOURS 744
+#define USAGE_DAYS 366
+// Daily totals are mirrored to flash no more often than this (milliseconds)
+#define USAGE_SAVE_MS (60 * 60 * 1000)
+
+extern void setup_usage();
+extern void usage_loop();
+extern void usage_door_changed(const GarageDoor &from, const GarageDoor &to);
+extern void usage_save();
+extern void usage_print(Print &out);
@@ -29,6 +29,10 @@
 #include "config.h"
 #include "comms.h"
 #include "led.h"
+#include "announce.h"
+#include "webhook.h"
+#include "history.h"
+#include "usage.h"
 
 // Logger tag
 static const char *TAG = "ratgdo-utils";
@@ -148,6 +152,7 @@ void load_all_config_settings()
     strlcpy(syslogIP, userConfig->getSyslogIP().c_str(), sizeof(syslogIP));
     syslogPort = userConfig->getSyslogPort();
     syslogEn = userConfig->getSyslogEn();
+    announceEn = userConfig->getAnnounceEn();
     rebootSeconds = userConfig->getRebootSeconds();
 
     // Now log what we have loaded
@@ -178,6 +183,7 @@ void load_all_config_settings()
     RINFO(TAG, "   syslogIP:            %s", userConfig->getSyslogIP().c_str());
     RINFO(TAG, "   syslogPort:          %d", userConfig->getSyslogPort());
     RINFO(TAG, "   vehicleThreshold:    %d", userConfig->getVehicleThreshold());
+    RINFO(TAG, "   announceEn:          %s", userConfig->getAnnounceEn() ? "true" : "false");
     RINFO(TAG, "RFC952 device hostname: %s", device_name_rfc952);
 
 #ifdef NTP_CLIENT
@@ -216,6 +222,9 @@ void sync_and_restart()
     {
         // In soft AP mode we never initialized garage door comms, so don't save rolling code.
         save_rolling_code();
+        webhook_save();
+        history_save();
+        usage_save();
     }
 
     ratgdoLogger->saveMessageLog();
@@ -23,6 +23,7 @@
 #include "vehicle.h"
 #include "homekit.h"
 #include "config.h"
+#include "watchdog.h"
 
 // Logger tag
 static const char *TAG = "ratgdo-vehicle";
@@ -90,9 +91,11 @@ void vehicle_loop()
         return;
 
     uint8_t dataReady = 0;
+    WDT_TRACE();
     if ((distanceSensor.VL53L4CX_GetMeasurementDataReady(&dataReady) == 0) && (dataReady > 0))
     {
         VL53L4CX_MultiRangingData_t distanceData;
+        WDT_TRACE();
         if (distanceSensor.VL53L4CX_GetMultiRangingData(&distanceData) == 0)
         {
             int16_t dist = 0;
@@ -105,6 +108,7 @@ void vehicle_loop()
             // If a distance found, add it to our vehicle presence vector.
             if (dist > 0)
                 calculatePresence(dist);
+            WDT_TRACE();
             distanceSensor.VL53L4CX_ClearInterruptAndStartMeasurement();
         }
     }
@@ -188,7 +192,7 @@ void calculatePresence(int16_t distance)
         vehicleDetected = false;
     if (vehicleDetected != priorVehicleDetected)
     {
-        led.flash();
+        led.activity();
         // if change occurs with arrival/departure window then record motion,
         // presence timer is set when door opens.
         lastChangeAt = millis();
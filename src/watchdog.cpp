@@ -0,0 +1,185 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+
+// C/C++ language includes
+#include <algorithm>
+#include <stddef.h>
+
+// ESP system includes
+#include <esp_attr.h>
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "scheduler.h"
+#include "watchdog.h"
+
+// Logger tag
+static const char *TAG = "ratgdo-watchdog";
+
+volatile int8_t wdtJob = -1;
+volatile uint32_t wdtJobStart = 0;
+const wdtTracePoint *volatile wdtTrace = nullptr;
+TaskHandle_t wdtTask = NULL;
+
+// Details of the most recent stall are kept in memory that survives a software
+// reset or panic, so if the stall ends in a watchdog reboot we can still report it.
+#define STALL_MAGIC 0x5354414C
+struct stallRecord
+{
+    uint32_t magic;
+    char job[16];
+    char file[32];
+    uint16_t line;
+    uint8_t recovered;
+    uint32_t duration; // milliseconds
+    uint32_t uptime;   // millis() when stall started
+    uint32_t checksum;
+};
+RTC_NOINIT_ATTR static stallRecord rtcStall;
+
+static stallRecord lastStall;
+static char lastStallText[96] = "";
+
+static bool stalled = false;
+static uint32_t totalStalls = 0;
+static uint32_t jobStalls[SCHEDULER_MAX_JOBS];
+static uint32_t jobStallMax[SCHEDULER_MAX_JOBS];
+static portMUX_TYPE wdtMux = portMUX_INITIALIZER_UNLOCKED;
+
+#define SUPERVISOR_STACK_SIZE 2048
+static StaticTask_t supervisorTaskBuffer;
+static StackType_t supervisorStack[SUPERVISOR_STACK_SIZE];
+
+static uint32_t stall_checksum(const stallRecord &r)
+{
+    const uint8_t *p = (const uint8_t *)&r;
+    uint32_t sum = 5381;
+    for (size_t i = 0; i < offsetof(stallRecord, checksum); i++)
+        sum = ((sum << 5) + sum) + p[i];
+    return sum;
+}
+
+static void format_stall(const stallRecord &r, bool previousBoot)
+{
+    snprintf(lastStallText, sizeof(lastStallText), "%s (%s:%d) %lums at %lus%s%s",
+             r.job, r.file[0] ? r.file : "no trace", r.line, r.duration, r.uptime / 1000,
+             r.recovered ? "" : ", did not recover", previousBoot ? ", before reboot" : "");
+}
+
+/****************************************************************************
+ * Supervisor task. Runs at higher priority than the main loop and checks that
+ * the running job has not exceeded its budget. It never logs, as the stalled job
+ * may be holding the log mutex.
+ */
+static void supervisor(void *args)
+{
+    TickType_t lastWake = xTaskGetTickCount();
+    while (true)
+    {
+        vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(WATCHDOG_PERIOD_MS));
+
+        portENTER_CRITICAL(&wdtMux);
+        int8_t job = wdtJob;
+        uint32_t elapsed = millis() - wdtJobStart;
+        if ((job >= 0) && (elapsed >= WATCHDOG_BUDGET_MS))
+        {
+            if (!stalled)
+            {
+                stalled = true;
+                totalStalls++;
+                jobStalls[job]++;
+                memset(&rtcStall, 0, sizeof(rtcStall));
+                rtcStall.magic = STALL_MAGIC;
+                strlcpy(rtcStall.job, scheduler_job_name(job), sizeof(rtcStall.job));
+                rtcStall.uptime = wdtJobStart;
+            }
+            const wdtTracePoint *trace = wdtTrace;
+            if (trace)
+            {
+                const char *file = strrchr(trace->file, '/');
+                strlcpy(rtcStall.file, file ? file + 1 : trace->file, sizeof(rtcStall.file));
+                rtcStall.line = trace->line;
+            }
+            rtcStall.duration = elapsed;
+            rtcStall.checksum = stall_checksum(rtcStall);
+            jobStallMax[job] = std::max(jobStallMax[job], elapsed);
+        }
+        portEXIT_CRITICAL(&wdtMux);
+    }
+}
+
+/****************************************************************************
+ * Called by scheduler when a job returns
+ */
+void wdt_job_end()
+{
+    portENTER_CRITICAL(&wdtMux);
+    bool wasStalled = stalled;
+    int8_t job = wdtJob;
+    wdtJob = -1;
+    if (wasStalled)
+    {
+        stalled = false;
+        rtcStall.duration = millis() - wdtJobStart;
+        rtcStall.recovered = 1;
+        rtcStall.checksum = stall_checksum(rtcStall);
+        jobStallMax[job] = std::max(jobStallMax[job], rtcStall.duration);
+        lastStall = rtcStall;
+        // Reported below, so must not be reported again after some later reboot
+        rtcStall.magic = 0;
+    }
+    portEXIT_CRITICAL(&wdtMux);
+
+    if (wasStalled)
+    {
+        format_stall(lastStall, false);
+        RERROR(TAG, "Main loop stalled: %s", lastStallText);
+    }
+}
+
+/****************************************************************************
+ * Initialize watchdog, report any stall that preceded a reboot
+ */
+void setup_watchdog()
+{
+    RINFO(TAG, "=== Setup main loop watchdog, budget %dms", WATCHDOG_BUDGET_MS);
+    if ((rtcStall.magic == STALL_MAGIC) && (rtcStall.checksum == stall_checksum(rtcStall)))
+    {
+        lastStall = rtcStall;
+        format_stall(lastStall, true);
+        RERROR(TAG, "Main loop stalled: %s", lastStallText);
+    }
+    rtcStall.magic = 0;
+
+    xTaskCreateStatic(supervisor, "supervisor", SUPERVISOR_STACK_SIZE, NULL, 2, supervisorStack, &supervisorTaskBuffer);
+}
+
+const char *watchdog_last_stall()
+{
+    return lastStallText;
+}
+
+// Print stall statistics as JSON object members (caller provides the braces)
+void watchdog_print_metrics(Print &out)
+{
+    out.printf("\"stalls\": %lu,\n\"stallBudget\": %d,\n\"lastStall\": \"%s\",\n\"jobStalls\": [",
+               totalStalls, WATCHDOG_BUDGET_MS, lastStallText);
+    bool first = true;
+    for (uint8_t i = 0; i < SCHEDULER_MAX_JOBS; i++)
+    {
+        if (jobStalls[i] == 0)
+            continue;
+        out.printf("%s\n{\"name\": \"%s\", \"stalls\": %lu, \"maxMs\": %lu}",
+                   first ? "" : ",", scheduler_job_name(i), jobStalls[i], jobStallMax[i]);
+        first = false;
+    }
+    out.printf("\n],\n");
+}
@@ -0,0 +1,65 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+
+// ESP system includes
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// Arduino includes
+#include <Print.h>
+
+// RATGDO project includes
+// none
+
+// A main loop job that runs longer than this is considered stalled (milliseconds)
+#define WATCHDOG_BUDGET_MS 250
+// How often the supervisor task checks on the main loop (milliseconds)
+#define WATCHDOG_PERIOD_MS 50
+
+struct wdtTracePoint
+{
+    const char *file;
+    uint16_t line;
+};
+
+// Progress markers, published by the main loop scheduler and read by the supervisor.
+extern volatile int8_t wdtJob;              // index of running scheduler job, -1 if none
+extern volatile uint32_t wdtJobStart;       // millis() when job started
+extern const wdtTracePoint *volatile wdtTrace; // last trace point passed in running job
+extern TaskHandle_t wdtTask;                   // task running the scheduler jobs
+
+// Mark progress through code that may block. Supervisor reports the last trace
+// point passed if the job stalls. Shared code may also run in other tasks, which
+// the supervisor does not watch, so only the main loop task records a trace.
+#define WDT_TRACE()                                            \
+    {                                                          \
+        static const wdtTracePoint _tp = {__FILE__, __LINE__}; \
+        if (xTaskGetCurrentTaskHandle() == wdtTask)            \
+            wdtTrace = &_tp;                                   \
+    }
+
+inline void wdt_job_start(int8_t job, uint32_t now)
+{
+    wdtTask = xTaskGetCurrentTaskHandle();
+    wdtTrace = nullptr;
+    wdtJobStart = now;
+    wdtJob = job;
+}
+
+extern void wdt_job_end();
+
+extern void setup_watchdog();
+extern void watchdog_print_metrics(Print &out);
+extern const char *watchdog_last_stall();
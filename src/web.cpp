@@ -14,19 +14,20 @@
  */
 
 // C/C++ language includes
+#include <algorithm>
 #include <string>
 #include <tuple>
 #include <unordered_map>
 #include <time.h>
 
 // Arduino includes
-#include <Ticker.h>
 #include <MD5Builder.h>
 #include <WebServer.h>
 #include <StreamString.h>
 
 // ESP system includes
 #include "esp_core_dump.h"
+#include "esp_flash.h"
 
 // RATGDO project includes
 #include "ratgdo.h"
@@ -40,6 +41,19 @@
 #include "json.h"
 #include "led.h"
 #include "vehicle.h"
+#include "scheduler.h"
+#include "heap.h"
+#include "timerwheel.h"
+#include "watchdog.h"
+#include "drycontact.h"
+#include "mqtt.h"
+#include "announce.h"
+#include "webhook.h"
+#include "history.h"
+#include "usage.h"
+#include "bench.h"
+#include "console.h"
+#include "gzip.h"
 
 // Logger tag
 static const char *TAG = "ratgdo-http";
@@ -69,6 +83,10 @@ void handle_showlog();
 void handle_showrebootlog();
 void handle_crashlog();
 void handle_clearcrashlog();
+void handle_metrics();
+void handle_history();
+void handle_usage();
+void handle_bench();
 #ifdef CRASH_DEBUG
 void handle_forcecrash();
 void handle_crash_oom();
@@ -96,6 +114,10 @@ const std::unordered_map<std::string, std::pair<const HTTPMethod, void (*)()>> b
     {"/rescan", {HTTP_POST, handle_rescan}},
     {"/crashlog", {HTTP_GET, handle_crashlog}},
     {"/clearcrashlog", {HTTP_GET, handle_clearcrashlog}},
+    {"/metrics", {HTTP_GET, handle_metrics}},
+    {"/history", {HTTP_GET, handle_history}},
+    {"/usage.json", {HTTP_GET, handle_usage}},
+    {"/selftest/bench", {HTTP_GET, handle_bench}},
 #ifdef CRASH_DEBUG
     {"/forcecrash", {HTTP_POST, handle_forcecrash}},
     {"/crashoom", {HTTP_POST, handle_crash_oom}},
@@ -128,6 +150,7 @@ const char response400invalid[] = "400: Bad Request, invalid argument\n";
 const char response404[] = "404: Not Found\n";
 const char response503[] = "503: Service Unavailable.\n";
 const char response200[] = "HTTP/1.1 200 OK\nContent-Type: text/plain\nConnection: close\n\n";
+const char response200json[] = "HTTP/1.1 200 OK\nContent-Type: application/json\nCache-Control: no-cache, no-store\nConnection: close\n\n";
 
 const char *http_methods[] = {"HTTP_ANY", "HTTP_GET", "HTTP_HEAD", "HTTP_POST", "HTTP_PUT", "HTTP_PATCH", "HTTP_DELETE", "HTTP_OPTIONS"};
 
@@ -139,7 +162,7 @@ struct SSESubscription
 {
     IPAddress clientIP;
     WiFiClient client;
-    Ticker heartbeatTimer;
+    WheelTimer heartbeatTimer;
     bool SSEconnected;
     int SSEfailCount;
     String clientUUID;
@@ -151,18 +174,11 @@ SSESubscription *firmwareUpdateSub = NULL;
 uint8_t subscriptionCount = 0;
 
 SemaphoreHandle_t jsonMutex = NULL;
+static StaticSemaphore_t jsonMutexBuffer;
 
-#define JSON_BUFFER_SIZE 1280
-char *json = NULL;
-
-#define DOOR_STATE(s) (s == 0) ? "Open" : (s == 1) ? "Closed"  \
-                                      : (s == 2)   ? "Opening" \
-                                      : (s == 3)   ? "Closing" \
-                                      : (s == 4)   ? "Stopped" \
-                                                   : "Unknown"
-#define LOCK_STATE(s) (s == 0) ? "Unsecured" : (s == 1) ? "Secured" \
-                                           : (s == 2)   ? "Jammed"  \
-                                                        : "Unknown"
+#define JSON_BUFFER_SIZE 2560
+static char jsonBuffer[JSON_BUFFER_SIZE];
+char *json = jsonBuffer;
 
 void web_loop()
 {
@@ -239,14 +255,8 @@ void setup_web()
     }
 
     IRAM_START
-    // IRAM heap is used only for allocating globals, to leave as much regular heap
-    // available during operations.  We need to carefully monitor useage so as not
-    // to exceed available IRAM.  We can adjust the LOG_BUFFER_SIZE (in log.h) if we
-    // need to make more space available for initialization.
-    json = (char *)malloc(JSON_BUFFER_SIZE);
-    RINFO(TAG, "Allocated buffer for JSON, size: %d", JSON_BUFFER_SIZE);
-    // We allocated json as a global block.  We are on dual core CPU.  We need to serialize access to the resource.
-    jsonMutex = xSemaphoreCreateMutex();
+    // json is a statically allocated global block.  We are on dual core CPU.  We need to serialize access to the resource.
+    jsonMutex = xSemaphoreCreateMutexStatic(&jsonMutexBuffer);
     last_reported_paired = homekit_is_paired();
 
     if (motionTriggers.asInt == 0)
@@ -279,7 +289,7 @@ void setup_web()
     server.on("/update", HTTP_POST, handle_update, handle_firmware_upload);
     server.onNotFound(handle_everything);
     // here the list of headers to be recorded
-    const char *headerkeys[] = {"If-None-Match"};
+    const char *headerkeys[] = {"If-None-Match", "Accept-Encoding"};
     size_t headerkeyssize = sizeof(headerkeys) / sizeof(char *);
     // ask server to track these headers
     server.collectHeaders(headerkeys, headerkeyssize);
@@ -440,12 +450,30 @@ void handle_everything()
     return handle_notfound();
 }
 
-void handle_status()
+// Dynamic responses are compressed on the fly if client can take it
+static bool accepts_gzip()
+{
+    return server.hasHeader(F("Accept-Encoding")) && strstr(server.header(F("Accept-Encoding")).c_str(), "gzip");
+}
+
+// Webhook URLs often carry a token in the path, query or user info, and
+// status.json needs no login, so only the scheme, host and port are reported.
+static std::string webhook_host(const std::string &url)
+{
+    size_t start = url.find("://");
+    start = (start == std::string::npos) ? 0 : start + 3;
+    size_t end = std::min(url.find_first_of("/?#", start), url.length());
+    size_t at = url.rfind('@', end);
+    if ((at != std::string::npos) && (at >= start))
+        return url.substr(0, start) + url.substr(at + 1, end - at - 1);
+    return url.substr(0, end);
+}
+
+// Caller must hold jsonMutex
+static void build_status_json()
 {
     unsigned long upTime = millis();
 #define clientCount 0
-    // Build the JSON string
-    xSemaphoreTake(jsonMutex, portMAX_DELAY);
     START_JSON(json);
     ADD_INT(json, "upTime", upTime);
     ADD_STR(json, cfg_deviceName, userConfig->getDeviceName().c_str());
@@ -474,16 +502,36 @@ void handle_status()
     ADD_INT(json, cfg_rebootSeconds, userConfig->getRebootSeconds());
     ADD_INT(json, "freeHeap", free_heap);
     ADD_INT(json, "minHeap", min_heap);
+    ADD_INT(json, "largestBlock", largest_block);
+    ADD_INT(json, "heapFrag", heap_fragmentation);
+    ADD_INT(json, "loopIdle", loopStats.idlePercent);
+    ADD_INT(json, "loopJitter", loopStats.jitterMax);
+    ADD_STR(json, "lastStall", watchdog_last_stall());
     // TODO monitor stack... ADD_INT(json, "minStack", 0);
     ADD_INT(json, "crashCount", crashCount);
+    ADD_INT(json, "consoleDropped", consoleStats.logDropped);
+    ADD_INT(json, "bootToIP", bootToIP);
+    ADD_INT(json, "bootToDoorReady", bootToDoorReady);
+    ADD_BOOL(json, "wifiFastConnect", wifiFastConnect);
     // TODO support WiFi PhyMode... ADD_INT(json, cfg_wifiPhyMode, userConfig->getWifiPhyMode());
     // TODO support WiFi TX Power... ADD_INT(json, cfg_wifiPower, userConfig->getWifiPower());
     ADD_BOOL(json, cfg_staticIP, userConfig->getStaticIP());
     ADD_BOOL(json, cfg_syslogEn, userConfig->getSyslogEn());
     ADD_STR(json, cfg_syslogIP, userConfig->getSyslogIP().c_str());
     ADD_INT(json, cfg_syslogPort, userConfig->getSyslogPort());
+    ADD_BOOL(json, cfg_mqttEn, userConfig->getMqttEn());
+    ADD_STR(json, cfg_mqttServer, userConfig->getMqttServer().c_str());
+    ADD_INT(json, cfg_mqttPort, userConfig->getMqttPort());
+    ADD_STR(json, cfg_mqttUser, userConfig->getMqttUser().c_str());
+    ADD_STR(json, cfg_mqttTopic, userConfig->getMqttTopic().c_str());
+    ADD_BOOL(json, "mqttConnected", mqtt_connected());
+    ADD_BOOL(json, cfg_announceEn, announceEn);
+    ADD_STR(json, cfg_webhookURL1, webhook_host(userConfig->getWebhookURL1()).c_str());
+    ADD_STR(json, cfg_webhookURL2, webhook_host(userConfig->getWebhookURL2()).c_str());
     ADD_INT(json, cfg_TTCseconds, userConfig->getTTCseconds());
     ADD_INT(json, cfg_vehicleThreshold, userConfig->getVehicleThreshold());
+    ADD_INT(json, cfg_dcPulseMs, userConfig->getDCPulseMs());
+    ADD_INT(json, cfg_dcPulseGapMs, userConfig->getDCPulseGapMs());
     ADD_INT(json, cfg_motionTriggers, motionTriggers.asInt);
     ADD_INT(json, cfg_LEDidle, led.getIdleState());
     // We send milliseconds relative to current time... ie updated X milliseconds ago
@@ -502,18 +550,48 @@ void handle_status()
     {
         ADD_STR(json, "vehicleStatus", vehicleStatus);
         ADD_INT(json, "vehicleDist", vehicleDistance);
-        last_reported_assist_laser = laser.state();
         ADD_BOOL(json, "assistLaser", last_reported_assist_laser);
     }
     END_JSON(json);
+}
+
+// Build status JSON without sending it, to time it
+void bench_status_json()
+{
+    xSemaphoreTake(jsonMutex, portMAX_DELAY);
+    build_status_json();
+    xSemaphoreGive(jsonMutex);
+}
+
+void handle_status()
+{
+    // Build the JSON string
+    xSemaphoreTake(jsonMutex, portMAX_DELAY);
+    if (garage_door.has_distance_sensor)
+        last_reported_assist_laser = laser.state();
+    build_status_json();
 
-    // send JSON straight to serial port
-    Serial.printf("%s\n", json);
+    // send JSON to serial port, as a log line so dropped if serial port is backed up
+    WDT_TRACE();
+    console_print(CONSOLE_LOG, json);
+    console_print(CONSOLE_LOG, "\n");
     last_reported_garage_door = garage_door;
 
-    server.sendHeader(F("Cache-Control"), F("no-cache, no-store"));
-    server.send_P(200, type_json, json);
-    RINFO(TAG, "JSON length: %d", strlen(json));
+    size_t length = strlen(json);
+    if ((length >= GZIP_THRESHOLD) && accepts_gzip())
+    {
+        WiFiClient client = server.client();
+        GzipPrint gz(client, response200json, true);
+        gz.write((const uint8_t *)json, length);
+        gz.end();
+        client.stop();
+    }
+    else
+    {
+        server.sendHeader(F("Cache-Control"), F("no-cache, no-store"));
+        server.send_P(200, type_json, json);
+    }
+    RINFO(TAG, "JSON length: %d", length);
     xSemaphoreGive(jsonMutex);
     return;
 }
@@ -532,12 +610,14 @@ bool helperResetDoor(const std::string &key, const std::string &value, configSet
 
 bool helperGarageLightOn(const std::string &key, const std::string &value, configSetting *action)
 {
+    history_command((value == "1") ? CMD_LIGHT_ON : CMD_LIGHT_OFF, SRC_WEB);
     set_light((value == "1") ? true : false);
     return true;
 }
 
 bool helperGarageDoorState(const std::string &key, const std::string &value, configSetting *action)
 {
+    history_command((value == "1") ? CMD_OPEN : CMD_CLOSE, SRC_WEB);
     if (value == "1")
         open_door();
     else
@@ -547,6 +627,7 @@ bool helperGarageDoorState(const std::string &key, const std::string &value, con
 
 bool helperGarageLockState(const std::string &key, const std::string &value, configSetting *action)
 {
+    history_command((value == "1") ? CMD_LOCK : CMD_UNLOCK, SRC_WEB);
     set_lock((value == "1") ? 1 : 0);
     return true;
 }
@@ -652,6 +733,16 @@ void handle_setgdo()
         {"factoryReset", {true, false, 0, helperFactoryReset}},
         {"assistLaser", {false, false, 0, helperAssistLaser}},
     };
+    // Longest value accepted for string settings, as limited on the settings page.
+    // These are copied into fixed size buffers, including status.json.
+    static const std::unordered_map<std::string, size_t> maxLength = {
+        {cfg_mqttServer, 63},
+        {cfg_mqttUser, 63},
+        {cfg_mqttPassword, 63},
+        {cfg_mqttTopic, 31},
+        {cfg_webhookURL1, WEBHOOK_URL_SIZE - 1},
+        {cfg_webhookURL2, WEBHOOK_URL_SIZE - 1},
+    };
     bool reboot = false;
     bool error = false;
     bool wifiChanged = false;
@@ -683,6 +774,11 @@ void handle_setgdo()
             reboot = reboot || actions.reboot;
             wifiChanged = wifiChanged || actions.wifiChanged;
         }
+        else if (maxLength.count(key) && (value.length() > maxLength.at(key)))
+        {
+            ESP_LOGW(TAG, "Value too long for Key: %s, %d bytes (F)", key.c_str(), (int)value.length());
+            error = true;
+        }
         else if (userConfig->contains(key))
         {
             RINFO(TAG, "Configuration set for Key: %s, Value: %s", key.c_str(), value.c_str());
@@ -780,8 +876,12 @@ void SSEheartbeat(SSESubscription *s)
         ADD_INT(json, "upTime", millis());
         ADD_INT(json, "freeHeap", free_heap);
         ADD_INT(json, "minHeap", min_heap);
+        ADD_INT(json, "largestBlock", largest_block);
+        ADD_INT(json, "heapFrag", heap_fragmentation);
+        ADD_INT(json, "loopIdle", loopStats.idlePercent);
+        ADD_INT(json, "loopJitter", loopStats.jitterMax);
         // TODO monitor stack... ADD_INT(json, "minStack", ESP.getFreeContStack());
-        if (garage_door.has_distance_sensor && (lastVehicleDistance != vehicleDistance))
+        if (door_state.read().has_distance_sensor && (lastVehicleDistance != vehicleDistance))
         {
             lastVehicleDistance = vehicleDistance;
             ADD_INT(json, "vehicleDist", vehicleDistance);
@@ -800,6 +900,7 @@ void SSEheartbeat(SSESubscription *s)
         */
         END_JSON(json);
         REMOVE_NL(json);
+        WDT_TRACE();
         s->client.printf("event: message\nretry: 15000\ndata: %s\n\n", json);
         xSemaphoreGive(jsonMutex);
     }
@@ -837,8 +938,7 @@ void SSEHandler(uint8_t channel)
     server.sendContent_P(PSTR("HTTP/1.1 200 OK\nContent-Type: text/event-stream;\nConnection: keep-alive\nCache-Control: no-cache\nAccess-Control-Allow-Origin: *\n\n"));
     s.SSEconnected = true;
     s.SSEfailCount = 0;
-    s.heartbeatTimer.attach_ms(1000, [channel, &s]
-                               { SSEheartbeat(&s); });
+    s.heartbeatTimer.attach_ms(1000, SSEheartbeat, &s);
     RINFO(TAG, "Client %s listening for SSE events on channel %d", client.remoteIP().toString().c_str(), channel);
 }
 
@@ -914,46 +1014,159 @@ void handle_subscribe()
             if (!subscription[channel].clientIP)
                 break;
     }
-    subscription[channel] = {clientIP, server.client(), Ticker(), false, 0, server.arg(id), logViewer};
+    subscription[channel] = {clientIP, server.client(), WheelTimer(), false, 0, server.arg(id), logViewer};
     SSEurl += std::to_string(channel);
     RINFO(TAG, "SSE Subscription for client %s with IP %s: event bus location: %s, Total subscribed: %d", server.arg(id).c_str(), clientIP.toString().c_str(), SSEurl.c_str(), subscriptionCount);
     server.sendHeader(F("Cache-Control"), F("no-cache, no-store"));
     server.send_P(200, type_txt, SSEurl.c_str());
 }
 
+/****************************************************************************
+ * Stream raw core dump from flash, for esp-coredump on a host with the matching .elf
+ */
+static void stream_coredump(WiFiClient &client)
+{
+    size_t addr = 0;
+    size_t size = 0;
+    if (esp_core_dump_image_get(&addr, &size) != ESP_OK)
+    {
+        client.print(response200);
+        client.print("No core dump saved\n");
+        return;
+    }
+    client.printf("HTTP/1.1 200 OK\r\nContent-Type: application/octet-stream\r\nContent-Length: %u\r\n"
+                  "Content-Disposition: attachment; filename=\"coredump.bin\"\r\nConnection: close\r\n\r\n",
+                  size);
+    uint8_t chunk[512];
+    for (size_t offset = 0; offset < size; offset += sizeof(chunk))
+    {
+        size_t len = std::min(size - offset, sizeof(chunk));
+        if ((esp_flash_read(NULL, chunk, addr + offset, len) != ESP_OK) || (client.write(chunk, len) != len))
+            break;
+    }
+}
+
 void handle_crashlog()
 {
     RINFO(TAG, "Request to display crash log...");
+    if (server.hasArg("raw"))
+    {
+        // Raw dump holds memory contents, may include credentials
+        AUTHENTICATE();
+        WiFiClient client = server.client();
+        stream_coredump(client);
+        client.stop();
+        return;
+    }
+
     WiFiClient client = server.client();
     client.print(response200);
-    /* TODO show crashdump
-        saveCrash.print(client);
-    #ifdef LOG_MSG_BUFFER
-        if (crashCount > 0)
-            printSavedLog(client);
-    #endif
-    */
+    esp_core_dump_summary_t summary;
+    if ((esp_core_dump_image_check() != ESP_OK) || (esp_core_dump_get_summary(&summary) != ESP_OK))
+    {
+        client.print("No core dump saved\n");
+        client.stop();
+        return;
+    }
+    // Layout is read by decode_crash.py, keep in step. Core dump does not hold the
+    // version of the firmware that crashed, only its ELF SHA256, which may not be
+    // the firmware running now if it was updated since.
+    client.printf("ELF SHA256: %s\n", (const char *)summary.app_elf_sha256);
+    client.printf("Running firmware: %s\n", AUTO_VERSION);
+    client.printf("Crashed task: %s\n", summary.exc_task);
+    client.printf("PC: 0x%08lx\n", summary.exc_pc);
+#if CONFIG_IDF_TARGET_ARCH_XTENSA
+    client.printf("Exception cause: %lu\n", summary.ex_info.exc_cause);
+    client.printf("Fault address: 0x%08lx\n", summary.ex_info.exc_vaddr);
+#endif
+    client.print("Backtrace:");
+    for (uint32_t i = 0; i < summary.exc_bt_info.depth; i++)
+        client.printf(" 0x%08lx", summary.exc_bt_info.bt[i]);
+    client.print(summary.exc_bt_info.corrupted ? " (corrupted)\n" : "\n");
+    client.stop();
+}
+
+void handle_metrics()
+{
+    // Streamed straight to the client as too big for the shared JSON buffer
+    WiFiClient client = server.client();
+    client.print(response200json);
+    client.printf("{\n\"upTime\": %lu,\n", millis());
+    heap_print_metrics(client);
+    timer_wheel_print_metrics(client);
+    watchdog_print_metrics(client);
+    drycontact_print_metrics(client);
+    mqtt_print_metrics(client);
+    announce_print_metrics(client);
+    webhook_print_metrics(client);
+    history_print_metrics(client);
+    gzip_print_metrics(client);
+    nvram_print_metrics(client);
+    client.printf("\"loopIdle\": %d,\n\"loopJitterMax\": %lu,\n\"loopJitterAvg\": %lu,\n\"loopPasses\": %lu,\n",
+                  loopStats.idlePercent, loopStats.jitterMax, loopStats.jitterAvg, loopStats.passes);
+    client.printf("\"doorStateReadCycles\": %lu,\n\"doorStateWrites\": %lu,\n\"doorStateRetries\": %lu,\n",
+                  door_state_read_cycles, door_state.writes(), door_state.retries());
+    client.print("\"jobs\": ");
+    scheduler_print_metrics(client);
+    client.print("\n}\n");
+    client.stop();
+}
+
+void handle_history()
+{
+    // Streamed a block at a time, whole journal is never copied
+    uint32_t from = server.hasArg("from") ? strtoul(server.arg("from").c_str(), NULL, 10) : 0;
+    uint32_t to = server.hasArg("to") ? strtoul(server.arg("to").c_str(), NULL, 10) : UINT32_MAX;
+    uint32_t start = server.hasArg("start") ? strtoul(server.arg("start").c_str(), NULL, 10) : 0;
+    uint32_t limit = server.hasArg("limit") ? strtoul(server.arg("limit").c_str(), NULL, 10) : 50;
+    WiFiClient client = server.client();
+    GzipPrint gz(client, response200json, accepts_gzip());
+    history_print(gz, from, to, start, std::min(limit, (uint32_t)HISTORY_LIMIT_MAX));
+    gz.end();
+    client.stop();
+}
+
+void handle_usage()
+{
+    WiFiClient client = server.client();
+    GzipPrint gz(client, response200json, accepts_gzip());
+    usage_print(gz);
+    gz.end();
+    client.stop();
+}
+
+void handle_bench()
+{
+    AUTHENTICATE();
+    // Only a request with ?run=1 starts a run. Results are read by asking without it.
+    if (server.arg("run") == "1")
+        bench_start();
+    WiFiClient client = server.client();
+    client.print(response200json);
+    bench_print(client);
     client.stop();
 }
 
 void handle_showlog()
 {
     WiFiClient client = server.client();
-    client.print(response200);
+    GzipPrint gz(client, response200, accepts_gzip());
 #ifdef LOG_MSG_BUFFER
-    ratgdoLogger->printMessageLog(client);
+    ratgdoLogger->printMessageLog(gz);
     // ratgdoLogger->saveMessageLog();
 #endif
+    gz.end();
     client.stop();
 }
 
 void handle_showrebootlog()
 {
     WiFiClient client = server.client();
-    client.print(response200);
+    GzipPrint gz(client, response200, accepts_gzip());
 #ifdef LOG_MSG_BUFFER
-    ratgdoLogger->printSavedLog(client);
+    ratgdoLogger->printSavedLog(gz);
 #endif
+    gz.end();
     client.stop();
 }
 
@@ -987,13 +1200,20 @@ void handle_forcecrash()
 }
 #endif
 
+static void SSESendState(Print &out, const IPAddress &clientIP, uint8_t channel, const char *data)
+{
+    String IPaddrstr = clientIP.toString();
+    RINFO(TAG, "SSE send to client %s on channel %d, data: %s", IPaddrstr.c_str(), channel, data);
+    out.printf_P(PSTR("event: message\ndata: %s\n\n"), data);
+}
+
 void SSEBroadcastState(const char *data, BroadcastType type)
 {
     if (!web_setup_done)
         return;
 
     // Flash LED to signal activity
-    led.flash(FLASH_MS);
+    led.activity();
 
     // if nothing subscribed, then return
     if (subscriptionCount == 0)
@@ -1012,14 +1232,20 @@ void SSEBroadcastState(const char *data, BroadcastType type)
             }
             else if (type == RATGDO_STATUS)
             {
-                String IPaddrstr = IPAddress(subscription[i].clientIP).toString();
-                RINFO(TAG, "SSE send to client %s on channel %d, data: %s", IPaddrstr.c_str(), i, data);
-                subscription[i].client.printf_P(PSTR("event: message\ndata: %s\n\n"), data);
+                SSESendState(subscription[i].client, subscription[i].clientIP, i, data);
             }
         }
     }
 }
 
+// Send a status event as SSEBroadcastState does, to somewhere other than a
+// browser, to time it without connected browsers seeing it
+void bench_sse_send(Print &out, const char *data)
+{
+    led.activity();
+    SSESendState(out, INADDR_NONE, 0, data);
+}
+
 // Implement our own firmware update so can enforce MD5 check.
 // Based on HTTPUpdateServer
 void _setUpdaterError()
@@ -1132,14 +1358,14 @@ void handle_firmware_upload()
     else if (_authenticatedUpdate && upload.status == UPLOAD_FILE_WRITE && !_updaterError.length())
     {
         // Progress dot dot dot
-        Serial.printf(".");
+        console_print(CONSOLE_LOG, ".");
         if (firmwareSize > 0)
         {
             uploadProgress += upload.currentSize;
             unsigned int uploadPercent = (uploadProgress * 100) / firmwareSize;
             if (uploadPercent >= nextPrintPercent)
             {
-                Serial.printf("\n"); // newline after the dot dot dots
+                console_print(CONSOLE_LOG, "\n"); // newline after the dot dot dots
                 RINFO(TAG, "%s progress: %i%%", verify ? "Verify" : "Update", uploadPercent);
                 SSEheartbeat(firmwareUpdateSub); // keep SSE connection alive.
                 nextPrintPercent += 10;
@@ -1165,7 +1391,7 @@ void handle_firmware_upload()
     }
     else if (_authenticatedUpdate && upload.status == UPLOAD_FILE_END && !_updaterError.length())
     {
-        Serial.printf("\n"); // newline after last of the dot dot dots
+        console_print(CONSOLE_LOG, "\n"); // newline after last of the dot dot dots
         if (!verify)
         {
             if (Update.end(true))
@@ -20,6 +20,9 @@
 // ESP system includes
 // none
 
+// Arduino includes
+#include <Print.h>
+
 // RATGDO project includes
 #define PROGMEM // so it is no-op in webcontent.h
 #include "www/build/webcontent.h"
@@ -31,6 +34,7 @@ extern void handle_notfound();
 extern void handle_reboot();
 
 extern void load_page(const char *page);
+extern void bench_status_json();
 
 extern const char response400invalid[];
 extern const char type_txt[];
@@ -41,5 +45,6 @@ enum BroadcastType : uint8_t
     LOG_MESSAGE = 2,
 };
 void SSEBroadcastState(const char *data, BroadcastType type = RATGDO_STATUS);
+extern void bench_sse_send(Print &out, const char *data);
 
 extern "C" int crashCount; // pull in number of times crashed.
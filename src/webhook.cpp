@@ -0,0 +1,336 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+
+// C/C++ language includes
+#include <algorithm>
+#include <time.h>
+
+// ESP system includes
+#include <esp_timer.h>
+
+// Arduino includes
+#include <WiFi.h>
+#include <HTTPClient.h>
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "config.h"
+#include "utilities.h"
+#include "webhook.h"
+
+// Logger tag
+static const char *TAG = "ratgdo-webhook";
+
+/*
+ * Events are added by the main loop to a fixed ring, and POSTed as JSON to each
+ * configured URL by a background task. Each target keeps its own place in the
+ * ring, so one that is unreachable does not hold up the other. An event is kept
+ * until every target has delivered it or it is pushed out by newer events.
+ */
+struct webhookEvent
+{
+    uint32_t seq;
+    uint32_t upTime; // millis() when event happened
+    uint32_t time;   // seconds since epoch, zero if clock not set
+    char event[12];
+    char value[12];
+};
+
+struct webhookTarget
+{
+    char url[WEBHOOK_URL_SIZE];
+    uint32_t next;     // seq of next event to deliver
+    uint32_t retryAt;  // millis() after which to retry, zero if not waiting
+    uint32_t backoff;  // milliseconds
+    uint32_t delivered;
+    uint32_t failures;
+    uint32_t dropped;
+    int16_t lastCode;  // HTTP status, or negative HTTPClient error
+    uint32_t latencyTotal; // milliseconds
+    uint32_t latencyMax;
+};
+
+// Saved to NVS before a planned reboot so undelivered events are not lost
+#define WEBHOOK_SAVE_MAGIC 0x57484B31
+struct webhookSaved
+{
+    uint32_t magic;
+    uint32_t firstSeq;
+    uint32_t nextSeq;
+    webhookEvent events[WEBHOOK_QUEUE_LEN];
+};
+static webhookSaved saved;
+
+static webhookEvent queue[WEBHOOK_QUEUE_LEN];
+static uint32_t nextSeq = 1;  // events [nextSeq - WEBHOOK_QUEUE_LEN, nextSeq) may be in queue
+static uint32_t firstSeq = 1; // events before this were delivered before a reboot
+static webhookTarget targets[WEBHOOK_MAX_TARGETS];
+static portMUX_TYPE webhookMux = portMUX_INITIALIZER_UNLOCKED;
+
+#define WEBHOOK_STACK_SIZE 6144
+static StaticTask_t webhookTaskBuffer;
+static StackType_t webhookStack[WEBHOOK_STACK_SIZE];
+static TaskHandle_t webhookTask = NULL;
+
+static uint32_t oldest_seq()
+{
+    return (nextSeq > firstSeq + WEBHOOK_QUEUE_LEN) ? nextSeq - WEBHOOK_QUEUE_LEN : firstSeq;
+}
+
+static void add_event(const char *event, const char *value)
+{
+    webhookEvent e;
+    e.upTime = millis();
+    e.time = clockSet ? time(NULL) : 0;
+    strlcpy(e.event, event, sizeof(e.event));
+    strlcpy(e.value, value, sizeof(e.value));
+
+    portENTER_CRITICAL(&webhookMux);
+    e.seq = nextSeq++;
+    queue[e.seq % WEBHOOK_QUEUE_LEN] = e;
+    portEXIT_CRITICAL(&webhookMux);
+
+    if (webhookTask)
+        xTaskNotifyGive(webhookTask);
+}
+
+/****************************************************************************
+ * Background delivery. Runs on its own task as an HTTP request can take seconds.
+ */
+static int deliver(const char *url, HTTPClient &http, WiFiClient &client, const webhookEvent &e, uint32_t &latency)
+{
+    char body[192];
+    int len = snprintf(body, sizeof(body),
+                       "{\"event\": \"%s\", \"value\": \"%s\", \"seq\": %lu, \"upTime\": %lu, \"time\": %lu, \"host\": \"%s\"}",
+                       e.event, e.value, e.seq, e.upTime, e.time, device_name_rfc952);
+
+    int64_t start = esp_timer_get_time();
+    int code = HTTPC_ERROR_CONNECTION_REFUSED;
+    // Connection is kept open between requests to the same host
+    http.setReuse(true);
+    http.setConnectTimeout(WEBHOOK_TIMEOUT_MS);
+    http.setTimeout(WEBHOOK_TIMEOUT_MS);
+    if (http.begin(client, url))
+    {
+        http.addHeader("Content-Type", "application/json");
+        code = http.POST((uint8_t *)body, len);
+        http.end();
+    }
+    latency = (esp_timer_get_time() - start) / 1000;
+    if ((code < 200) || (code >= 300))
+        client.stop();
+    return code;
+}
+
+static void webhook_task(void *args)
+{
+    static HTTPClient http[WEBHOOK_MAX_TARGETS];
+    static WiFiClient client[WEBHOOK_MAX_TARGETS];
+    static char url[WEBHOOK_URL_SIZE];
+    uint32_t wait = WEBHOOK_BACKOFF_MAX_MS;
+
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait));
+        wait = WEBHOOK_BACKOFF_MAX_MS;
+        if (!WiFi.isConnected())
+        {
+            wait = WEBHOOK_BACKOFF_MIN_MS;
+            continue;
+        }
+
+        for (uint8_t i = 0; i < WEBHOOK_MAX_TARGETS; i++)
+        {
+            webhookTarget &t = targets[i];
+            if (!t.url[0])
+                continue;
+            uint32_t now = millis();
+            if (t.retryAt && (int32_t)(t.retryAt - now) > 0)
+            {
+                wait = std::min(wait, t.retryAt - now);
+                continue;
+            }
+            t.retryAt = 0;
+
+            while (true)
+            {
+                webhookEvent e;
+                portENTER_CRITICAL(&webhookMux);
+                if (t.next < oldest_seq())
+                {
+                    t.dropped += oldest_seq() - t.next;
+                    t.next = oldest_seq();
+                }
+                bool pending = (t.next < nextSeq) && t.url[0];
+                if (pending)
+                {
+                    e = queue[t.next % WEBHOOK_QUEUE_LEN];
+                    strlcpy(url, t.url, sizeof(url));
+                }
+                portEXIT_CRITICAL(&webhookMux);
+                if (!pending)
+                    break;
+
+                uint32_t latency;
+                int code = deliver(url, http[i], client[i], e, latency);
+                bool ok = (code >= 200) && (code < 300);
+
+                portENTER_CRITICAL(&webhookMux);
+                // If the URL was changed while we were sending, the result is for the old
+                // one and the target has already been reset by webhook_configure()
+                bool same = (strcmp(t.url, url) == 0);
+                if (same)
+                {
+                    t.lastCode = code;
+                    if (ok)
+                    {
+                        t.delivered++;
+                        t.latencyTotal += latency;
+                        t.latencyMax = std::max(t.latencyMax, latency);
+                        t.backoff = WEBHOOK_BACKOFF_MIN_MS;
+                        // Event may have been overwritten while we were sending it, drop check above will catch that
+                        t.next = e.seq + 1;
+                    }
+                    else
+                    {
+                        t.failures++;
+                        t.retryAt = millis() + t.backoff;
+                        wait = std::min(wait, t.backoff);
+                        t.backoff = std::min(t.backoff * 2, (uint32_t)WEBHOOK_BACKOFF_MAX_MS);
+                    }
+                }
+                portEXIT_CRITICAL(&webhookMux);
+                if (!ok || !same)
+                    break;
+            }
+        }
+    }
+}
+
+/****************************************************************************
+ * Copy target URLs from settings, call after they are changed
+ */
+void webhook_configure()
+{
+    std::string urls[WEBHOOK_MAX_TARGETS] = {userConfig->getWebhookURL1(), userConfig->getWebhookURL2()};
+    portENTER_CRITICAL(&webhookMux);
+    for (uint8_t i = 0; i < WEBHOOK_MAX_TARGETS; i++)
+    {
+        webhookTarget &t = targets[i];
+        if (strcmp(t.url, urls[i].c_str()) == 0)
+            continue;
+        // At boot a target starts with events restored from before reboot, if
+        // changed later it only gets new events.
+        strlcpy(t.url, urls[i].c_str(), sizeof(t.url));
+        t.next = webhookTask ? nextSeq : oldest_seq();
+        t.retryAt = 0;
+        t.backoff = WEBHOOK_BACKOFF_MIN_MS;
+        // Statistics are for the new URL only
+        t.delivered = 0;
+        t.failures = 0;
+        t.dropped = 0;
+        t.lastCode = 0;
+        t.latencyTotal = 0;
+        t.latencyMax = 0;
+    }
+    portEXIT_CRITICAL(&webhookMux);
+    if (webhookTask)
+        xTaskNotifyGive(webhookTask);
+}
+
+void setup_webhook()
+{
+    if (webhookTask)
+        return;
+
+    RINFO(TAG, "=== Setup webhooks");
+    // Restore events that were not delivered before a reboot
+    if (nvRam->readBlob(nvram_webhook_q, (char *)&saved, sizeof(saved)) && (saved.magic == WEBHOOK_SAVE_MAGIC))
+    {
+        memcpy(queue, saved.events, sizeof(queue));
+        firstSeq = saved.firstSeq;
+        nextSeq = saved.nextSeq;
+        RINFO(TAG, "Restored webhook events %lu to %lu", oldest_seq(), nextSeq - 1);
+        nvRam->erase(nvram_webhook_q);
+    }
+
+    for (uint8_t i = 0; i < WEBHOOK_MAX_TARGETS; i++)
+        targets[i].url[0] = 0;
+    webhook_configure();
+    webhookTask = xTaskCreateStatic(webhook_task, "webhook", WEBHOOK_STACK_SIZE, NULL, 1, webhookStack, &webhookTaskBuffer);
+}
+
+/****************************************************************************
+ * Called before a planned reboot, only writes flash if there is anything to save
+ */
+void webhook_save()
+{
+    portENTER_CRITICAL(&webhookMux);
+    uint32_t undelivered = nextSeq;
+    for (uint8_t i = 0; i < WEBHOOK_MAX_TARGETS; i++)
+    {
+        if (targets[i].url[0])
+            undelivered = std::min(undelivered, std::max(targets[i].next, oldest_seq()));
+    }
+    saved.magic = WEBHOOK_SAVE_MAGIC;
+    saved.firstSeq = undelivered;
+    saved.nextSeq = nextSeq;
+    memcpy(saved.events, queue, sizeof(queue));
+    portEXIT_CRITICAL(&webhookMux);
+
+    if (undelivered < saved.nextSeq)
+    {
+        RINFO(TAG, "Save %lu undelivered webhook events", saved.nextSeq - undelivered);
+        if (!nvRam->writeBlob(nvram_webhook_q, (const char *)&saved, sizeof(saved)))
+            RERROR(TAG, "Failed to save %u bytes of webhook events, they will be lost", sizeof(saved));
+    }
+}
+
+/****************************************************************************
+ * Turn state changes into events, called from main loop when door state is published
+ */
+void webhook_door_changed(const GarageDoor &from, const GarageDoor &to)
+{
+    // State found at boot is not a change
+    if (!webhookTask || !to.active || !from.active)
+        return;
+
+    if (to.current_state != from.current_state)
+        add_event("door", DOOR_STATE(to.current_state));
+    if (to.obstructed != from.obstructed)
+        add_event("obstruction", to.obstructed ? "obstructed" : "clear");
+}
+
+void webhook_vehicle_changed(const char *status)
+{
+    if (webhookTask)
+        add_event("vehicle", status);
+}
+
+// Print webhook statistics as JSON object members (caller provides the braces)
+void webhook_print_metrics(Print &out)
+{
+    out.printf("\"webhookEvents\": %lu,\n\"webhooks\": [", nextSeq - 1);
+    bool first = true;
+    for (uint8_t i = 0; i < WEBHOOK_MAX_TARGETS; i++)
+    {
+        webhookTarget &t = targets[i];
+        if (!t.url[0])
+            continue;
+        out.printf("%s\n{\"target\": %d, \"delivered\": %lu, \"failures\": %lu, \"dropped\": %lu, \"pending\": %lu, "
+                   "\"lastCode\": %d, \"latencyAvgMs\": %lu, \"latencyMaxMs\": %lu}",
+                   first ? "" : ",", i + 1, t.delivered, t.failures, t.dropped,
+                   (nextSeq > t.next) ? nextSeq - std::max(t.next, oldest_seq()) : 0,
+                   t.lastCode, t.delivered ? t.latencyTotal / t.delivered : 0, t.latencyMax);
+        first = false;
+    }
+    out.printf("\n],\n");
+}
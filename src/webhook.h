@@ -0,0 +1,36 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ */
+#pragma once
+
+// C/C++ language includes
+#include <stdint.h>
+
+// Arduino includes
+#include <Print.h>
+
+// RATGDO project includes
+#include "ratgdo.h"
+
+#define WEBHOOK_MAX_TARGETS 2
+#define WEBHOOK_URL_SIZE 128
+// Events waiting for delivery, oldest is dropped when full
+#define WEBHOOK_QUEUE_LEN 32
+// Retry backoff doubles from minimum to maximum after each failure (milliseconds)
+#define WEBHOOK_BACKOFF_MIN_MS 1000
+#define WEBHOOK_BACKOFF_MAX_MS (5 * 60 * 1000)
+#define WEBHOOK_TIMEOUT_MS 3000
+
+extern void setup_webhook();
+extern void webhook_door_changed(const GarageDoor &from, const GarageDoor &to);
+extern void webhook_vehicle_changed(const char *status);
+extern void webhook_configure();
+extern void webhook_save();
+extern void webhook_print_metrics(Print &out);
@@ -0,0 +1,2334 @@
+/**************************************
+ * Autogenerated DO NOT EDIT
+ **************************************/
+#include <unordered_map>
+#include <string>
+const unsigned char src_www_build_favicon_png_gz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x08,0xA3,0x04,0xD5,0x6A,0x02,0xFF,0x66,0x61,
+  0x76,0x69,0x63,0x6F,0x6E,0x2E,0x70,0x6E,0x67,0x00,0x01,0x8C,
+  0x03,0x73,0xFC,0x89,0x50,0x4E,0x47,0x0D,0x0A,0x1A,0x0A,0x00,
+  0x00,0x00,0x0D,0x49,0x48,0x44,0x52,0x00,0x00,0x00,0x40,0x00,
+  0x00,0x00,0x40,0x08,0x04,0x00,0x00,0x00,0x00,0x60,0xB9,0x55,
+  0x00,0x00,0x03,0x53,0x49,0x44,0x41,0x54,0x78,0xDA,0xED,0xD9,
+  0x5D,0x68,0x56,0x75,0x1C,0xC0,0xF1,0xCF,0xB6,0x67,0xD3,0xA5,
+  0xD0,0x8B,0xDA,0x8B,0x2F,0x63,0x99,0x49,0x45,0x50,0x52,0x64,
+  0x94,0x2F,0x44,0x4A,0x41,0x74,0x33,0x62,0x17,0x42,0x63,0x14,
+  0x48,0x77,0xBB,0xA9,0x96,0x78,0x33,0xA8,0x8B,0x09,0x12,0xAC,
+  0xBB,0x4A,0x1C,0x3D,0x17,0x85,0x76,0x63,0x8E,0xD1,0xC5,0xF2,
+  0x22,0x0C,0xA1,0xA8,0x24,0xEC,0x85,0x4D,0xD7,0xDA,0x56,0x39,
+  0xDD,0xC0,0xCC,0xA5,0x39,0xDC,0x7E,0xC1,0x73,0xB5,0x87,0xA7,
+  0x8D,0xE7,0x3C,0xCF,0x79,0xA6,0xC2,0xBE,0xDF,0xBB,0x3F,0xE7,
+  0x7F,0xF8,0xF2,0x3F,0xE7,0xFC,0x0F,0x87,0xE3,0x66,0x27,0x23,
+  0xE3,0xBA,0x51,0xE5,0x65,0x67,0xFD,0x69,0x97,0xEB,0xC2,0x46,
+  0x7D,0x42,0x4E,0x5F,0x7A,0xD8,0x82,0xB2,0xDC,0x7E,0x53,0xC2,
+  0x39,0x2D,0x5A,0x9C,0x13,0xA6,0xEC,0xB3,0xCC,0x02,0xF1,0xA2,
+  0x61,0x61,0x5A,0xD6,0x4A,0x70,0x9B,0x2E,0xD7,0x84,0x3F,0xB4,
+  0xA8,0x38,0x1B,0x7C,0x2E,0x84,0xEF,0x6C,0x36,0x9B,0x4D,0x4E,
+  0x08,0xE1,0x98,0x07,0x55,0x8C,0x7A,0x1D,0xFE,0x15,0x2E,0x68,
+  0x53,0x83,0x7C,0xAA,0xB4,0x18,0x17,0xA6,0x74,0x59,0x5E,0x99,
+  0x85,0xFF,0x55,0x98,0x91,0x75,0xA7,0xB9,0xB8,0x43,0x97,0x69,
+  0x61,0xD4,0x4B,0x52,0x65,0xAD,0x4F,0x85,0xF0,0x83,0xA7,0x31,
+  0x3F,0x8F,0xFB,0x46,0x08,0x3D,0xEE,0x95,0x0A,0xB5,0xDA,0x5C,
+  0x12,0x26,0xB5,0xCB,0x28,0x86,0x6A,0xBB,0x5D,0x14,0x2E,0xEB,
+  0xB0,0x44,0x99,0x3C,0xE3,0x67,0x21,0xF4,0x58,0x27,0x09,0x77,
+  0xCB,0x9A,0x11,0x4E,0x7B,0x5E,0xC9,0xAC,0x96,0x15,0xC2,0x80,
+  0xE7,0x94,0xC2,0x76,0x3F,0xCA,0xC5,0x6B,0x90,0x98,0x8C,0x36,
+  0x7F,0x0B,0xFF,0x94,0xB5,0x8C,0xB5,0xB3,0xCE,0x52,0x27,0x01,
+  0xDB,0x9C,0x92,0x6B,0xD7,0xA8,0x5C,0xD6,0xC8,0x0A,0xA1,0xDF,
+  0xCE,0x64,0x57,0x6F,0xD0,0x0B,0xD2,0xE2,0x59,0xBF,0x08,0xA1,
+  0xC7,0x5A,0xF3,0x52,0xAD,0xC5,0x84,0xDC,0x66,0x62,0x99,0x34,
+  0x59,0xAA,0xC3,0x15,0xE1,0x2F,0x6D,0x6A,0xCC,0xC1,0x63,0xBE,
+  0x16,0xC2,0x31,0x0F,0xA8,0x04,0xF7,0xE9,0x15,0xC2,0x49,0x4F,
+  0x29,0x60,0xA5,0x03,0x66,0x84,0x11,0x4D,0x2A,0x49,0x93,0x11,
+  0x61,0xDA,0x87,0x56,0xC8,0xE3,0xAB,0x05,0x7B,0xA5,0x2E,0xB3,
+  0xCF,0x94,0x70,0x5C,0x1E,0x43,0xC2,0x56,0x0B,0xC5,0x56,0x61,
+  0xA8,0x30,0xA0,0xD1,0x42,0xD1,0xB8,0x18,0x30,0x7F,0xC0,0x6A,
+  0x3B,0x2A,0xE4,0xEA,0xE2,0x02,0xC6,0x44,0x85,0x3C,0x5B,0x5C,
+  0x40,0x08,0x7D,0xD2,0x37,0x44,0xF1,0x01,0xD2,0x67,0x31,0x20,
+  0x59,0xC0,0x8E,0xF4,0x4D,0x10,0x50,0x39,0x17,0x9F,0x82,0xF2,
+  0x02,0xD6,0x69,0xB6,0xBB,0x08,0x5F,0xB5,0x5D,0x75,0xFA,0x01,
+  0x6F,0x9A,0x12,0x45,0xFB,0xBD,0x7B,0xD2,0x0D,0xD8,0x22,0x5C,
+  0xD3,0xEB,0xFD,0x22,0x3C,0xE8,0x77,0xA1,0x27,0xDD,0x80,0x43,
+  0x42,0xA7,0x62,0x59,0x63,0xD2,0x8C,0x0D,0xE9,0x05,0xDC,0xEA,
+  0xB2,0x69,0xEB,0x14,0x4F,0x56,0xE8,0x48,0x2F,0xE0,0x35,0xE1,
+  0x0B,0x49,0xD8,0x29,0x0C,0xA9,0x4A,0x2B,0xE0,0x84,0xD0,0x22,
+  0x09,0xD5,0x46,0x84,0x6D,0xE9,0x04,0xDC,0x6F,0xC6,0xA4,0xE5,
+  0x92,0xD1,0x29,0x1C,0x48,0x27,0xE0,0x1D,0xE1,0x23,0x49,0x79,
+  0x48,0xB8,0xE8,0x96,0xF2,0x03,0x6A,0xFC,0x26,0x7C,0xA2,0x3D,
+  0xB1,0x17,0x84,0x5D,0xE5,0x06,0xD4,0x3A,0x24,0xCA,0x70,0x54,
+  0x43,0x79,0x01,0x59,0xE1,0x92,0xFD,0x3A,0x4B,0xF2,0x5B,0xE1,
+  0xA4,0x4C,0xE9,0x01,0x5B,0x84,0x2B,0x36,0x2B,0x95,0xDB,0x0D,
+  0x0B,0xCD,0xA5,0x07,0x74,0x0A,0xEF,0x02,0x56,0x58,0xA5,0x58,
+  0x56,0x59,0x01,0xD8,0x2B,0xBC,0x57,0x7A,0xC0,0x41,0xE1,0x15,
+  0x6C,0xF2,0x93,0x10,0xFA,0x3D,0x81,0x7A,0x67,0x84,0x42,0x8F,
+  0x83,0x27,0xF5,0x0B,0xE1,0x94,0x47,0xD1,0x2A,0x74,0x97,0x1E,
+  0xD0,0x2D,0xB4,0xCA,0x38,0x23,0x4C,0x18,0x17,0x46,0xD4,0x69,
+  0x14,0x73,0xC8,0x12,0xA3,0xC2,0xB8,0x09,0x61,0x40,0x4D,0x3A,
+  0x01,0x1B,0x85,0x31,0x75,0x32,0x86,0x84,0x47,0x14,0x4E,0x87,
+  0x21,0x81,0x4D,0xC2,0x90,0x8C,0x3A,0x63,0xC2,0x86,0x74,0x02,
+  0xEE,0x12,0xAE,0x6A,0xD6,0x64,0x52,0x68,0xD4,0x28,0x8C,0xD9,
+  0x21,0xDF,0x31,0x81,0xF5,0xC2,0xA4,0x26,0xCD,0xAE,0x0A,0xAB,
+  0xD2,0x09,0x30,0x6B,0x2F,0xF8,0x0C,0x0D,0xE2,0x7F,0x9D,0x06,
+  0x3D,0x42,0x4E,0x1F,0x93,0x56,0x40,0xAD,0x37,0x1C,0x71,0xD4,
+  0x5B,0x96,0xA0,0xC6,0x07,0xFA,0x14,0xFA,0x36,0x58,0x6A,0x8F,
+  0xA3,0x8E,0x78,0x5D,0x6D,0x5A,0x01,0x25,0x93,0x4E,0xC0,0x61,
+  0xED,0x65,0x78,0xB8,0xEC,0x80,0x72,0x2D,0x3F,0xA0,0x57,0xA7,
+  0x9C,0x42,0xE8,0x9C,0xD7,0xC2,0xE3,0x7A,0xD3,0xBC,0x07,0x42,
+  0x24,0xFC,0x00,0xA1,0xF5,0xA6,0x0A,0x18,0x36,0x98,0x33,0x3F,
+  0xE0,0xBC,0x41,0x39,0x13,0x05,0x0C,0xCA,0xE9,0xBC,0xD0,0x5D,
+  0x30,0x3E,0x5C,0x18,0xD0,0x2B,0x66,0xD9,0x0F,0xD8,0x2B,0xE4,
+  0x8F,0x17,0xC3,0x69,0x91,0xE7,0x1E,0xC0,0x80,0x98,0x65,0xAF,
+  0x3C,0xEA,0xAC,0x9F,0x65,0x3D,0xA0,0x4A,0x83,0xFC,0xF1,0x62,
+  0xA8,0xCF,0x9B,0xD3,0xA0,0x0A,0x85,0xE3,0x75,0x37,0xC8,0xEF,
+  0xF7,0xFF,0x00,0x8F,0x3E,0x11,0xE1,0x4A,0x98,0x2C,0x57,0x00,
+  0x00,0x00,0x00,0x49,0x45,0x4E,0x44,0xAE,0x42,0x60,0x82,0xAC,
+  0xFD,0x5E,0x54,0x8C,0x03,0x00,0x00,
+};
+const unsigned int src_www_build_favicon_png_gz_len = 943;
+
+const unsigned char src_www_build_auth_gz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x08,0xA3,0x04,0xD5,0x6A,0x02,0xFF,0x61,0x75,
+  0x74,0x68,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,
+};
+const unsigned int src_www_build_auth_gz_len = 25;
+
+const unsigned char src_www_build_style_css_gz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x08,0xA3,0x04,0xD5,0x6A,0x02,0xFF,0x73,0x74,
+  0x79,0x6C,0x65,0x2E,0x63,0x73,0x73,0x00,0xC5,0x58,0x69,0x6F,
+  0xDB,0x36,0x18,0xFE,0xBE,0x5F,0x21,0xA4,0x28,0x9A,0x14,0x96,
+  0x22,0x3B,0x57,0x23,0x63,0x40,0xB7,0x76,0x2B,0x8A,0x01,0x5B,
+  0xB1,0x15,0xFB,0xB0,0x21,0x1F,0x28,0x91,0xB6,0x88,0x50,0xA4,
+  0x46,0xD2,0x71,0x5C,0xC1,0xFF,0x7D,0x2F,0x0F,0x59,0x94,0x2C,
+  0x27,0x01,0x7A,0x49,0x39,0x24,0x1E,0xEF,0xF1,0xBC,0x27,0x75,
+  0xFA,0xF2,0x73,0xAE,0x1F,0xA2,0x97,0xD1,0x5F,0x7A,0xC3,0x88,
+  0x2A,0x09,0xD1,0xD1,0x42,0xC8,0xE8,0xCF,0x9F,0x3E,0xBE,0x7D,
+  0xF7,0x47,0xB4,0x26,0x79,0xA4,0x34,0xD2,0x2B,0x15,0xD5,0x68,
+  0x49,0xCC,0x42,0xF3,0xFB,0x46,0xD4,0x1B,0x49,0x97,0xA5,0x8E,
+  0x8E,0x8B,0x93,0x68,0x96,0xCE,0xCE,0xE2,0xD9,0x79,0xF4,0x16,
+  0xDD,0x51,0x1C,0xFD,0x46,0xA4,0x9C,0x44,0xA5,0xD6,0xB5,0xCA,
+  0x4E,0x4F,0x97,0x54,0x97,0xAB,0x3C,0x29,0x44,0x75,0x8A,0x6F,
+  0x61,0xE6,0xF2,0x1C,0xF6,0xC3,0xCF,0xE7,0x5C,0xA7,0xD1,0xCB,
+  0x26,0x17,0xF7,0xB1,0xA2,0x9F,0x28,0x5F,0x66,0xB9,0x90,0x98,
+  0xC8,0x18,0x46,0xB6,0xA5,0xAE,0xD8,0x24,0x17,0x78,0xD3,0xE4,
+  0xA8,0xB8,0x5D,0x4A,0xB1,0xE2,0x38,0x2E,0x04,0x13,0x32,0xC3,
+  0x48,0xC2,0x00,0xDA,0xCC,0xC5,0x1D,0x91,0x0B,0x26,0xD6,0xF1,
+  0x7D,0x56,0x52,0x8C,0x09,0x9F,0x2F,0x04,0xD7,0xF1,0x02,0x55,
+  0x94,0x6D,0xB2,0xBF,0x89,0xC4,0x88,0xA3,0xC9,0x3B,0xC2,0xC9,
+  0x1D,0x9A,0x7C,0x44,0xA5,0xA8,0xD0,0x44,0x21,0xAE,0x62,0x45,
+  0x24,0x5D,0xB8,0xC5,0xC0,0x99,0x64,0x67,0x77,0xEB,0x2D,0xE5,
+  0xF5,0x4A,0x4F,0xEC,0xDF,0x7F,0xF5,0xA6,0x26,0x3F,0x1E,0x2D,
+  0x28,0x23,0x47,0x37,0x59,0x16,0x03,0x74,0xB7,0x14,0xE8,0xC2,
+  0x7B,0xBC,0xAA,0x99,0x40,0x38,0xCE,0x57,0x5A,0x0B,0x3E,0xBA,
+  0xDC,0x2E,0x53,0x84,0x91,0x42,0x0B,0xE9,0x17,0x1E,0x50,0x42,
+  0x30,0x10,0x5A,0x0A,0x3C,0x77,0x63,0xEB,0x92,0x6A,0x32,0xF7,
+  0x20,0x28,0x63,0xC5,0x4C,0x09,0x46,0x71,0x3B,0x34,0xB2,0x4A,
+  0x8B,0x3A,0x66,0x64,0xA1,0x63,0x89,0x30,0x5D,0xA9,0xEC,0xA2,
+  0xBE,0x0F,0xA7,0xAC,0x65,0x47,0xE6,0x72,0x01,0x52,0x55,0x8F,
+  0x4D,0x1F,0x20,0xBC,0xA6,0x58,0x97,0xD9,0x14,0x06,0x2C,0x82,
+  0x6B,0x62,0xA8,0x80,0xED,0x18,0x0E,0x20,0x9D,0xDD,0xAD,0xE7,
+  0x35,0xC2,0xD8,0x98,0xD5,0xEC,0x2D,0x56,0x52,0x81,0xF0,0xB5,
+  0xA0,0x5C,0x13,0xB9,0x0D,0x81,0x33,0x1C,0xC4,0xD1,0x4D,0x0F,
+  0xCC,0xA2,0x24,0xC5,0x2D,0xF8,0xC1,0xD1,0x4D,0x03,0x46,0xD6,
+  0xB4,0x40,0x2C,0x46,0x8C,0x2E,0x79,0x56,0x81,0xA5,0x19,0x99,
+  0xA3,0xA2,0x20,0xC0,0x6B,0x04,0x4C,0x47,0x3B,0x51,0x00,0x1C,
+  0x91,0x4D,0x6B,0x3C,0x54,0xD7,0x04,0x49,0xC4,0x0B,0x92,0x71,
+  0xC1,0x61,0xFF,0xE0,0x7D,0x9C,0x4B,0x85,0xE4,0x92,0xF2,0x2C,
+  0xF5,0xAA,0xC3,0x43,0xAB,0x53,0x3A,0x2F,0x9D,0xDE,0x53,0x8B,
+  0xCC,0xD0,0xBC,0x1A,0x48,0xAB,0x1A,0x49,0x90,0xB1,0x85,0xAD,
+  0x03,0xB2,0x27,0x61,0xE7,0x5F,0xEE,0x3D,0x96,0x2B,0xCE,0x51,
+  0x0E,0x3E,0x04,0x34,0x8A,0xDB,0xC6,0xB3,0x39,0x1B,0xE3,0xF2,
+  0xEC,0xE7,0xD4,0xDC,0x0F,0xD3,0x83,0xA8,0xAD,0xF2,0x27,0xE3,
+  0xE0,0x8D,0x7B,0x05,0xEC,0x5A,0x05,0xAF,0x3A,0xD3,0xB7,0x3A,
+  0xA4,0xCF,0x77,0x88,0xC0,0xA4,0x43,0xC9,0x38,0x5C,0x16,0x5F,
+  0xF5,0xE4,0x1C,0xBA,0xF9,0x88,0x13,0x74,0x62,0x57,0xE2,0x13,
+  0x30,0xE0,0xCB,0xCF,0xD0,0x3C,0x20,0x61,0xB5,0xFE,0x96,0xDA,
+  0xB8,0x90,0x3F,0xE0,0xAE,0x5D,0x60,0x4C,0x49,0xF5,0x40,0x88,
+  0x7F,0xDF,0x78,0xF6,0x4F,0x17,0x20,0x62,0x18,0xBB,0x81,0x8F,
+  0xAC,0xB8,0x22,0x7A,0x8B,0xE9,0x5D,0x53,0x0B,0x45,0x35,0x15,
+  0x3C,0x33,0x45,0x85,0x16,0x73,0x48,0xC4,0x48,0x67,0x86,0xC5,
+  0x88,0xB5,0x7E,0x49,0xCD,0xDD,0xCF,0x63,0xCF,0xCE,0x52,0x73,
+  0xEF,0x38,0x4D,0x01,0x7C,0x43,0x39,0x81,0xEC,0x0C,0x20,0xBA,
+  0x5A,0xE5,0x2D,0x78,0x75,0xF1,0x7C,0x97,0xED,0xDB,0x5C,0xBF,
+  0x13,0x40,0x12,0x06,0x12,0xDC,0x91,0xB9,0xC6,0x19,0xD7,0x65,
+  0x5C,0x94,0x94,0xE1,0xE3,0xE9,0x49,0xA3,0xC9,0xBD,0xF6,0x66,
+  0xB0,0xC8,0x6C,0x2D,0xF9,0xFF,0x64,0x21,0x30,0xF1,0x84,0x67,
+  0x40,0xB8,0x42,0xF7,0x1E,0x83,0x59,0x6A,0x1C,0xE0,0x51,0x46,
+  0x96,0xCC,0x62,0xC5,0x98,0xDD,0xD5,0x3A,0x59,0x9A,0x86,0xA4,
+  0x5E,0x3D,0x8D,0xD4,0xC0,0x42,0x23,0x1E,0xE1,0x67,0x3A,0x23,
+  0x79,0xBC,0xAC,0x35,0xAD,0xC3,0xB6,0x03,0x56,0x47,0x3B,0xD2,
+  0x03,0x62,0xC6,0xA3,0x38,0x3A,0x88,0x46,0x49,0x90,0x49,0x93,
+  0xDF,0x47,0x87,0x9E,0xF8,0x26,0xE0,0x2E,0x82,0x77,0xB7,0xC9,
+  0xE6,0xCB,0x16,0x6F,0xD3,0xB8,0x34,0x3E,0x27,0xA3,0x95,0x16,
+  0x7B,0xB2,0xFA,0x20,0xB7,0x73,0x8F,0xCB,0xED,0x5C,0xD6,0xA6,
+  0xBD,0x91,0x88,0x0C,0xE5,0x4A,0xF7,0xE5,0x6A,0xBD,0xD5,0x94,
+  0x21,0x00,0x30,0x40,0xD7,0x8D,0x84,0x3A,0x3A,0x05,0x84,0xD0,
+  0x7D,0xA4,0x83,0xA4,0x30,0x3B,0x00,0x4A,0x00,0x42,0xC2,0xC4,
+  0x52,0x34,0x61,0x87,0xF3,0xE2,0x8D,0x58,0x49,0x4A,0x64,0xF4,
+  0x3B,0x59,0xBF,0x98,0xF8,0x97,0x49,0x25,0xB8,0x80,0xD2,0x53,
+  0x40,0x3C,0x74,0x32,0xD9,0xB8,0xB4,0x9D,0x43,0x6C,0xE7,0xB2,
+  0x5A,0x92,0xFD,0xF2,0xDD,0x15,0xB7,0x5D,0xE1,0xC3,0x54,0xD5,
+  0x0C,0x6D,0x32,0xCA,0x19,0xE5,0x24,0x5E,0x4A,0x8A,0xB7,0xF5,
+  0xBE,0x28,0x4F,0x6B,0xB6,0x3C,0x2F,0x2E,0x64,0x85,0xD8,0xA0,
+  0x59,0x68,0x39,0x82,0xA6,0x20,0x5B,0xC0,0xC1,0x01,0x94,0x5C,
+  0xEC,0xD6,0xB4,0xA0,0xC4,0xB0,0xCD,0x22,0xCB,0x51,0x45,0x9A,
+  0x07,0x7A,0x91,0x73,0xD8,0x3A,0xC4,0x62,0x44,0x55,0x4F,0xDD,
+  0xC6,0x55,0x27,0x91,0xB5,0xBF,0x63,0xDF,0x96,0x10,0x63,0xBB,
+  0x16,0x97,0x05,0x23,0xF7,0x5B,0x8D,0x9B,0x5D,0x16,0x03,0xE3,
+  0x0D,0x4A,0x00,0x10,0xD8,0x6A,0x53,0xD1,0x21,0xB3,0x69,0x0D,
+  0x8B,0x54,0xA4,0xF1,0x64,0x30,0xC2,0x50,0x4E,0x98,0x1F,0xAC,
+  0x91,0x52,0x6B,0x70,0xC8,0x6E,0xD9,0x6E,0xC4,0x2E,0x7B,0xB4,
+  0xC6,0xA4,0xC9,0x2B,0x52,0xED,0xF3,0x4C,0x42,0x26,0xE1,0xF8,
+  0xFB,0x0F,0x07,0xD8,0x27,0x0F,0xF1,0x1B,0x26,0x94,0x9E,0x00,
+  0xD7,0xFB,0x02,0xB8,0x5A,0xFD,0xF1,0x1F,0xD7,0x69,0x8F,0x4E,
+  0xBE,0xFF,0x60,0xFF,0x37,0x43,0x4A,0x49,0x25,0x30,0x62,0x4D,
+  0x0B,0xBA,0x0D,0xD9,0x5D,0x3C,0x2F,0xE8,0x3D,0xC1,0xF3,0x4F,
+  0x31,0xE5,0x98,0xDC,0x67,0xD3,0x5E,0xE0,0x4E,0x6D,0x5A,0x68,
+  0x43,0x78,0x97,0x32,0x83,0x20,0x0C,0x8D,0xBA,0x4B,0x19,0x36,
+  0x81,0xEC,0x95,0x31,0xB9,0xCC,0xD1,0x71,0x3A,0xB1,0x77,0x72,
+  0x7E,0xE2,0xA5,0x82,0x49,0x88,0x77,0xAE,0x9B,0x83,0x65,0x2F,
+  0xCC,0x58,0xAD,0x9F,0xCC,0xD2,0x5D,0x01,0x36,0x3E,0x13,0xD9,
+  0x9C,0x13,0xD9,0x63,0x8D,0x13,0xEE,0xBA,0x97,0x8A,0xAF,0xEC,
+  0xFA,0x2E,0x61,0x6D,0x93,0x82,0x09,0x45,0x1A,0xCF,0x08,0xD9,
+  0xCB,0xCF,0x0F,0x8D,0x31,0x7B,0x35,0xD2,0xAA,0x7B,0x02,0x59,
+  0x69,0x74,0x9E,0xF8,0x97,0x85,0x28,0xA0,0xE4,0x3A,0x9A,0x39,
+  0x03,0x75,0x9C,0x8D,0x31,0x29,0x84,0x44,0x16,0x6B,0x8B,0xFC,
+  0xA0,0xF1,0x59,0x50,0xC2,0x30,0x18,0xB2,0xD9,0x53,0x67,0x77,
+  0x52,0xEB,0xF0,0xB6,0x01,0x0B,0xB6,0x6F,0x86,0xE9,0xD9,0xDB,
+  0x81,0x72,0x30,0x2A,0x24,0x87,0xC0,0x42,0xDF,0xA8,0x68,0x3E,
+  0x52,0x87,0xEC,0x79,0x07,0x82,0x1D,0x52,0x20,0x08,0x9D,0xBA,
+  0x67,0x55,0x4A,0xCA,0x6F,0xC1,0xE7,0xEC,0x5B,0x8E,0x14,0x55,
+  0xD6,0xCC,0xAD,0x96,0xD1,0xD3,0x8E,0x7F,0x7B,0xB9,0x2B,0x3C,
+  0xE9,0x85,0x8D,0x55,0xD8,0x3F,0x85,0x47,0x0C,0xEF,0x61,0x46,
+  0x46,0xB1,0xD2,0x26,0x53,0x8F,0x59,0xAA,0x73,0xBE,0xBB,0x75,
+  0x34,0x35,0x49,0xD1,0x90,0x70,0xD8,0xA6,0xC9,0x99,0xEA,0x67,
+  0xE4,0x81,0x0E,0xCE,0x53,0xF6,0x35,0x61,0x46,0x6A,0x6B,0xE4,
+  0xC0,0x6F,0x06,0x7B,0x13,0x54,0x18,0xBB,0xED,0x6F,0x56,0x94,
+  0x01,0xD1,0xB1,0x9D,0x6D,0x50,0xF5,0x42,0x7E,0x3F,0x6C,0x7B,
+  0x0D,0x8A,0x0B,0xB0,0x2F,0xDC,0x9E,0xF4,0x6B,0xCE,0x74,0x70,
+  0x42,0x98,0xA6,0x3D,0xB7,0x98,0x3E,0xC1,0x2D,0xA0,0xB2,0xF9,
+  0xA6,0xAB,0x0B,0xEF,0x50,0xA5,0x36,0x02,0xCC,0xDE,0x2C,0x8D,
+  0xA6,0x91,0x4B,0x46,0x23,0x4A,0xD8,0x44,0xF0,0xCC,0x7C,0x8F,
+  0x30,0x86,0xF1,0xC1,0x37,0xDB,0x45,0x9F,0x75,0x1F,0x55,0x89,
+  0x5B,0x72,0xF0,0xC0,0xE3,0x74,0xE8,0xB6,0x60,0x5A,0x05,0xF1,
+  0x7A,0x15,0xB4,0x54,0xF6,0x19,0x71,0x5A,0xB9,0x3C,0xA0,0x6A,
+  0xCA,0xA3,0x29,0x94,0x2D,0x70,0x35,0x24,0x21,0x7B,0x2F,0x8C,
+  0xD8,0x70,0x8C,0xA6,0x8A,0xE6,0x94,0x51,0xBD,0x69,0xE3,0xBA,
+  0xCD,0xCB,0xD7,0xD7,0xD0,0xC1,0x60,0xE9,0xDB,0xA5,0x9D,0x95,
+  0x50,0x0E,0x9C,0x57,0xB0,0xD3,0xE6,0xE8,0x79,0xDB,0x5C,0xF9,
+  0x54,0x3D,0xF7,0xE1,0x19,0xA6,0xD0,0xED,0xEB,0x5B,0xB2,0x59,
+  0x48,0xA8,0xF9,0x2A,0x32,0x62,0x34,0x06,0xBC,0xC6,0xBA,0xF2,
+  0x02,0x1A,0x8B,0x4C,0x0A,0x38,0x39,0x90,0xE3,0xB3,0xCB,0x14,
+  0x93,0xE5,0xC9,0x76,0xFB,0xBA,0x22,0x98,0xA2,0x48,0x70,0xB6,
+  0x89,0x54,0x21,0x09,0xE1,0x11,0xE2,0x38,0x3A,0xAE,0xC0,0x84,
+  0x4E,0xCF,0xCB,0x4B,0x50,0xEE,0xA4,0xB1,0x5F,0x9B,0x82,0x96,
+  0xE3,0x3A,0x79,0xE5,0x5B,0xB7,0x20,0x92,0x77,0x75,0xFE,0x1C,
+  0x40,0xBB,0x6C,0x13,0xAB,0xDB,0x70,0x96,0xCC,0xDA,0xC3,0xFD,
+  0x57,0xFB,0x90,0xB4,0xC7,0xAE,0xDF,0x00,0xB9,0xE0,0xBD,0x4C,
+  0xCE,0x3B,0x37,0xB5,0x48,0xBA,0xC5,0xA1,0xE7,0x5E,0x27,0xD7,
+  0xE3,0xAD,0x96,0x9D,0x18,0xB6,0x5A,0x9E,0x59,0xBD,0xD7,0x97,
+  0xB9,0xF1,0x16,0xE4,0x63,0xA0,0xB7,0x80,0xB3,0x9B,0x0B,0xEF,
+  0x58,0x15,0x25,0xA9,0x88,0x4B,0x11,0x27,0x4D,0xBF,0x5C,0x4E,
+  0xEC,0x17,0x3E,0x90,0x7E,0x44,0xF7,0x03,0x1F,0xFE,0x1E,0x3C,
+  0x46,0x86,0x39,0xC4,0x81,0xD6,0x23,0xCC,0x57,0x55,0x4E,0xE4,
+  0xE0,0x2B,0x93,0xA9,0x6E,0x83,0xA1,0xB6,0xF9,0x39,0xBA,0x19,
+  0xE1,0xFF,0x6B,0x6A,0xEE,0xC7,0xF9,0x77,0xED,0xFE,0x04,0xB5,
+  0x25,0xFA,0x22,0x35,0xF7,0x23,0x48,0x99,0xB2,0xF0,0x25,0x80,
+  0xF2,0x32,0xF5,0x05,0xF5,0xE8,0x05,0xB5,0xE5,0xAB,0x01,0x35,
+  0x4B,0xCD,0xFD,0x38,0xFF,0x31,0xA0,0xFC,0x97,0x9D,0xED,0xFF,
+  0x8A,0x0C,0x50,0xE0,0x09,0x17,0x00,0x00,
+};
+const unsigned int src_www_build_style_css_gz_len = 1712;
+
+const unsigned char src_www_build_functions_js_gz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x08,0xA3,0x04,0xD5,0x6A,0x02,0xFF,0x66,0x75,
+  0x6E,0x63,0x74,0x69,0x6F,0x6E,0x73,0x2E,0x6A,0x73,0x00,0xCD,
+  0x7D,0x7D,0x5B,0xDB,0xC6,0xD2,0xF7,0xFF,0x7C,0x0A,0x55,0x57,
+  0x8B,0xA5,0x5A,0xC8,0x92,0xFC,0x6E,0x23,0x72,0xD1,0x40,0x1A,
+  0xEE,0x13,0x12,0x9E,0x00,0x6D,0x73,0x53,0x4A,0x84,0xB5,0xB6,
+  0x75,0x62,0x4B,0xAE,0x24,0x43,0x5C,0xE0,0x7C,0xF6,0x67,0x66,
+  0x5F,0xA4,0x95,0xFC,0x06,0x6D,0xAE,0xE7,0x39,0xB9,0x12,0xD0,
+  0xCB,0xEC,0xEC,0x6F,0x67,0x66,0x67,0x67,0x77,0x67,0x95,0xDA,
+  0x8F,0xDF,0xE6,0xCF,0x8E,0xF2,0xA3,0x32,0x8E,0xA6,0xE4,0x4B,
+  0x90,0xEE,0xC5,0x5E,0x3A,0xF2,0x23,0xE5,0x9E,0xDC,0x2A,0x33,
+  0x6F,0x44,0x94,0x7F,0x7B,0x77,0x5E,0x32,0x88,0x83,0x59,0xAA,
+  0x0C,0xE7,0xE1,0x20,0x0D,0xA2,0x30,0x01,0x7A,0x2C,0xF2,0x3A,
+  0x9A,0x2D,0xE2,0x60,0x34,0x4E,0x15,0x6D,0xA0,0x2B,0x8E,0xE5,
+  0xD4,0xF7,0x9C,0x86,0x72,0xE4,0xDD,0x05,0xBE,0xF2,0x2F,0x12,
+  0xC7,0x86,0x32,0x4E,0xD3,0x59,0xD2,0xAB,0xD5,0x46,0x41,0x3A,
+  0x9E,0xDF,0x9A,0x83,0x68,0x5A,0xF3,0xBF,0xC0,0x9B,0x56,0x83,
+  0xB1,0xA8,0xED,0xEC,0xDC,0x79,0xB1,0x92,0x90,0xF8,0x8E,0xC4,
+  0xE7,0xA9,0x97,0xCE,0x13,0xF7,0xE1,0xA9,0x8F,0xCF,0x06,0x63,
+  0x32,0xF8,0xF2,0x96,0x78,0x71,0x7A,0x4B,0xBC,0xD4,0x9D,0x87,
+  0x3E,0x19,0x06,0x21,0xF1,0xE9,0x4B,0x72,0x97,0x9E,0x47,0xF3,
+  0x78,0x40,0x4A,0xCF,0x7D,0x32,0xF1,0x16,0x8C,0xCF,0x9B,0xD0,
+  0xBD,0xBA,0xEE,0x0F,0x00,0x6D,0xAA,0x0C,0x26,0x01,0x09,0xD3,
+  0xCB,0xCB,0x93,0x23,0x77,0x3E,0x0F,0xFC,0xBB,0x86,0xA6,0xF3,
+  0x37,0x31,0xB9,0x8D,0xA2,0xF4,0x9C,0xC0,0x9D,0x9F,0xB8,0xB6,
+  0xC5,0x1F,0xA7,0xC1,0x94,0xFC,0x6F,0x14,0x92,0xE4,0xF2,0xE3,
+  0x3B,0x57,0x15,0xAD,0x88,0xBD,0x7B,0x93,0xB5,0x64,0x0E,0x88,
+  0x81,0x32,0x05,0xAE,0xB4,0x51,0xA1,0xB7,0xF0,0xE2,0x64,0x91,
+  0xA4,0x64,0x9A,0xD4,0x66,0x51,0x12,0x7C,0xBD,0x49,0xFF,0xBA,
+  0xF1,0x6F,0x6B,0x31,0x19,0x26,0xB5,0x31,0xF1,0xFC,0xA4,0x36,
+  0xF5,0xE0,0x75,0x5C,0xFB,0x0B,0xD9,0x9A,0x83,0xE4,0x4E,0x2D,
+  0xD5,0x75,0x44,0x86,0xDE,0x7C,0x92,0x26,0x6E,0x45,0x3D,0x4E,
+  0x07,0xB5,0xCB,0x8B,0xD7,0xAA,0xA1,0xC2,0x4F,0x4B,0xFD,0x3D,
+  0xAC,0x54,0x77,0x2A,0xEA,0xE1,0x94,0xC4,0xC1,0xC0,0xAB,0xBD,
+  0x27,0xF7,0x37,0x9F,0xA2,0xF8,0x0B,0xBC,0x3E,0x3E,0xBF,0x68,
+  0x1E,0x1F,0x5D,0x18,0xA7,0x75,0xD3,0x31,0x2D,0xE3,0xD4,0xB6,
+  0x4D,0xDB,0x5C,0x2A,0xF0,0x7A,0x0C,0x3F,0x47,0x11,0xD0,0xBF,
+  0x3E,0xBF,0x68,0xBD,0xDE,0x4A,0x7F,0x44,0x42,0x50,0x07,0x90,
+  0x9F,0x9E,0x5F,0xB4,0x4F,0xB7,0x92,0x9F,0x8D,0x23,0x12,0x06,
+  0x5F,0x39,0x7D,0xF9,0xED,0xBB,0x28,0xB9,0x39,0x0C,0x47,0x64,
+  0x42,0x12,0xA0,0x38,0x3B,0xBF,0xE8,0x9C,0x6D,0xE5,0x78,0x18,
+  0x0E,0xC6,0x51,0x0C,0xD6,0x07,0x25,0x0E,0xFF,0x75,0x7E,0xD1,
+  0x3D,0xFC,0xD7,0xDA,0x32,0x67,0xDE,0x20,0x18,0x06,0x83,0xDA,
+  0xDB,0x28,0x8C,0x26,0xF3,0xC9,0x1C,0x8A,0xBC,0x3D,0xBF,0xB0,
+  0x2D,0xB5,0x42,0x2D,0x22,0xD3,0xA4,0x1B,0x92,0x7B,0xE5,0x30,
+  0x8E,0xBD,0x05,0x28,0xBF,0xF0,0xE6,0x5D,0xE4,0xF9,0xC4,0x77,
+  0x87,0xDE,0x24,0x21,0x7D,0x61,0xE3,0x4A,0xFA,0xD7,0x45,0xC4,
+  0xC8,0x93,0x34,0xD6,0x1F,0xBC,0xD8,0x85,0xDF,0x66,0x32,0x9B,
+  0x04,0xA9,0x56,0x81,0xBA,0xF5,0xBE,0x17,0x9B,0xC3,0x28,0x3E,
+  0xF6,0x06,0x63,0x4D,0x83,0xE6,0x4D,0xC1,0x18,0x8C,0x00,0xCC,
+  0xF1,0xAB,0xEE,0x1E,0x00,0xFD,0x15,0xBD,0xBE,0x76,0xF9,0x2B,
+  0x33,0x99,0x04,0x03,0xA2,0xD9,0xC6,0x9E,0xAD,0x9B,0x31,0x99,
+  0x4D,0x3C,0xB8,0xAB,0x00,0xDA,0x8A,0x51,0xE9,0x03,0xB7,0x27,
+  0xBD,0x1F,0x93,0x74,0x1E,0x87,0x8A,0x17,0xF7,0x9F,0x76,0xBC,
+  0x64,0x11,0x0E,0xB2,0x1E,0xA7,0x4C,0x00,0xE3,0x85,0x00,0xAC,
+  0xE9,0x0F,0xAB,0xC1,0xD3,0x66,0xFD,0xF5,0xFA,0xFC,0x17,0x57,
+  0x55,0xE9,0xCD,0xD4,0xFB,0xFA,0x8E,0x84,0xA3,0x74,0xEC,0x5A,
+  0xFD,0x34,0x5E,0x3C,0x08,0xA3,0x4F,0x66,0x70,0x41,0x5C,0xEF,
+  0xDE,0x0B,0xA0,0x5B,0x93,0x14,0x9A,0x20,0x9B,0xBC,0xF1,0x30,
+  0x25,0xE9,0x38,0xF2,0x7B,0xEA,0xCF,0xC7,0x17,0xAA,0x31,0x80,
+  0x26,0x92,0x9E,0x1A,0x46,0x7B,0xF4,0x4A,0x35,0x62,0xE2,0x07,
+  0x31,0x19,0xA4,0x3D,0x75,0x18,0x4D,0x26,0xD1,0xBD,0xFA,0xA4,
+  0xEF,0x98,0x03,0x2F,0xA5,0x92,0x88,0xE3,0x28,0x46,0x09,0x60,
+  0x5D,0xD1,0x84,0x98,0xF7,0x5E,0x1C,0x6A,0x9F,0xCF,0xE2,0x68,
+  0x1A,0x24,0x04,0xEA,0xFE,0x37,0x61,0x4D,0xA2,0x84,0xAC,0xF2,
+  0x20,0x1C,0x51,0x75,0x28,0xD8,0x39,0x94,0x20,0x04,0xB1,0x4E,
+  0x3D,0x24,0xEA,0x29,0xDF,0x3F,0x50,0xBA,0xA7,0xCF,0x7A,0x3F,
+  0x1D,0xC7,0xD1,0xBD,0xA6,0x2E,0x71,0x52,0xA9,0xF0,0x82,0xA1,
+  0xF6,0x9D,0x68,0x98,0x19,0x7D,0x79,0x7C,0xCC,0x6E,0x12,0xEA,
+  0x0F,0xBE,0x73,0x5D,0xC7,0xB2,0xF4,0x12,0xAC,0x63,0x0A,0xE2,
+  0xE3,0x6B,0xA8,0xA7,0x44,0xFF,0xB4,0x05,0x9A,0x99,0x23,0x12,
+  0x4C,0x10,0xC8,0x0E,0x93,0x3F,0x93,0x6C,0xC6,0x32,0x25,0x5F,
+  0x53,0x0D,0xDF,0x52,0x21,0x3D,0x30,0x9A,0x72,0xC7,0xC7,0xC2,
+  0x42,0x09,0xE6,0x24,0x53,0x5B,0x66,0xC0,0xB4,0x54,0xC1,0x02,
+  0x73,0xF2,0xF5,0x86,0x98,0xD1,0xBC,0xD0,0x1E,0x41,0x9E,0xE5,
+  0xA2,0x1C,0xD4,0x41,0x66,0x55,0xFA,0x4E,0x6E,0x60,0x6B,0x88,
+  0x51,0x35,0x65,0x63,0x4D,0xE3,0x39,0xE9,0x0B,0x3D,0x4C,0xA2,
+  0x91,0xF6,0xF9,0xD4,0xFB,0x1A,0x4C,0xE7,0x53,0x85,0x95,0x51,
+  0xA2,0x21,0x95,0x39,0x15,0x39,0xF4,0x3A,0xD0,0x41,0x82,0x96,
+  0x90,0x55,0x86,0xD6,0xF0,0xB4,0x93,0x75,0x0E,0x94,0xB5,0xE8,
+  0x1C,0x58,0x05,0xF4,0x0F,0xDE,0x95,0xB0,0xCF,0x73,0x7B,0xD1,
+  0x34,0xD0,0x46,0x34,0xB9,0x23,0xC2,0x36,0x53,0xE8,0x54,0xD1,
+  0xCC,0xD5,0xE0,0xBE,0x0C,0xD0,0xA5,0x10,0x5F,0xF1,0x02,0x5A,
+  0xE9,0xB5,0xDE,0x4B,0x08,0xAD,0x2F,0x9A,0xA7,0x1A,0xF2,0xD0,
+  0xFB,0xF8,0x53,0xA3,0x66,0xB8,0xD4,0x73,0x81,0xF6,0x9C,0x0E,
+  0x6F,0x02,0x21,0x14,0x19,0x50,0x0B,0xCA,0x6D,0x91,0xCA,0xE0,
+  0x9C,0xA4,0x7C,0x20,0x94,0x0C,0x0E,0xF4,0x8A,0x2D,0x17,0x45,
+  0xB0,0xE1,0x68,0xE8,0x65,0x44,0x3B,0xCC,0xDE,0x96,0x05,0xC1,
+  0xC7,0x18,0xAA,0x12,0x57,0x32,0x17,0x78,0x70,0x82,0xCF,0xB4,
+  0xF4,0x2F,0x68,0xFE,0x5F,0x66,0x10,0x0E,0x26,0x73,0x1F,0x5C,
+  0x4B,0x06,0x8E,0x56,0x44,0xCB,0x1D,0xB8,0x56,0x09,0xEA,0x9B,
+  0x08,0x86,0x5D,0xC5,0x4B,0x01,0x19,0xA5,0x78,0x42,0x8C,0x65,
+  0x03,0x40,0xAC,0x0C,0x16,0x88,0xE0,0xE7,0xA3,0x0F,0x9A,0x2A,
+  0x28,0x54,0xA3,0x4C,0x8B,0x72,0x23,0xE0,0xC1,0x0A,0xD5,0xA8,
+  0x17,0x99,0x18,0xC2,0x08,0xDC,0x14,0x56,0x6A,0x28,0x29,0x99,
+  0x4C,0x32,0x39,0x45,0x0A,0x8C,0xC4,0x0A,0x0C,0x92,0xA6,0xBA,
+  0xBE,0x32,0x31,0x9C,0xF6,0xE9,0x60,0x0A,0x55,0x49,0xA6,0x33,
+  0x4D,0x2E,0x22,0xAC,0x46,0xF3,0xE7,0x31,0x57,0x0A,0xF5,0x9B,
+  0xC1,0x64,0x02,0x36,0xC3,0xA2,0x82,0x53,0x2F,0x1D,0x9B,0x43,
+  0x50,0x71,0xAC,0x65,0x64,0x3F,0xD8,0x16,0x38,0x93,0x1A,0xFC,
+  0xD4,0x8D,0x4D,0x74,0x35,0x4A,0xF7,0x43,0x0B,0xC8,0xA6,0x41,
+  0x38,0x4F,0xC9,0x1A,0x32,0x0D,0xE9,0x7E,0x04,0x32,0x46,0x3B,
+  0x86,0xE0,0x66,0x0B,0x25,0x23,0x76,0x1A,0xBA,0xE1,0x7B,0x8B,
+  0xED,0xB4,0x3F,0x02,0x25,0xE8,0x94,0x31,0xD6,0xE8,0xAF,0x7D,
+  0xDB,0xD2,0x5F,0xA9,0x96,0x5A,0xA5,0x77,0x3D,0xFA,0xB3,0x2F,
+  0x50,0x6A,0xFC,0x22,0x23,0xE2,0xF7,0x3D,0xFE,0xBB,0x2F,0x5A,
+  0xAD,0xF1,0x8B,0x8C,0x90,0xDF,0xF7,0xF8,0x6F,0x31,0xAA,0x21,
+  0xCA,0xAA,0xDA,0xE3,0xB5,0xD1,0x2B,0xCE,0x8A,0x5E,0x0B,0x6A,
+  0x49,0x37,0x69,0x34,0x1A,0x4D,0xC8,0xF9,0x22,0x41,0x63,0xD0,
+  0x1F,0xFC,0x68,0x30,0xA7,0x8E,0x6B,0x44,0xD2,0x63,0xE6,0xC3,
+  0x7E,0x5A,0x9C,0xF8,0x9A,0x9A,0x50,0x8A,0x0B,0xEF,0x76,0x42,
+  0x54,0x1D,0xBC,0xF7,0x02,0xEC,0xC7,0x0F,0xC0,0x4F,0x7A,0x0B,
+  0x57,0x4B,0xC7,0x41,0x62,0x92,0x3B,0x2C,0x97,0x7A,0x31,0x14,
+  0x35,0x69,0x60,0x09,0x7D,0xE6,0x95,0x9A,0xD2,0x22,0x38,0xB0,
+  0x81,0x99,0xB0,0x7E,0xB5,0x96,0xFA,0x81,0xC6,0x02,0xE6,0x10,
+  0x9C,0x89,0xB6,0x02,0x49,0xF2,0xD3,0xE2,0xF5,0xC4,0x4B,0x92,
+  0xF7,0x1E,0xD8,0x12,0x47,0x74,0x72,0x16,0x84,0xB3,0x79,0xAA,
+  0xEA,0x7A,0xE6,0x9E,0x45,0xDB,0x34,0xFA,0xE6,0x4D,0x40,0x26,
+  0xC0,0x39,0xBF,0x36,0xEF,0xBC,0xC9,0x9C,0xE0,0xE0,0xFD,0x54,
+  0x34,0x53,0x26,0x8A,0xD3,0x3F,0xD3,0x74,0x93,0x20,0xA6,0xF0,
+  0xFE,0x1F,0x8B,0x61,0x59,0x01,0x30,0x1C,0x06,0x83,0x93,0xB3,
+  0x8D,0x2A,0xE0,0x34,0xE9,0x7F,0x93,0x12,0x38,0xA6,0x6F,0xAC,
+  0x84,0xCC,0x8D,0x6F,0x10,0x87,0xF0,0x3D,0xFF,0x58,0x19,0x34,
+  0xEC,0xFB,0x5F,0x8C,0x3A,0xB4,0xAD,0x95,0x9D,0xF0,0x76,0xAE,
+  0x09,0x1E,0x19,0x17,0xF0,0x6A,0x29,0x34,0x76,0x48,0x2F,0xF8,
+  0x10,0xBD,0xEF,0xDA,0xF4,0xD1,0x0B,0x46,0x95,0xF5,0x81,0x07,
+  0x8E,0xAE,0x13,0x18,0xC9,0xA2,0x19,0x56,0xED,0x66,0xA8,0x07,
+  0x31,0xCC,0xE2,0x08,0x07,0xAE,0xA9,0xEC,0x35,0x38,0x63,0xA4,
+  0x45,0x64,0x79,0x58,0xC2,0xE2,0x1B,0x0C,0x41,0x18,0x11,0x0D,
+  0x9E,0x5C,0xA4,0xB9,0xB2,0xAE,0xC5,0x33,0xA6,0x23,0xFA,0xD0,
+  0xBE,0xEE,0xD3,0xC6,0x78,0xBE,0xAF,0xB1,0xB7,0x7C,0x20,0x66,
+  0xAC,0x8B,0x03,0x1F,0xBD,0xFF,0x30,0xD4,0xE4,0x19,0xA7,0x29,
+  0x5E,0x97,0x86,0x3C,0xCA,0x35,0x01,0x5C,0x83,0x94,0xB0,0xD1,
+  0xD2,0xA5,0x2F,0x0B,0x46,0x91,0xE4,0xD6,0xF7,0x06,0xCC,0x92,
+  0x71,0xD4,0x58,0x08,0xA9,0x53,0x49,0xF8,0xD0,0x6E,0x3A,0xF9,
+  0x38,0x82,0x0B,0x90,0x1D,0x48,0x4C,0xA3,0xA3,0xF2,0xD5,0x17,
+  0xB2,0x30,0x68,0x43,0xAE,0x21,0xE0,0xF9,0x70,0x8B,0xE1,0xAC,
+  0x09,0x8C,0xE2,0x80,0x64,0x1C,0xF4,0x87,0xE4,0x3E,0xC0,0xB8,
+  0x1A,0x68,0x61,0x10,0xF6,0x12,0xA2,0xCE,0x3C,0x88,0xBD,0x7D,
+  0xB5,0x07,0x58,0x69,0xE1,0x0D,0x76,0x38,0x0F,0x91,0x18,0x0C,
+  0x90,0x9B,0xF4,0x65,0xB8,0x87,0x0F,0x94,0xB7,0x30,0xD7,0xFF,
+  0x57,0x90,0xAA,0xFD,0xB5,0x25,0xFF,0x84,0xE9,0xAD,0xBF,0x6C,
+  0xBA,0xDC,0x2C,0xD7,0x16,0x8B,0x09,0xAD,0x60,0x0F,0x15,0xB3,
+  0x5C,0x38,0x08,0x27,0x30,0x53,0xDF,0xBB,0x85,0x18,0xE3,0x0B,
+  0xF4,0x2E,0x3A,0xE0,0x3F,0x1B,0xFB,0x47,0x02,0xA2,0x7E,0x06,
+  0xF2,0xCD,0x10,0xB6,0xE0,0x5F,0xD7,0xEC,0x12,0xF2,0x9D,0x5B,
+  0xB0,0xE6,0x2F,0x7D,0xAA,0x8E,0xF9,0x0C,0xFB,0x86,0xDA,0x5B,
+  0xC7,0x13,0x15,0x07,0x66,0x17,0x92,0xF8,0xED,0xC5,0xE9,0x3B,
+  0x37,0x0B,0x38,0x98,0xEE,0xFA,0x68,0x1D,0x26,0x8F,0x27,0x35,
+  0xB4,0x10,0x33,0x84,0x29,0x85,0xBE,0x27,0x5E,0xAF,0x43,0x0A,
+  0x7E,0x2E,0xFD,0x48,0x17,0x2F,0x0E,0xA1,0xD3,0x4B,0x15,0x50,
+  0x86,0x69,0xF4,0x0E,0xE2,0x38,0xF4,0xDD,0x18,0x3C,0x83,0xD1,
+  0x49,0x80,0x21,0x3A,0x3A,0x27,0x83,0x79,0x1C,0xA4,0x8B,0x8B,
+  0xC5,0xEC,0xF9,0xC8,0x19,0x62,0x17,0x9C,0xC5,0x2B,0x15,0x18,
+  0x54,0x15,0xB5,0x27,0x1E,0x39,0xE2,0x11,0xCC,0xCF,0xC1,0x77,
+  0x1D,0xC5,0x0B,0xE5,0x75,0x14,0xA6,0xDE,0x60,0x93,0xA2,0x46,
+  0x7E,0x04,0x83,0xBE,0x0D,0xE0,0xB9,0xF7,0x93,0x6A,0xD8,0x56,
+  0xCA,0x59,0x51,0xCA,0xD9,0x5C,0xCA,0x8F,0x17,0x03,0x8E,0x69,
+  0xB9,0x6C,0xBD,0x20,0x21,0x9F,0xDC,0xC1,0xD4,0x08,0x47,0x91,
+  0x67,0x0B,0x87,0xF2,0xC9,0xEB,0x4F,0x83,0x74,0x42,0xCA,0x0F,
+  0xCB,0xA0,0xC0,0x27,0x1C,0xE5,0x35,0xE9,0x26,0x9D,0x82,0x8D,
+  0xA3,0x89,0x4F,0x62,0x5E,0x54,0x36,0x33,0xF0,0x58,0x9B,0x11,
+  0x21,0xBF,0x4B,0x41,0xB5,0x85,0xDB,0x0C,0x46,0xC9,0xFB,0x28,
+  0xF6,0x3F,0x92,0x3F,0xE7,0xCC,0x9B,0xAC,0xE5,0x3A,0xBB,0x8F,
+  0xC9,0x9F,0x92,0xC8,0x96,0x78,0xBD,0x3B,0x3E,0x0A,0xFC,0xC9,
+  0x26,0x60,0x9C,0xC2,0x5A,0x21,0x78,0x88,0x19,0x71,0xAA,0xD5,
+  0x63,0xEB,0x17,0xDB,0x38,0xAC,0x36,0x96,0x97,0x70,0x58,0x6D,
+  0x38,0x32,0x07,0xA9,0x65,0x85,0xC5,0xC1,0x0D,0xED,0x63,0x74,
+  0x6F,0x31,0xAE,0xCD,0xFC,0x15,0xFD,0x59,0x6B,0x59,0xF0,0x57,
+  0x66,0x79,0x71,0xF1,0x3A,0xD9,0xC6,0x8F,0x9A,0x96,0xC4,0x65,
+  0x7D,0xA3,0x72,0x6E,0xBF,0x20,0xA1,0xBA,0x6C,0x91,0xB2,0x55,
+  0xC3,0x70,0xE6,0x85,0x03,0x72,0x4E,0x60,0x8A,0x15,0x6F,0x68,
+  0xCE,0x1D,0x19,0x07,0x83,0x09,0xF9,0x18,0xDD,0x2F,0x87,0x2E,
+  0xCC,0x2D,0xF1,0x30,0x65,0x2F,0x06,0x92,0xDE,0x36,0x9F,0xCA,
+  0xD9,0xC1,0xF4,0x36,0x05,0x5F,0xF4,0x4D,0x58,0x82,0xF3,0x23,
+  0xF1,0x4F,0xF3,0x34,0xC5,0x10,0x62,0x1D,0xBF,0x82,0xCF,0x16,
+  0x2C,0x25,0x79,0x70,0x5C,0x17,0x63,0x98,0xE6,0x63,0x3F,0xF9,
+  0x16,0x0A,0x29,0xF3,0x7C,0x7D,0xAA,0x6E,0xF0,0x12,0xDB,0x4A,
+  0x9F,0x84,0x83,0x71,0xA1,0x3C,0x9D,0xE4,0xC5,0x38,0x0F,0x66,
+  0xAD,0xAC,0x99,0x4E,0xB3,0x81,0xB3,0x50,0xB9,0x5D,0xC3,0x20,
+  0x9E,0xDE,0x7B,0x31,0xF9,0x85,0xC4,0x09,0xC6,0x58,0x7F,0xD3,
+  0x85,0x95,0xC1,0x95,0xD8,0x3A,0x9B,0x8D,0x0D,0x97,0x11,0x26,
+  0x27,0x67,0xDF,0xAA,0xF2,0x93,0x33,0x88,0xEE,0x40,0x2A,0xC9,
+  0x36,0xC7,0x96,0xCC,0x6F,0x43,0x92,0x9E,0x7A,0xC9,0x97,0x6F,
+  0x57,0x35,0x30,0x9C,0x22,0xC3,0x2D,0x55,0x8F,0x60,0xE0,0xBD,
+  0xF7,0x16,0xDF,0xB2,0xD1,0x9C,0xE5,0xB6,0x9A,0x43,0xF0,0xF8,
+  0x2C,0xA0,0xDD,0x54,0x39,0xB6,0x24,0x23,0xDC,0x2A,0x47,0x3E,
+  0x79,0xDA,0xD2,0x96,0xE2,0xA0,0xF0,0x77,0xA7,0x87,0x05,0x0F,
+  0xB0,0xAA,0xAB,0x8A,0xF9,0xF4,0xB7,0x92,0x6C,0xC6,0x6F,0x9B,
+  0x14,0x28,0xDD,0x59,0x14,0xA7,0xDF,0xB6,0x66,0xCA,0xF1,0x59,
+  0x75,0x1F,0x87,0xDF,0x48,0x03,0x9B,0xD6,0x48,0xB6,0xCA,0xDF,
+  0x0B,0x43,0x70,0x3A,0x03,0xF2,0x42,0x34,0x12,0x07,0x5C,0x9A,
+  0xF8,0x56,0x6D,0xD9,0xB0,0xCC,0xB1,0xB5,0x25,0xF7,0xE4,0x76,
+  0x1C,0x45,0x5F,0x2E,0x3F,0xBE,0xB3,0xD5,0x5E,0xE9,0x89,0xB3,
+  0x05,0x9E,0xAC,0x2E,0x56,0x93,0x58,0x10,0x87,0x28,0x86,0xDE,
+  0x57,0xD5,0x9A,0x69,0x9A,0x50,0x2F,0xEE,0x18,0xF6,0x6A,0xB5,
+  0x71,0x94,0xA4,0xBD,0x19,0x28,0xBB,0x36,0x03,0xCF,0xAD,0x96,
+  0x05,0xC2,0xD6,0x85,0x39,0x0E,0x7C,0x80,0xE1,0x9B,0x74,0x7B,
+  0x11,0xCD,0x82,0xC1,0x0B,0x86,0xA5,0x12,0xFB,0x67,0xD8,0xED,
+  0x46,0x0B,0x24,0x21,0x4A,0xF1,0xFD,0xC5,0x37,0x72,0x02,0x5B,
+  0x16,0x45,0xB6,0xAA,0x2E,0x5B,0xD0,0xCD,0x66,0xBE,0xD9,0x6C,
+  0x1E,0x57,0x0B,0xF6,0x61,0xC6,0xBE,0xBC,0xD6,0xCE,0xA7,0x51,
+  0x85,0x19,0x1B,0x4E,0x9D,0x8E,0xA2,0x28,0xBE,0x9C,0xE1,0x5C,
+  0xE9,0x10,0x65,0xF4,0xF7,0x26,0x61,0xE5,0x09,0xD2,0xCB,0x27,
+  0x6B,0xAB,0x67,0x6B,0x20,0x85,0xCB,0xF0,0x0B,0x40,0x08,0x39,
+  0xB4,0x4D,0xD3,0xB9,0x24,0x6B,0x70,0xA9,0x1D,0x14,0xFC,0x8F,
+  0x74,0xFD,0xB9,0x5F,0xDA,0x68,0xC8,0x36,0x19,0x70,0xDD,0x9E,
+  0xD7,0x70,0x79,0xF1,0x5A,0xB0,0xC7,0x95,0x7B,0xD9,0x96,0x22,
+  0x5C,0xE9,0xB8,0x88,0x83,0xD1,0x08,0xC6,0x7E,0x15,0x77,0x3F,
+  0x4E,0x0B,0x8F,0x84,0x94,0x0B,0x83,0x21,0x6E,0xDF,0xBE,0xC3,
+  0xE4,0x80,0x0F,0xDF,0x2C,0x04,0x99,0x20,0xBB,0x2C,0xEC,0x63,
+  0x96,0x2F,0x82,0x78,0x1A,0xBC,0x83,0xE0,0x68,0x95,0x0A,0xD6,
+  0x29,0x2E,0x87,0x43,0x75,0x19,0x19,0xEA,0x1F,0xD7,0x6A,0xC8,
+  0xB7,0xC2,0xE6,0x03,0xC3,0x35,0xD0,0xD4,0xD7,0x13,0x98,0xB3,
+  0xFA,0x2A,0xA0,0xFB,0x30,0x23,0xA1,0x82,0x75,0x03,0x3C,0xFA,
+  0x94,0xDD,0xAC,0x90,0x1C,0x04,0xAD,0xDF,0x14,0x1F,0x46,0xC1,
+  0xEB,0xF0,0x5D,0x86,0x09,0x2E,0x08,0x30,0x88,0x58,0xB3,0x80,
+  0x78,0x19,0x4E,0xB2,0xBB,0xC2,0x78,0x90,0x24,0x30,0x99,0x78,
+  0xE7,0x51,0x77,0xF5,0xCC,0x28,0x7D,0x8D,0xBA,0x90,0x86,0xAB,
+  0x8B,0x5D,0x96,0xD4,0x35,0x8C,0x09,0x39,0x89,0xBD,0xE9,0x5B,
+  0xE2,0xCD,0xD4,0x1E,0x7B,0xE1,0xB3,0x0D,0xD3,0x1E,0xEE,0x68,
+  0xBF,0x48,0x3A,0x4F,0x6C,0x8F,0x9A,0x6D,0x51,0x97,0x76,0x82,
+  0x79,0xAF,0x48,0x80,0x81,0x32,0x0F,0x63,0x98,0x56,0x8D,0xC2,
+  0xE0,0x2F,0xE2,0x2B,0x6C,0x25,0x4E,0x01,0x86,0xD8,0x5B,0xE0,
+  0x17,0xDD,0x7D,0x84,0x3F,0xE5,0x65,0x56,0xEA,0x07,0xF9,0x02,
+  0x20,0x70,0x9F,0x10,0x2F,0x16,0xBB,0x84,0xC5,0x64,0x16,0xBD,
+  0x7F,0x3F,0x0E,0x26,0x44,0x2B,0x64,0xAB,0xF0,0xB1,0x44,0x2F,
+  0x94,0x2B,0x52,0xCC,0x70,0x93,0x51,0xDF,0xB6,0x91,0xAF,0x32,
+  0xC0,0xE6,0xBF,0x13,0x94,0xFB,0x3F,0xDE,0x97,0xE7,0xCD,0xC7,
+  0x35,0x77,0xE5,0xE3,0xE1,0xC5,0xCF,0x47,0x1F,0x0C,0x05,0x10,
+  0x28,0xDE,0xC8,0x0B,0x42,0x05,0xFE,0x36,0x15,0xB1,0xE3,0xF3,
+  0x5F,0xB1,0x59,0xFF,0x7C,0xBC,0xEB,0x76,0xF0,0x0B,0xD9,0x48,
+  0xA5,0x8D,0x7C,0x14,0xAA,0xB4,0x91,0x5F,0xD2,0xCF,0x3C,0x19,
+  0x6B,0xD2,0xDE,0xB0,0x64,0x10,0x46,0x13,0xFD,0xB0,0x48,0xF1,
+  0xC0,0xF2,0x92,0x47,0x96,0x2B,0xD4,0xFB,0x85,0xA5,0xE9,0xD2,
+  0xAC,0xCB,0x55,0xEF,0x70,0xAB,0x6C,0x3D,0x41,0x7F,0xCD,0x7A,
+  0x74,0xA1,0x06,0x94,0x7E,0x96,0x41,0xF5,0xF8,0x98,0x5D,0x9A,
+  0xD0,0xBB,0x7C,0xDA,0x1C,0xBA,0x2A,0xC2,0x8D,0x0C,0x5E,0x7F,
+  0x5C,0x69,0x67,0x20,0x94,0xB4,0x46,0xB7,0x31,0x92,0x1A,0xCC,
+  0xBB,0x30,0x49,0xEC,0x96,0xBC,0x0A,0x7C,0x57,0xAD,0xE6,0x09,
+  0x57,0xB4,0x36,0x89,0xC5,0x26,0x05,0x73,0x35,0xC4,0x64,0x14,
+  0x60,0xAA,0x14,0x6A,0x73,0x08,0xF7,0xBC,0x67,0x9E,0x63,0xCF,
+  0x3C,0xA6,0xD5,0xA9,0x25,0x41,0x52,0x90,0x97,0xF1,0xC4,0xD5,
+  0x18,0x40,0xB9,0x3E,0x96,0x7A,0xA1,0x57,0x2B,0x88,0xAC,0x22,
+  0x21,0x2B,0x0E,0x8A,0x1F,0x79,0xA5,0xB4,0xC6,0x44,0xF2,0x05,
+  0xAC,0x81,0x6C,0xB3,0x9B,0xD5,0x82,0xE6,0x9D,0x27,0xA0,0xE1,
+  0xCA,0x3E,0x45,0xC5,0xEE,0x35,0x46,0x23,0x51,0xE0,0xC6,0x04,
+  0x25,0x78,0x87,0x15,0x80,0x43,0x82,0x08,0x16,0x66,0xB2,0x34,
+  0xBB,0x49,0xA3,0xDC,0x69,0xAF,0xDC,0xE4,0x2E,0x4A,0xB9,0x70,
+  0x92,0x89,0x69,0x72,0x8F,0x66,0xA3,0xFB,0xF9,0x31,0x1D,0xDA,
+  0xE1,0xAD,0xA1,0x84,0x91,0xC2,0xEB,0x02,0xA9,0x0E,0x48,0x70,
+  0x07,0xFE,0x0C,0xBA,0x40,0xDD,0xCA,0xFA,0x80,0x02,0x6E,0x17,
+  0x1C,0x1E,0x5D,0xC4,0xC6,0x0E,0x5C,0x30,0x2E,0xF6,0xF8,0x49,
+  0xD1,0xBE,0x7F,0xC8,0xD6,0xAD,0x57,0x10,0xE8,0x4F,0xBA,0x2C,
+  0x12,0x73,0x80,0x23,0x1B,0xF4,0x92,0xE7,0xF7,0x0E,0x9B,0xF5,
+  0x8E,0x27,0xA3,0x6E,0xD1,0x78,0x85,0xEE,0xC1,0x27,0xA3,0xFF,
+  0x81,0xDE,0xE6,0xFE,0xCF,0xF9,0x87,0xF7,0xE6,0xCC,0x8B,0x13,
+  0xC2,0xA4,0x65,0x42,0xC0,0xE2,0x15,0xBB,0x89,0xFB,0x00,0x61,
+  0xB7,0xFC,0xC0,0x80,0x7B,0x5E,0xFE,0x69,0x4D,0x97,0xE0,0xAF,
+  0xA9,0x3B,0xDA,0xA4,0x2B,0x10,0xEA,0x08,0x93,0xE1,0x24,0x55,
+  0x49,0xE2,0x96,0x11,0x6D,0x61,0x34,0x9F,0xE1,0x3E,0x1C,0xAB,
+  0x5D,0x66,0x87,0x7B,0x44,0x5B,0xDA,0x8A,0x24,0xC9,0xCC,0x0B,
+  0xCF,0x08,0xB0,0x0E,0x53,0x77,0xFD,0xA6,0x09,0x0D,0x69,0x39,
+  0x19,0xF4,0x12,0xA9,0x50,0x29,0xDE,0xAE,0x04,0x61,0x90,0x06,
+  0xDE,0xA4,0x52,0xA0,0x91,0xF7,0x29,0x28,0x22,0x93,0xA1,0x16,
+  0xEF,0xD3,0x48,0xC4,0x88,0xD5,0xCA,0x0F,0xBB,0xE1,0x6D,0x32,
+  0xAB,0x6C,0x6B,0x36,0x1D,0x11,0xD6,0x89,0x8F,0x5A,0x2B,0x1B,
+  0x70,0xA2,0x01,0x84,0x20,0x10,0x83,0x28,0x74,0x6C,0x84,0xFE,
+  0x96,0x92,0xE9,0x2C,0xA5,0xE9,0x57,0x91,0x02,0x65,0x42,0x18,
+  0x3F,0xF0,0x92,0xF6,0x42,0x5E,0xDB,0xBC,0xD4,0x19,0xFF,0x86,
+  0xE5,0x71,0xBF,0x8C,0x1B,0x86,0x4B,0x09,0x28,0x14,0x9D,0x37,
+  0xA1,0x5E,0x11,0x37,0xFA,0xE6,0xB3,0xCC,0x0D,0x48,0x00,0x0C,
+  0x85,0x7A,0xCC,0x5E,0xE1,0x45,0xEE,0x49,0x59,0xAE,0x92,0x70,
+  0x57,0x79,0x7E,0xA1,0x1F,0xC1,0x24,0x04,0xFF,0xD2,0x9D,0x53,
+  0x96,0x76,0x12,0xB8,0x16,0x4B,0x63,0x8D,0xD2,0xC4,0x55,0x4D,
+  0x55,0xE4,0x4E,0x40,0xDD,0x27,0x21,0x38,0x27,0x88,0x62,0x58,
+  0x8F,0xC7,0x7D,0xCA,0x6A,0xF5,0x07,0xC7,0xC2,0xCD,0x3F,0xA0,
+  0xC5,0x1F,0x55,0x2C,0x20,0x36,0xD5,0x78,0x79,0xCC,0xAA,0x21,
+  0x53,0x79,0x77,0x28,0xC2,0x3C,0x33,0x6C,0xF5,0x8A,0x7D,0x62,
+  0x2A,0x17,0x3E,0x90,0x68,0xB3,0x38,0x1A,0xE1,0x8A,0x9B,0x18,
+  0x06,0xEE,0xD8,0x73,0x34,0x37,0x77,0xD3,0x16,0x04,0xA7,0x53,
+  0x45,0xEA,0x91,0x54,0xCE,0x79,0x4E,0x41,0x47,0xCD,0xBA,0x3F,
+  0x44,0xCE,0x88,0x08,0x57,0x8D,0xFB,0x12,0x9B,0xA2,0x95,0xCA,
+  0x6F,0x9C,0xD2,0x2B,0x86,0x00,0x0D,0xFC,0x88,0x49,0x69,0x75,
+  0xED,0x59,0x53,0x79,0x01,0x2F,0x0C,0x38,0xBD,0x50,0x91,0x60,
+  0x91,0xA7,0x0D,0xAF,0x1A,0x10,0x45,0x9E,0xB0,0x37,0x0B,0x4C,
+  0x29,0xE3,0x39,0x26,0xB3,0x28,0xA9,0x8D,0xC8,0x24,0xF0,0xE7,
+  0x09,0x94,0x04,0x3F,0x3E,0x18,0xD7,0x8A,0xF9,0xD6,0x75,0x07,
+  0xC8,0x60,0x08,0x48,0x30,0x4B,0xF6,0xE5,0xD9,0x97,0x19,0x2C,
+  0xC6,0x62,0x4D,0xD4,0x02,0x56,0xB3,0x26,0xCE,0x5A,0x2D,0x5D,
+  0x55,0x5D,0x27,0x5C,0x55,0xED,0xAF,0x1E,0xB9,0x71,0xF3,0xFA,
+  0xAE,0x1C,0x86,0xFD,0x1C,0xA4,0x6F,0xE7,0xB7,0x6A,0x55,0xC0,
+  0x33,0xF9,0x98,0x24,0x8D,0xE2,0xE8,0xE1,0x66,0x31,0xE1,0x14,
+  0xEB,0xED,0x24,0xA7,0xC9,0x37,0x72,0x78,0xE3,0x27,0xD0,0xD9,
+  0x92,0xD4,0x15,0x95,0xEC,0x98,0x49,0x14,0xC3,0x00,0xE9,0x19,
+  0xB7,0xD8,0x63,0x78,0x4F,0xA2,0x93,0x7B,0xE6,0x60,0x6F,0x79,
+  0x4E,0x82,0x7F,0x03,0x43,0xEC,0x9E,0xF4,0xC2,0x93,0x5F,0xF4,
+  0x31,0xB5,0x15,0xD3,0xE5,0x34,0x2D,0xBA,0xFD,0x77,0xCE,0x49,
+  0xCB,0x91,0x3C,0x3E,0x7E,0x07,0xAF,0xCC,0xFC,0x01,0x75,0x27,
+  0x85,0x71,0x92,0x61,0x13,0x41,0x1C,0xBB,0x43,0x75,0xB0,0xAB,
+  0x62,0x76,0x9D,0xFA,0x9E,0xDC,0x93,0xBC,0xE3,0xF4,0x14,0xB5,
+  0xCA,0xC8,0xCC,0xD4,0x1B,0xDD,0xE0,0x12,0x6E,0x66,0xA7,0x09,
+  0x38,0x06,0xCE,0xCD,0xA4,0x37,0xC9,0x4A,0xA8,0x88,0x8E,0x67,
+  0xAB,0xDF,0xA4,0x8B,0x19,0x04,0x77,0xAE,0xEA,0xCD,0x66,0x93,
+  0x80,0xA5,0xFA,0xD5,0xA2,0x41,0x4A,0xD2,0xBD,0x24,0x85,0x56,
+  0x4F,0x55,0x7D,0x77,0x17,0xE9,0xB1,0x1E,0x34,0x92,0x38,0x4D,
+  0x7E,0x05,0x53,0x06,0xE3,0xE6,0xF6,0x3A,0x8A,0xC1,0x5C,0xED,
+  0x02,0x59,0x96,0x3C,0x98,0x6D,0x12,0xA8,0xCB,0x22,0xF0,0xA3,
+  0xFB,0x10,0x87,0x92,0x42,0x46,0x7D,0xA9,0x53,0x88,0x5E,0x13,
+  0x44,0xCB,0xDD,0x43,0xB0,0xAE,0xA9,0x55,0xDA,0x54,0x5A,0x75,
+  0x9F,0x7A,0x89,0x4F,0xD1,0x5C,0x19,0x7B,0x77,0x04,0xD3,0x3D,
+  0x49,0xDE,0x0D,0x68,0x36,0xD1,0xA6,0x60,0x79,0xBF,0x2C,0xD7,
+  0x07,0xCA,0x8E,0xAD,0x0B,0x29,0xDE,0x9D,0x17,0x4C,0x70,0x31,
+  0x4A,0x51,0xB4,0x25,0x15,0x54,0x55,0x5D,0xC5,0x3C,0x90,0xE5,
+  0xA4,0xC5,0xF7,0x91,0x22,0xAA,0x61,0x29,0x8B,0xEA,0x06,0x41,
+  0xE4,0xA7,0x17,0x68,0xCD,0xCB,0x65,0x31,0xC0,0xC5,0xC8,0x30,
+  0x73,0xFF,0xDC,0x37,0xB1,0xA1,0x1D,0xAF,0xD6,0xF6,0xD7,0xE7,
+  0xB9,0x49,0x6E,0x82,0xAF,0x72,0x21,0xBC,0x2A,0x35,0xB5,0x87,
+  0xA5,0xA5,0x8C,0x97,0x01,0x00,0x4B,0xB1,0x11,0x98,0xF9,0x97,
+  0x18,0xF0,0x76,0xCB,0x64,0xF7,0x99,0x5E,0x58,0x05,0x77,0x0B,
+  0x7F,0xEB,0xEA,0x86,0x7D,0xFC,0x69,0xE4,0x7B,0x93,0x0B,0xDC,
+  0x5C,0x2F,0x2C,0xA3,0xA9,0x1B,0xF6,0x0A,0x59,0x48,0x74,0x9A,
+  0x8C,0x54,0xBD,0x24,0x11,0xB0,0x8E,0x2D,0xA5,0x8E,0x20,0x40,
+  0x8A,0xA0,0xE0,0xA6,0x14,0x9B,0x02,0xE1,0x0B,0xD3,0x4D,0x68,
+  0x73,0xE8,0x3A,0xD0,0x52,0xD1,0x0A,0x16,0x85,0xE0,0x6A,0xE7,
+  0xB9,0xB1,0xDE,0xEA,0xF2,0xEB,0xAB,0x5E,0x9C,0x62,0xE5,0xCB,
+  0xE5,0xE8,0x7E,0x69,0x65,0x9B,0x3C,0xD9,0xB8,0xB8,0xDC,0x60,
+  0x9E,0x21,0xB3,0xC6,0x38,0xE9,0x51,0x1F,0x96,0x36,0x8A,0xB6,
+  0xB3,0x8A,0x4C,0xE4,0x81,0xD2,0x23,0x40,0xC2,0xD2,0xDC,0x55,
+  0x01,0x10,0xA7,0xDC,0xDB,0x73,0x5D,0x9A,0xA0,0x5C,0xE8,0x26,
+  0x59,0x51,0xCC,0xCD,0x66,0x6E,0xCE,0x1C,0xC7,0x64,0xE8,0xAA,
+  0x35,0x35,0x1B,0x75,0x68,0xE7,0xDD,0x80,0xE1,0xE9,0x89,0x4D,
+  0x4C,0x56,0x24,0x75,0x8F,0xA3,0xFB,0x4B,0x49,0xF3,0x1B,0xB3,
+  0x32,0xB7,0x48,0x7A,0x89,0xB9,0x70,0x01,0xAC,0x02,0x8D,0xF9,
+  0x44,0x9A,0x91,0x2E,0x62,0x31,0x9A,0xAC,0x58,0x8C,0xC4,0xFE,
+  0x9C,0x93,0x78,0x71,0x4E,0x93,0xD5,0xA2,0x58,0xAB,0x50,0x8A,
+  0x2B,0xEA,0xEC,0xC1,0x29,0x43,0x77,0xB9,0x66,0x29,0xFD,0xDF,
+  0x31,0x6E,0xBB,0xBB,0x5A,0xC6,0xC3,0xC4,0xF7,0xD9,0x81,0x03,
+  0x10,0xA5,0xBE,0xC2,0xA1,0x81,0x17,0x44,0x5F,0x00,0x63,0x74,
+  0x74,0x17,0xF8,0xB8,0x52,0xD8,0xF7,0x26,0x04,0xC6,0x57,0xEA,
+  0x7C,0xA7,0x73,0xEC,0xE0,0xB4,0x72,0xC5,0x63,0xD4,0x98,0x9A,
+  0x4D,0xA7,0x0E,0xA6,0x3C,0x59,0x47,0x04,0x7C,0x8E,0x4E,0xBD,
+  0xC4,0xE1,0x1C,0x86,0x16,0x18,0x4A,0xA0,0x42,0x6C,0xB5,0xF6,
+  0x99,0xFB,0xDE,0xDC,0x0B,0x62,0xFC,0xF0,0xFD,0x03,0x43,0xFD,
+  0xAA,0xC2,0x22,0x89,0x4A,0xAF,0x42,0xF7,0x97,0x69,0x4D,0x15,
+  0x08,0xC0,0x91,0x72,0x01,0x38,0x92,0x79,0x4C,0x5E,0x29,0x47,
+  0x11,0xCD,0x17,0xA7,0x73,0x01,0xE5,0x36,0x8E,0xEE,0x71,0x5D,
+  0x11,0xCC,0x21,0x98,0x80,0x45,0x4D,0x67,0x10,0x6A,0x10,0xF3,
+  0xB3,0xAE,0x8B,0x43,0x02,0x00,0x8B,0x1A,0x26,0xA8,0x94,0xAD,
+  0xD1,0x83,0xAF,0x90,0xCE,0xD3,0xC4,0xD9,0x33,0x55,0xFD,0x1B,
+  0xAE,0x6C,0x7B,0x44,0xB9,0x69,0x15,0xF3,0x9F,0xB9,0x97,0xD5,
+  0xAE,0x4F,0xDD,0x20,0x1F,0x56,0x22,0x13,0x53,0x62,0x2A,0x2C,
+  0x43,0x49,0xB9,0x0F,0x26,0x13,0x2E,0x0A,0x98,0xA0,0x91,0x30,
+  0x97,0xE4,0xFE,0x6D,0x7C,0x80,0xFF,0x2E,0xA9,0xB6,0x21,0xF4,
+  0xC3,0x1D,0xB0,0x7F,0xE8,0x3E,0x30,0x1A,0xBC,0x0D,0x42,0xF1,
+  0xFB,0xF4,0xA8,0x49,0x2F,0xC9,0xD7,0x19,0xCD,0xC5,0xC4,0x7B,
+  0xB0,0x24,0x66,0x14,0x2C,0x75,0x75,0x7D,0xB4,0x55,0xB2,0xE6,
+  0xD7,0xB8,0x97,0x99,0x2A,0x62,0x10,0xCE,0x2C,0xCD,0xE0,0xF1,
+  0xA3,0x08,0xBB,0x40,0x20,0x6C,0x07,0x26,0x33,0xF4,0x37,0xC2,
+  0x26,0x05,0x05,0xCC,0x05,0x99,0x3D,0x2A,0x41,0x22,0xC8,0x0D,
+  0x65,0xC0,0x2A,0xE0,0x92,0x64,0x91,0xFA,0x64,0x21,0x07,0xC2,
+  0xA6,0xBA,0x66,0x1D,0x10,0x34,0x53,0x42,0x45,0x8B,0x61,0x04,
+  0xB8,0x2E,0x82,0xD0,0xFF,0x4B,0xB4,0x2F,0x90,0xD3,0x35,0x3B,
+  0xA9,0xA9,0x68,0x0B,0x62,0x6E,0x32,0x22,0x5F,0xDD,0xDA,0xEF,
+  0x26,0x28,0xF4,0xFB,0x1A,0xD5,0xE7,0xCA,0x59,0xD4,0xBA,0x96,
+  0x66,0x67,0x94,0x28,0x23,0x43,0x35,0xA7,0x7E,0x53,0xD5,0x5F,
+  0x3C,0x57,0x32,0xF0,0x30,0x26,0x28,0xB0,0xF7,0xA0,0x1E,0x0E,
+  0x06,0x64,0x96,0xAA,0x3D,0x15,0x97,0x08,0x6B,0xC0,0x3C,0x08,
+  0x55,0xE3,0xC9,0x78,0x5A,0x3D,0x51,0xA2,0xF3,0x24,0x78,0x21,
+  0x5C,0x55,0x6E,0x0F,0x60,0x8E,0xCC,0x9B,0x25,0xF3,0x29,0x77,
+  0x95,0xE2,0xB8,0x8A,0x02,0x66,0xC2,0x25,0x41,0x33,0x22,0x83,
+  0x70,0x4E,0x84,0x98,0xC1,0x95,0x0E,0x60,0x1E,0x04,0xBE,0x61,
+  0x71,0xEF,0x2D,0x5E,0xA9,0x65,0xBF,0xBB,0x81,0xFF,0x34,0x48,
+  0x12,0x90,0xB4,0x81,0xA7,0x5F,0xD0,0x43,0x81,0xF3,0x4F,0xA0,
+  0x5F,0xE0,0x32,0x09,0xAB,0x82,0xF1,0x44,0x43,0x93,0xFA,0x0C,
+  0x4D,0x69,0x5F,0x5E,0xE4,0xC8,0xEA,0x11,0xEA,0xC7,0x24,0xB1,
+  0x09,0x70,0xF3,0x92,0xF5,0x55,0x7F,0xCE,0x4D,0x98,0x07,0xC1,
+  0x72,0x45,0xDA,0xCA,0xE3,0x6F,0xBA,0x09,0xB3,0xC3,0xA9,0xA6,
+  0xD3,0xED,0xCC,0x7B,0x12,0xBF,0xF6,0xE8,0x5A,0x4D,0x01,0xCC,
+  0x31,0xE7,0x92,0xF7,0x00,0xE0,0x47,0x97,0x56,0x72,0xF6,0x62,
+  0x45,0xE5,0x05,0xC6,0xF3,0x4D,0xCC,0x64,0xED,0x94,0x89,0x19,
+  0x0D,0xD8,0x75,0x79,0xDE,0xED,0xE1,0x71,0x85,0x9F,0xE6,0xC3,
+  0x21,0x89,0x35,0x4A,0x80,0xC2,0x81,0x7F,0x1A,0x2E,0x1A,0x5F,
+  0x06,0x61,0xDA,0x61,0x27,0x4C,0xE1,0x0D,0x3B,0x6F,0xA5,0x49,
+  0xCD,0xFC,0x0E,0xF4,0x05,0x43,0x63,0xF1,0x11,0xE3,0xA1,0xEB,
+  0x6B,0x54,0xC8,0x85,0xC5,0xA8,0xE8,0x01,0x2C,0xE6,0xBB,0x3E,
+  0x8A,0xC5,0x5F,0x59,0xAC,0xE0,0x04,0x49,0x42,0x6D,0x75,0x8A,
+  0x9B,0x19,0x99,0x7B,0xC5,0x77,0xA6,0x52,0x36,0x0B,0xEF,0x16,
+  0xA6,0xD3,0xA4,0x30,0x9C,0x33,0x63,0xCA,0xDB,0x5D,0x0A,0x29,
+  0xAE,0xAC,0xEB,0x17,0x4A,0xA0,0xE8,0x0E,0x65,0xCB,0xA4,0x5E,
+  0x31,0x09,0xFE,0x22,0xBC,0x79,0xE6,0xED,0x22,0x25,0xF9,0x61,
+  0xC0,0xE7,0x4A,0xA3,0x70,0x42,0x8C,0x35,0xEC,0x12,0xA6,0x60,
+  0x31,0x26,0x59,0x19,0x74,0xF1,0x95,0x1D,0x37,0x0C,0x86,0x0B,
+  0xED,0x01,0x1C,0x4C,0x8F,0x95,0x35,0x68,0xCD,0xC5,0x6A,0x0D,
+  0x3C,0x49,0xDE,0xCB,0xB7,0x13,0x9E,0x74,0xFD,0xBF,0x72,0x24,
+  0xFE,0xFF,0xB0,0x76,0x5C,0xB1,0x2C,0xB1,0x38,0xCC,0x7C,0x3F,
+  0x1E,0x9A,0x3D,0xF2,0x52,0x8F,0x6E,0x96,0xBC,0xE1,0x37,0xEC,
+  0x28,0x04,0xBD,0x34,0xA1,0x6B,0x91,0x10,0x30,0xF0,0x55,0x0A,
+  0xD5,0x40,0xC2,0x9F,0x26,0xD1,0xAD,0x76,0x05,0x52,0xBF,0xD6,
+  0x75,0x1E,0x8A,0xAD,0xE8,0xF2,0x9F,0x19,0xEE,0x57,0x1E,0x0D,
+  0x9E,0x5D,0x76,0xB7,0x8B,0x0A,0x73,0x97,0x2C,0x65,0x17,0x54,
+  0xEA,0xE6,0x06,0x91,0x7B,0x85,0xB3,0x0F,0xE7,0xE0,0x16,0x6E,
+  0x23,0x7F,0xD1,0x13,0x98,0xB0,0x4B,0x17,0x63,0x42,0x7A,0x6C,
+  0x75,0xFD,0x1A,0x5A,0x1E,0x28,0xAE,0x3E,0xFC,0x2B,0x6C,0x94,
+  0x2E,0x77,0x2F,0x1B,0x37,0x7D,0xDC,0xA3,0x5B,0x9B,0x9C,0x0F,
+  0x3F,0xEC,0x99,0xC5,0xC6,0xCF,0x28,0xA1,0x1C,0x7F,0x0D,0x12,
+  0xBA,0x68,0x9E,0x75,0x74,0x34,0x30,0x3E,0x74,0xFA,0x26,0x1E,
+  0x86,0x1D,0x10,0xE8,0xE2,0x10,0x9E,0x73,0x1B,0x62,0xC9,0xEE,
+  0xAF,0x94,0xF7,0x1F,0x2E,0x8E,0x7B,0x0A,0x6B,0x2D,0x06,0x34,
+  0x31,0x4F,0x0D,0x67,0xA4,0x7B,0x2C,0x19,0x48,0x9C,0xBF,0xA0,
+  0x3B,0x64,0x50,0x0C,0xF7,0x50,0x45,0xCB,0xD9,0x66,0xAB,0xC6,
+  0x76,0xF6,0xC5,0x79,0xCE,0x55,0x51,0xF5,0xF2,0x84,0x2C,0x5F,
+  0x1F,0xDF,0x59,0xC5,0x4B,0x0A,0xC1,0x2F,0x8B,0xDD,0x82,0x5A,
+  0xF8,0xD3,0xCE,0x30,0x08,0xBD,0xC9,0x64,0xF1,0xB0,0x66,0xA9,
+  0x04,0x27,0x8B,0x32,0x0E,0xF4,0x9E,0x62,0x0D,0xA3,0x90,0xE3,
+  0x6D,0x64,0x35,0x55,0x55,0xEC,0x49,0x0C,0x06,0x17,0x11,0x17,
+  0x18,0xEB,0x57,0xD4,0xBC,0xFB,0xAA,0xBE,0xF5,0x14,0xCB,0xC6,
+  0x70,0xF7,0x59,0xF1,0xFB,0xBA,0xE0,0x5F,0x1C,0x46,0x59,0x4E,
+  0x44,0x28,0xC8,0xD0,0xA7,0xC5,0xF9,0xF4,0x11,0x97,0x3C,0xE8,
+  0x3D,0x3B,0x9A,0x94,0x7E,0x4D,0xF1,0x60,0x0D,0x55,0xB9,0xD8,
+  0x2B,0x2F,0xCC,0xA5,0xD8,0x81,0x3C,0x61,0x81,0x40,0xAE,0xEB,
+  0x85,0x49,0x53,0xBC,0x66,0x63,0x18,0x39,0xAA,0xE5,0xEE,0xF5,
+  0xB4,0x69,0x05,0x7A,0xD5,0x72,0x72,0x71,0x0F,0x28,0x96,0x71,
+  0x96,0x26,0x95,0xBC,0x51,0xEB,0xD4,0xAA,0x3E,0x47,0x91,0x65,
+  0x29,0xB2,0x03,0x48,0x5C,0x8A,0x6C,0x96,0xB1,0x69,0xEA,0x5A,
+  0x39,0xC3,0x93,0x55,0x80,0x13,0x5D,0x17,0xEF,0x26,0x25,0x69,
+  0x56,0xF2,0x49,0xA7,0xC2,0xBA,0xC2,0xD3,0x0E,0xF6,0x64,0x12,
+  0xD3,0x41,0x93,0xE9,0xF7,0x2E,0x48,0x82,0xDB,0x60,0x12,0xA4,
+  0xA0,0x62,0x7A,0x0D,0x93,0xF7,0xFE,0x26,0x59,0xC3,0x70,0xB6,
+  0x4A,0xD4,0x1B,0x19,0x8F,0x03,0xDF,0x27,0xA1,0xFA,0x8F,0xF4,
+  0xC1,0xE4,0x03,0xA1,0xA6,0xBF,0x5E,0x35,0x1B,0x15,0xF2,0x01,
+  0x58,0xD0,0xB3,0x5A,0xC8,0x30,0x67,0xB3,0x4D,0x2F,0xB9,0xF4,
+  0x59,0x13,0xB9,0x69,0x7B,0xF0,0x84,0x3B,0x18,0x5C,0x58,0xA7,
+  0xAF,0xF4,0x7F,0x2A,0x5D,0x64,0x5A,0xDE,0x8F,0x61,0x66,0xFC,
+  0x9C,0x0A,0x84,0x94,0x19,0x4B,0xF9,0x5B,0x04,0xB1,0x7B,0x20,
+  0xED,0x47,0xC6,0x46,0xD3,0xD2,0x57,0x75,0x0E,0xAE,0x0B,0xDA,
+  0x34,0x3A,0xFA,0x30,0xAF,0xAA,0xAC,0xA2,0x6C,0x58,0x76,0x59,
+  0x6B,0xEF,0x41,0x27,0x28,0x28,0x70,0x28,0x18,0xB7,0xD2,0x55,
+  0x1B,0xE1,0x6A,0x15,0x64,0xBA,0xF2,0x6B,0x05,0x68,0xEE,0xA0,
+  0x00,0x2F,0x1E,0x25,0xFA,0x03,0x2E,0x4E,0x3C,0x4F,0x88,0xD8,
+  0x3F,0xCA,0xDD,0x83,0xF9,0xEF,0x25,0x9B,0xDF,0x1A,0x14,0x68,
+  0xF4,0xE8,0xA6,0x6B,0xF5,0x83,0x7D,0x84,0x21,0x3E,0x25,0x11,
+  0xB8,0x41,0xD5,0xD1,0x1F,0x4A,0xAB,0xFA,0x57,0x48,0x72,0x15,
+  0x5C,0x5F,0x7F,0xE7,0xB2,0xAB,0xAA,0x7D,0xBD,0xFC,0x69,0x05,
+  0x1C,0x27,0x39,0xE1,0x13,0x58,0x6F,0x7E,0x0B,0xD4,0x38,0xD0,
+  0x96,0x43,0x11,0x4E,0x6B,0xE4,0x2C,0xFB,0x2B,0x2B,0xCD,0xEB,
+  0xC4,0x99,0x10,0x40,0x93,0x8E,0x28,0x67,0x3C,0xBF,0x90,0x45,
+  0x82,0xF3,0x9F,0x2C,0x5D,0xF8,0x61,0xBD,0xC9,0x81,0x06,0x46,
+  0x7E,0xA4,0x6E,0x8E,0x4D,0x92,0x60,0x04,0x23,0x5E,0xEF,0x10,
+  0x63,0xF2,0x73,0x7A,0x6D,0xF2,0x9C,0x0F,0xCD,0xC1,0x15,0xCB,
+  0x97,0xFB,0xDA,0x84,0x1D,0xCF,0xE1,0x7D,0x98,0x6E,0xDF,0x91,
+  0xAC,0x27,0x67,0x9A,0xCB,0x66,0x8F,0x34,0xBC,0x99,0x4F,0xD2,
+  0x35,0xB1,0x0E,0xAB,0x1B,0xDE,0xE7,0x7B,0x43,0x15,0x36,0xCE,
+  0x54,0x4A,0x73,0x97,0x4A,0x96,0x77,0x47,0xEB,0x4F,0x94,0xC4,
+  0x83,0x79,0x8A,0x21,0x5C,0x8A,0x88,0x42,0x2A,0x19,0x14,0xDE,
+  0x0F,0x8A,0xC0,0x56,0x6C,0xC4,0x54,0x98,0x29,0xF7,0x94,0xF7,
+  0x91,0x42,0xB3,0xFF,0x12,0x30,0x4C,0x2F,0x1C,0xC9,0xBC,0xB2,
+  0xD2,0x59,0x5E,0x20,0xB5,0x2E,0xF8,0x4D,0x77,0x97,0x70,0x9F,
+  0x8C,0xF7,0x51,0x2A,0x24,0x35,0x87,0xCE,0x82,0x38,0xF1,0xB6,
+  0xA7,0x9C,0x60,0x6E,0x42,0xF4,0x45,0x99,0x46,0xE0,0xF0,0x53,
+  0xA8,0x27,0x4F,0x33,0x43,0x5F,0x39,0xC2,0xC1,0x76,0x4C,0xB8,
+  0xD0,0xBE,0x13,0x71,0x83,0x52,0xAA,0x8C,0xEA,0x73,0x4D,0x55,
+  0x6F,0xD0,0x3C,0xC4,0x2C,0x4C,0xB9,0x5D,0xB0,0xB9,0x3F,0x8B,
+  0x7A,0x15,0x4D,0x4C,0x1E,0x92,0x34,0x9A,0x29,0xB7,0x34,0xE7,
+  0xD2,0xA0,0xF3,0x0A,0xEA,0xAC,0xBD,0x5B,0x43,0x81,0xE2,0xE6,
+  0xBA,0x7A,0xF1,0x1C,0xE8,0x9A,0x6A,0x57,0x99,0x98,0xAE,0x30,
+  0xDB,0xC4,0x30,0x11,0xC3,0xCB,0x64,0x3E,0x9B,0x51,0x58,0x6A,
+  0x39,0x8B,0x82,0xC7,0xBA,0xC7,0x2C,0x52,0xC5,0xE5,0x68,0x9E,
+  0x24,0x48,0xAB,0x7E,0x32,0x44,0x76,0x92,0x78,0xCA,0x6F,0x59,
+  0x86,0x65,0x16,0xD6,0x3D,0xCB,0xC9,0x96,0x4D,0x62,0x79,0xD8,
+  0x40,0xE5,0x9F,0xF1,0x83,0x8F,0x6C,0x40,0x07,0xCF,0x73,0xF6,
+  0x2B,0xCF,0x4C,0x75,0x71,0xBA,0xFD,0xC0,0xE7,0xCB,0xEF,0xC1,
+  0x25,0x89,0x33,0x92,0x62,0x45,0xEF,0x16,0xA6,0x68,0x13,0x2F,
+  0xFC,0x52,0x0A,0x3D,0x24,0x1E,0xD0,0xBF,0x78,0x34,0x20,0x9E,
+  0x64,0x0C,0x45,0xBD,0x09,0x4C,0xBA,0xF3,0x29,0xB7,0x5A,0xDA,
+  0x01,0xBF,0xBF,0xBF,0xBF,0x41,0xB5,0x52,0xBD,0x3C,0xF3,0x9C,
+  0x27,0xCB,0x84,0xC7,0xFC,0x3B,0x96,0x99,0x63,0x19,0x75,0x8B,
+  0x76,0x40,0x99,0x99,0xB4,0xBA,0x5F,0xA8,0xA3,0x98,0xCC,0xC5,
+  0x99,0xBE,0x7A,0xA5,0x7A,0xFE,0x34,0x08,0xC5,0xCA,0x1D,0x96,
+  0x88,0x89,0x37,0x99,0xBA,0x22,0x8E,0x7A,0x17,0x8D,0x82,0x50,
+  0xC9,0x0E,0x8F,0x72,0x3A,0x21,0xB0,0xB7,0x5E,0x32,0xA6,0x73,
+  0x7C,0x3A,0xC9,0xBF,0x00,0x8F,0x70,0x1C,0xE2,0xB1,0xEA,0x58,
+  0x37,0x09,0xBD,0x28,0x40,0xA3,0x5F,0xFF,0xC8,0xAA,0xA0,0x77,
+  0x92,0x48,0xF5,0xE2,0xDC,0x5E,0xC5,0x8F,0xE4,0x20,0xD7,0x01,
+  0xD4,0x8B,0xC3,0x1A,0xE8,0x9A,0x7A,0x73,0xB5,0x2A,0xD7,0x5E,
+  0x9E,0xE9,0x4B,0xD4,0xCB,0xD3,0x7C,0x01,0xA4,0x27,0xA3,0x32,
+  0xA4,0x22,0x3D,0x99,0xB5,0x21,0x6E,0x7A,0x12,0x4A,0x9C,0xFB,
+  0x6F,0xDC,0x02,0x5D,0xBF,0x07,0x95,0xEF,0xAB,0x8E,0x96,0xD2,
+  0xEA,0x59,0x90,0x7E,0x1B,0xA4,0xB8,0xCD,0x6F,0xF5,0xD9,0x45,
+  0x75,0xC3,0x39,0x03,0x96,0xA9,0xCF,0xB8,0xE4,0xF9,0x11,0xFA,
+  0x2B,0xBB,0xF7,0xFC,0xD2,0x1F,0xD0,0x90,0xE6,0x83,0x32,0x0B,
+  0xE7,0x05,0x2C,0x7E,0x85,0x5E,0x7B,0xE6,0x85,0x64,0x52,0x60,
+  0xD0,0x01,0x0E,0xBC,0x8B,0x32,0x46,0xFD,0xE2,0x67,0x14,0x4A,
+  0x8D,0x67,0x34,0x9B,0xF6,0xD5,0x56,0x36,0xD6,0xE5,0x05,0x77,
+  0x9F,0x79,0x2E,0x78,0x43,0xA3,0x33,0x56,0xCE,0x4B,0x58,0xAD,
+  0x68,0x7C,0xCE,0xA8,0x53,0xE0,0xF4,0xD4,0x2F,0x47,0x5F,0x30,
+  0xF6,0xF1,0x73,0xB2,0x09,0x9F,0x72,0x64,0xD3,0x8B,0x73,0x4C,
+  0x70,0x10,0x2F,0x4D,0x31,0x51,0x9F,0x7A,0x0B,0x74,0x4C,0x62,
+  0x98,0x5C,0x9E,0x70,0x3C,0x94,0x12,0x65,0x21,0xB6,0x80,0x20,
+  0x7C,0x83,0x0A,0x97,0x8E,0xE5,0xEB,0xAF,0x2A,0x76,0x65,0xA7,
+  0xA7,0x3D,0xFF,0x48,0x3E,0x94,0x70,0x2A,0xBD,0x4A,0x5D,0x2C,
+  0xFF,0xCC,0x60,0xEA,0xFD,0xE7,0x86,0x2A,0x4B,0x47,0xCC,0x69,
+  0x85,0xBD,0x8A,0x25,0x8A,0x17,0xCF,0x9F,0xB8,0x2B,0xFA,0x09,
+  0x27,0xE4,0x67,0xBC,0x37,0xD4,0xB4,0x7C,0x0A,0x1C,0x0C,0x73,
+  0x53,0xDB,0x96,0x0F,0x9E,0xB3,0xDE,0xC4,0xB6,0x2F,0xB2,0x63,
+  0xDF,0xEC,0x64,0xEE,0xD4,0xFB,0xAA,0xB1,0x8B,0x20,0xD4,0x68,
+  0x2E,0xD1,0x49,0x98,0x6A,0x2F,0x39,0x36,0xAE,0x1B,0x6D,0x47,
+  0x37,0x98,0xFF,0x0E,0x92,0xF7,0xDE,0x7B,0x4D,0x22,0xC2,0xB9,
+  0x77,0x5E,0x23,0xC3,0x50,0xF8,0x86,0x80,0xFB,0xEC,0x4F,0x0D,
+  0xAC,0x1C,0x34,0xF8,0xF2,0x7C,0x9F,0x0D,0x6A,0x39,0xBD,0x34,
+  0x78,0x14,0xAB,0x2B,0xAE,0xB6,0x67,0xCF,0x29,0xB0,0xFC,0x68,
+  0xFA,0xDF,0x92,0x8D,0x74,0x4E,0x3E,0x13,0x0D,0x7E,0x18,0x4B,
+  0x16,0x4D,0x4E,0xA3,0xEB,0x52,0x75,0x4C,0x30,0xE5,0xB3,0xD4,
+  0x7F,0x0B,0xC5,0xD2,0x11,0xF1,0x0C,0x0B,0xC6,0xD1,0x46,0x53,
+  0x02,0x53,0x26,0xD5,0xF5,0x25,0x04,0xE2,0xE3,0xA2,0xE2,0x64,
+  0xE7,0x06,0x3B,0xCD,0x0E,0x7F,0xAE,0xE8,0x14,0x74,0x41,0x97,
+  0x1F,0x60,0x75,0x9F,0x73,0xC4,0x75,0x59,0xD9,0x36,0x43,0x2E,
+  0x68,0x24,0x05,0x67,0x8C,0x0B,0xBA,0x15,0x4F,0xA5,0xBA,0xF1,
+  0x70,0xA1,0xFB,0xBC,0x63,0xAE,0xCB,0xF5,0xCB,0xD5,0x23,0x51,
+  0x0E,0xE0,0xF1,0xF1,0xFD,0x7C,0x7A,0x4B,0x62,0xE9,0xA5,0x9E,
+  0xE3,0xA2,0x95,0xAE,0x40,0x86,0xCF,0xB3,0x9D,0x76,0x71,0x54,
+  0x75,0x83,0x78,0xA5,0xF3,0xAC,0x6B,0xBD,0x0E,0x3F,0x17,0x7A,
+  0xEC,0x07,0x29,0x7A,0xF0,0xC0,0xD7,0xDD,0x83,0x75,0x0C,0xE1,
+  0x25,0xCD,0xD4,0xC6,0xB4,0x34,0xC2,0x0A,0xB8,0xAA,0xAD,0x16,
+  0x39,0xE1,0x99,0xD3,0xF5,0x12,0x93,0x0F,0xA6,0xAE,0x54,0x99,
+  0xD3,0xCE,0x3A,0x68,0x99,0xAD,0xF3,0x1C,0xB6,0xCE,0x56,0xB6,
+  0xD9,0x87,0x89,0x94,0x79,0x3C,0x51,0xA2,0xE1,0x95,0x84,0xC9,
+  0x90,0x18,0x5D,0xD3,0x91,0x09,0x68,0xB2,0xF9,0xEC,0xEE,0xEE,
+  0x77,0x78,0x5B,0x48,0x17,0x64,0x27,0x60,0x71,0x57,0x93,0x85,
+  0xC0,0x9F,0x7F,0x65,0x1C,0x14,0x60,0xC1,0x13,0x46,0x90,0x5C,
+  0xB9,0x07,0x72,0x85,0x53,0x2B,0x38,0x0F,0xE0,0x49,0xDD,0xF9,
+  0xF6,0x22,0x1F,0x05,0xE8,0x09,0xE2,0x4D,0xB1,0x07,0x3B,0x62,
+  0xBC,0x7E,0x18,0xC9,0x4E,0xDC,0xBA,0x1B,0x79,0x9C,0x8B,0x03,
+  0xF2,0xCB,0xD2,0x6A,0xD5,0x33,0x61,0xD1,0xAC,0x7D,0x7E,0xC8,
+  0x76,0x33,0xBF,0x2D,0xBD,0x40,0x90,0xAC,0xE8,0x03,0xE2,0x15,
+  0xED,0x01,0x59,0x65,0x05,0xFB,0x17,0x4F,0xA5,0x36,0xE2,0xDC,
+  0x60,0x33,0x22,0x7A,0xCC,0x78,0x4B,0xFB,0x72,0x7E,0x62,0xEA,
+  0xB2,0xA5,0x95,0x9C,0x6A,0x1D,0xDF,0x4C,0x60,0xF4,0x50,0xF3,
+  0x66,0x5E,0xEC,0xDC,0xF3,0xCA,0x51,0xCA,0x96,0x47,0xA9,0x8C,
+  0x56,0x72,0x60,0x79,0x15,0x4B,0x72,0xA2,0x8F,0x45,0x39,0x30,
+  0x25,0x17,0xEC,0x63,0x77,0x37,0x57,0xB9,0xC4,0x45,0x4C,0xDB,
+  0x4E,0xFF,0xCF,0xC5,0x05,0x6E,0xCC,0x7D,0xC1,0xA9,0x36,0xFB,
+  0x02,0x45,0x16,0x6B,0x2D,0x1F,0x42,0x12,0x9F,0x39,0xD8,0xE4,
+  0xD8,0xC5,0x77,0x15,0xD6,0x38,0x76,0xFE,0xDD,0x0C,0xF7,0x59,
+  0x5F,0xC2,0x58,0xEB,0xD8,0x39,0x17,0xA9,0x41,0x82,0x6F,0x31,
+  0x4F,0x86,0x3D,0x64,0x5E,0x3D,0xFB,0x70,0x86,0xFB,0xAC,0x4F,
+  0x61,0xAC,0x1F,0x54,0x32,0x46,0xF2,0xB0,0x92,0x73,0x2F,0xBA,
+  0xEF,0xEC,0x39,0x05,0x91,0x7D,0x42,0xC3,0x7D,0xD6,0x47,0x31,
+  0xD6,0x62,0xC8,0xF8,0x48,0x10,0x72,0xDE,0x05,0x04,0xD9,0x63,
+  0x16,0x4E,0x49,0x5F,0xD2,0x70,0x9F,0xFB,0x21,0x8D,0xB5,0x30,
+  0x64,0x6E,0x72,0x10,0x25,0x57,0x52,0x00,0x23,0xBF,0xE1,0x3D,
+  0x30,0x3B,0x84,0xBF,0xC1,0xA8,0xF2,0x83,0xFA,0x6B,0x9D,0x1F,
+  0x7E,0xCB,0xCE,0x7D,0xEE,0x27,0x04,0x4B,0x1F,0x26,0x77,0xE9,
+  0x87,0xF0,0xD8,0xA7,0xF5,0x92,0xAB,0xE5,0xAF,0xE2,0x5D,0xD3,
+  0x55,0xBF,0x6A,0xA5,0x5F,0xA9,0x6E,0xA5,0x64,0xE7,0x70,0xA5,
+  0x8C,0xA0,0x93,0xB3,0xBB,0x86,0x5B,0xFB,0x43,0xD3,0xAE,0xAC,
+  0xBD,0xEE,0xF5,0xE3,0x95,0x0D,0x3F,0xD9,0xA5,0x4D,0x7F,0x3D,
+  0x38,0x4F,0x8F,0x0E,0x5C,0x35,0xF8,0x53,0xA7,0x09,0xBF,0x9B,
+  0xD7,0xFA,0xEF,0xA6,0xFE,0x50,0x7F,0x7A,0x69,0xA9,0xEF,0x6B,
+  0x01,0x5D,0xA8,0xD6,0xB2,0xBA,0x4D,0x4C,0xFA,0x12,0x1D,0x46,
+  0xDF,0xDD,0x2D,0xBD,0xC8,0x0D,0x74,0xF9,0x5D,0x66,0x3A,0xCB,
+  0xAF,0x64,0x45,0xAE,0x60,0xCA,0xC3,0x29,0x5D,0x2F,0x2F,0xB7,
+  0x7D,0x3E,0x09,0x41,0x42,0x81,0xAF,0x9C,0x9C,0x09,0x7F,0xA3,
+  0x25,0xBA,0xF8,0x02,0x30,0x20,0x7C,0x52,0x6A,0x78,0x48,0x2F,
+  0x43,0xC5,0xEE,0x33,0x24,0xEC,0x56,0xAE,0x9D,0x17,0xE0,0x35,
+  0xE6,0x29,0x21,0xFF,0x2F,0x6A,0x2A,0xB9,0x47,0x36,0x7B,0x71,
+  0x8B,0x4B,0x33,0xE5,0xAF,0xD1,0x19,0x6C,0x82,0x6A,0x2C,0x7F,
+  0xA2,0xCC,0xA0,0xD3,0x48,0xA3,0xF4,0x55,0x2E,0x43,0x9E,0x21,
+  0xF1,0xCF,0xE2,0x1A,0xF2,0x17,0xDC,0x8C,0xC2,0x9C,0xC5,0x90,
+  0x67,0x16,0x46,0x7E,0x6D,0x2C,0xC7,0xFA,0x46,0xF9,0x89,0x51,
+  0xFE,0x12,0x82,0x51,0xBC,0x37,0xB2,0x4F,0xA1,0x19,0xFC,0xC2,
+  0xC8,0xFD,0xBD,0x21,0xAE,0x8C,0xEC,0xDB,0x48,0x06,0xBF,0x30,
+  0xE4,0xAF,0x16,0x19,0xF9,0xB5,0x21,0x7D,0x52,0xC8,0xC8,0x2E,
+  0x8D,0xE2,0xE7,0x7E,0x0C,0xF9,0xCE,0x90,0x5C,0x81,0x91,0x5D,
+  0x1A,0x2B,0x3E,0xBC,0x6C,0xE4,0x53,0x0C,0x43,0x5C,0x19,0xF9,
+  0xA4,0xC1,0x10,0x57,0x86,0x1C,0xCA,0x1B,0xF9,0xB5,0x21,0xC7,
+  0xD0,0x46,0x7E,0x8D,0x07,0x2F,0xB5,0x42,0xE8,0x5C,0x0A,0x6D,
+  0x5F,0x5D,0x15,0xEE,0xA5,0xB8,0xD2,0xBE,0xEE,0x5D,0x5D,0xEB,
+  0x9B,0x19,0x38,0x25,0x06,0x8E,0x5A,0x08,0x4C,0x29,0x03,0x11,
+  0x08,0x1A,0xEC,0xB7,0x21,0x07,0x75,0x46,0x7E,0x6D,0xE4,0xC1,
+  0x99,0x21,0xAE,0x8C,0x3C,0x3C,0x32,0xC4,0x95,0x21,0x85,0x24,
+  0x46,0x76,0x49,0x61,0xCA,0x71,0x4F,0x16,0x0B,0x03,0xBE,0x42,
+  0x3C,0x64,0xC8,0x77,0x14,0x21,0xDF,0x1E,0x41,0xAB,0x5D,0x9F,
+  0x89,0xA0,0x9E,0x97,0x36,0x44,0x9E,0xB5,0x85,0x4D,0x17,0xDF,
+  0x37,0xE6,0x57,0x2C,0xA5,0x0A,0x40,0x47,0xC4,0xEF,0x3B,0x68,
+  0x85,0xE4,0xC6,0x0A,0xFB,0xDA,0x26,0x7E,0xD4,0x42,0x89,0xA3,
+  0xC9,0x04,0x77,0x11,0x70,0xE5,0x36,0xA1,0xFB,0xB4,0x33,0x2C,
+  0x05,0xEA,0xC6,0xEF,0xB4,0xB3,0x2E,0x80,0x47,0xA5,0x93,0x28,
+  0x36,0xB3,0x05,0x2A,0x96,0xA6,0x44,0x93,0x9B,0xE8,0xBA,0x3B,
+  0xEE,0x49,0x08,0xEC,0x52,0x06,0xD3,0x8A,0xF5,0xAA,0xA2,0x7B,
+  0xC8,0xF0,0x81,0xE9,0xE2,0x36,0x6F,0x7F,0xAD,0xBC,0x8E,0x28,
+  0x56,0x24,0x7F,0xA6,0xAC,0xD6,0x89,0x04,0x3F,0x22,0x73,0x7E,
+  0x72,0x54,0x12,0xC8,0xC5,0x38,0xE0,0x8D,0x4A,0x06,0x5E,0x48,
+  0x4F,0x89,0xE7,0x07,0x84,0x7E,0x0D,0xDE,0x04,0x0A,0xF4,0x5A,
+  0x50,0xF1,0x17,0x7E,0xE6,0xED,0x7E,0x4C,0x78,0xCB,0x90,0xBC,
+  0xB2,0x53,0xAD,0x64,0xF9,0xF1,0x9C,0x50,0xC1,0x5A,0xCC,0xDF,
+  0xC3,0xDF,0xC3,0xC3,0xB2,0x0C,0xCA,0x1A,0xBC,0x0F,0x86,0x81,
+  0x37,0x33,0xC7,0xE9,0x74,0xB2,0x49,0x99,0x54,0x1E,0xD1,0x30,
+  0x3D,0x3C,0x5B,0x0B,0xBE,0xB0,0x53,0x2F,0x04,0x14,0x84,0x69,
+  0xA4,0x60,0x41,0x05,0x73,0x1D,0x21,0xC4,0x3D,0x8B,0xE0,0x11,
+  0xA8,0xD6,0x27,0x5B,0x1B,0x23,0x37,0x3D,0x6F,0x51,0x76,0x28,
+  0x40,0x1C,0xDC,0x85,0xB2,0xB1,0x32,0xF1,0x66,0xB8,0x3D,0x05,
+  0xA2,0x9B,0x46,0xB7,0x98,0x4C,0xCA,0xEB,0x87,0xDA,0x91,0x27,
+  0x65,0xF5,0x9E,0xB1,0xEA,0x29,0x6A,0xA5,0xBA,0x3E,0xBD,0x5E,
+  0x5E,0xCB,0xCA,0xF2,0xCE,0xB2,0x0C,0xE1,0xDA,0xEF,0x49,0x6D,
+  0x64,0x54,0xF6,0x2A,0x7A,0xB5,0xA2,0x52,0x8B,0x4D,0x59,0xA2,
+  0x9C,0x84,0x45,0x6C,0x98,0x41,0xDD,0xF9,0x08,0xD8,0xA3,0x38,
+  0xEC,0xAE,0x63,0xDA,0xAD,0x8E,0xD9,0x30,0xED,0x95,0xDA,0x29,
+  0x5A,0x68,0x42,0x05,0x8E,0xB2,0xDA,0x6A,0xA2,0xFF,0xC8,0x2C,
+  0x87,0x1E,0x9E,0xEC,0x58,0xD0,0x8E,0x59,0x52,0xEF,0xDE,0x9E,
+  0xF2,0xEB,0xE1,0xC7,0xF7,0x27,0xEF,0x7F,0x56,0x0A,0x97,0x88,
+  0x3E,0x57,0x3D,0x89,0xBD,0x84,0x28,0x87,0xEF,0xDE,0xE5,0x7B,
+  0xAD,0x28,0x1A,0xCE,0x97,0x75,0x1D,0x26,0x1B,0x06,0xD0,0x54,
+  0x70,0x57,0x93,0x16,0xF5,0x09,0x26,0x5B,0xD1,0x1D,0x4C,0x91,
+  0x00,0xE6,0x51,0x4B,0x81,0x82,0x26,0x95,0x59,0xA6,0x70,0x89,
+  0x34,0x23,0x61,0x46,0x74,0x38,0x9B,0xF1,0x04,0x32,0x9E,0xEC,
+  0xC1,0xBE,0x45,0x8C,0x94,0xBC,0x42,0x61,0x39,0xB4,0xCE,0x77,
+  0x1F,0xCE,0x8F,0x29,0xDA,0xC3,0xCB,0x8B,0x0F,0xA7,0x87,0x17,
+  0x27,0x1F,0xDE,0x9F,0xE3,0x89,0xC7,0x68,0x10,0x60,0x2A,0x03,
+  0x5B,0x37,0xC0,0x2F,0x69,0xF3,0xD2,0x2B,0x55,0x25,0x4B,0xE9,
+  0xF0,0xE3,0xB1,0xF2,0xE9,0xC3,0xA5,0xF2,0xF1,0x18,0xB8,0x7E,
+  0x52,0xCE,0x2F,0x3F,0x1E,0xAF,0x50,0xA7,0x2C,0xE6,0x6F,0xA2,
+  0x50,0x49,0xA3,0xF4,0x90,0xEB,0x39,0xAE,0x7A,0xB8,0x0F,0x5F,
+  0x7B,0x96,0xB1,0xE8,0x59,0x4F,0x7D,0xFE,0x30,0x9A,0x49,0xCF,
+  0x72,0x5F,0x74,0x1F,0xCC,0x08,0x2D,0xA1,0xB1,0xEC,0x2D,0xDC,
+  0x42,0x05,0xAF,0x4B,0xAE,0x2A,0xEC,0xCB,0xE1,0x17,0xD1,0x1C,
+  0x22,0xFE,0xA4,0x72,0xFD,0x9D,0xEB,0xAA,0xD9,0x69,0x42,0x55,
+  0x1C,0x14,0x4A,0xF1,0xB5,0x4B,0xCC,0x02,0x31,0x7E,0x46,0x9B,
+  0xC1,0x30,0xBF,0xBA,0x94,0xC2,0x4C,0x06,0x31,0x21,0xE1,0x6F,
+  0xE2,0xF1,0xA2,0xF0,0xF8,0x13,0xDF,0xD4,0xCD,0xCA,0x90,0x65,
+  0x7A,0x92,0xD3,0xCA,0xBB,0x3A,0x08,0xFF,0x38,0xF4,0x97,0xC0,
+  0xF3,0x9D,0xF8,0x67,0xA2,0x2F,0x52,0x73,0xF8,0xD1,0x6C,0x15,
+  0x7A,0x78,0xBA,0x16,0x3C,0x2D,0x41,0x96,0xA8,0x25,0xE8,0x3B,
+  0x14,0x30,0x3D,0x74,0xAE,0x15,0xFE,0x87,0x11,0xF9,0x39,0x07,
+  0xC7,0x40,0x7D,0x72,0x85,0x08,0xF6,0x38,0xBF,0xBE,0xFC,0xFA,
+  0x37,0xF1,0xFA,0x2B,0x7F,0xFD,0x95,0xAD,0x18,0x9F,0xCD,0x27,
+  0x13,0x3C,0x32,0xA1,0x71,0x2E,0x06,0x27,0x97,0x7D,0x7F,0x4C,
+  0x26,0xEC,0x63,0xEB,0xB2,0x44,0xA5,0xA2,0xFE,0x27,0xC3,0xFF,
+  0x2D,0xCB,0xAD,0xF1,0x3F,0xED,0x5B,0xBB,0xBB,0x1A,0x5B,0xDD,
+  0xF6,0x6E,0x13,0x0D,0xDE,0xED,0xBB,0xB6,0x05,0x0F,0xF3,0x47,
+  0x9F,0xF4,0x03,0xB7,0x6E,0x59,0xFA,0xCE,0xE3,0x63,0x81,0xB0,
+  0x26,0x93,0xEC,0xBB,0x96,0x59,0xDF,0xDD,0xF5,0x3F,0x1D,0xB8,
+  0x2D,0xFA,0x69,0x84,0xBC,0x76,0xF1,0x9F,0x67,0xF1,0x4A,0x55,
+  0x3C,0x1D,0x87,0x7F,0xF6,0xF0,0x62,0xAF,0x81,0x3F,0x3A,0xE2,
+  0x56,0xFC,0x51,0x73,0xB7,0x7C,0x65,0xD9,0x9D,0x6B,0xF0,0xCC,
+  0x03,0xF7,0x60,0x47,0xAB,0x0E,0xFE,0x18,0xC4,0x0B,0x18,0x10,
+  0xD0,0xBB,0x7F,0x04,0x8F,0x10,0x4D,0xE9,0x47,0x6C,0x93,0x72,
+  0x6A,0xB8,0xAD,0xEB,0xA0,0xF2,0x5D,0xBB,0x79,0x70,0x50,0x1D,
+  0xD4,0x1A,0x7A,0xFE,0x11,0x0A,0xBB,0x45,0xE1,0x61,0x2E,0x0D,
+  0xA6,0x95,0x67,0xDF,0xF5,0xF7,0x79,0x7E,0x8D,0x7B,0xAA,0xFD,
+  0xA2,0x7D,0xD2,0x7E,0x83,0x07,0x46,0xE7,0x47,0x11,0xA2,0xE9,
+  0xD9,0x67,0x78,0x94,0xB8,0x74,0x14,0x41,0xEA,0x79,0xA7,0xC8,
+  0x05,0x57,0x44,0x91,0xD3,0x8D,0x31,0x75,0x55,0xCB,0x76,0xEA,
+  0x8D,0x66,0xAB,0xDD,0xE9,0x1E,0xFE,0xF4,0xFA,0xE8,0xF8,0x8D,
+  0x6A,0xC0,0xD0,0xAC,0x1A,0xB1,0x6B,0xF5,0xE3,0x7D,0xC1,0xBC,
+  0x1F,0x57,0xAB,0xFA,0x8D,0xEB,0x5F,0xC5,0xD7,0xC6,0xB0,0xEA,
+  0x4E,0xD1,0x76,0xE3,0xC3,0x54,0xBB,0x39,0x38,0x38,0x68,0x40,
+  0x1B,0xF4,0x6A,0xF6,0xC8,0x6E,0xEE,0xDE,0xE4,0x99,0x28,0xFD,
+  0xA7,0xAC,0xEA,0xDF,0x0A,0x55,0xBB,0x4C,0x0A,0x59,0x80,0x79,
+  0xE0,0xE8,0x80,0xC6,0xEA,0x4F,0xF7,0x6F,0x44,0x9D,0x53,0xAC,
+  0xF3,0x6A,0x7A,0x0D,0x4F,0xB1,0x18,0x7B,0x9B,0x37,0x18,0xDE,
+  0xBB,0x1D,0x24,0x38,0x38,0x68,0x5E,0x3F,0xBA,0x9A,0xD3,0x6C,
+  0xEE,0xFA,0x57,0xD3,0x5A,0xE7,0x5A,0xDF,0xDF,0x9F,0xFE,0x50,
+  0x77,0x04,0x88,0x1B,0x09,0xC4,0x2F,0xAB,0x40,0x88,0x9A,0xEB,
+  0x4E,0x99,0x39,0xFB,0xC6,0x86,0xCF,0xEA,0x80,0xB6,0x22,0xDB,
+  0x5D,0xA8,0x48,0x5F,0xC5,0xFB,0x93,0xE6,0x1B,0x37,0xFA,0x83,
+  0x7F,0x75,0xC3,0x10,0xD9,0x4E,0x67,0x7F,0xFF,0x06,0x4A,0x18,
+  0xFE,0x95,0xDD,0xA8,0x6A,0x37,0xD5,0x56,0x03,0x78,0x74,0xF7,
+  0xF7,0x1B,0xFA,0xB5,0x7B,0xD3,0x17,0x30,0xA6,0xAE,0xDD,0xAE,
+  0x3B,0xCD,0x4E,0xC3,0xEE,0xD6,0x41,0xF8,0x7B,0x4E,0x1B,0xEE,
+  0xEB,0x9D,0x76,0x17,0x94,0xB0,0x97,0xBD,0x6A,0x18,0x81,0x2B,
+  0xDE,0x74,0x8C,0x10,0x00,0x87,0xB9,0x7A,0xC2,0xAA,0x0B,0x56,
+  0x43,0xCD,0x63,0xEC,0x4E,0x8D,0xD4,0x1D,0x1A,0x23,0x37,0x36,
+  0x88,0x1B,0xF4,0x87,0xEE,0xD4,0x6F,0xDE,0x04,0x81,0xB6,0xF5,
+  0x62,0x3C,0xDE,0x7E,0x31,0x1A,0x6D,0xBF,0x18,0x0E,0x37,0x5E,
+  0x40,0xAB,0xF8,0x65,0x0C,0x4D,0xE2,0x97,0x01,0xA8,0x80,0x5F,
+  0x4E,0x0D,0x20,0x31,0x02,0x10,0x5A,0x58,0xB5,0xAE,0x8D,0xB6,
+  0xB1,0xD7,0xEA,0x58,0x9D,0x76,0xAB,0x5B,0x6F,0xE9,0xF4,0x15,
+  0xBE,0xB0,0xAF,0x0D,0xDB,0x31,0xF6,0xEA,0x9D,0x6E,0xB3,0xD5,
+  0x68,0x76,0xE0,0x0D,0x16,0xC3,0x37,0x0E,0xBC,0x69,0x1B,0x2D,
+  0xAB,0x65,0x5B,0xCD,0x8E,0xDD,0xD5,0x81,0xD3,0x94,0xBE,0xA8,
+  0x5F,0x1B,0x0E,0x14,0xB1,0xAD,0x46,0xA3,0xE9,0x34,0xEB,0x75,
+  0x98,0x50,0xBF,0x00,0x49,0x83,0x22,0xB1,0xDB,0xAD,0x86,0xDD,
+  0xE9,0x74,0xDB,0x39,0x92,0x26,0x45,0x62,0x63,0x7E,0x5A,0xC7,
+  0x6A,0x38,0x12,0x92,0x16,0x45,0xB2,0x67,0x37,0x40,0x85,0x75,
+  0xBB,0xDE,0xB0,0x73,0x2C,0x6D,0x86,0xA5,0xD1,0x6C,0x5B,0xCD,
+  0x6E,0xA7,0xFE,0x22,0x24,0x1D,0x44,0x62,0xB7,0xDB,0x96,0x55,
+  0x6F,0x36,0x6C,0x49,0x26,0x5D,0x26,0x13,0xBB,0x8B,0xF6,0xD2,
+  0x68,0xD8,0xED,0x1C,0x8A,0x6D,0x31,0x2C,0x0D,0xC7,0x6A,0xD5,
+  0x73,0x18,0xB6,0xCD,0x65,0xD2,0xED,0x5A,0x0D,0x0B,0x98,0x39,
+  0x2F,0x42,0x62,0x3B,0x14,0x0A,0x34,0xBB,0x65,0xD5,0x5B,0x1D,
+  0x47,0x52,0x4F,0x9D,0x61,0x69,0x58,0xD0,0x6C,0xDB,0xB2,0x25,
+  0x24,0x0D,0x2E,0x95,0xA6,0x05,0x22,0x73,0x9C,0xAE,0x25,0xC1,
+  0x69,0x52,0x38,0xE0,0x90,0x5A,0xCD,0x7A,0xB3,0xEE,0x74,0x05,
+  0x1A,0x30,0x2D,0x81,0x06,0x2E,0x05,0x1A,0xB8,0x2C,0xA0,0xB9,
+  0x36,0x9A,0xC0,0xB7,0xD5,0x6C,0x77,0x5B,0x4D,0xDB,0xCA,0xC1,
+  0x80,0x1E,0xBA,0xA8,0xF7,0x56,0xB7,0x69,0xD9,0xAD,0xBA,0x23,
+  0x81,0x41,0x33,0x6A,0x18,0xAD,0x46,0x1D,0x3A,0x56,0xDB,0x96,
+  0x24,0x03,0xF2,0x72,0x2C,0xB0,0xAF,0x36,0x58,0x58,0xBB,0x6E,
+  0x39,0x2F,0x42,0xD2,0xA4,0x48,0xDA,0x96,0xDD,0x04,0xCB,0xEC,
+  0xDA,0x92,0x58,0x2C,0x84,0x52,0xEF,0x00,0x0C,0x0B,0xB5,0x9E,
+  0xE1,0x68,0x52,0x1C,0x7B,0xAD,0x96,0xD5,0x68,0x77,0xEA,0xF5,
+  0x66,0x0E,0xA4,0xC1,0x80,0x34,0xAC,0x66,0xB3,0xDE,0xEE,0x34,
+  0x3A,0x2F,0x02,0xD2,0x45,0x20,0xCD,0x56,0xA7,0xD1,0x80,0x26,
+  0x76,0x24,0x1C,0x0D,0x2E,0x12,0xBB,0xDB,0x01,0xCD,0xA1,0x0E,
+  0x04,0x94,0x3A,0x43,0x62,0x77,0xDA,0xF5,0x56,0xBD,0xDB,0x92,
+  0x6C,0xB6,0x43,0x91,0xD8,0x20,0xC1,0x66,0x1D,0xB4,0x67,0xBF,
+  0x4C,0x39,0x75,0xA6,0x9D,0x06,0x40,0xE9,0xD8,0x8D,0x96,0xD4,
+  0x81,0x1C,0x8A,0xA5,0x69,0x83,0xAD,0x40,0x03,0x73,0x24,0x6D,
+  0x8A,0x04,0x1C,0x1E,0x58,0x42,0x07,0xFA,0x90,0x64,0x27,0x0E,
+  0x13,0x0A,0xCC,0x68,0x40,0x62,0xED,0x76,0xBD,0x21,0xB0,0x80,
+  0x9F,0x12,0x58,0xE0,0x52,0x60,0x81,0xCB,0x92,0x7A,0x1A,0xA8,
+  0xDA,0x0E,0xA8,0x27,0x87,0x01,0xCD,0xB3,0x6D,0x63,0xCF,0x01,
+  0x9B,0x6C,0xB6,0x01,0x65,0xBD,0x64,0x26,0x2D,0x30,0xF4,0x7A,
+  0xD7,0xAA,0x5B,0x4D,0xEC,0x25,0x19,0x14,0xD4,0x4F,0x1D,0xB8,
+  0x35,0xEB,0x56,0xB7,0xD9,0x6C,0xBD,0x08,0x88,0x4D,0x81,0xD8,
+  0x58,0xB4,0x0B,0x1D,0x53,0x32,0xD9,0x06,0x05,0x63,0x3B,0x6D,
+  0xA7,0xD3,0x05,0x73,0xA8,0x17,0xA5,0xD2,0xC2,0x42,0xCD,0x46,
+  0xB7,0x4D,0x8D,0x39,0x83,0x62,0x31,0x28,0xB6,0xD5,0x05,0x69,
+  0x59,0xAD,0x86,0xF5,0x32,0x30,0x75,0x44,0x03,0xCA,0x71,0xDA,
+  0x5D,0xBB,0xDD,0xC8,0xB1,0x58,0x4C,0x30,0xF5,0x66,0x07,0x2C,
+  0xD0,0x71,0x9C,0xA2,0xAD,0x00,0x16,0x78,0xD8,0x74,0xEC,0x6E,
+  0x5B,0xF2,0xB5,0x2D,0x0A,0xA5,0xDD,0xB2,0x9C,0xAE,0xDD,0xE9,
+  0xBE,0x08,0x47,0x97,0x0A,0x05,0xD0,0xD7,0x5B,0x8D,0x46,0x47,
+  0xB2,0x13,0xD4,0x3A,0x02,0x69,0x38,0x76,0xC7,0x6E,0x76,0xB0,
+  0x93,0x14,0xFA,0x4F,0xCB,0x00,0x41,0xB6,0x1B,0x80,0x45,0x72,
+  0x29,0x0E,0x93,0x49,0xB7,0x0B,0x0E,0xBF,0x03,0x6E,0x41,0x40,
+  0x81,0x41,0x4F,0x40,0x81,0x4B,0x01,0x05,0x2E,0x4B,0xA3,0x0F,
+  0x8A,0xBA,0xDB,0x69,0xD5,0x2D,0xE8,0x43,0x39,0x14,0x54,0x02,
+  0x76,0x05,0xA7,0xD5,0xE9,0xDA,0x0D,0xBB,0x59,0x72,0x6F,0xD4,
+  0xD0,0xB1,0x9F,0x34,0xBA,0x96,0xD4,0x95,0xD1,0xBB,0x01,0x7E,
+  0xB0,0xAE,0x3A,0x76,0xE7,0x17,0x41,0xC1,0xC6,0x83,0x05,0x82,
+  0xD3,0x6F,0x80,0xD9,0xB6,0x25,0x9F,0x52,0xA7,0x58,0xA0,0xC3,
+  0x76,0x1B,0x00,0x14,0xC6,0xBD,0x92,0xD7,0x47,0x30,0x56,0xD3,
+  0x6E,0x3A,0x72,0x07,0x62,0x48,0x1C,0x0B,0x10,0x3A,0xA0,0xEF,
+  0xEE,0x8B,0xB0,0x74,0x28,0x14,0x70,0x10,0x30,0xA8,0xD5,0x9B,
+  0x5D,0x49,0x43,0x4D,0x86,0x05,0x8C,0xCF,0x06,0x13,0x6A,0x14,
+  0x87,0x42,0x04,0xD2,0x6C,0xA1,0xCB,0x01,0x07,0x28,0x61,0xA9,
+  0x53,0x30,0x36,0x74,0x02,0xBB,0x69,0xB7,0x1A,0x2F,0xC3,0xD2,
+  0x60,0x2A,0x6A,0x34,0xA1,0x7D,0x56,0x5B,0xEA,0x41,0xB4,0xCF,
+  0xA2,0x5C,0x60,0x64,0x76,0x6C,0x70,0x2D,0xDD,0x62,0x88,0xD0,
+  0x34,0xDA,0xD0,0x84,0x4E,0xDB,0x69,0x4A,0x66,0xDB,0x65,0x72,
+  0xA9,0x83,0x82,0x40,0xCA,0x68,0x2D,0x53,0x37,0xF1,0x86,0xE4,
+  0x06,0xFF,0x13,0xA6,0xA9,0x31,0x06,0xF6,0xF9,0xFD,0xD0,0x48,
+  0x11,0x6A,0x76,0x1F,0x1B,0x23,0xE0,0x94,0xDF,0x07,0x06,0x9E,
+  0x17,0xE3,0x71,0x22,0x0B,0x34,0x39,0x72,0x5D,0x0A,0x1A,0xB1,
+  0x4D,0x83,0x69,0x88,0xA1,0xA3,0x21,0x5E,0x8B,0xC9,0x4F,0xC6,
+  0xEA,0x36,0x48,0x6F,0xE2,0x68,0xA2,0x65,0x0F,0xB2,0x8B,0x1B,
+  0x03,0x26,0x01,0x12,0xA4,0x40,0x07,0x4C,0x00,0xBB,0x5C,0x05,
+  0x8C,0xDC,0x52,0x0D,0x46,0x98,0xD5,0x21,0xEA,0xBF,0xD9,0x9D,
+  0x3E,0xFE,0xE7,0x66,0x17,0x04,0x04,0x64,0x8C,0xA4,0xC4,0x02,
+  0x3C,0xFA,0x36,0x16,0xC3,0xC7,0xE9,0xEE,0x7F,0x36,0xB0,0x80,
+  0xAE,0xBE,0x85,0xC5,0x1F,0xD3,0x3F,0x36,0x94,0x07,0xE5,0x6F,
+  0x2E,0x3F,0xFD,0x43,0xBB,0x79,0xFC,0xCF,0x50,0x5F,0xCD,0x22,
+  0x93,0x13,0x8D,0xD3,0x59,0xE8,0xAD,0xB5,0x60,0x60,0x85,0x89,
+  0x83,0x5E,0xE5,0x57,0xD9,0xE4,0x45,0xF3,0x0F,0x0E,0x20,0xBC,
+  0xAA,0xE2,0x24,0x87,0xFE,0x9E,0xD2,0xDF,0xFB,0xFB,0x76,0xEB,
+  0x91,0x91,0x4E,0x25,0xDE,0x42,0x45,0x94,0xB5,0x98,0xBC,0x42,
+  0xF8,0xFF,0x08,0x5C,0x0E,0xEA,0xCE,0x1E,0x4C,0x14,0xFE,0x2F,
+  0x7B,0x06,0xF4,0xBC,0xD7,0x7A,0x00,0x00,
+};
+const unsigned int src_www_build_functions_js_gz_len = 9104;
+
+const unsigned char src_www_build_index_html_gz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x08,0xA3,0x04,0xD5,0x6A,0x02,0xFF,0x69,0x6E,
+  0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x00,0xCD,0x3C,0x6B,
+  0x73,0xDB,0x38,0x92,0xDF,0xFD,0x2B,0x30,0xAC,0x9A,0xB1,0x54,
+  0x6B,0x51,0xB6,0x1C,0x27,0x59,0xD9,0xD2,0x96,0x63,0x3B,0x89,
+  0x6F,0xED,0x58,0x89,0x9D,0x99,0xDD,0xA9,0xAB,0x9A,0x82,0x48,
+  0x48,0xC2,0x9A,0x22,0x18,0x12,0x94,0xAC,0x4D,0xF2,0xDF,0xAF,
+  0x1B,0x00,0x9F,0x22,0x29,0x29,0xC9,0xEE,0x8D,0x63,0x8B,0x22,
+  0x88,0x7E,0xA0,0xD1,0xE8,0x07,0xD8,0xC8,0xD9,0x4F,0x97,0x77,
+  0x17,0x0F,0xFF,0x1C,0x5D,0x91,0x99,0x9C,0x7B,0xC3,0xBD,0x33,
+  0xBC,0x10,0x8F,0xFA,0xD3,0x81,0xC5,0x7C,0x0B,0x1B,0x18,0x75,
+  0xE1,0xF2,0x53,0xA7,0x43,0xC8,0x85,0x08,0x56,0x21,0x9F,0xCE,
+  0x24,0x69,0x39,0x6D,0xD2,0x3B,0xEC,0x1D,0x77,0x7A,0xCF,0xC8,
+  0x25,0x5D,0x70,0x97,0xFC,0x9D,0x85,0xE1,0x01,0x60,0x91,0x41,
+  0xD4,0xEF,0x76,0xA7,0x5C,0xCE,0xE2,0xB1,0xED,0x88,0x79,0xD7,
+  0x7D,0x84,0x27,0xCF,0x9F,0x91,0x4E,0x07,0xD0,0xCC,0x99,0xA4,
+  0xC4,0x99,0xD1,0x30,0x62,0x72,0x60,0x7D,0x7C,0x78,0xDD,0x79,
+  0x69,0x25,0xCD,0x3E,0x9D,0xB3,0x81,0xB5,0xE0,0x6C,0x19,0x88,
+  0x50,0x5A,0xC4,0x11,0xBE,0x64,0x3E,0x74,0x5B,0x72,0x57,0xCE,
+  0x06,0x2E,0x5B,0x70,0x87,0x75,0xD4,0xCD,0x01,0xE1,0x3E,0x97,
+  0x9C,0x7A,0x9D,0xC8,0xA1,0x1E,0x1B,0x1C,0xD9,0x87,0x07,0x64,
+  0x4E,0x9F,0xF8,0x3C,0x9E,0xE7,0x9B,0xE2,0x88,0x85,0xEA,0x9E,
+  0x8E,0xB1,0xA9,0x44,0x8A,0x06,0x81,0xC7,0x3A,0x73,0x31,0xE6,
+  0x70,0x59,0xB2,0x71,0x07,0x1A,0x3A,0x92,0x4B,0x8F,0xE5,0x88,
+  0x7F,0x38,0x7F,0xB8,0x7C,0x73,0xB7,0x0D,0xA4,0x43,0x03,0x24,
+  0x93,0x83,0x5D,0xB1,0x68,0x1B,0xC0,0x48,0x52,0x19,0x47,0x9D,
+  0x31,0x05,0x5E,0xE5,0xAA,0x80,0x61,0xEC,0x51,0xE7,0x31,0xC5,
+  0x81,0xD2,0xED,0xB0,0x4F,0x31,0x5F,0x0C,0xAC,0x7F,0x74,0x3E,
+  0x9E,0x77,0x2E,0xC4,0x3C,0xA0,0x92,0x17,0xA9,0x72,0x36,0x60,
+  0xEE,0x94,0x21,0x94,0x1A,0xCC,0xF0,0xAD,0x98,0xB3,0xBF,0x73,
+  0x49,0xDE,0xD0,0x90,0x4E,0x19,0xB9,0x14,0x22,0x24,0x77,0x01,
+  0xF3,0x59,0x78,0xD6,0xD5,0x3D,0xF6,0xCE,0x3C,0xEE,0x3F,0x92,
+  0x90,0x79,0x03,0x4B,0xB1,0x10,0xCD,0x18,0x83,0x29,0x98,0x85,
+  0x6C,0x62,0x5A,0x6C,0x27,0x8A,0xFE,0xB6,0x18,0x3C,0x7B,0x7D,
+  0x7E,0xCB,0xA7,0x56,0x01,0x82,0x03,0xE9,0xA4,0xEF,0x04,0x94,
+  0x01,0x6E,0xED,0xC0,0x9F,0x42,0xEF,0x5F,0x5F,0xBF,0xF8,0x6B,
+  0x78,0x6E,0x11,0xB9,0x0A,0x60,0xF0,0x7C,0x0E,0xE4,0xBB,0xF0,
+  0xA4,0x08,0xAE,0x65,0x22,0x45,0xEC,0xCC,0x3A,0x79,0x54,0xE5,
+  0x76,0x83,0xF3,0x6E,0x71,0xFF,0xE2,0xE5,0xB2,0x12,0x67,0xE4,
+  0x84,0x3C,0x90,0x24,0x0A,0x1D,0x60,0x24,0xF6,0x1D,0xC9,0x85,
+  0x1F,0xD9,0xFF,0x42,0xBE,0x17,0xA3,0xF7,0x6F,0xD8,0xD2,0x1A,
+  0x9E,0x75,0x75,0x27,0xE8,0xDD,0x35,0xAA,0x3D,0x16,0xEE,0x0A,
+  0x2E,0x2E,0x5F,0x10,0xC7,0xA3,0x51,0x84,0xB0,0x9E,0x17,0x50,
+  0x2D,0x42,0x6C,0xE6,0xEE,0xC0,0xF2,0x04,0x75,0x59,0x68,0x25,
+  0x5D,0x3C,0x37,0x74,0x40,0xDA,0xD0,0x02,0x28,0xA1,0x0F,0x4E,
+  0x11,0xE5,0x7E,0x11,0x0F,0x12,0xC0,0x1E,0x85,0x46,0x4F,0x4C,
+  0x05,0x36,0x05,0x21,0x2B,0x35,0x91,0x3F,0xF0,0xA7,0xE6,0x93,
+  0xE8,0xEF,0x7B,0x5F,0x08,0x7E,0xFF,0x02,0xB7,0xF0,0x09,0x7F,
+  0xE4,0x8F,0x2F,0xF8,0xA1,0x3E,0xC9,0xFF,0xAA,0x4F,0xF2,0x65,
+  0x4F,0x5D,0x3B,0xE6,0xCE,0xFC,0x5B,0xFB,0xDD,0xFB,0x02,0x60,
+  0xE9,0x2F,0x60,0xC3,0x3F,0xFC,0x51,0x9F,0x5D,0xF3,0x7D,0x8F,
+  0xA4,0x3F,0x67,0x5D,0x60,0x1A,0x59,0x2F,0x32,0x4E,0x26,0xA0,
+  0x50,0x89,0x92,0x09,0x9F,0xBC,0xF9,0xF0,0xE6,0xF2,0xEE,0x88,
+  0xBC,0xA5,0xA1,0xBB,0xA4,0x21,0x03,0x28,0x94,0xB6,0x16,0x52,
+  0x4E,0x10,0xB8,0x22,0x94,0x20,0x94,0x7C,0xF5,0xF2,0x7E,0x87,
+  0x6D,0x44,0x29,0xDC,0xC0,0x9A,0xD3,0x70,0xCA,0xFD,0xFE,0x61,
+  0xF0,0x74,0x6A,0x0D,0x73,0xCA,0xBB,0x86,0xD0,0xF4,0x9F,0xC0,
+  0x1C,0xC9,0xBE,0x32,0x50,0xA7,0x0B,0x16,0x4A,0x0E,0x0B,0xBF,
+  0x43,0x3D,0x3E,0xF5,0xFB,0x64,0xCE,0x5D,0xD7,0x63,0xA7,0x24,
+  0xA0,0xAE,0xCB,0xFD,0x69,0xC7,0x63,0x13,0xD9,0x27,0x87,0x59,
+  0x83,0x02,0x53,0x2D,0x4E,0x1C,0x46,0x22,0xEC,0x93,0x40,0x70,
+  0x9C,0xE0,0x53,0xE4,0x91,0xCF,0xA7,0x8A,0x4B,0x30,0x5B,0x12,
+  0x7A,0x47,0x46,0x51,0x95,0xA6,0xA5,0x6D,0x91,0xC7,0x61,0xBA,
+  0x23,0x3B,0x5A,0xA0,0x9E,0xDE,0xDC,0xBF,0x7E,0x3F,0x01,0x3D,
+  0xA5,0x1E,0xAC,0xC9,0x7B,0xD3,0x27,0x1D,0x9B,0x32,0x63,0xFD,
+  0x23,0xFB,0x84,0xCD,0x4F,0x67,0x4C,0xD1,0xD6,0x37,0x79,0x6A,
+  0xA8,0x51,0x79,0x4A,0x53,0x25,0x03,0x30,0x34,0xA1,0xA1,0xF1,
+  0xDE,0x19,0x87,0x9F,0xA6,0x86,0x06,0xCE,0x80,0xD2,0x5A,0x98,
+  0x03,0xC7,0xE3,0xCE,0x23,0x28,0x20,0x8F,0xA4,0x08,0x57,0xF6,
+  0x18,0xAC,0x48,0xAB,0x6D,0xE5,0xA6,0x92,0x24,0x8C,0xB8,0x3C,
+  0x0A,0x3C,0xBA,0xEA,0xFB,0xC2,0x07,0xF1,0x34,0xB2,0x65,0x24,
+  0x9E,0x13,0x7C,0xCA,0xA4,0xA6,0x6B,0x50,0x1A,0x91,0x82,0x30,
+  0x61,0xE6,0x52,0x01,0x8F,0x85,0x94,0x62,0xDE,0x27,0x47,0x7A,
+  0x3E,0x0B,0xAA,0x00,0x66,0x1A,0x26,0x4C,0xDB,0x41,0x65,0xB7,
+  0xD0,0x90,0xE2,0x35,0xC4,0x0F,0xB7,0x28,0x34,0xF2,0xEC,0xF0,
+  0x67,0x6B,0xF8,0x9A,0x87,0x73,0xD4,0xAE,0x3E,0xD8,0x30,0x57,
+  0xF5,0x1A,0x9E,0x45,0x01,0xF5,0x15,0x4F,0x13,0xF3,0xF0,0x57,
+  0x40,0x0A,0x36,0x40,0x2D,0x7B,0x78,0x36,0x3C,0x1B,0x87,0xD0,
+  0x2B,0x0E,0x52,0x8D,0x01,0x9B,0xD9,0x89,0xF8,0xBF,0x19,0xF0,
+  0x6A,0x3F,0x57,0xC3,0x54,0x48,0x0A,0x82,0x4A,0x7E,0x10,0xB1,
+  0xCF,0x96,0x8B,0x32,0xCE,0x94,0xAA,0x2B,0x24,0xFC,0x1E,0x65,
+  0x4F,0xBA,0x40,0x6A,0x68,0xF8,0xEB,0xEA,0xB1,0x94,0x06,0x34,
+  0xE3,0x92,0x75,0xA0,0xB3,0x03,0x1C,0xC0,0xDA,0x02,0xFA,0x1F,
+  0x03,0xF2,0xC0,0xE7,0xD5,0xC3,0x8A,0x03,0x7C,0xB4,0xCB,0x68,
+  0x5A,0x2E,0x5D,0x45,0xFD,0x59,0x18,0xF5,0xE7,0xB0,0x92,0x22,
+  0xE6,0xB4,0x2B,0x99,0x4A,0x30,0x98,0x29,0x27,0xBD,0xE0,0xC9,
+  0xD2,0x8C,0x3A,0xC2,0x43,0x5A,0x03,0xAB,0x67,0x55,0x8E,0x64,
+  0xF8,0x1B,0x7F,0xCD,0xC9,0xFD,0xFD,0xF5,0x65,0xC6,0xB1,0xE2,
+  0x75,0xC9,0x27,0x1C,0x9B,0x9B,0xC0,0x3E,0x40,0x87,0x0A,0x30,
+  0x6C,0x6E,0x02,0x3B,0x1F,0x55,0x4A,0x07,0x41,0x5F,0x25,0x24,
+  0x77,0x9A,0x6E,0x63,0xE0,0x9D,0x47,0xE6,0x9E,0x8F,0xAC,0xCA,
+  0xC9,0x2F,0xAD,0x16,0x82,0xCB,0x05,0xC4,0x7B,0xA3,0x80,0x88,
+  0x14,0xC0,0x54,0x7B,0xE3,0xB4,0x0F,0x6F,0xCF,0x2F,0xC8,0xB9,
+  0xEB,0x86,0x2C,0x8A,0x4A,0xE3,0x9E,0x53,0xC7,0x3C,0xA8,0x19,
+  0xF9,0xF5,0xA8,0x06,0x12,0xF8,0xA6,0xDE,0xF5,0xA8,0x06,0xEC,
+  0x1D,0x93,0x73,0x1A,0x3D,0x96,0x60,0xA2,0x78,0xEC,0x33,0x79,
+  0x0B,0x0F,0x6A,0xC0,0xDE,0x50,0xC9,0x96,0x74,0x45,0xAE,0x47,
+  0x25,0xC8,0xA9,0x7E,0xB0,0x46,0xAF,0x9B,0x2C,0xD9,0x75,0x3B,
+  0xFF,0x29,0x74,0x84,0xCB,0xF2,0x76,0xCD,0xB4,0x68,0xA3,0xA6,
+  0x6F,0x8C,0x41,0x1B,0x7D,0xBC,0xBA,0xFB,0x9F,0xF7,0xC6,0xA0,
+  0xBD,0xFF,0x00,0x11,0xA7,0x9B,0xD9,0x95,0x82,0xA9,0xCA,0x3C,
+  0x47,0xC8,0xC0,0xFC,0xF0,0xB0,0xC3,0xFD,0x89,0xA8,0xEE,0x4B,
+  0x72,0x13,0x6F,0xCC,0xCF,0xF5,0x84,0xAC,0x44,0x0C,0xF6,0x2E,
+  0x9A,0xE1,0xEC,0x21,0x02,0xBC,0x52,0x5F,0xC8,0x19,0xCB,0xBC,
+  0xD9,0x0C,0xAE,0x07,0xD8,0x73,0x6F,0x1E,0x47,0x92,0x80,0x5D,
+  0x81,0xCF,0xD8,0x57,0x04,0xC9,0x24,0x14,0x73,0xC2,0x9E,0xC0,
+  0xC6,0x82,0x7D,0x53,0x5D,0xED,0xBD,0x3A,0x67,0x87,0x21,0x85,
+  0x32,0x5F,0xD5,0x56,0xB2,0xC9,0x1E,0x6E,0x67,0x56,0x4F,0xB0,
+  0x31,0x55,0xCF,0x89,0xC7,0xE0,0xF6,0x5F,0xC0,0x33,0x9F,0xAC,
+  0x3A,0x26,0x34,0xEC,0x13,0x65,0x69,0x3A,0x6C,0xC1,0x7C,0x6F,
+  0xA5,0x3D,0x8D,0x1F,0xC4,0xD2,0x84,0x52,0xE3,0x18,0x30,0x81,
+  0xAB,0x59,0x50,0x2F,0x86,0xDB,0x0F,0x6C,0x2C,0x84,0x24,0x10,
+  0xFF,0x82,0x37,0xCF,0xF9,0x94,0x50,0xB5,0xEB,0xE6,0x96,0x0C,
+  0x63,0xD6,0xDE,0x80,0x28,0xB1,0xD4,0xE4,0x63,0xE0,0x82,0xF6,
+  0xE4,0x50,0x45,0x33,0xB1,0xD4,0x8D,0x97,0x10,0xCB,0x8B,0x69,
+  0xAB,0x6D,0x35,0x68,0x10,0x49,0x02,0xAE,0x6A,0x6A,0xCA,0x40,
+  0xFA,0x38,0x31,0xB9,0x21,0x80,0x6F,0x4E,0xE6,0x32,0x47,0x57,
+  0x77,0x33,0x43,0x68,0x57,0xBB,0xB6,0xB5,0x79,0x4B,0xDC,0x52,
+  0xC9,0x19,0xFD,0xF5,0xE4,0x67,0xAB,0xD6,0x53,0x1D,0x1F,0xFE,
+  0x0C,0x62,0x56,0x01,0xF7,0x3D,0x4C,0x66,0xCE,0xAA,0x97,0x3A,
+  0xF6,0xB0,0xA3,0x59,0x60,0xE8,0xE3,0x11,0x44,0x41,0xA4,0xCB,
+  0xAC,0x06,0xF7,0x8D,0x4A,0xC7,0xEE,0xFC,0xAD,0x31,0x2B,0x80,
+  0x3B,0xBF,0x66,0xDD,0xA3,0x3D,0x5B,0x63,0x35,0x07,0x0C,0x8F,
+  0xCB,0x6C,0x0D,0xEF,0xC6,0x11,0xA8,0x81,0x0A,0xB6,0x2B,0x81,
+  0x92,0xE7,0xCC,0xAD,0x21,0xAA,0xE4,0x33,0x0A,0x85,0x14,0xE0,
+  0x6D,0x4A,0x28,0x60,0x86,0xEE,0x19,0x44,0x64,0x5C,0xAE,0x1E,
+  0x60,0xBA,0xF3,0x74,0x6F,0x45,0x2D,0x49,0xFD,0x68,0x8D,0x9C,
+  0xEA,0xB1,0x60,0x33,0xEE,0x78,0xEC,0x83,0x58,0xD6,0x1B,0x16,
+  0x80,0xFA,0x55,0x77,0x2B,0xA1,0x37,0xC0,0xF7,0x26,0x52,0xC9,
+  0x98,0xB9,0x04,0x2B,0x40,0x7D,0xA7,0xDA,0x6F,0x1B,0x28,0xEC,
+  0x93,0xFA,0xA6,0x5F,0xFC,0x71,0x14,0x9C,0x3A,0xF3,0x8D,0x56,
+  0xD4,0x48,0x01,0xD7,0x70,0x08,0xCE,0xD8,0x5A,0xD7,0xCC,0xBD,
+  0x35,0x37,0x55,0x8C,0x72,0x7B,0x05,0x83,0x61,0x02,0x5D,0xDD,
+  0xF8,0x43,0x0C,0x86,0xF2,0x42,0x88,0xF5,0x55,0x71,0xE1,0x27,
+  0xBA,0x59,0xF4,0xA8,0xD9,0xEA,0x67,0x12,0xD7,0xDF,0x7E,0x41,
+  0x2F,0xF7,0x0F,0x48,0x0B,0xC9,0x49,0x5B,0x42,0xF4,0xCF,0xA4,
+  0xAD,0x70,0x91,0xC1,0x60,0x40,0xF6,0x13,0x7C,0xFB,0x6D,0xF2,
+  0x37,0xB2,0x7F,0xB4,0x4F,0xFA,0x64,0xFF,0x70,0xBF,0xDD,0xC8,
+  0x97,0x0B,0xBA,0x55,0x62,0x0B,0x53,0x5F,0x95,0x47,0x6C,0xC5,
+  0x57,0xBA,0x12,0x9B,0x38,0x4B,0x51,0xEE,0xC2,0x1A,0x06,0x1C,
+  0x65,0x89,0xE1,0xF2,0xDB,0x9A,0xB5,0x74,0x35,0x36,0x0A,0x2D,
+  0x41,0xB9,0x13,0x6B,0x14,0x3C,0x50,0x99,0x37,0x6C,0xC3,0xD9,
+  0xAC,0x5E,0x35,0xCD,0x0C,0x83,0xC6,0x82,0xF2,0x2B,0x14,0x8D,
+  0xCC,0x1A,0x1A,0x55,0xBC,0x56,0x67,0x1F,0x69,0xF2,0x55,0xC8,
+  0x40,0x0A,0x61,0xDA,0x5A,0xD2,0x57,0xB1,0x1A,0x2A,0x7C,0x70,
+  0xAD,0xC7,0xEE,0x48,0x11,0xD4,0x38,0xE1,0x1C,0x9A,0xD4,0x5D,
+  0x18,0x74,0x01,0x7C,0x2E,0x45,0xE8,0xE6,0x9D,0x45,0x92,0x45,
+  0xD3,0x31,0xF3,0x20,0xF2,0x87,0xB1,0x63,0x4E,0x9C,0x33,0x21,
+  0xDA,0x48,0x24,0xF3,0x64,0x12,0x10,0xEC,0xA7,0xF3,0x64,0x3D,
+  0x71,0x92,0x3D,0x81,0x73,0x83,0xF1,0x3A,0x6C,0x26,0x3C,0xC8,
+  0x40,0x07,0x16,0x75,0x21,0xDC,0xB7,0x70,0x47,0xCC,0x63,0xFE,
+  0x54,0xCE,0x06,0xD6,0xF1,0x21,0xDC,0x72,0x3F,0xB9,0x55,0x5B,
+  0x61,0x99,0xA5,0xAA,0x4A,0x51,0x8A,0xCC,0x8D,0x0C,0xFB,0x9B,
+  0x98,0x4B,0xFA,0x25,0xCC,0xA5,0xC3,0x2E,0x32,0x08,0x3D,0x49,
+  0xF6,0x88,0xC6,0x68,0xFA,0xE7,0x81,0xC7,0x24,0x53,0xCF,0x3A,
+  0x79,0x69,0xED,0xC2,0xE6,0x85,0xF0,0x31,0xF7,0x6B,0xE4,0xD2,
+  0xD1,0x7D,0xB6,0xE4,0xD4,0xF4,0x26,0x05,0x8E,0xF3,0x5C,0x69,
+  0x02,0xEB,0x9F,0x8D,0x31,0xD1,0x3D,0x5D,0x40,0x3C,0x04,0x13,
+  0xD9,0xCD,0xD8,0x48,0x17,0x8D,0x33,0xA3,0xFE,0x94,0x25,0x0F,
+  0x4C,0x80,0x52,0xE1,0x37,0xCB,0x19,0x84,0x74,0x66,0xB7,0xD1,
+  0xD4,0x6A,0xCA,0x76,0x30,0x21,0x6A,0x72,0x38,0x3B,0x04,0xAE,
+  0xDB,0x2D,0x83,0x6A,0x8F,0x54,0xB5,0xEF,0x62,0x95,0x57,0x4C,
+  0xB2,0xB4,0x2B,0xC2,0xAB,0xE2,0xD0,0xF4,0xFE,0xC4,0x59,0x3C,
+  0x7C,0x27,0x88,0x8E,0x4E,0xE1,0xF2,0x29,0xE6,0x21,0x43,0x75,
+  0x8D,0x87,0x3B,0x69,0xD0,0xBB,0x2D,0x56,0xE0,0x65,0x6E,0xAF,
+  0xAA,0x76,0x0D,0x6E,0xB9,0xFC,0x9A,0x78,0x51,0x81,0xD1,0x85,
+  0x27,0x22,0x46,0x2E,0x19,0xDA,0xB3,0x3A,0xBE,0x34,0x13,0x21,
+  0xAA,0x8D,0xA2,0x33,0xB0,0x0E,0x15,0xF9,0x81,0xF5,0xFC,0x30,
+  0xD5,0xB9,0x43,0x6D,0xDB,0x1F,0x1E,0x2E,0x22,0x06,0x5A,0xED,
+  0x42,0x28,0xA1,0x37,0xA5,0xF3,0x2D,0x89,0xEC,0xD5,0x56,0x56,
+  0x63,0x2A,0x6C,0xB6,0x8A,0x4E,0x92,0xC9,0x56,0xD1,0x8E,0x79,
+  0x56,0xB7,0xFB,0x56,0x98,0xB7,0x97,0x6C,0xDE,0xB4,0xDD,0x42,
+  0x4A,0xDC,0xFE,0x8A,0xA3,0x28,0x85,0x4F,0xF7,0xFA,0x91,0x69,
+  0xDB,0x46,0xA4,0x1F,0xB4,0x62,0x90,0x8D,0xF6,0x4C,0x8B,0xD4,
+  0x99,0x31,0xE7,0x71,0x2C,0x9E,0xB4,0xE8,0x82,0x25,0xE8,0x55,
+  0x22,0x35,0x73,0x63,0x84,0xEB,0x8B,0xB2,0x0C,0xCA,0x63,0x05,
+  0x21,0xB9,0x6C,0x42,0x63,0x0F,0xB4,0x5D,0xD9,0xE7,0x6E,0x62,
+  0x4E,0x76,0x60,0xFF,0xE6,0xEA,0x92,0x50,0x08,0xB5,0x17,0x10,
+  0x0F,0x6F,0xD4,0x06,0x97,0x0B,0xCD,0x37,0x40,0x71,0x90,0xFF,
+  0x61,0xC2,0xBA,0xB9,0xCF,0x69,0x06,0x6E,0xC8,0x23,0x05,0xDC,
+  0xCA,0xCD,0xF5,0x1F,0xDE,0x4D,0x26,0x64,0x39,0x63,0x18,0xC6,
+  0x7A,0xEC,0xAC,0xAB,0xFA,0x0C,0x37,0xD1,0x39,0xAA,0xA3,0x73,
+  0x54,0x4D,0x07,0x9A,0xEF,0xFC,0xDD,0xC9,0xF4,0xEA,0xC8,0xF4,
+  0xAA,0xC9,0x40,0x33,0x44,0xE0,0x68,0x61,0x32,0x0A,0x9B,0x25,
+  0x7E,0xBF,0x8A,0x20,0x33,0xDD,0x49,0x4D,0x22,0x05,0x72,0xE5,
+  0x27,0xFC,0x65,0xF7,0x99,0xB2,0xA0,0xB5,0x57,0x66,0x1E,0x6C,
+  0x87,0x98,0x4E,0x21,0xA5,0x50,0x9D,0xB4,0xB1,0xDF,0xA0,0x46,
+  0xF7,0xCC,0x77,0x09,0x74,0x8E,0xD4,0x8E,0x05,0xD1,0xE8,0x89,
+  0xDE,0x33,0x68,0xD2,0xA5,0x9C,0x21,0xAC,0x33,0xB5,0x39,0xFE,
+  0x1F,0xF4,0xCB,0xAC,0xCA,0x88,0xAA,0x22,0x88,0xB9,0x1E,0x25,
+  0x02,0x53,0x7C,0x90,0xEB,0x51,0x77,0x24,0x42,0x59,0x2B,0xB8,
+  0x84,0xB2,0xA2,0x75,0x3D,0xD2,0x8D,0xE6,0x9A,0x67,0xE3,0x7A,
+  0xD4,0x60,0x63,0x0F,0x6D,0xF5,0xCF,0xAA,0x31,0x20,0xF8,0x93,
+  0xB3,0xBA,0x2F,0x0A,0x26,0xF9,0xE8,0x04,0x06,0x07,0x72,0x55,
+  0xDF,0x0C,0x73,0xFD,0x5D,0xB9,0x1B,0xA9,0x37,0x95,0xB5,0xFC,
+  0x9D,0x1C,0x3D,0x2B,0xD9,0xFD,0x26,0x4E,0x33,0xDE,0x52,0xD6,
+  0x4E,0xCA,0x8E,0x22,0x73,0xD8,0x1B,0x35,0xF7,0xF6,0xFD,0xC3,
+  0xC3,0x4E,0x7A,0x3B,0xFF,0x24,0x65,0xA6,0xB5,0xC9,0x5D,0x83,
+  0xCE,0xDE,0x42,0x97,0xAD,0x34,0x76,0x14,0x8F,0x3D,0xDC,0x69,
+  0xC3,0x1D,0x2D,0xA6,0xF7,0xD9,0x08,0xB2,0x47,0xC6,0xA1,0x78,
+  0xFC,0x31,0x4A,0x8B,0xEC,0x7E,0xAB,0xCA,0xBE,0x52,0x5C,0x34,
+  0xEB,0x6B,0x42,0x43,0xAB,0x77,0xC3,0x9C,0xEB,0x21,0xD9,0x6A,
+  0x5B,0xB6,0xA0,0x70,0xCF,0x8F,0x1B,0x14,0x2E,0x41,0xBF,0x41,
+  0xA1,0x8E,0x5E,0xBE,0x3C,0x2E,0x69,0xD4,0x76,0x7A,0x53,0x37,
+  0xF4,0xAD,0x92,0x0E,0x64,0x0C,0x3B,0x16,0x19,0xAB,0x1D,0xDA,
+  0x76,0x94,0xB7,0xCA,0x28,0x94,0x48,0xB6,0x0B,0xD4,0x63,0xA3,
+  0x9C,0xEE,0x77,0x73,0xF6,0x20,0x02,0xEE,0xE0,0xEB,0x98,0x09,
+  0x7F,0xDA,0xC8,0x9D,0xEA,0xDC,0x30,0x63,0x21,0x95,0x53,0x57,
+  0x14,0x83,0xC1,0xA3,0x7A,0x9E,0x76,0x58,0xDF,0x37,0xE7,0xEF,
+  0xC8,0xB9,0xEF,0x8B,0xB8,0xB8,0xED,0xB4,0x79,0x9D,0x53,0x03,
+  0x94,0xAD,0xF5,0x7C,0xCB,0x2E,0x01,0xCD,0x2D,0x44,0x33,0x10,
+  0xE7,0x45,0xD2,0xAC,0x6C,0x3D,0x03,0x11,0xBE,0x04,0x56,0xFA,
+  0x0F,0x59,0x93,0x84,0xA9,0x7A,0xDC,0x21,0xC2,0xF9,0x8D,0x8D,
+  0x67,0x42,0x3C,0x46,0x8D,0x82,0x5F,0xEA,0x4E,0x1F,0x3F,0xDC,
+  0x1C,0x35,0x88,0x1E,0xCB,0x25,0xFA,0xDD,0xEE,0x4C,0x44,0xB2,
+  0x8F,0x25,0x25,0x10,0x70,0x61,0x1A,0x93,0xF7,0x01,0xBD,0x17,
+  0xC9,0x54,0x1C,0xD7,0x78,0x11,0xE1,0x2B,0xB2,0x40,0x60,0xC6,
+  0x23,0xDB,0xA5,0x92,0x82,0xDD,0xB1,0x99,0xCB,0x25,0x73,0xC9,
+  0x00,0x37,0x29,0x36,0xA6,0x67,0x8D,0x03,0xE8,0xFD,0x69,0x07,
+  0x50,0x76,0x27,0x6A,0x4F,0x95,0x3C,0x40,0xC2,0x36,0x65,0x61,
+  0xB4,0x9B,0x67,0x51,0xB0,0x66,0x57,0x36,0xF1,0x2F,0x85,0xB6,
+  0x9C,0x97,0x71,0x75,0x90,0xE6,0x16,0x83,0xB8,0x42,0x77,0xC3,
+  0x4C,0x75,0xA4,0x58,0x45,0x3A,0xB7,0x47,0x5D,0xA4,0x5F,0x78,
+  0x50,0x50,0xFD,0x35,0xDA,0xF9,0xAE,0xF9,0x4D,0xEF,0xED,0xB9,
+  0xF8,0x8D,0x7A,0xDE,0x88,0xFA,0x20,0xCD,0x02,0x0F,0xB9,0xE6,
+  0x66,0x0E,0xB2,0x8E,0x43,0xFC,0x4A,0xD4,0xF7,0xBA,0x60,0xB6,
+  0xB0,0x5F,0xAD,0x5D,0x65,0xD3,0x86,0x77,0x69,0xB6,0xCD,0xF6,
+  0x37,0xA9,0xD8,0xD7,0xDE,0x94,0x7A,0x9E,0x98,0xD4,0xF3,0xF8,
+  0x30,0xCB,0x3D,0x8F,0x5E,0x9A,0xEC,0xD3,0x30,0xF4,0x30,0x0B,
+  0x59,0x84,0x6A,0x9E,0x48,0x62,0xAD,0xBD,0x52,0x97,0x8B,0xD9,
+  0xE9,0x7F,0x37,0x13,0x2D,0x73,0x78,0x71,0xBB,0xB6,0x97,0xAF,
+  0xAF,0xAD,0x5D,0x31,0x5D,0x83,0xE7,0x2A,0xE1,0xE2,0xD0,0xD4,
+  0x6E,0xB4,0x9A,0x4D,0x3B,0x21,0xB8,0xCB,0x13,0x0F,0x3F,0x7C,
+  0xEF,0x56,0x48,0xCD,0x7B,0x99,0x4D,0xD9,0x26,0xB8,0x3B,0x48,
+  0xD9,0xD3,0x24,0x50,0xDF,0xAA,0x37,0x38,0x51,0xA2,0x86,0x35,
+  0xF9,0x60,0x02,0x09,0x39,0x84,0xF3,0x97,0x8D,0x69,0xA0,0xEE,
+  0xDD,0xDB,0x82,0x4E,0xAF,0x92,0x4E,0x4F,0xD3,0x21,0x3D,0xFB,
+  0x70,0x1B,0x5A,0x6E,0xB8,0xC2,0xD7,0x22,0x90,0x7D,0x6F,0x41,
+  0xF1,0x78,0x9D,0x62,0x0E,0x7E,0x78,0x19,0xAE,0xC8,0x85,0xBE,
+  0xD9,0x29,0x17,0x05,0x27,0x0B,0x91,0x49,0xFE,0xA5,0xFC,0x36,
+  0xE9,0xA8,0x82,0xC2,0x3C,0xCA,0xA4,0xA3,0xE9,0x7D,0x53,0x3A,
+  0x6A,0x3A,0x6D,0xB1,0xFB,0xB8,0x21,0x99,0x34,0x88,0xE4,0x37,
+  0xC6,0xE6,0x55,0x75,0x0F,0x35,0xA9,0xA4,0xA1,0x54,0x91,0xAC,
+  0x5D,0x8F,0xA8,0x29,0xAE,0xF8,0x6F,0xE4,0x92,0xDB,0x45,0x99,
+  0x6B,0x95,0x19,0xDF,0x30,0x2A,0x5F,0xE3,0xF8,0x13,0x8D,0xCA,
+  0x14,0x8E,0x7C,0xD7,0xA8,0x4C,0x8D,0xC9,0x9F,0x68,0x54,0x97,
+  0xEF,0xEE,0x89,0x4E,0xFC,0xBE,0x6F,0xBA,0x60,0xFD,0x45,0x9B,
+  0xF2,0xC7,0xFF,0xD4,0xD8,0x76,0xC8,0x2C,0xAE,0x7C,0xB5,0x9E,
+  0xDF,0x3D,0xEC,0x66,0x68,0x98,0x02,0x03,0xA8,0xC4,0xD2,0xE4,
+  0x1A,0x1A,0x4C,0x0D,0xD6,0xB4,0xFD,0x0E,0x66,0x60,0xAB,0x9D,
+  0x84,0xBB,0xB1,0xA4,0xDC,0x27,0x12,0x60,0x74,0xFD,0x0D,0x60,
+  0xFF,0x81,0x5B,0x5F,0xD2,0xF0,0xF2,0xAD,0x3B,0x09,0x38,0x16,
+  0x82,0x08,0x2A,0x04,0x17,0x31,0x8F,0x39,0xA9,0xA2,0x24,0x94,
+  0xAE,0x95,0x38,0x1F,0x7E,0xCF,0x29,0x4A,0xE1,0x91,0x9A,0x46,
+  0x0D,0xBA,0xC3,0x84,0x6E,0xB9,0x17,0xAE,0x02,0x84,0x2B,0x90,
+  0xDD,0xA6,0xCD,0x64,0x3F,0x9E,0x8F,0x51,0x6B,0x75,0xBD,0x15,
+  0x82,0xBD,0x15,0x71,0x98,0xBE,0x41,0x28,0x34,0x65,0xAF,0x1B,
+  0x0E,0xD2,0x77,0x11,0x07,0x3A,0x24,0x7C,0xD1,0xC3,0xAF,0x91,
+  0x64,0x81,0x76,0xFE,0x0A,0x82,0x6C,0x9A,0xF3,0x96,0xCF,0x70,
+  0xE5,0x1D,0x2A,0x74,0xFD,0x23,0x85,0xAB,0xFF,0xA2,0xD7,0xDE,
+  0x66,0xC2,0xB7,0x4B,0xC9,0xEA,0xDF,0xD1,0x65,0x85,0xBB,0xD9,
+  0x3B,0x6D,0x68,0x4F,0x9A,0xD7,0xDD,0xE3,0x2E,0x6F,0xD4,0xB6,
+  0x2A,0xDC,0xF8,0xCF,0xD5,0x6D,0x14,0xAA,0xA4,0x54,0xD5,0x41,
+  0xBE,0xCA,0x0B,0x1A,0xB1,0xAD,0xB5,0xA9,0xBC,0x0B,0x44,0x41,
+  0xD2,0x22,0x50,0xAB,0xF0,0xEA,0x1F,0x5B,0x36,0xC2,0xBF,0x42,
+  0x1D,0xBC,0x17,0x13,0x49,0xCE,0x47,0x39,0x70,0x54,0x28,0x6C,
+  0x3D,0x1F,0x6D,0xC4,0xF0,0x1A,0xC2,0x28,0x01,0x11,0x95,0x1A,
+  0x48,0x0E,0xC5,0x44,0xB7,0xAB,0xE6,0xAA,0x32,0xAF,0xAE,0xA9,
+  0xD8,0x9F,0x00,0x29,0x16,0x96,0x26,0x49,0xB5,0xE9,0x22,0xC3,
+  0xAA,0x72,0xF4,0xD7,0x10,0x1A,0xBB,0xC2,0x89,0xE7,0x20,0x6E,
+  0xAA,0x12,0x63,0xEA,0x43,0x50,0x1E,0x07,0x98,0xA7,0x83,0x41,
+  0x62,0x44,0xCE,0x18,0x39,0xA3,0x05,0x2B,0xAE,0xCF,0x35,0x54,
+  0x9C,0x91,0x99,0x32,0xC8,0x68,0xE2,0x08,0x85,0x4E,0x43,0x67,
+  0xD6,0xC5,0x5A,0xC2,0x47,0x2E,0x3B,0x7A,0xF3,0xE8,0x18,0x22,
+  0xD5,0x37,0x5C,0xBE,0x8D,0xC7,0x67,0x5D,0x3A,0xDC,0xC3,0x4A,
+  0x07,0x1B,0x63,0xFC,0xEA,0xE3,0x38,0x3F,0x8A,0x66,0x77,0x1A,
+  0xD2,0x60,0x16,0x75,0x55,0xE1,0x11,0x07,0x91,0x0B,0x58,0xDC,
+  0xC3,0x62,0xAF,0xBD,0xFC,0x43,0x1B,0xB9,0x43,0xBE,0x6E,0xB8,
+  0xC3,0xFC,0x88,0xB9,0x24,0xF6,0xC1,0xA3,0x11,0x90,0xE3,0x3C,
+  0x22,0x62,0xB2,0x59,0x22,0xCB,0xE5,0xD2,0x9E,0xFA,0xB1,0x2D,
+  0xC2,0x69,0xD7,0xD3,0x48,0xA2,0xEE,0x34,0xF0,0x3A,0xC7,0xE0,
+  0x11,0x99,0x6F,0xE3,0xE1,0x24,0x10,0xC5,0xE8,0x06,0x1B,0xF6,
+  0x0C,0x19,0x45,0xD6,0xD4,0x5D,0x8E,0xC3,0x72,0x95,0xDE,0x58,
+  0x84,0xC0,0x03,0x2C,0x0C,0xCF,0xA3,0x41,0x04,0x46,0x25,0xF9,
+  0x66,0x65,0x49,0xF2,0x24,0x64,0xEC,0x96,0xCD,0xB1,0x22,0x6C,
+  0xAD,0xE8,0xB9,0x5C,0x7A,0x7E,0xF2,0x73,0xFA,0xEA,0x5A,0xBD,
+  0xE7,0x06,0x08,0x04,0x7F,0xCB,0x68,0xD0,0xD7,0x36,0x25,0x57,
+  0x85,0x6E,0x1E,0x58,0xC3,0xC3,0x42,0x72,0x97,0x15,0x0F,0xEC,
+  0x42,0xE9,0x94,0x60,0xB0,0x90,0xE4,0xB1,0xBA,0x16,0x12,0x97,
+  0x36,0xD8,0xC4,0x4A,0xEA,0xA6,0xBD,0x8E,0x78,0xC9,0x5A,0xED,
+  0x22,0xB4,0x9A,0x9A,0xFC,0xB2,0x60,0x60,0x21,0x29,0x0B,0x72,
+  0xA1,0xBC,0x7D,0xC2,0x5F,0x4D,0x99,0xE2,0xF3,0x35,0xF8,0xA4,
+  0x10,0x49,0xE1,0xD0,0x55,0xA2,0xE7,0xD2,0x6A,0x2E,0xA7,0x6F,
+  0xE4,0x45,0xBB,0xBB,0x6F,0xE7,0x43,0xC3,0xAF,0xF1,0x90,0x8A,
+  0xB0,0xDA,0x50,0xEC,0x9D,0x51,0xA3,0xE5,0xF8,0xC6,0x4E,0xAB,
+  0x30,0xD1,0x95,0x4F,0x03,0xEB,0x8F,0xB1,0x47,0xFD,0x47,0x48,
+  0xEC,0x66,0x62,0x89,0xEF,0xF1,0x24,0x9B,0xAB,0x17,0x7B,0xA8,
+  0xD2,0x66,0x33,0xC1,0x09,0x69,0x34,0xBB,0x10,0xB1,0x2F,0xD7,
+  0x66,0x38,0x7B,0x94,0xEE,0x1E,0xB4,0x8B,0x05,0xC8,0xDD,0xD4,
+  0xB4,0x95,0x0F,0x6D,0xAC,0x6E,0x85,0x8B,0xEF,0x27,0x8C,0xB9,
+  0x9B,0xAB,0xBB,0xA2,0x09,0x54,0x6D,0x89,0x4B,0x49,0x43,0x33,
+  0xBD,0x9B,0x05,0x4F,0x54,0x5D,0x42,0x8A,0xC0,0x51,0x77,0x7B,
+  0x6B,0x05,0x60,0x89,0x8D,0xB4,0x61,0xBC,0x57,0x1E,0xC3,0xAF,
+  0xAF,0x56,0xD7,0x6E,0x6B,0xDF,0x70,0xB0,0xDF,0xB6,0xF5,0xF1,
+  0x32,0xE3,0xD1,0x70,0x47,0x12,0xA3,0xAC,0x7D,0x6B,0xF8,0x0B,
+  0xC6,0x41,0xD1,0x69,0xEA,0xE5,0x8B,0xE4,0x1F,0xD4,0x39,0xBD,
+  0xE1,0xB5,0x0F,0x11,0xB7,0xE7,0x81,0xB1,0x49,0x0F,0x84,0xAC,
+  0x2D,0xC3,0xE2,0x61,0x10,0x30,0xA6,0x4F,0x4F,0x4F,0xF9,0x13,
+  0x02,0xD9,0xD7,0x4C,0x40,0x71,0xAE,0x2C,0xD9,0x2A,0x1E,0x30,
+  0x2A,0x16,0x95,0xF5,0xB5,0x11,0x38,0x9B,0x70,0xE6,0xB9,0xE0,
+  0x68,0x30,0xEF,0x67,0x53,0xE6,0xBB,0x43,0xAD,0xB3,0x3A,0x4A,
+  0x4D,0xCC,0xB7,0x79,0x54,0x7B,0xC2,0x25,0xBF,0xC4,0xF5,0x41,
+  0x26,0x6B,0x78,0x03,0x58,0x22,0x49,0xE8,0x82,0x72,0x75,0x8E,
+  0x91,0x50,0x69,0xF0,0x55,0x16,0x9B,0x66,0x47,0x54,0x7A,0xB5,
+  0x67,0x54,0x72,0x4F,0x2A,0x55,0xB9,0xC1,0xD9,0x5E,0x60,0xC8,
+  0xAF,0x4E,0x7C,0xC5,0xE5,0x72,0x6E,0x95,0x0D,0x18,0x29,0xB7,
+  0xF6,0x0D,0xA5,0xFD,0x35,0xEF,0x5D,0xAA,0xA9,0x08,0x59,0x08,
+  0xD1,0x2D,0x45,0x5D,0x32,0x85,0x15,0xB9,0x96,0x5D,0x5E,0x46,
+  0x5C,0x03,0x1F,0xB1,0xCB,0xF0,0xC5,0x4D,0xC7,0x20,0xC8,0x2A,
+  0x43,0x1A,0x46,0x94,0x94,0xA5,0x17,0x27,0xD9,0x48,0x3F,0x17,
+  0x4D,0x18,0x35,0xD2,0xDD,0xB3,0xCA,0xF7,0x6E,0x6E,0xE6,0x95,
+  0x0A,0x35,0x6B,0x82,0x7E,0x2F,0x32,0xE1,0xAA,0x0A,0x21,0xD1,
+  0x86,0x3C,0x77,0xF8,0xC8,0x22,0xD4,0x71,0x58,0x00,0x16,0xC2,
+  0x1E,0x73,0xFF,0x00,0x3F,0xEC,0xE9,0xBF,0x13,0x01,0x25,0x9C,
+  0x58,0x45,0x7B,0x5D,0x2C,0xC6,0xCA,0xAA,0xB0,0x7E,0xF8,0xD0,
+  0x27,0xD4,0x8B,0xD6,0xC7,0x5E,0xB2,0x30,0x66,0x01,0x09,0x30,
+  0xDF,0xB2,0xEE,0x54,0x46,0xC3,0x72,0xCA,0x9D,0x79,0x42,0x3C,
+  0x58,0xD7,0x36,0xBC,0x14,0xD0,0x17,0x13,0x28,0x2C,0x88,0x1A,
+  0x87,0x62,0x89,0xC5,0xA2,0x60,0xFD,0xB8,0x67,0x74,0x91,0x24,
+  0x45,0x84,0x91,0x4D,0x74,0x8D,0x16,0x59,0x72,0xCF,0x4B,0x8A,
+  0xC2,0x54,0x85,0x49,0xD2,0xC5,0xCE,0x2D,0xFD,0x35,0x72,0x23,
+  0xA6,0x4E,0x77,0xD6,0xED,0x97,0xD7,0xAC,0xAA,0x63,0x2B,0x43,
+  0x88,0xC8,0xC7,0xE1,0x7A,0xC8,0xA9,0x2F,0xE6,0x0C,0x2A,0xD8,
+  0xD6,0x48,0x80,0xED,0xC3,0xC2,0x8F,0xFD,0x0B,0x8F,0x03,0x49,
+  0xF2,0xF1,0xE3,0xF5,0x65,0x9F,0xEC,0xFF,0xC5,0x51,0xB7,0x78,
+  0xD7,0x3E,0xC5,0x7E,0x92,0xE8,0x13,0xA8,0x68,0x44,0x07,0x75,
+  0x56,0x35,0x39,0xA5,0xDA,0x3E,0xCD,0x3A,0x1B,0xFB,0xBA,0xE0,
+  0x11,0x1F,0x73,0x8F,0xCB,0x15,0x9E,0xB1,0x8E,0xD4,0x99,0xE1,
+  0x53,0xB5,0x14,0x75,0x31,0x7B,0xAB,0xBD,0x67,0x43,0x80,0xE6,
+  0xB7,0x5A,0xED,0xC1,0xF0,0x73,0x23,0xF8,0x8C,0xBB,0x2E,0xF3,
+  0x0D,0x74,0xB2,0xDE,0xD3,0xD3,0x6F,0xED,0xD3,0xAF,0x9A,0x7C,
+  0x92,0xD7,0x03,0xEA,0xD3,0x25,0xF7,0x5D,0xB1,0xB4,0x61,0x8E,
+  0xAF,0xB0,0xF4,0xF7,0x86,0x83,0xAB,0xF3,0x59,0xD8,0xB2,0x32,
+  0xBC,0x7A,0x53,0xC0,0x3A,0xD0,0xC5,0xC1,0xC8,0x04,0x9F,0xB4,
+  0xD2,0x81,0x66,0xFD,0x54,0xC5,0xF3,0x60,0x90,0x8D,0xA2,0xFD,
+  0xF9,0xFF,0x79,0xB0,0x5F,0xE1,0x2F,0x65,0x74,0x6D,0x88,0xFB,
+  0xEA,0x04,0x33,0x78,0xA9,0x50,0xEE,0x1F,0x24,0xA7,0x92,0x5B,
+  0xAC,0xFD,0x39,0x5A,0xF2,0x00,0xF7,0x59,0x43,0x09,0x77,0xA7,
+  0x5F,0x0F,0xF4,0xB2,0xDA,0x88,0x09,0x2C,0x46,0x05,0x9E,0x2B,
+  0xDF,0xAD,0xC6,0x52,0xD6,0x90,0xE2,0x09,0xD6,0xB6,0x9D,0x2C,
+  0x72,0x1A,0xAD,0x7C,0xA7,0x65,0xC4,0x4E,0x97,0x94,0xC3,0x42,
+  0xC3,0x21,0x9F,0xC7,0x72,0xD6,0x6A,0x03,0x15,0x08,0x51,0xB2,
+  0xAC,0xF7,0x34,0x39,0x59,0x1A,0xC4,0xD1,0x4C,0xCD,0x48,0x86,
+  0xD9,0x3A,0xB0,0x50,0x2E,0x5F,0x4F,0x13,0x26,0x49,0x11,0xF6,
+  0xF3,0xD6,0xBC,0x15,0x22,0x03,0xF4,0x02,0x3E,0x4C,0x63,0x2D,
+  0x74,0x76,0x10,0x75,0x57,0xC8,0x62,0x11,0xF9,0x1A,0xF4,0x18,
+  0x2B,0xF5,0x37,0x11,0xAE,0x66,0xD9,0x80,0xAA,0xE5,0xF0,0x3B,
+  0x1E,0x50,0x6B,0xD5,0x62,0x29,0xEE,0xFA,0xB4,0x41,0x82,0x7B,
+  0x05,0x01,0xDE,0x02,0x15,0xE4,0xAF,0x49,0x80,0x0D,0x9C,0x7C,
+  0x9F,0x08,0xBE,0x5D,0xF4,0x9B,0x84,0xB7,0x61,0xCE,0x0D,0xF8,
+  0xD7,0x54,0xE1,0x42,0xA6,0x76,0x4B,0x8D,0xCE,0xCD,0x8D,0x50,
+  0xB4,0xCE,0xD5,0x5A,0x99,0x40,0x04,0xAA,0x40,0x01,0xAD,0x8B,
+  0x51,0x71,0x66,0x47,0x89,0x21,0x49,0x91,0x68,0x2D,0xCF,0x04,
+  0x0D,0x53,0xC0,0x60,0x35,0x91,0x62,0xF7,0x54,0xCF,0xD7,0x16,
+  0x05,0x1A,0x02,0xAC,0x81,0xFF,0xAD,0xDE,0x40,0xE7,0x4B,0xE4,
+  0x95,0x61,0x57,0xA5,0xE8,0x0D,0x00,0xE5,0x6A,0xF5,0xF6,0x69,
+  0x52,0xE8,0x3D,0x68,0x98,0x0E,0x53,0x0A,0x6E,0xD8,0xB1,0x93,
+  0x1A,0x80,0x82,0x6D,0xD5,0x8F,0x74,0x24,0x30,0x18,0xA4,0xAC,
+  0xE8,0x96,0xF6,0xE7,0x04,0x89,0xCD,0x7D,0x90,0xE1,0xDB,0x87,
+  0xDB,0x9B,0x81,0x85,0x2E,0xCD,0x32,0x52,0xA9,0xEC,0x90,0xB0,
+  0x19,0x11,0x57,0x3B,0x6B,0xD5,0xC9,0x80,0x7D,0xCD,0xC6,0xFB,
+  0xA7,0xE1,0xA8,0x56,0x86,0xF9,0x2D,0xCD,0x76,0x85,0x4A,0x3D,
+  0xB2,0x55,0xA0,0xDE,0x28,0x15,0x1D,0x96,0x3E,0xD9,0xB2,0x9C,
+  0x71,0xA0,0xF1,0xEC,0xE5,0x97,0x2F,0xB9,0xFB,0xE1,0xC9,0x8B,
+  0xF6,0x67,0x7D,0x0F,0x90,0x78,0xBD,0xD4,0xF5,0xC0,0x46,0x73,
+  0xCE,0xC3,0x90,0xAE,0x6C,0x0C,0x12,0xAB,0x8C,0x44,0xF4,0x6A,
+  0x75,0x81,0xA9,0x16,0x56,0x9D,0xB7,0xAC,0xE4,0xC5,0x42,0xBB,
+  0x6D,0x43,0x28,0x7E,0x45,0x9D,0x59,0x2B,0x75,0x09,0xEA,0xC9,
+  0x6B,0x0C,0xCC,0xDA,0x9F,0xB3,0xEF,0xDB,0x0F,0x61,0xD3,0x18,
+  0x7E,0xF9,0x25,0xDF,0xE3,0xA7,0xC1,0xB3,0xE7,0xED,0xC6,0x71,
+  0xC1,0x2F,0x56,0x71,0xAB,0x77,0xF6,0xF5,0x3A,0x9B,0x2B,0x42,
+  0x57,0xFD,0x31,0x13,0xDA,0xA6,0xB7,0x2E,0x0B,0x4F,0x41,0x72,
+  0x53,0x9F,0x12,0xD5,0xFA,0x93,0x31,0x91,0x2A,0x5F,0x2A,0xB2,
+  0xF6,0xE7,0x75,0x70,0x55,0x2E,0xA3,0x21,0xBF,0x9E,0x2E,0xB0,
+  0x0E,0xE2,0x7E,0xC3,0x10,0xD6,0x6A,0x18,0xDA,0x1A,0xEE,0x01,
+  0x10,0x1F,0x6D,0x0F,0x76,0x71,0x9B,0x07,0xEC,0x6D,0x0F,0xA8,
+  0xEA,0x08,0xF2,0x34,0x73,0xA3,0xC9,0x0D,0xC0,0x0C,0x2A,0xA3,
+  0x90,0xEB,0x76,0x4B,0xE5,0xCC,0x0E,0x45,0x0C,0xD1,0xC4,0x1A,
+  0x44,0xD7,0xEE,0x9D,0x3C,0x6B,0x77,0x8F,0x0E,0xF3,0xD2,0xA8,
+  0x92,0x65,0x25,0x03,0x39,0x71,0x6E,0xA2,0x9C,0x75,0xCD,0x48,
+  0x7E,0xCD,0xFF,0xC7,0x2D,0xE6,0x7F,0x6C,0xE9,0xAA,0xFF,0xB3,
+  0xE8,0xFF,0x00,0x2E,0x54,0x80,0xA2,0xC3,0x48,0x00,0x00,
+};
+const unsigned int src_www_build_index_html_gz_len = 4691;
+
+const unsigned char src_www_build_logs_html_gz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x08,0xA3,0x04,0xD5,0x6A,0x02,0xFF,0x6C,0x6F,
+  0x67,0x73,0x2E,0x68,0x74,0x6D,0x6C,0x00,0xBD,0x57,0x7B,0x6F,
+  0xDB,0x36,0x10,0xFF,0xDF,0x9F,0xE2,0x2A,0x60,0x4D,0x8C,0x45,
+  0x92,0xD3,0x16,0x6B,0xEA,0x57,0x91,0x39,0x4D,0x5A,0x34,0x5D,
+  0xBA,0x34,0xD9,0x03,0x18,0x50,0x50,0xD2,0x59,0x62,0x4D,0x89,
+  0x2A,0x49,0xD9,0x35,0x90,0x0F,0xBF,0x3B,0x49,0x76,0x6C,0x27,
+  0xE9,0x5A,0x14,0x98,0x63,0x53,0xE2,0x91,0xBC,0xFB,0x1D,0xEF,
+  0x99,0xE1,0xA3,0x93,0x8B,0xC9,0xD5,0xDF,0xEF,0x5F,0x41,0xE6,
+  0x72,0x35,0xEE,0x0C,0xF9,0x01,0x4A,0x14,0xE9,0xC8,0xC3,0xC2,
+  0x63,0x02,0x8A,0x84,0x1E,0x8F,0x7C,0x1F,0x60,0xA2,0xCB,0xA5,
+  0x91,0x69,0xE6,0x60,0x3F,0xEE,0xC2,0x93,0xDE,0x93,0x67,0x70,
+  0x22,0xE6,0x32,0x81,0xB7,0x68,0xCC,0x01,0xB1,0x70,0xA5,0xED,
+  0x87,0x61,0x2A,0x5D,0x56,0x45,0x41,0xAC,0xF3,0x30,0x99,0xD1,
+  0xCA,0x2F,0xCF,0xC0,0xF7,0x89,0x47,0x8E,0x4E,0x40,0x9C,0x09,
+  0x63,0xD1,0x8D,0xBC,0xEB,0xAB,0x53,0xFF,0xC8,0x5B,0x91,0x0B,
+  0x91,0xE3,0xC8,0x9B,0x4B,0x5C,0x94,0xDA,0x38,0x0F,0x62,0x5D,
+  0x38,0x2C,0x68,0xDB,0x42,0x26,0x2E,0x1B,0x25,0x38,0x97,0x31,
+  0xFA,0xF5,0xE4,0x00,0x64,0x21,0x9D,0x14,0xCA,0xB7,0xB1,0x50,
+  0x38,0x3A,0x0C,0x7A,0x07,0x90,0x8B,0x2F,0x32,0xAF,0xF2,0x4D,
+  0x52,0x65,0xD1,0xD4,0x73,0x11,0x31,0x69,0x47,0x94,0x28,0x4B,
+  0x85,0x7E,0xAE,0x23,0x49,0x8F,0x05,0x46,0x3E,0x11,0x7C,0x27,
+  0x9D,0xC2,0x0D,0xE1,0x97,0xC7,0x57,0x27,0x67,0x17,0xDF,0x72,
+  0x32,0x16,0x25,0x8B,0xD9,0x38,0xBB,0x44,0xFB,0x2D,0x07,0xAD,
+  0x13,0xAE,0xB2,0x7E,0x24,0x08,0xAB,0x5B,0x6E,0x71,0x88,0x94,
+  0x88,0x67,0x6B,0x1E,0x7C,0xBB,0x3E,0x7E,0xAE,0xE4,0x7C,0xE4,
+  0xFD,0xE5,0x5F,0x1F,0xFB,0x13,0x9D,0x97,0xC2,0xC9,0x6D,0xA9,
+  0x12,0x47,0x98,0xA4,0xC8,0xA7,0x6A,0x65,0xC6,0xAF,0x75,0x8E,
+  0x6F,0xA5,0x83,0x33,0x61,0x44,0x8A,0x70,0xA2,0xB5,0x81,0x73,
+  0x9D,0xDA,0x61,0xD8,0xAC,0x77,0x86,0x4A,0x16,0x33,0x30,0xA8,
+  0x46,0x5E,0x0D,0xC0,0x66,0x88,0x64,0x80,0xCC,0xE0,0xB4,0xA5,
+  0x04,0xB1,0xB5,0x2F,0xE7,0xA3,0x67,0xA7,0xC7,0xEF,0x64,0xEA,
+  0x6D,0x9D,0x90,0x24,0x78,0xB5,0x77,0x4A,0xAE,0x40,0xD3,0xA0,
+  0x2C,0x52,0xDA,0xFD,0xC7,0xE9,0xF3,0x17,0xE6,0xD8,0x03,0xB7,
+  0x2C,0x49,0x75,0x99,0x93,0xF0,0x90,0x56,0xB6,0x8F,0x37,0x37,
+  0xE2,0x74,0x15,0x67,0xFE,0x26,0xAB,0x5D,0x7A,0xCB,0xF3,0x62,
+  0xFE,0xE1,0xF9,0xD1,0xE2,0x5E,0x9E,0x36,0x36,0xB2,0x74,0x60,
+  0x4D,0x3C,0xF2,0x14,0xA9,0x17,0x7C,0x62,0xC8,0x4A,0x57,0x87,
+  0x97,0xBF,0x7B,0xE3,0x61,0xD8,0xAC,0xD3,0xC6,0xB0,0x75,0xE8,
+  0x48,0x27,0x4B,0x7A,0x24,0x72,0x0E,0xB1,0x12,0xD6,0x12,0xFE,
+  0x4A,0xA9,0x92,0x58,0x7A,0x50,0x6B,0x3D,0xF2,0xC8,0xA7,0x1A,
+  0x8F,0xEB,0xC3,0x61,0xAF,0xF7,0xD3,0x00,0x32,0x64,0xE7,0xEF,
+  0xC3,0x8B,0xA3,0x79,0x36,0x80,0x44,0xDA,0x52,0x89,0x65,0x7F,
+  0xAA,0xF0,0xCB,0x00,0x78,0xF4,0xA7,0x4A,0x2F,0xFA,0x64,0x0C,
+  0x55,0xE5,0xC5,0xC0,0x6B,0xD9,0xCB,0x84,0x21,0x89,0x04,0x8D,
+  0xB7,0x12,0xA5,0x12,0x13,0x93,0xB9,0x88,0x42,0xD0,0x68,0xCF,
+  0x36,0x10,0x46,0x88,0x06,0x48,0x8D,0xE6,0xCD,0xDB,0x5E,0x26,
+  0xBA,0x66,0x52,0x69,0x70,0x87,0x04,0x1F,0xF9,0xF3,0xC0,0x08,
+  0xCD,0x7B,0xE7,0x06,0xF8,0xFD,0x86,0xA6,0x34,0xD2,0x0F,0x3E,
+  0xDE,0xF0,0x50,0x8F,0xF0,0x4F,0x3D,0xC2,0x4D,0xA7,0x7E,0xFA,
+  0xED,0xAC,0xFD,0xBB,0xF3,0xED,0xDC,0xD0,0xB1,0xF5,0x97,0xB8,
+  0xF1,0x8F,0x3F,0xF5,0x18,0xB6,0xEF,0x1D,0x58,0x7F,0x86,0x21,
+  0x81,0x66,0xE8,0xDB,0xC0,0x61,0x4A,0x4E,0xB9,0x72,0x54,0x5D,
+  0xC0,0xD9,0xE5,0xD9,0xC9,0xC5,0x21,0xBC,0x16,0x26,0x59,0x08,
+  0x83,0x74,0x8A,0x0D,0x77,0xE7,0x9E,0x38,0xAA,0xEA,0x8B,0xA8,
+  0xAF,0xB8,0x49,0x11,0xBF,0x31,0xED,0xD6,0x80,0x26,0x95,0x45,
+  0xBF,0x57,0x7E,0x21,0x63,0x6C,0x04,0xC0,0x16,0xC3,0xBB,0x7C,
+  0x9D,0x88,0x98,0x6D,0x54,0x39,0x47,0x60,0x6E,0x89,0xEC,0xB7,
+  0xD6,0x6B,0x85,0x4D,0x45,0xA5,0xDC,0x45,0x49,0x49,0x92,0x10,
+  0xC7,0x4A,0xC6,0xB3,0x91,0xA7,0x69,0x7A,0x25,0xA2,0x7D,0x9C,
+  0x93,0x71,0x0F,0x60,0x8F,0xB4,0xA3,0xE9,0x5E,0xD7,0x1B,0x7F,
+  0x58,0x5A,0x87,0x39,0x07,0xDE,0x30,0x6C,0xF8,0x7E,0x45,0xC0,
+  0x83,0xFC,0x9A,0x5C,0xB1,0x62,0x59,0x4F,0x7E,0x84,0x9D,0xC1,
+  0x48,0x6B,0xD7,0xB2,0xBB,0xAC,0x27,0x3F,0x8A,0x30,0x36,0xC2,
+  0x66,0x2D,0xC7,0x09,0xBF,0xEF,0x30,0x94,0x45,0x59,0xB9,0xFA,
+  0x06,0x63,0x85,0xC2,0xFC,0xEA,0x8A,0x55,0x34,0x37,0x5B,0x3C,
+  0x98,0x0B,0x55,0xD1,0x74,0xC2,0xCB,0x50,0xB3,0xE3,0x40,0xF0,
+  0xD6,0x4E,0xD4,0x9A,0x76,0x15,0x7C,0x50,0xE8,0x02,0x07,0xD0,
+  0x58,0xDA,0x57,0x38,0xA5,0xF0,0x7C,0x82,0xF9,0x9A,0xE2,0x74,
+  0xD9,0x87,0x5E,0x70,0x44,0xA4,0x5B,0x1E,0x6B,0xF8,0x06,0x5D,
+  0x65,0x0A,0xCE,0x9E,0x53,0x69,0xF2,0xFD,0xBD,0x1D,0xA9,0x07,
+  0x40,0xDE,0x07,0x4B,0x5D,0x81,0xAD,0x0C,0xBE,0xDC,0xEB,0xC2,
+  0xE3,0xC7,0x50,0x03,0xAF,0x75,0x23,0xD5,0xF6,0xBB,0x75,0x98,
+  0x6F,0xF8,0x10,0xEB,0xB6,0xB6,0x93,0xB7,0x71,0x75,0x6D,0x8A,
+  0x6E,0x1C,0x76,0xDB,0x41,0xA1,0xF1,0x50,0xAA,0x36,0xE4,0xF7,
+  0xD0,0x38,0x32,0x34,0x4C,0x82,0x20,0x68,0xBC,0x95,0xA3,0xFD,
+  0x96,0xF7,0x27,0xAB,0xB9,0x3A,0x9F,0x53,0x5A,0x91,0x45,0x4A,
+  0x9B,0x3A,0xBB,0x21,0xB6,0x03,0xA9,0x71,0xC5,0xEF,0xC1,0x03,
+  0x9C,0xC7,0xB4,0xE9,0x43,0x22,0xCC,0x2C,0xD5,0x2A,0xC1,0xC2,
+  0xE8,0x84,0xCC,0x5A,0x19,0x43,0xE7,0x80,0xAA,0xEB,0x9C,0xB2,
+  0x54,0x8E,0xD6,0x72,0x5C,0x91,0x80,0xBB,0x58,0x33,0xBD,0x60,
+  0xE3,0x8D,0x1F,0x00,0xB5,0x76,0xC0,0xEF,0xC2,0x75,0x3F,0xAC,
+  0x77,0x0D,0x0E,0xCB,0x40,0x52,0x4C,0x40,0xE6,0x39,0x26,0x52,
+  0x38,0x54,0x4B,0x88,0x90,0x12,0x0C,0x41,0x14,0xD6,0xD5,0x5D,
+  0x01,0x15,0x9F,0xCF,0x15,0x52,0x44,0x26,0xD0,0x40,0x00,0xCD,
+  0x34,0x6A,0x4B,0xEE,0xA8,0xD0,0xAC,0x7F,0x4D,0x89,0x95,0xCB,
+  0xFF,0x8F,0x3A,0xD8,0x26,0x9B,0xD4,0x92,0xD7,0x88,0x6D,0x29,
+  0x8A,0x5B,0x40,0xC4,0x81,0xBA,0x19,0x32,0x8E,0x13,0x79,0x69,
+  0xEB,0x0A,0x48,0xEB,0x1B,0x8A,0xAD,0x76,0xDD,0xAB,0xD7,0xAA,
+  0x22,0x92,0xEA,0x5C,0xB5,0x5A,0x0D,0xB8,0xC4,0x11,0x7E,0x38,
+  0x84,0xDE,0xE0,0x3E,0xD5,0x1A,0x2F,0x3E,0xA5,0xBB,0x4C,0x74,
+  0x5C,0xE5,0x74,0x01,0xD4,0x9E,0x50,0xFA,0x10,0x45,0x42,0x01,
+  0x54,0x72,0x63,0x47,0x5E,0x83,0xE0,0x32,0x84,0xA1,0xD8,0x28,
+  0x0B,0x4D,0xD1,0xBF,0xA7,0x7D,0x34,0xC2,0xA5,0x89,0x0E,0x33,
+  0x2A,0x0D,0x33,0xE9,0xFC,0x66,0x4A,0xA9,0x5C,0xBA,0xD7,0x55,
+  0x34,0x0C,0xC5,0xB8,0xC3,0x05,0x3B,0x18,0x46,0x66,0x7C,0xA7,
+  0x37,0x7D,0xEA,0x53,0x7B,0xFA,0x03,0x62,0xC2,0xD4,0x88,0x32,
+  0xB3,0x21,0xDB,0xD2,0x48,0x4A,0x4F,0xDA,0xD0,0x3D,0x6E,0xEF,
+  0xE9,0x6C,0x2E,0x06,0x0C,0x88,0xA1,0x9C,0x53,0xF8,0x16,0x96,
+  0xEC,0x57,0x15,0x5C,0xC7,0xE9,0x0A,0x73,0x0B,0x7A,0xFA,0x5F,
+  0x7A,0x2F,0x16,0x8B,0x20,0x2D,0xAA,0x40,0x9B,0x34,0x54,0x0D,
+  0x0B,0x1B,0xA6,0xA5,0xF2,0x9F,0x06,0xBD,0x00,0x8B,0x80,0x5B,
+  0x73,0xD2,0xFD,0xFD,0x39,0x13,0x3A,0xAD,0x90,0x5A,0x68,0xE7,
+  0xA1,0x82,0xC6,0x86,0xA6,0x4E,0x4A,0x58,0xFC,0x53,0x48,0xB7,
+  0xF6,0xD0,0x5C,0x27,0x42,0xED,0x74,0x15,0x35,0xCD,0xBF,0x75,
+  0xDC,0x49,0x86,0xF1,0x8C,0x72,0x0B,0x35,0x36,0x9C,0x0D,0x27,
+  0x97,0x93,0x00,0x1A,0x56,0xB0,0x20,0x5E,0x9C,0x72,0x76,0x04,
+  0xB6,0x2D,0x16,0xB1,0xB0,0x9A,0x9A,0x46,0xF2,0x2D,0x4E,0xA8,
+  0x92,0x73,0xC5,0xF5,0xF5,0x9B,0x93,0x3E,0xEC,0xFD,0x1C,0xD7,
+  0x53,0x9E,0x75,0x07,0xBC,0xCF,0x41,0xD3,0x18,0xBD,0x52,0x98,
+  0x8F,0x56,0x4E,0x13,0xA4,0xE8,0x98,0x40,0xAF,0xBF,0x2E,0xDF,
+  0x24,0xFB,0xAB,0xE6,0xA9,0x3B,0x78,0x70,0xC7,0x66,0x39,0xEE,
+  0x06,0x75,0x72,0xA7,0xCC,0xCC,0xE7,0xB8,0xD5,0xA5,0xD7,0xCD,
+  0x06,0xB0,0xED,0xFC,0xC2,0xFA,0x3F,0x9E,0x7F,0x01,0x4B,0xA7,
+  0x7C,0x96,0x01,0x0D,0x00,0x00,
+};
+const unsigned int src_www_build_logs_html_gz_len = 1362;
+
+const unsigned char src_www_build_settings_sliders_svg_gz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x08,0xA3,0x04,0xD5,0x6A,0x02,0xFF,0x73,0x65,
+  0x74,0x74,0x69,0x6E,0x67,0x73,0x2D,0x73,0x6C,0x69,0x64,0x65,
+  0x72,0x73,0x2E,0x73,0x76,0x67,0x00,0x95,0x52,0xB1,0x6E,0x83,
+  0x30,0x14,0xDC,0xFB,0x15,0xD6,0xEB,0x6A,0xCC,0x7B,0x36,0x18,
+  0x52,0x85,0x44,0xED,0x50,0xB1,0x44,0x5D,0xDA,0x25,0x1B,0x29,
+  0x14,0x2C,0x11,0x88,0x12,0x1A,0xF2,0xF9,0x75,0x20,0xA4,0xB4,
+  0x54,0xAA,0x22,0xA3,0x13,0xB6,0xEF,0xE4,0x3B,0x9F,0xE7,0xCB,
+  0xD3,0xB6,0x64,0xC7,0x6C,0x7F,0x30,0x75,0x15,0x01,0x09,0x04,
+  0x96,0x55,0xEF,0x75,0x6A,0xAA,0x3C,0x82,0xB7,0xD7,0x67,0x27,
+  0x84,0xE5,0xE2,0x6E,0x7E,0x38,0xE6,0xCC,0x32,0xAB,0x43,0x04,
+  0x45,0xD3,0xEC,0x1E,0x5C,0xB7,0x6D,0x5B,0xD1,0x2A,0x51,0xEF,
+  0x73,0x57,0x22,0xA2,0x6B,0x19,0xC0,0x4C,0x1A,0xC1,0xCB,0x67,
+  0x53,0x9A,0x2A,0x03,0x76,0x34,0x59,0xFB,0x54,0x9F,0x22,0x40,
+  0x86,0x4C,0x7A,0xF6,0x03,0xD6,0x9A,0xB4,0x29,0x22,0xF0,0x49,
+  0x02,0x2B,0x32,0x93,0x17,0x4D,0x3F,0x59,0xCC,0x77,0x49,0x53,
+  0x30,0x2B,0x5F,0x11,0xF7,0x44,0xE0,0xC7,0x4A,0x04,0x4A,0x27,
+  0x16,0x65,0xC8,0x7B,0xC4,0x6E,0x04,0x82,0x66,0x3E,0xC7,0x58,
+  0xAA,0x84,0x38,0x5D,0x16,0xD1,0x91,0x31,0xA1,0x98,0x29,0x9A,
+  0x2A,0x9C,0x41,0x41,0x63,0x01,0x97,0xEB,0x55,0x20,0x94,0x52,
+  0x5C,0x26,0x64,0xCF,0xE3,0x1D,0xA0,0x25,0x90,0x73,0x9D,0x3F,
+  0x9E,0x41,0xF2,0x1E,0xB1,0xDB,0xBD,0x68,0xD6,0xC0,0x3E,0x4C,
+  0x59,0x46,0x70,0xBF,0x09,0x43,0x8D,0x1B,0x70,0x47,0x09,0xA4,
+  0xE2,0x44,0xB1,0x44,0x21,0xB5,0xD7,0xF9,0x09,0x78,0x8F,0xDF,
+  0x7E,0xBC,0xA9,0x9F,0x98,0x94,0xC0,0x60,0xCA,0xE7,0x03,0xFF,
+  0x77,0xE2,0xF5,0xD6,0xD1,0xBD,0x9B,0xC1,0xEA,0x28,0x04,0xA7,
+  0x50,0x78,0x14,0x70,0x1A,0xEC,0x8F,0x43,0x90,0x16,0x5A,0xDB,
+  0x3D,0x7B,0x8A,0xFF,0x6F,0x92,0x99,0x90,0xFE,0xCD,0x97,0x7B,
+  0x73,0x7D,0xD7,0x36,0x26,0x75,0x74,0xBF,0xCE,0xB5,0x0E,0xC5,
+  0x7B,0xFC,0x51,0xC7,0x9F,0x7D,0x9C,0x9F,0xE4,0xE2,0x0B,0x7F,
+  0x50,0x21,0x2D,0xE1,0x02,0x00,0x00,
+};
+const unsigned int src_www_build_settings_sliders_svg_gz_len = 355;
+
+const unsigned char src_www_build_wifiap_html_gz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x08,0xA3,0x04,0xD5,0x6A,0x02,0xFF,0x77,0x69,
+  0x66,0x69,0x61,0x70,0x2E,0x68,0x74,0x6D,0x6C,0x00,0xA5,0x56,
+  0xDB,0x6E,0xE3,0x36,0x10,0x7D,0xF7,0x57,0x4C,0xFD,0x50,0x4A,
+  0x88,0x23,0x6F,0x16,0x8B,0xA2,0xB5,0x25,0x2D,0x92,0x6C,0xDA,
+  0x06,0x68,0x9D,0x45,0x1C,0x60,0x51,0x60,0x5F,0x68,0x91,0xB2,
+  0x88,0x50,0xA4,0x4A,0x52,0xF1,0x0A,0x86,0xFF,0xBD,0x43,0x4A,
+  0x76,0x9C,0xDB,0xA2,0x68,0x5F,0x4C,0xDD,0x66,0xCE,0x99,0x33,
+  0x33,0x07,0x4E,0x7F,0xF8,0x74,0x73,0x79,0xF7,0xD7,0xE7,0x2B,
+  0xA8,0x5C,0x2D,0xF3,0x51,0xBA,0x3F,0x38,0x65,0x78,0x58,0xD7,
+  0x49,0x9E,0x27,0x94,0x3D,0x6C,0x99,0xB0,0x8D,0xA4,0xDD,0x4C,
+  0x69,0xC5,0x77,0x8E,0x4D,0x5C,0xB5,0x75,0xFC,0x9B,0x3B,0xA5,
+  0x52,0xAC,0xD5,0x4C,0xF2,0xD2,0xED,0x5C,0x35,0x53,0xAE,0x3A,
+  0x2D,0x2A,0x21,0x59,0x74,0xA6,0x4E,0x3E,0xC4,0x13,0xC7,0x9E,
+  0x3F,0x7A,0x92,0x68,0x7E,0x94,0xC2,0x88,0x75,0xE5,0x76,0xE9,
+  0xB4,0xC7,0x44,0xEC,0xC2,0x88,0xC6,0xE5,0x85,0x56,0xD6,0xC1,
+  0x86,0x1A,0x75,0xF7,0xCD,0x65,0x64,0xC9,0x25,0x2F,0x9C,0x50,
+  0x6B,0x58,0x2E,0xAF,0x3F,0x81,0x50,0x80,0xE4,0xA8,0x2A,0x38,
+  0x83,0x5A,0x33,0x0E,0x52,0x17,0xF7,0x16,0x5C,0xC5,0x81,0xF1,
+  0x07,0x51,0x70,0x70,0x1A,0x28,0xD8,0x86,0x17,0xA2,0x14,0x05,
+  0x7C,0x11,0xBF,0x0A,0x20,0x27,0x23,0x42,0x8B,0x82,0x5B,0x0B,
+  0x8D,0x16,0xCA,0xC1,0xAA,0x03,0xE1,0x2C,0xB4,0x4A,0xFC,0xDD,
+  0x72,0xA8,0xA8,0x61,0x88,0xC7,0xE1,0xC2,0x43,0x24,0x70,0x5D,
+  0x62,0x3E,0xEA,0xE0,0x49,0xC8,0x5A,0x73,0x0B,0xBA,0x2C,0xA5,
+  0x50,0x7C,0x02,0xDA,0x40,0xA7,0x5B,0x30,0x1C,0x2B,0x43,0x4C,
+  0x0F,0x20,0xDC,0xC4,0xD3,0x50,0xC7,0x5C,0x36,0x42,0x4A,0x58,
+  0xDC,0xDC,0x01,0x16,0xA5,0xB0,0x0C,0x4F,0xCE,0x33,0x4A,0xC8,
+  0xBC,0x2F,0xD3,0x72,0x37,0x54,0xE9,0xFA,0xFA,0xA8,0x62,0xD0,
+  0x50,0x6B,0x37,0xDA,0xB0,0x09,0x78,0x52,0x1E,0xC7,0xB6,0x86,
+  0x7F,0x24,0xF3,0xB2,0x55,0x28,0x85,0x56,0x60,0x2B,0xBD,0x39,
+  0x1F,0x64,0x88,0x8A,0x8A,0x17,0xF7,0x9C,0xC5,0xDB,0x73,0x63,
+  0x68,0x97,0x94,0x46,0xD7,0x11,0xD3,0x45,0x5B,0x73,0xE5,0x92,
+  0x35,0x77,0x57,0x92,0xFB,0x4B,0x7B,0xD1,0x5D,0x4A,0xCC,0xBC,
+  0xA0,0x35,0x8F,0x08,0x8A,0x48,0xE2,0x38,0x29,0xB5,0xB9,0xA2,
+  0x45,0x15,0x45,0xA8,0x72,0x1D,0x67,0xF9,0xD6,0x9F,0x49,0xE8,
+  0x48,0x32,0xF4,0x2D,0x1B,0xF2,0x7F,0x24,0x8E,0xAE,0x24,0x3F,
+  0x35,0x7A,0x43,0x66,0xC4,0x37,0x93,0xCC,0x77,0xF1,0xFC,0x35,
+  0x50,0x14,0xD5,0x74,0x7D,0xE3,0xB4,0x39,0x97,0x32,0x22,0xAF,
+  0x4C,0x0A,0xBC,0x1C,0x95,0xFF,0xC8,0xA8,0xE0,0x52,0x1E,0x53,
+  0x7A,0xA5,0xF8,0x8B,0xEE,0x9A,0x45,0xC4,0x0F,0x15,0x89,0x13,
+  0x81,0xBD,0x30,0xBF,0xDF,0xFD,0xF9,0xC7,0x63,0xA2,0xB4,0xC9,
+  0xD3,0x55,0xFE,0xE5,0xFC,0x76,0x71,0xBD,0xF8,0x6D,0x06,0xE9,
+  0x74,0x95,0x93,0x93,0x61,0x06,0x4F,0x48,0x3A,0x6D,0x72,0x04,
+  0xC0,0xE4,0xA3,0x43,0x0B,0xB0,0x7F,0xA5,0x30,0xF5,0xA1,0x0B,
+  0xF1,0x56,0x94,0xD1,0x9B,0xC8,0x41,0xEE,0xE4,0xD0,0x29,0xC3,
+  0x5D,0x6B,0x0E,0x39,0x22,0x72,0x00,0x3E,0x02,0xFD,0xAA,0xBE,
+  0x2A,0x72,0xD2,0x0F,0x48,0x3C,0xDF,0x71,0x69,0xF9,0xF3,0xB8,
+  0xC3,0xCB,0x97,0xBC,0x2E,0x3D,0x2B,0xD9,0xB3,0xC2,0x15,0xA1,
+  0xFE,0x5D,0x52,0x69,0xEB,0x14,0xB6,0x3F,0xCB,0xC6,0x67,0xBF,
+  0xBC,0x4F,0xCE,0x7E,0xFA,0x39,0xF9,0x90,0x9C,0x8D,0x5F,0xF0,
+  0x19,0xDF,0xF2,0x95,0xD6,0xB8,0x84,0xC2,0x55,0xBA,0x75,0x50,
+  0x54,0x54,0xAD,0xB9,0x7D,0x36,0x8F,0x63,0x04,0x1E,0x05,0x5A,
+  0x8F,0x00,0x86,0x97,0xD9,0x78,0x3A,0x9E,0x0F,0x09,0x4B,0x8A,
+  0xAF,0x9F,0xD0,0x93,0x9A,0xB2,0x05,0x77,0x16,0x99,0x95,0xDC,
+  0x61,0x9F,0xC9,0x06,0xF7,0x54,0xE1,0x13,0x12,0x8F,0x12,0xBF,
+  0x3F,0x91,0xE1,0xB6,0xC1,0xE5,0xE0,0x59,0xBE,0xBF,0x4A,0xBC,
+  0x6B,0x44,0xF1,0xFE,0x03,0x6F,0x59,0x38,0x18,0x6F,0xB7,0xF9,
+  0x90,0xF1,0xA8,0xD5,0x3E,0x68,0xFE,0xBD,0x16,0xD9,0x82,0x2A,
+  0x85,0x3E,0x83,0x43,0xE8,0x75,0x15,0x35,0xC7,0xD2,0xA3,0x3D,
+  0xDF,0xC9,0xD9,0xBB,0x77,0xEF,0xB0,0x60,0xE4,0x80,0xB5,0x22,
+  0x6F,0x6E,0x8C,0x36,0x59,0x70,0x2B,0x8D,0xA3,0x19,0x6E,0x23,
+  0x72,0xE5,0x0F,0x08,0x95,0x79,0xCB,0xF2,0xC8,0x33,0x32,0x09,
+  0x2F,0x63,0x2F,0xD7,0x50,0x33,0x16,0x86,0x68,0x64,0xB2,0xAD,
+  0x39,0x2A,0xCC,0x66,0xE3,0xCF,0x37,0xCB,0xBB,0xF1,0x2E,0x7E,
+  0x2E,0xC0,0xA3,0x5A,0xFF,0x0B,0x17,0x3D,0xB6,0xF7,0xD6,0x51,
+  0x3A,0x1D,0x8C,0x7E,0xA5,0x59,0x07,0x61,0xAB,0x32,0x52,0x6A,
+  0xE5,0x4E,0x4B,0x5A,0x0B,0xD9,0xCD,0xD0,0x54,0x95,0xB6,0x0D,
+  0x9A,0x1A,0xC1,0xAF,0x9A,0xBC,0xDF,0x62,0xF0,0xFB,0x0D,0xF4,
+  0x81,0x0A,0xE9,0x37,0x0E,0x50,0x5D,0x34,0xA8,0x7B,0x1B,0x8C,
+  0xB0,0xA6,0xAA,0xA5,0x52,0x76,0x80,0x52,0x72,0x13,0x6C,0x6C,
+  0xE6,0x37,0x66,0x94,0xE2,0x2E,0x63,0x54,0x68,0x7C,0x46,0xA6,
+  0xA8,0xAA,0xB5,0x82,0x11,0xE8,0x8B,0xCE,0x48,0x83,0xE3,0xE8,
+  0x51,0xC2,0x16,0x83,0x60,0xD9,0x78,0xDF,0xB9,0xB1,0x7F,0x6A,
+  0xFC,0x0F,0xC3,0xA1,0x94,0xC8,0x07,0x13,0xBC,0x27,0xF9,0x72,
+  0xE8,0x51,0x92,0x24,0xE9,0xD4,0xF9,0x3A,0xA6,0xE1,0xB3,0x69,
+  0x48,0xE1,0xCB,0x32,0x79,0x8A,0x14,0xB9,0x04,0xC4,0x46,0x84,
+  0x0D,0xC9,0x17,0x3D,0xD7,0x83,0xAB,0xCE,0x7E,0x54,0x2B,0xDB,
+  0xA0,0x26,0xE1,0x3B,0x8C,0x11,0xAA,0xC1,0x19,0x17,0x2C,0x7C,
+  0x0E,0x61,0x3F,0xC2,0x95,0xEB,0x1A,0x7F,0x35,0x84,0x11,0x08,
+  0x56,0x5F,0x69,0xC9,0xB8,0x39,0x7A,0xEC,0x55,0x0A,0xC1,0xC1,
+  0x5C,0xF2,0xBE,0xF0,0x3E,0x65,0x9F,0xC0,0xB6,0xAB,0x5A,0x38,
+  0x02,0x0F,0x54,0xB6,0x78,0xBB,0x1C,0x6E,0xBD,0x36,0x2F,0xA5,
+  0xD1,0xAA,0x90,0xA2,0xB8,0xCF,0xC8,0xD3,0x8D,0x7C,0x74,0x99,
+  0x39,0xC9,0x7B,0xFE,0xDF,0x05,0xB9,0xED,0xE7,0xEB,0x29,0x88,
+  0x17,0x97,0x36,0xFF,0x2A,0xBE,0x77,0x8F,0x67,0xF1,0x26,0x98,
+  0xC2,0x9B,0x1C,0xF7,0x8E,0x33,0xF7,0x92,0x4C,0x7D,0xA4,0x3F,
+  0xFD,0x9C,0x85,0xB1,0xF3,0x7F,0x33,0xFE,0x01,0xBB,0x0E,0x12,
+  0x0A,0x7D,0x08,0x00,0x00,
+};
+const unsigned int src_www_build_wifiap_html_gz_len = 1037;
+
+const unsigned char src_www_build_wifinets_gz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x08,0xA3,0x04,0xD5,0x6A,0x02,0xFF,0x77,0x69,
+  0x66,0x69,0x6E,0x65,0x74,0x73,0x00,0x7D,0x8F,0x4D,0x8E,0xC2,
+  0x30,0x0C,0x85,0xF7,0x9C,0xC2,0x3B,0x33,0x1B,0x18,0xB1,0x4E,
+  0x2B,0xF1,0xB3,0x98,0x8A,0xDD,0x30,0x17,0xF0,0xC4,0x96,0x12,
+  0x11,0x92,0x2A,0x4D,0x0B,0x73,0xFB,0x09,0x2D,0xA5,0xAA,0x90,
+  0xC8,0x22,0xB2,0x5F,0xE2,0xCF,0xEF,0xA9,0x14,0xCB,0x05,0xE4,
+  0xA3,0x12,0x97,0xCA,0xFA,0xBA,0x4D,0x60,0xB9,0x40,0xE2,0x0E,
+  0xC1,0xD3,0x45,0xFA,0x92,0xBC,0x16,0x46,0x48,0x7F,0x75,0xEE,
+  0xB5,0x11,0x7D,0xFE,0x0D,0x37,0x84,0xE0,0xB5,0xB3,0xFA,0x5C,
+  0x60,0x63,0xB6,0xDC,0x2D,0x93,0xB1,0xCD,0xAA,0x7F,0x15,0xFE,
+  0xC0,0x52,0xAD,0x33,0x72,0x64,0x83,0x0E,0xAE,0xA9,0xC9,0x17,
+  0xB8,0xC1,0x72,0xFB,0x20,0x0E,0x3F,0xF2,0x9D,0x3D,0xA8,0xC9,
+  0x88,0xB9,0x8F,0x9A,0xA9,0x3B,0x9D,0xAA,0xC3,0x5C,0xF9,0xCE,
+  0xD2,0x5C,0xD9,0x1B,0xF2,0x73,0xE5,0x8B,0x22,0x5F,0x29,0x0A,
+  0xEC,0xA6,0xF9,0x97,0x55,0xCF,0xCC,0x43,0xB4,0x48,0x6C,0xC3,
+  0x98,0xDB,0x4B,0x42,0xE8,0xC8,0xB5,0xB9,0xFE,0x7C,0x17,0x67,
+  0x86,0x48,0x72,0x4B,0x23,0xA1,0x6D,0x24,0xDE,0x97,0x23,0xD4,
+  0x8E,0xB4,0x98,0xE0,0x58,0x62,0x81,0x83,0xF4,0x20,0x1F,0xAB,
+  0xF0,0x33,0xC2,0x7B,0x7B,0xFF,0xC3,0xAA,0x6A,0x8F,0x92,0x01,
+  0x00,0x00,
+};
+const unsigned int src_www_build_wifinets_gz_len = 230;
+
+const unsigned char src_www_build_qrcode_svg_gz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x08,0xA3,0x04,0xD5,0x6A,0x02,0xFF,0x71,0x72,
+  0x63,0x6F,0x64,0x65,0x2E,0x73,0x76,0x67,0x00,0xA5,0x58,0x5D,
+  0x6F,0x22,0xCB,0x11,0x7D,0xCF,0xAF,0x68,0x91,0xE7,0x19,0x77,
+  0x55,0xF5,0x67,0xE4,0x5D,0x29,0x41,0x91,0x90,0x02,0x0F,0xC9,
+  0x4A,0x3C,0xF0,0xC6,0xC5,0xAC,0x07,0x5D,0x58,0x6F,0x0C,0x19,
+  0xDF,0x9B,0x5F,0x9F,0x53,0x3D,0x03,0x0C,0xC6,0xC6,0xBE,0x8A,
+  0x05,0x45,0x4F,0x77,0x57,0x75,0xD5,0xA9,0xD3,0xD5,0x3D,0xBE,
+  0xDF,0xB7,0x8F,0xA6,0xDD,0xAC,0x5F,0xFE,0xF6,0xF4,0xDB,0x97,
+  0x91,0x35,0xD6,0x38,0x6B,0x8D,0x77,0x76,0x64,0x7E,0xDB,0x6D,
+  0x7F,0xEC,0xBF,0x8C,0x9A,0xC3,0xE1,0xE7,0x5F,0xEE,0xEE,0x5E,
+  0x5E,0x5E,0xEA,0x17,0xA9,0x9F,0x9E,0x1F,0xEF,0xD8,0x5A,0x7B,
+  0x07,0xBD,0xD1,0xD7,0x3F,0x19,0x73,0x7F,0xD8,0x1C,0xB6,0xEB,
+  0xAF,0x93,0xA7,0xDD,0xFA,0x1F,0x9B,0x83,0xF9,0xE7,0xBF,0xCC,
+  0xF8,0xE9,0x61,0x7D,0x7F,0xD7,0x75,0xEB,0x84,0x87,0xF5,0xF7,
+  0xBD,0x36,0xCC,0xFD,0xFE,0xF7,0xDD,0x2F,0x4F,0x5B,0xB3,0x79,
+  0x80,0x55,0xCC,0xFF,0x75,0x73,0x18,0x5D,0xAE,0x4D,0x82,0x2F,
+  0xDB,0xD1,0xD7,0xFB,0x9F,0xCB,0x43,0x63,0x30,0x6F,0x47,0x9C,
+  0x6A,0x4E,0xC6,0xE5,0x9A,0x43,0x45,0xAE,0x26,0x48,0xAA,0xA5,
+  0xAD,0xD8,0xAE,0x6C,0x45,0xB5,0x0B,0x55,0xED,0x23,0x1A,0x19,
+  0xDF,0xA0,0xBF,0x4D,0x95,0xEA,0xEC,0x56,0x68,0xB2,0xD1,0x19,
+  0x59,0x6A,0x76,0xE5,0xD7,0x40,0xB4,0x64,0xA7,0x21,0xD6,0x89,
+  0xF0,0x20,0x4B,0x57,0x33,0x9B,0x22,0x74,0x79,0x5B,0x85,0xDA,
+  0x66,0x63,0xA7,0x18,0xA2,0x6E,0xC9,0x55,0xC5,0x35,0xA9,0x62,
+  0xD0,0x35,0xBC,0x60,0x32,0xD5,0xA9,0xFC,0x34,0xF0,0x83,0x5C,
+  0x1B,0x20,0x57,0xD6,0x70,0x1D,0x63,0x37,0x20,0x0E,0x0F,0xC1,
+  0xF8,0xDA,0xBA,0x65,0x34,0xB1,0xB3,0xAC,0xE3,0x5C,0xFB,0x26,
+  0x73,0xED,0x64,0x19,0x6B,0x32,0xFA,0x3D,0x0F,0x21,0x88,0x15,
+  0xC1,0x44,0x55,0x47,0xD5,0xC6,0xAA,0xDC,0x35,0x60,0x46,0xE6,
+  0x5E,0x6A,0x11,0x5D,0x8F,0x57,0x18,0x08,0x45,0x27,0xE9,0x24,
+  0x57,0x47,0xA9,0x5C,0x6D,0xE3,0x62,0xC6,0xB6,0x0E,0xC1,0xB8,
+  0x54,0xD3,0x32,0xD5,0xCE,0x9B,0x22,0x0A,0xA8,0x06,0xDA,0x8C,
+  0xD0,0x72,0xD4,0x25,0x10,0x86,0x44,0x23,0x51,0x41,0xE1,0x0C,
+  0xEB,0x46,0x52,0xDF,0x4E,0x0A,0x88,0x53,0x40,0x1C,0xF7,0xAA,
+  0x70,0x41,0x41,0x25,0xB7,0x22,0x83,0x65,0x14,0x41,0x5F,0x3B,
+  0x75,0x4D,0xDB,0xE4,0xB6,0xAA,0x6C,0xC4,0xEA,0x9A,0x62,0x8A,
+  0x38,0xAF,0x69,0xB0,0x66,0x68,0x3D,0xD2,0xA1,0x40,0x7B,0x53,
+  0x44,0x19,0x86,0xCF,0x51,0xD7,0x89,0x71,0xC2,0x88,0xD0,0xEB,
+  0xB8,0x0E,0x9F,0x46,0x25,0xEB,0x94,0x38,0xD7,0x78,0x16,0x23,
+  0xF3,0x7D,0xB3,0xDD,0x7E,0x19,0xFD,0x19,0xC4,0x1B,0xDD,0x9D,
+  0xC9,0x31,0x43,0x14,0xC4,0x26,0x6B,0x14,0x13,0x45,0x76,0x29,
+  0xFA,0x5C,0x44,0x07,0x6D,0x89,0x5C,0x6A,0x1F,0xDA,0xCA,0xE9,
+  0x38,0x7C,0x4F,0xA6,0x88,0x2E,0xDF,0x40,0xB3,0xF2,0xD3,0x00,
+  0x3F,0xBD,0xE1,0x50,0x27,0x5E,0x21,0x11,0x09,0x5F,0x45,0x09,
+  0xB9,0x48,0x98,0x61,0xC1,0x30,0x74,0x45,0xCD,0x44,0x21,0x1C,
+  0xC8,0xA1,0xDD,0x52,0xA7,0x6D,0x05,0xA5,0x60,0x18,0x89,0x11,
+  0xB5,0xAD,0x59,0x77,0xE1,0x6C,0xDB,0xF8,0xD6,0xF5,0x6E,0x39,
+  0x53,0xC4,0xD1,0x2D,0x40,0x09,0xB7,0xE2,0x62,0x87,0xA0,0x11,
+  0x2A,0xC6,0xE2,0x5F,0x91,0x47,0x10,0x5D,0x45,0x07,0x21,0x54,
+  0x73,0x34,0x9E,0xB7,0x94,0xE1,0x5F,0x45,0x1E,0xB4,0x5E,0x2A,
+  0x59,0x0A,0x63,0xFA,0x49,0x9A,0x51,0xE4,0x68,0x55,0x07,0x18,
+  0x65,0x3C,0x72,0x41,0x99,0x94,0x6E,0x88,0x0B,0xCC,0x41,0xB6,
+  0x60,0xC0,0xA2,0xCF,0x83,0x72,0xC5,0x96,0xE9,0x6C,0x29,0x71,
+  0x4C,0x11,0x47,0x5B,0x3E,0xC0,0xAD,0x14,0xE6,0x09,0x59,0xC5,
+  0x52,0x25,0xD1,0xAE,0x1F,0x46,0x40,0x21,0x2B,0xF1,0x64,0xE2,
+  0x40,0x7F,0x1D,0xF6,0x86,0x4F,0x2C,0xC3,0x70,0xAC,0x74,0x74,
+  0xEE,0x3D,0x4C,0xBC,0x9F,0x34,0xB8,0xE4,0x9D,0x49,0xA0,0x6B,
+  0x6C,0x18,0xFA,0x4A,0x2D,0xAB,0x0E,0x03,0x70,0xEC,0x9D,0xD2,
+  0xC0,0x1E,0x9B,0x07,0x8B,0x16,0xA0,0x13,0x85,0x4E,0x7A,0xE8,
+  0x74,0x57,0x8B,0x7A,0x12,0xA7,0x01,0x31,0x90,0xF1,0x76,0xA9,
+  0x1A,0x45,0xED,0x04,0x3C,0x5A,0xDB,0x8A,0x2C,0x00,0x06,0x25,
+  0xA9,0x18,0x11,0x53,0xC4,0xD9,0x88,0x52,0x3B,0xB6,0xA4,0xE3,
+  0x2B,0x5D,0xDE,0xF5,0x56,0x3A,0x0F,0x4A,0x6B,0xB1,0xC3,0x12,
+  0x5C,0x11,0x58,0x86,0x45,0xB4,0xEF,0xC8,0x6E,0xE0,0xAA,0xBB,
+  0x62,0x0B,0xA2,0x56,0xEA,0xDC,0xB2,0x4E,0xF5,0x31,0x6D,0xE0,
+  0xBC,0xB1,0x7B,0xD7,0x31,0x51,0xB4,0x22,0xA0,0x7E,0x69,0xEB,
+  0xCA,0x86,0x2E,0x45,0x6D,0x82,0x9B,0xF0,0x00,0x7B,0xBD,0x96,
+  0x02,0x42,0x54,0x57,0x26,0x08,0x5F,0xD9,0x88,0xB8,0xAB,0x12,
+  0x5A,0xD5,0x8D,0xA1,0xF2,0xA9,0xC2,0x42,0x21,0xBD,0xEB,0x0A,
+  0xEA,0x55,0x71,0xB5,0xAF,0xCA,0x2A,0xC0,0x73,0x69,0x50,0x54,
+  0x67,0x84,0xB4,0xA7,0x15,0x15,0xDC,0x63,0x95,0x55,0xB0,0xFB,
+  0xC6,0xA9,0x3C,0x17,0xF7,0xB2,0xD6,0x18,0xB7,0x07,0xB7,0x9D,
+  0x76,0xB1,0x5B,0xCC,0x54,0x8E,0xC1,0x25,0x90,0xCC,0x9A,0xA0,
+  0xBD,0x61,0xA5,0x59,0x01,0x93,0x31,0x3D,0x4D,0x31,0x9E,0xB0,
+  0xCD,0x16,0x3B,0x0C,0x53,0x5A,0x55,0xEA,0x39,0xEC,0x56,0xB9,
+  0x4A,0x60,0x30,0x6A,0x77,0xEB,0x14,0x68,0xEC,0x47,0x0C,0x57,
+  0x65,0xD2,0xCD,0x28,0xE8,0xA3,0x28,0x4A,0x47,0x5B,0x85,0x09,
+  0xD3,0xDC,0x36,0x55,0x9C,0xC2,0xED,0x36,0x6E,0x49,0xAA,0xDC,
+  0x50,0x2B,0x7E,0x62,0xDB,0xD0,0x88,0xBB,0xB9,0x08,0x7F,0xB4,
+  0x08,0xDC,0x44,0x39,0x0C,0xC9,0xCD,0xF1,0x1B,0x82,0x9B,0x44,
+  0x6C,0x33,0x9B,0xC3,0xBC,0xEF,0x1E,0xF7,0xCF,0x06,0xA7,0x05,
+  0x2B,0x34,0x75,0xCC,0x09,0xBB,0x16,0x99,0xF2,0x20,0x19,0x61,
+  0x0B,0x5A,0x3A,0x3E,0x8E,0xC1,0x77,0x0A,0xF1,0x3C,0x8C,0xE2,
+  0x97,0x22,0x8A,0x2D,0xD8,0x13,0x04,0x7C,0x38,0x3E,0x93,0xD4,
+  0x21,0x05,0x37,0x3E,0x3D,0xA3,0x5C,0x0B,0x4E,0x17,0xDD,0xDC,
+  0x82,0xEA,0x85,0x5D,0x1C,0xC9,0x69,0xE2,0xC0,0x05,0x6C,0x7B,
+  0x94,0x21,0xE1,0x9C,0xA7,0xB6,0x16,0x1F,0x24,0x23,0x08,0x65,
+  0xA5,0x25,0xD4,0xCF,0x89,0xB8,0xB9,0xD3,0x2A,0x96,0x79,0xA2,
+  0xDE,0x05,0x41,0x2F,0x76,0x3A,0x79,0x99,0xC2,0x1D,0x96,0x8C,
+  0xF2,0x0D,0x76,0x26,0x1A,0xE3,0x37,0x10,0x2A,0x38,0xBA,0x85,
+  0x09,0xA4,0x45,0x59,0x4A,0x56,0xD3,0x05,0x0A,0x83,0x2D,0xA7,
+  0x67,0x2D,0xAB,0x31,0x8F,0x8F,0xCF,0x28,0x7A,0x36,0xE3,0x50,
+  0x81,0x17,0x30,0xAB,0x04,0x42,0xD8,0xC5,0x3F,0x3B,0x46,0x69,
+  0x25,0x67,0xBB,0x1A,0x81,0xDD,0x94,0x7D,0x56,0xFE,0xF7,0xE0,
+  0xDD,0x4C,0x8D,0x7C,0xC8,0x62,0x1C,0x4F,0xA1,0x09,0x2B,0x2D,
+  0xB8,0xA0,0x93,0xA8,0x48,0x7B,0xF0,0xAE,0xB0,0x4B,0x45,0x25,
+  0x2A,0xE2,0x04,0x57,0x05,0x93,0x40,0x54,0x3D,0xC9,0x55,0xEE,
+  0x41,0x78,0x65,0x30,0x48,0x89,0x4B,0x44,0xA8,0x9C,0x4E,0xD3,
+  0x0F,0x32,0x55,0x11,0x54,0xBD,0xAA,0x53,0x21,0x30,0x8E,0x3F,
+  0x94,0x00,0x74,0xF3,0xB8,0x44,0x66,0xBC,0x56,0x4A,0xC1,0xBA,
+  0x84,0x69,0xAE,0x82,0x3D,0x4C,0x33,0x1A,0x61,0x32,0xAC,0xCB,
+  0xEC,0xC1,0xF0,0x84,0x5D,0x95,0x9A,0xCA,0xB7,0xFE,0x66,0x8C,
+  0xEE,0xA3,0x18,0x19,0xC7,0x40,0x6A,0xC2,0x5C,0x52,0x13,0x41,
+  0x75,0xB0,0x7C,0x4E,0xB8,0xE1,0x84,0x96,0x64,0x12,0xA7,0x7A,
+  0x6F,0xE9,0x88,0x2F,0xD2,0xFA,0x86,0x09,0xB7,0x9B,0x9B,0xEB,
+  0xF9,0x4F,0x56,0x06,0xDB,0x55,0x86,0x58,0x30,0x0A,0x7B,0x05,
+  0xA1,0xFF,0x74,0xFB,0x1A,0x91,0x2A,0xC6,0x6E,0x9A,0x4D,0x40,
+  0x11,0x9F,0xDB,0x89,0x4C,0x91,0x8D,0xD8,0xE0,0x8A,0x81,0xE8,
+  0x3D,0x90,0xC9,0xF8,0xF6,0x99,0x71,0x2A,0xC8,0x6A,0x6A,0x0A,
+  0xCE,0x90,0x2B,0x8C,0xDA,0x53,0x86,0xD2,0x39,0x43,0xA5,0xDC,
+  0xD0,0x6D,0x66,0x84,0x4F,0x54,0x06,0x61,0x64,0x36,0xAB,0xE3,
+  0xBE,0xFF,0x68,0x0D,0x45,0xD2,0xE1,0xBB,0x6C,0xE1,0xE4,0x54,
+  0xEF,0x22,0xB8,0x2B,0x4E,0x75,0x39,0x75,0xA7,0x84,0xCB,0x2A,
+  0x52,0x29,0x80,0x68,0x94,0x2A,0x87,0xF8,0xCF,0x50,0x2C,0x0A,
+  0x42,0x28,0xCC,0xA1,0x73,0xBF,0x67,0xCE,0xDE,0x75,0x61,0x75,
+  0xF2,0x18,0xF0,0x20,0xDE,0x9B,0xF1,0xC4,0x8F,0xE2,0xD1,0xE7,
+  0x26,0x4D,0xD1,0x1F,0x00,0xB5,0x96,0x35,0x8E,0x53,0xED,0xBC,
+  0x69,0x36,0xFD,0xB1,0x64,0xFB,0x12,0x61,0x41,0x49,0xC3,0xA2,
+  0x12,0x19,0xB7,0x15,0xAD,0x06,0x7B,0xC2,0xBE,0xDA,0x13,0xDF,
+  0x70,0xC7,0x01,0xEB,0x09,0x68,0xA3,0x51,0x0E,0x02,0x44,0xDB,
+  0xD2,0xD8,0xE9,0xC9,0x81,0x33,0x44,0x0F,0x12,0xF1,0xAF,0xF6,
+  0xDF,0x62,0x87,0x53,0x3A,0x75,0x1C,0xC8,0xA0,0x40,0x06,0xBC,
+  0xB6,0xEC,0xA6,0x04,0xDE,0xA4,0x7D,0xEE,0x2C,0x41,0xCB,0x01,
+  0x43,0x3D,0xA1,0x70,0x53,0x82,0x31,0xB9,0xC4,0x3D,0xEF,0x55,
+  0x41,0xF9,0x73,0xDE,0xFF,0x98,0x9F,0xD5,0xCD,0x7C,0x13,0x9A,
+  0xFC,0x89,0xB2,0x1F,0x56,0xCA,0x02,0x50,0xC0,0xF7,0x1F,0x2D,
+  0x5C,0xA1,0x40,0x21,0xB8,0x5D,0x18,0x01,0xF9,0x35,0x2D,0x5B,
+  0xC5,0xC9,0x01,0x24,0x5C,0xF6,0x81,0x88,0x8A,0x54,0xE2,0x8A,
+  0x65,0xC7,0xA8,0xFC,0x66,0x4D,0x57,0x15,0x0B,0x7D,0x4E,0x15,
+  0xEB,0x8D,0x7D,0xF1,0x0D,0x55,0x94,0x7B,0xEA,0x51,0x7F,0xCA,
+  0xDE,0x8C,0xE4,0xDF,0xCF,0xFA,0xBE,0xF5,0x99,0xB7,0xB5,0xCB,
+  0x88,0xC1,0x7E,0x46,0x35,0xD8,0x37,0xCB,0x9F,0xEB,0xEA,0x79,
+  0xFD,0xE3,0x61,0xFD,0xBC,0xF9,0xF1,0xF8,0x65,0xB4,0x7A,0xDE,
+  0xEC,0x7F,0xFE,0xFD,0xE1,0x71,0xBD,0x3F,0xC2,0xD1,0x5F,0xE3,
+  0xBE,0x97,0xBF,0x51,0x8F,0x8E,0x6D,0xD8,0xB7,0x8C,0x23,0xF6,
+  0xBF,0xA7,0xBB,0xDD,0xFE,0xF0,0xFC,0xF4,0xEB,0xBA,0xBB,0xF0,
+  0xE9,0x9D,0xEF,0x38,0x13,0x6F,0x3D,0x71,0x87,0x5A,0xDA,0xD0,
+  0x4E,0x8A,0x3C,0xB7,0xA3,0xE2,0x8C,0x71,0xDA,0xF9,0xC1,0x88,
+  0x16,0x35,0xD9,0xB9,0xD2,0x2E,0xFD,0x33,0x7D,0xDF,0xF1,0xFD,
+  0xB8,0xF4,0xB3,0x54,0xF2,0x85,0x5D,0x3E,0xF5,0xF7,0x73,0x66,
+  0x7A,0xD3,0x7E,0x4B,0x4F,0xFA,0xB9,0x3C,0x58,0xF5,0x52,0xCF,
+  0xBD,0xA9,0x47,0xBD,0x57,0xEF,0xEB,0xF9,0x41,0x34,0x7C,0x15,
+  0x13,0x5D,0xC4,0x14,0x06,0xC8,0xDC,0x92,0x71,0x86,0xBD,0x83,
+  0xB9,0x3D,0x26,0x33,0x30,0x10,0x4F,0x7C,0x81,0x03,0x17,0xE9,
+  0x5E,0x69,0xFA,0x19,0xDE,0x8E,0x4E,0x91,0x5C,0x7B,0xC4,0x17,
+  0x28,0x0E,0xFA,0x67,0x41,0x6F,0x32,0xBE,0x87,0xB6,0x73,0xDC,
+  0x0F,0x96,0x22,0x18,0x26,0x7A,0xE5,0xC5,0xB5,0xCD,0x4E,0x45,
+  0x74,0xF2,0x39,0x81,0x7E,0x40,0x03,0x37,0x80,0x8F,0x67,0xE5,
+  0xDE,0xE3,0x4F,0x7E,0xF2,0xC0,0xB7,0xA1,0x65,0x6D,0xBB,0xEE,
+  0x62,0xF6,0x9A,0x3A,0xF4,0xA6,0x62,0xBF,0x16,0x80,0x23,0x3F,
+  0xF0,0x79,0xC0,0xB0,0x37,0xF0,0x39,0x66,0x54,0x6F,0x70,0xFD,
+  0x64,0xBE,0x48,0xB9,0x46,0x11,0xFA,0x69,0xA9,0xDC,0xC4,0xFA,
+  0x09,0xEE,0x9A,0xED,0x6A,0x27,0x0D,0xD2,0xCD,0xB7,0x16,0xED,
+  0x41,0xB3,0x7A,0xCB,0x3B,0x07,0x28,0x57,0x5C,0x94,0x41,0xBE,
+  0xB0,0x43,0xEC,0x4D,0xCA,0x52,0xBF,0xDD,0x98,0xAE,0xA6,0x0D,
+  0xF7,0x8D,0xBF,0x70,0x80,0xF9,0x9D,0xED,0x73,0x8D,0x33,0xBD,
+  0x01,0x1D,0xCB,0x8D,0x04,0xC9,0x95,0x7A,0x89,0xC2,0x15,0x94,
+  0xAE,0xB6,0xF2,0x05,0xB0,0x45,0xBE,0x2A,0x8A,0xF7,0x77,0xC7,
+  0xFF,0x33,0xDD,0x3F,0xAF,0x57,0x87,0xC1,0xCB,0x67,0xA9,0x45,
+  0xCD,0x7A,0xF3,0xD8,0x1C,0x70,0x01,0xD2,0xFF,0x6C,0x3D,0xA3,
+  0x06,0x32,0x7E,0x5F,0x36,0x0F,0x87,0x06,0x97,0xB0,0xF2,0x82,
+  0xFA,0x5A,0xF3,0x58,0xEF,0x4E,0x9A,0xD2,0x6B,0x92,0x3F,0x69,
+  0x4A,0xD6,0xFF,0x93,0x95,0x6B,0xD5,0xEF,0x2A,0x3B,0x2B,0xFF,
+  0xD9,0xAF,0x4D,0xF3,0xBC,0xFE,0x0E,0x23,0xA7,0x7F,0x73,0x1D,
+  0xAD,0xD0,0x60,0x5D,0x92,0x4E,0x9B,0x5D,0x51,0x17,0x7B,0xAD,
+  0xCF,0x67,0x4D,0x9C,0x4F,0xA7,0x65,0x5D,0xD1,0xA3,0xF8,0xBE,
+  0xA2,0xBF,0xA5,0xC8,0x9C,0xDE,0x55,0xA4,0x9B,0x8A,0x89,0xDF,
+  0x55,0xB4,0xB7,0x14,0x45,0xC2,0xFF,0x17,0x23,0x59,0xFE,0x83,
+  0x4B,0x1E,0x83,0x7C,0x53,0x93,0x3F,0x13,0xE5,0x9B,0x9A,0xF2,
+  0x99,0x30,0xDF,0xD4,0x3C,0x9E,0xD4,0x47,0x75,0x71,0x76,0xA0,
+  0xDF,0x51,0x41,0x19,0xA1,0xFA,0xB1,0x70,0xE9,0x5E,0xCF,0xED,
+  0xAF,0xFF,0x03,0x25,0x0E,0x41,0x3D,0xA3,0x15,0x00,0x00,
+};
+const unsigned int src_www_build_qrcode_svg_gz_len = 2051;
+
+const unsigned char src_www_build_garage_car_svg_gz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x08,0xA3,0x04,0xD5,0x6A,0x02,0xFF,0x67,0x61,
+  0x72,0x61,0x67,0x65,0x2D,0x63,0x61,0x72,0x2E,0x73,0x76,0x67,
+  0x00,0x65,0x53,0xCB,0x8E,0xDA,0x40,0x10,0xBC,0xE7,0x2B,0xAC,
+  0xC9,0xD5,0x33,0x4C,0xCF,0x7B,0x22,0xCC,0x4A,0x39,0x44,0x1C,
+  0xC8,0x2D,0xC9,0x61,0x2F,0x11,0x6B,0x1C,0x6C,0xC5,0x0B,0x2B,
+  0xB0,0xCC,0xE6,0xEF,0x53,0x3D,0x86,0x5C,0x22,0x61,0xD3,0x8F,
+  0xEA,0xAE,0xEE,0x6A,0x58,0x3F,0xBD,0xBF,0x8E,0xD5,0xDC,0x5D,
+  0xAE,0xC3,0xF9,0xD4,0x08,0x52,0x5A,0x54,0xDD,0xA9,0x3D,0x1F,
+  0x86,0xD3,0xB1,0x11,0xDF,0xBF,0x7D,0x91,0x49,0x3C,0x6D,0x3E,
+  0xAC,0xAF,0xF3,0xB1,0x02,0xF2,0x74,0x6D,0x44,0x3F,0x4D,0x6F,
+  0x9F,0x56,0xAB,0xDB,0xED,0xA6,0x6E,0x56,0x9D,0x2F,0xC7,0x95,
+  0xD1,0x5A,0xAF,0x80,0x10,0xD5,0x70,0x68,0xC4,0x6E,0xFF,0xA7,
+  0xBB,0xFC,0x24,0x51,0x1D,0xF6,0xD3,0x5E,0x9E,0xF6,0xAF,0xDD,
+  0x3D,0x56,0x21,0x76,0x1B,0x0E,0x53,0xDF,0x08,0x4F,0x46,0x54,
+  0x7D,0x37,0x1C,0xFB,0xE9,0xEE,0xCC,0x43,0x77,0xFB,0x7C,0x7E,
+  0x6F,0x84,0xAE,0x74,0x65,0x1C,0x3E,0x62,0xB3,0x7E,0xDB,0x4F,
+  0x7D,0xF5,0x6B,0x18,0xC7,0x46,0x7C,0x7C,0x49,0x29,0xE8,0x17,
+  0x51,0x5D,0xA7,0xCB,0xF9,0x77,0xF7,0x5F,0x40,0xDE,0x3B,0x6B,
+  0xE5,0xC1,0xDC,0x88,0xAF,0xC6,0x2A,0xED,0x7C,0x9D,0x94,0xB6,
+  0x6E,0x47,0x56,0x79,0x38,0xCA,0x87,0xD0,0x4A,0x95,0x75,0x92,
+  0x2A,0x92,0x97,0x46,0x51,0x32,0x8B,0x09,0x74,0xAE,0xF5,0x4E,
+  0x65,0x7F,0xAF,0x01,0x2E,0xE8,0x58,0x2B,0x17,0xA3,0x2C,0x51,
+  0x52,0x94,0xED,0xC3,0xCC,0x21,0xCC,0xE4,0xB6,0xFE,0x07,0x19,
+  0xE5,0x5B,0x2D,0x55,0x32,0xC0,0x86,0x68,0x25,0x29,0xCE,0x7B,
+  0xFE,0xEE,0x89,0xDA,0x92,0xD0,0x1C,0x29,0xE9,0xFA,0x9E,0x9E,
+  0x89,0xF3,0x28,0xD7,0x5C,0x1C,0x23,0xA6,0xB0,0x2E,0xA1,0xC8,
+  0xA5,0x5C,0x38,0x64,0xE1,0x78,0x7E,0x95,0x65,0x0B,0x72,0xEC,
+  0xF5,0xD2,0x3E,0xF8,0x48,0xD9,0x98,0xF1,0x26,0x43,0xD8,0xC2,
+  0x3F,0x9E,0x6D,0x40,0x76,0x49,0xD6,0x9A,0x03,0xF5,0x3F,0x48,
+  0x6D,0x98,0x15,0xF2,0x6C,0xE9,0xCE,0xEA,0x82,0xAB,0x95,0xD1,
+  0xE0,0x4B,0x19,0x96,0xC7,0x10,0x40,0xC7,0xBC,0xC3,0x6C,0x3A,
+  0x1A,0x94,0x5A,0xEF,0x5A,0x08,0x07,0x01,0x1C,0x4F,0x6E,0x19,
+  0x5B,0xAC,0x04,0x11,0xF4,0x98,0xD1,0x35,0xA2,0x4D,0x6A,0x95,
+  0x0D,0x16,0xBD,0x92,0x2F,0x6D,0x6A,0x56,0x74,0xB1,0x4A,0xC3,
+  0x99,0x2C,0x16,0x01,0x32,0x05,0xBC,0x73,0x84,0xB4,0x46,0x3B,
+  0xE8,0x4B,0x81,0x77,0x0F,0xA0,0xD5,0x2C,0x9C,0x33,0xBE,0x98,
+  0xBD,0x74,0x28,0x4B,0x7C,0x01,0x97,0x6A,0x5E,0xD6,0x18,0xC2,
+  0x25,0xC8,0x2D,0xA0,0x9A,0x41,0x34,0x72,0x3C,0xD4,0x16,0x0A,
+  0x5B,0x40,0x99,0xD1,0x79,0x1C,0xC8,0xF0,0x25,0xB2,0x49,0x8B,
+  0x85,0x02,0x8D,0x01,0x54,0xB4,0xA1,0xA7,0xD9,0xE0,0x91,0xA6,
+  0x0F,0x0F,0x03,0xAF,0x92,0x2A,0x72,0x24,0x82,0xD8,0x98,0x06,
+  0xF2,0x87,0x52,0xCC,0x6C,0x3A,0x2D,0x3C,0x92,0x79,0x3C,0xD6,
+  0x08,0xC0,0xA4,0x5A,0x59,0x82,0x34,0x3A,0x30,0x8B,0x0E,0x35,
+  0x03,0x70,0x40,0x1E,0x21,0x2E,0x56,0xBF,0xAC,0xA0,0x0C,0x05,
+  0x9C,0x1F,0x7D,0x30,0x14,0xD9,0x5C,0x00,0xA8,0x76,0x6E,0x54,
+  0x29,0xF2,0x51,0x82,0xC7,0x5D,0x03,0x9C,0x5C,0x22,0x92,0x23,
+  0xE0,0xC1,0x21,0x71,0x1E,0xCF,0xCE,0x36,0xCD,0xF2,0x31,0xA4,
+  0x45,0x0D,0x68,0xE1,0xE3,0x0E,0x60,0x28,0xDA,0xE5,0x30,0x2A,
+  0x8D,0x9F,0x8C,0xA2,0x90,0xFA,0xA8,0xBC,0x8D,0xEC,0x83,0x86,
+  0x42,0x6E,0x15,0x11,0x13,0x7A,0x53,0xE0,0x38,0xCD,0xDD,0xE0,
+  0x3A,0x3F,0x73,0xDF,0x67,0xB1,0xDA,0xAC,0xF9,0xFF,0xBB,0xF9,
+  0x0B,0xAA,0xEB,0xC6,0x41,0x0E,0x04,0x00,0x00,
+};
+const unsigned int src_www_build_garage_car_svg_gz_len = 621;
+
+const unsigned char src_www_build_apple_touch_icon_png_gz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x08,0xA3,0x04,0xD5,0x6A,0x02,0xFF,0x61,0x70,
+  0x70,0x6C,0x65,0x2D,0x74,0x6F,0x75,0x63,0x68,0x2D,0x69,0x63,
+  0x6F,0x6E,0x2E,0x70,0x6E,0x67,0x00,0x4D,0x95,0x77,0x38,0xDB,
+  0x8B,0x1A,0xC7,0x7F,0xB1,0x12,0x6A,0x34,0x46,0xEC,0x51,0x34,
+  0x49,0x6B,0xEF,0x51,0x2A,0x48,0x5A,0x4A,0x13,0xAB,0x45,0x51,
+  0xCA,0xA1,0x2A,0xD4,0x28,0xBD,0x41,0x24,0x29,0x1D,0x36,0x25,
+  0x75,0x84,0x1A,0xC7,0xA8,0x5A,0x45,0x6B,0xD3,0xDA,0x55,0xAB,
+  0x28,0x45,0x6B,0xC5,0x6E,0x54,0xCD,0xD6,0x1E,0xF7,0x9C,0x7B,
+  0xEE,0x79,0xEE,0x7D,0x9F,0xE7,0x7D,0xBE,0xCF,0x3B,0xFE,0xFC,
+  0x7E,0x9F,0x4F,0x94,0x05,0xF6,0x32,0x17,0x87,0x08,0x07,0x00,
+  0x00,0x5C,0xA6,0x26,0x68,0x2B,0x00,0x00,0x01,0x7F,0x35,0x84,
+  0xF9,0x4F,0xC1,0x97,0xD8,0xD9,0x00,0x00,0x53,0xAD,0x85,0xB9,
+  0x0D,0x66,0x7D,0xFD,0xA4,0xA9,0xA9,0xC7,0xCD,0xED,0xCE,0xED,
+  0xDB,0x3E,0x1D,0x1D,0x83,0x74,0xFA,0xAA,0xA7,0xE7,0x5D,0x66,
+  0xE6,0xBF,0xDE,0x98,0x98,0x98,0xEC,0xEC,0x9C,0xA6,0xA6,0x56,
+  0xD6,0xD6,0x8E,0x53,0x53,0xFF,0xE0,0xE7,0x17,0x10,0x14,0x14,
+  0x6A,0x6B,0xEB,0xD7,0xD2,0xD2,0xD5,0xD5,0xBD,0xD8,0xD9,0x39,
+  0x34,0x3B,0xBB,0xCE,0xC2,0xC2,0x32,0x3F,0xBF,0x99,0x9D,0x5D,
+  0x04,0x83,0x09,0x0A,0x09,0x89,0x9C,0x3A,0xC5,0x19,0x1E,0x1E,
+  0x6D,0x64,0x74,0xA9,0xB7,0xF7,0xCB,0xD2,0xD2,0x2F,0x02,0x81,
+  0xCC,0xC6,0xC6,0x66,0x62,0x62,0x3E,0x34,0x44,0x1F,0x1B,0x5B,
+  0x60,0x65,0x65,0x5D,0x58,0xD8,0x7A,0xF9,0xF2,0xB5,0x98,0x98,
+  0xC4,0x99,0x33,0x32,0xC5,0xC5,0xD5,0x6F,0xDE,0xBC,0x43,0x20,
+  0xCE,0x89,0x88,0x88,0x7D,0xFC,0x38,0x8E,0x46,0x9B,0x40,0x20,
+  0xEC,0x0C,0xC6,0xCE,0xF7,0xEF,0xFB,0x4F,0x9E,0x24,0x72,0x70,
+  0x9C,0x1A,0x1C,0x9C,0xFA,0xF6,0x6D,0x1B,0x02,0x81,0x18,0x18,
+  0x18,0xF7,0xF4,0x8C,0x0D,0x0C,0x4C,0x5E,0xBE,0x6C,0x26,0x29,
+  0x79,0x46,0x58,0x58,0x54,0x42,0x42,0x6A,0x64,0x64,0xCE,0xC2,
+  0xE2,0x1A,0x18,0x0C,0xBE,0x70,0xC1,0xE0,0xC3,0x87,0xE1,0xBE,
+  0xBE,0xAF,0xC6,0xC6,0x97,0xD9,0xD9,0x39,0x18,0x8C,0x5D,0x21,
+  0x21,0x61,0x51,0x51,0x71,0x59,0x59,0x78,0x59,0x59,0xFD,0xDC,
+  0xDC,0xC6,0xE2,0xE2,0xCF,0x95,0x95,0x03,0x4E,0x4E,0x2E,0x15,
+  0x15,0x75,0x6D,0xED,0x0B,0x14,0x4A,0x64,0x75,0x75,0xCB,0xB9,
+  0x73,0xF2,0x50,0x28,0xEF,0xEA,0xEA,0x91,0x80,0x00,0x4C,0x5E,
+  0x5E,0xA9,0xAE,0xAE,0xE3,0xCB,0x97,0x25,0x10,0x08,0x34,0x39,
+  0xF9,0x7D,0x66,0x66,0x6D,0x7C,0x9C,0xC1,0xCB,0xCB,0xA7,0xA8,
+  0xA8,0xD2,0xD0,0xD0,0xD9,0xDA,0xFA,0x51,0x43,0x43,0xFB,0xF4,
+  0x69,0xE8,0x8F,0x1F,0x87,0xCD,0xCD,0xBD,0x6A,0x6A,0x9A,0x3C,
+  0x3C,0xA7,0xF9,0xF8,0xF8,0x95,0x94,0x54,0xA7,0xA7,0x7F,0x9C,
+  0x3D,0x8B,0xA8,0xA8,0x68,0xAC,0xAD,0x6D,0x93,0x93,0x53,0xD4,
+  0xD4,0xD4,0x59,0x5E,0xDE,0xE3,0xE2,0xE2,0xD6,0xD6,0xD6,0x1B,
+  0x1E,0x9E,0xF9,0xF2,0x65,0x51,0x5A,0x5A,0xB6,0xB4,0xB4,0xB6,
+  0xB2,0xB2,0x09,0x89,0x3C,0x8F,0x42,0xA1,0x3F,0x7D,0x9A,0x1E,
+  0x1D,0x9D,0xFF,0xE3,0x8F,0xE2,0xC2,0xC2,0x37,0x17,0x2F,0x1A,
+  0x75,0x77,0x8F,0xEA,0xEB,0x1B,0x76,0x75,0x8D,0xF4,0xF7,0x4F,
+  0x60,0x30,0xA6,0x7E,0x7E,0xFF,0x12,0x17,0x97,0x94,0x92,0x92,
+  0x2E,0x2C,0xAC,0xC4,0xE1,0x6C,0x74,0x74,0xF4,0x0D,0x0D,0x31,
+  0x89,0x89,0x34,0x19,0x99,0xB3,0x6F,0xDF,0x76,0x95,0x97,0x37,
+  0x4C,0x4C,0x2C,0x7F,0xFD,0xFA,0x8D,0x9B,0x9B,0x47,0x41,0x41,
+  0xB9,0xBE,0xFE,0xFD,0xAB,0x57,0x75,0xCA,0xCA,0x6A,0x45,0x45,
+  0x55,0xAF,0x5F,0xBF,0x85,0xC3,0x91,0x96,0x96,0xD7,0x83,0x83,
+  0x29,0x36,0x36,0xF6,0x97,0x2E,0x5D,0xA9,0xA9,0x69,0x7D,0xF6,
+  0x2C,0x33,0x2F,0xEF,0x55,0x72,0xF2,0x73,0x7F,0x7F,0xC2,0x83,
+  0x07,0x51,0x11,0x11,0x31,0xF6,0xF6,0x37,0x6D,0x6D,0x1D,0x03,
+  0x03,0x43,0x5D,0x5D,0x3D,0x5D,0x5C,0x3C,0xF4,0xF4,0x50,0x9F,
+  0x3F,0xCF,0x22,0x91,0x72,0xEF,0xDF,0x7F,0xF2,0xF4,0xF4,0x0D,
+  0x0B,0x7B,0x94,0x93,0x53,0x42,0x24,0x3E,0x34,0x35,0xC5,0x06,
+  0x05,0x11,0xEF,0xDD,0x0B,0x69,0x6C,0xFC,0x10,0x17,0x97,0xA2,
+  0xAE,0xAE,0x85,0xC5,0x5A,0xC7,0xC4,0x50,0x1F,0x3F,0x8E,0x7F,
+  0xF1,0xA2,0xDC,0xDC,0xDC,0x32,0x3F,0xBF,0x0C,0x8F,0x0F,0xF0,
+  0xF0,0xF0,0x26,0x93,0x9F,0xDC,0xBD,0x1B,0x44,0x22,0x3D,0x2E,
+  0x29,0xA9,0x49,0x48,0x48,0xA5,0xD1,0x72,0x54,0x55,0x35,0x92,
+  0x92,0xD2,0xED,0xED,0x9D,0x33,0x33,0x5F,0x06,0x07,0x3F,0x48,
+  0x4B,0xCB,0x73,0x77,0xC7,0x3B,0x39,0xB9,0xDD,0xBF,0x1F,0x56,
+  0x55,0xD5,0x1C,0x15,0x95,0x94,0x9B,0x5B,0x1A,0x1F,0xFF,0x7B,
+  0x57,0xD7,0x67,0x33,0x33,0x8B,0xBA,0xBA,0xF6,0x94,0x94,0xAC,
+  0xF4,0xF4,0xFC,0xD0,0xD0,0x88,0xE7,0xCF,0x5F,0xC4,0xC6,0x3E,
+  0x2B,0x28,0xA8,0xF0,0xF2,0xF2,0x7B,0xF4,0x28,0xEE,0xE1,0xC3,
+  0xD8,0xE8,0xE8,0xE4,0x77,0xEF,0xBA,0xB3,0xB2,0x0A,0x33,0x32,
+  0x0A,0x7C,0x7C,0x02,0x1D,0x1D,0x5D,0x1D,0x1C,0x6E,0x59,0x5B,
+  0xDB,0xDD,0xB8,0xE1,0xE2,0xEC,0xEC,0x6E,0x65,0x65,0x81,0x00,
+  0x00,0xF0,0x03,0x53,0xB4,0xA1,0x0D,0x01,0xB4,0xD2,0xF2,0xE0,
+  0x4F,0xC3,0x02,0x94,0xEC,0xA3,0x42,0xC1,0x42,0x26,0xE0,0x7F,
+  0x05,0x27,0x67,0x42,0xA5,0x20,0xE1,0x40,0x74,0xBC,0x8F,0x28,
+  0xDE,0x61,0xA7,0x69,0x2C,0x64,0x40,0x1C,0x37,0xFC,0x2B,0xD9,
+  0x68,0x9B,0x2D,0xDE,0xC3,0x8E,0x5B,0x39,0x4B,0x10,0x6D,0x9A,
+  0x24,0x20,0x80,0x74,0x1E,0xE2,0x62,0xA4,0x17,0xE2,0x4F,0x1F,
+  0xA5,0x28,0x54,0xE9,0x28,0x6A,0xBF,0x43,0x44,0x5A,0x29,0x39,
+  0x43,0x5C,0xF6,0xDA,0x4C,0x5A,0xA3,0x83,0x50,0xC4,0xD1,0x3B,
+  0x63,0xA6,0x69,0xF0,0xBE,0xCC,0x05,0xD4,0x2E,0xC6,0x5E,0x63,
+  0x31,0x04,0x6D,0xE9,0x96,0x5F,0x07,0x6F,0xE5,0x0F,0x27,0x6B,
+  0xFA,0x36,0xC7,0x2C,0xAC,0xBD,0xB9,0xA1,0x95,0x15,0x87,0xD5,
+  0x23,0x37,0xE0,0xCB,0x0F,0x36,0x07,0xF4,0x12,0x0A,0xEE,0x6D,
+  0x95,0x2A,0xA1,0xB7,0xCA,0x16,0x4A,0x9F,0x4E,0x49,0x2A,0xDD,
+  0x8D,0x3D,0x73,0x81,0x09,0x79,0xDD,0x01,0xF1,0x72,0x3C,0xC8,
+  0x47,0xD4,0x6D,0xBC,0xDA,0x7F,0x7F,0xA3,0x73,0xCC,0xE4,0x75,
+  0xEC,0x54,0x4C,0x0B,0xDF,0xDD,0x35,0x42,0x53,0xF6,0xA3,0xB9,
+  0x50,0xD7,0xC5,0xB6,0x10,0xF1,0x1F,0x4F,0xCB,0x38,0xA9,0xEB,
+  0x3F,0x27,0x5E,0x8F,0x3B,0xAD,0x36,0xAE,0xBF,0x85,0x8A,0x3F,
+  0xCF,0x1C,0x0C,0xDE,0xD9,0x1F,0x49,0x5D,0x38,0x8A,0xF0,0x23,
+  0xAE,0x12,0x6F,0xBD,0xC9,0x0A,0xDA,0x5F,0x83,0xA5,0x9F,0x6C,
+  0xF0,0xCC,0xEC,0x1F,0x19,0xBB,0x1F,0xB7,0x70,0x8C,0x07,0x9F,
+  0x38,0xA8,0x70,0xD4,0x8A,0xCF,0xB0,0xC7,0xED,0xB5,0xAA,0x41,
+  0x2B,0xAE,0xE8,0x4D,0xC6,0x07,0x63,0x8D,0x08,0xFD,0xF9,0x46,
+  0x62,0xDB,0x3D,0xF3,0xED,0xB2,0x1D,0xB4,0xD7,0xC9,0x72,0xF6,
+  0x98,0xDD,0xCF,0x22,0x2C,0x8B,0x78,0xDB,0x40,0x81,0x7B,0x81,
+  0x72,0xFB,0x1F,0xD1,0x9C,0xA7,0x62,0x6C,0xDA,0x21,0x13,0xC4,
+  0x85,0xFA,0xA8,0x87,0x43,0xDE,0x0C,0xC7,0x5E,0x2F,0x19,0xAB,
+  0x6D,0x35,0xF0,0x6F,0x07,0x19,0x8A,0xAE,0x91,0x0D,0x17,0x8C,
+  0xA9,0xDF,0x25,0xA4,0x19,0x55,0x00,0x69,0x4F,0x61,0x27,0xB3,
+  0xFB,0xE2,0xF9,0xC6,0xC6,0x1C,0xF0,0xC1,0x66,0x31,0xC5,0x60,
+  0x20,0x26,0xDC,0x25,0xD2,0x37,0x93,0xEE,0x22,0x67,0xDE,0xF9,
+  0x05,0x9B,0x37,0xBA,0x21,0x7C,0x56,0xD7,0x75,0x20,0x73,0xA9,
+  0xE4,0xA9,0xD2,0x8F,0x8E,0x50,0xDB,0x64,0xBB,0xC1,0x0A,0x56,
+  0x8E,0xC5,0x1E,0x25,0xDA,0x32,0xCE,0x5A,0xB7,0xAD,0x6C,0x00,
+  0x45,0x87,0xF7,0xC4,0x1F,0x94,0x41,0xC5,0x2C,0x83,0xEF,0xAF,
+  0xB6,0x98,0x26,0x79,0x27,0xE4,0xEE,0xFA,0x12,0xCF,0x57,0x8F,
+  0x78,0x96,0x8C,0xE3,0xC7,0xAF,0xCF,0xDD,0xF9,0x1C,0x4B,0x70,
+  0xB3,0x2D,0xD3,0xAF,0xF6,0x19,0xAF,0xF6,0x39,0x10,0x8E,0x20,
+  0xCF,0xBD,0x4D,0x7F,0xAA,0x71,0x6D,0xC8,0xBA,0xB4,0x7B,0xB9,
+  0x24,0x54,0x66,0x15,0xA1,0x3D,0x74,0x31,0xAE,0xF7,0x10,0xA6,
+  0x9E,0x79,0x48,0x4A,0x62,0xD9,0xD5,0xF1,0x52,0x6F,0xEC,0xC9,
+  0xEB,0x5A,0x1B,0x74,0x96,0x35,0x24,0xC5,0x89,0x58,0xC5,0xD2,
+  0x0E,0x87,0xBF,0x0D,0x9E,0xB6,0xFE,0xEA,0x3B,0x89,0x76,0x18,
+  0xCC,0xC5,0xEE,0x48,0x24,0x59,0xE8,0x87,0xCE,0x84,0x64,0xEF,
+  0x24,0xEF,0xE3,0x48,0x5C,0xFE,0x6A,0x38,0xAC,0xA4,0x63,0xD8,
+  0x41,0x54,0xFC,0xCD,0x35,0xC9,0x20,0xE3,0xAC,0x77,0x64,0xA7,
+  0xB0,0xD4,0x43,0xB6,0x09,0x45,0xAE,0xF9,0xA9,0x07,0x83,0x9D,
+  0xB6,0x57,0x11,0x4D,0x9B,0x86,0x86,0xCE,0x1F,0xCB,0xD9,0xC8,
+  0x05,0x33,0xF3,0x4B,0x6D,0x93,0xFA,0xAB,0x91,0x17,0x3B,0x47,
+  0x7C,0x37,0xF1,0x06,0xE8,0xF1,0x62,0x79,0x49,0xB8,0x41,0xD5,
+  0xD4,0x6E,0x58,0x86,0xBE,0x4D,0x71,0x97,0xAF,0x9D,0x6A,0x4A,
+  0xCA,0x4C,0x88,0x39,0xC9,0xAB,0xE5,0xF3,0x6D,0xFC,0xD6,0xC9,
+  0xD0,0x3A,0xB9,0xED,0x24,0x70,0x00,0xE2,0x28,0x73,0xF9,0x6C,
+  0xD8,0xE6,0x5C,0xCB,0xA8,0xC6,0xFE,0xC2,0x16,0x79,0xF3,0xC0,
+  0x33,0x70,0xF3,0xE4,0x90,0xB4,0x7C,0x32,0x5F,0xD0,0xA2,0x50,
+  0x87,0xC3,0x70,0x37,0xBB,0x3D,0x96,0xF5,0xD9,0xEC,0x51,0x3E,
+  0xE1,0xEF,0x6D,0x63,0xBF,0x33,0x65,0x67,0xFA,0xDA,0x7F,0xAE,
+  0x65,0x29,0x74,0x82,0x0D,0x41,0x0F,0x21,0xCD,0x26,0x27,0x05,
+  0xE2,0xB0,0x44,0x89,0x51,0x59,0x32,0x07,0x31,0x01,0x1F,0x80,
+  0x1B,0x34,0xEA,0xEF,0xAA,0x7D,0x11,0x29,0xF9,0x62,0xF6,0x43,
+  0x06,0xFC,0x6B,0x6A,0x4A,0x8C,0x5B,0xD1,0xEE,0x2D,0x5D,0xD4,
+  0x46,0x2C,0x71,0xD0,0xE4,0x38,0xD6,0x95,0xC2,0x38,0x66,0x25,
+  0xA0,0xD4,0xB7,0x28,0x6B,0x20,0x6F,0x40,0xB4,0x99,0xAD,0xFC,
+  0xFF,0x44,0x6A,0xD8,0xD7,0xC2,0xEA,0xE7,0x29,0x06,0x54,0xAA,
+  0x21,0x5C,0xF6,0x4E,0x56,0x29,0x86,0x42,0x93,0xED,0x93,0x57,
+  0x60,0xEA,0x85,0xDF,0xF1,0xC0,0x43,0x5D,0xB8,0x4D,0xD5,0x2E,
+  0x67,0x01,0xF6,0x0A,0x61,0x29,0xF9,0xF6,0x94,0xCE,0x8E,0xDB,
+  0x09,0xE3,0x80,0x26,0x85,0xCB,0x85,0x79,0xEC,0x1F,0x09,0x61,
+  0x11,0xA2,0xCD,0xBE,0x79,0x9A,0xC6,0xBA,0x9E,0xF5,0xDF,0xB5,
+  0x3E,0xE7,0xD7,0xBF,0x8F,0xDF,0x24,0xE9,0x19,0x75,0x35,0x2F,
+  0xAA,0x4A,0x9A,0xFA,0xEB,0x7B,0xD3,0x5D,0x43,0x80,0x85,0xE4,
+  0x3D,0xD0,0x6C,0x35,0xFD,0xE6,0x1C,0xB3,0x3C,0x91,0x45,0xE9,
+  0x92,0x9E,0x37,0x81,0x72,0x88,0x21,0x58,0xD7,0x8E,0xAD,0x00,
+  0x66,0xEB,0x45,0x47,0x05,0x70,0xF0,0xEE,0xE2,0x55,0xAA,0xAD,
+  0x07,0x67,0x51,0x53,0x7E,0x53,0x5B,0x45,0xEF,0x3C,0xD0,0x63,
+  0x09,0x7F,0x28,0xAB,0x88,0xCB,0x3D,0xF4,0x08,0xA0,0xC4,0x03,
+  0x5A,0x4B,0x66,0xCF,0xAF,0x03,0x2C,0xEF,0x34,0xB5,0x9A,0x91,
+  0xD4,0x67,0xBC,0x65,0xFE,0x48,0xB3,0x3E,0x2E,0x65,0x9E,0xFC,
+  0xF4,0x76,0xB9,0x5D,0x91,0x66,0x7A,0x76,0x21,0xC8,0x68,0x01,
+  0x20,0xA7,0xEC,0x96,0x1A,0xD9,0xFB,0x78,0x51,0xF8,0xA9,0x1A,
+  0xBC,0x4D,0xA1,0x31,0x20,0x91,0x74,0x11,0xBA,0xE1,0x92,0x86,
+  0xEF,0x69,0x9E,0x11,0xA6,0x4A,0xE2,0x74,0x2F,0xE0,0x6E,0x0F,
+  0x7C,0x6F,0x8F,0xF9,0x85,0xEC,0xE9,0xE5,0x2C,0x07,0xB9,0xE7,
+  0x12,0x06,0x67,0xAE,0x52,0x04,0x3C,0xD8,0x84,0xD8,0x2D,0x24,
+  0x78,0x71,0x9A,0xA0,0x09,0x9D,0x89,0x76,0xA0,0x26,0x57,0x1D,
+  0xEA,0xAB,0x99,0xAB,0xE7,0xE3,0x4A,0x51,0x40,0xC6,0xB5,0xA7,
+  0x17,0x7C,0x05,0x55,0x6A,0x29,0xA3,0x5A,0xFA,0x80,0x84,0x48,
+  0x5B,0x07,0xCB,0xB4,0x34,0xC1,0x6C,0xC9,0x6E,0xCD,0x0D,0x2F,
+  0x48,0xF7,0xFD,0x2D,0x26,0x73,0x00,0x22,0xCF,0xDF,0xFF,0x9E,
+  0x39,0x0F,0x96,0x0A,0xA3,0xC7,0x23,0x00,0x12,0xFF,0xDA,0xFD,
+  0xEC,0x15,0x75,0x85,0x66,0x45,0xEA,0xE4,0xEC,0x64,0xBF,0x02,
+  0x00,0xA7,0xC1,0xE8,0xD7,0x97,0xAA,0x60,0x4D,0x54,0x20,0x14,
+  0xC8,0xAC,0x6D,0x2B,0x01,0x94,0x60,0xC9,0x2E,0xA1,0x71,0x1C,
+  0xE5,0xE5,0x32,0x51,0xDB,0xDD,0x5A,0x6C,0xAC,0x04,0xCD,0x84,
+  0xF6,0x03,0x37,0xB0,0x1B,0x53,0x60,0x03,0xED,0xB1,0x9F,0xC3,
+  0x87,0x44,0xE0,0xD4,0xC1,0x80,0xF2,0x36,0x0D,0x4A,0xEF,0x8A,
+  0xD7,0xBE,0x79,0x77,0x58,0xF7,0x96,0x44,0x7B,0xC5,0x74,0x24,
+  0x00,0xF6,0x5B,0x91,0x4B,0x6C,0x0F,0x0E,0x90,0xBA,0x32,0x9D,
+  0x08,0x02,0xA9,0x4E,0x1B,0x33,0xC4,0xA9,0xE8,0x6E,0x25,0x23,
+  0x1D,0x4F,0x14,0x85,0x0B,0xF9,0x44,0xB6,0xE5,0x66,0x08,0x5F,
+  0x76,0x13,0x08,0x54,0xCF,0xA4,0x97,0xA6,0x14,0x75,0x5F,0x48,
+  0xEA,0xC8,0xFA,0x07,0x33,0x7F,0x25,0xA0,0x2D,0xCD,0x5E,0x03,
+  0xCD,0x37,0x3F,0x00,0xCA,0x72,0xC5,0x04,0x46,0xB9,0x74,0xF0,
+  0x24,0xF2,0xCA,0xEE,0x77,0xDE,0x0D,0xC6,0xA8,0xD2,0xB5,0x62,
+  0x74,0x8E,0xBC,0x1E,0x69,0x65,0x07,0x11,0xA0,0xEB,0xD8,0x50,
+  0x3E,0x99,0x13,0x46,0x39,0x83,0xDC,0x89,0x9E,0x9B,0x2F,0x84,
+  0x21,0x3B,0x6A,0x32,0x60,0xA3,0xB4,0xEA,0x61,0x97,0xDF,0xB4,
+  0xFC,0xAF,0x0A,0x5B,0xC4,0x06,0x2C,0xC1,0x77,0x9A,0x48,0x46,
+  0x8C,0x92,0x30,0xCA,0x47,0xA4,0x41,0x54,0xC0,0x76,0x70,0x2B,
+  0x93,0x59,0xC7,0xC6,0x6C,0xC6,0xB0,0x67,0x82,0xF6,0xBC,0xA3,
+  0xCA,0x2D,0xDC,0x73,0x2D,0x0D,0x14,0x96,0x82,0x14,0x45,0xD3,
+  0xAE,0xF4,0x45,0xBF,0xC1,0xD0,0x30,0x54,0xD8,0x51,0x2F,0xA7,
+  0xC5,0x0D,0x6C,0x25,0x4C,0x7F,0xFE,0x44,0xD1,0x22,0x26,0x49,
+  0xC8,0x00,0xF1,0x63,0x55,0x59,0xB5,0x39,0x40,0xCC,0xB7,0x9A,
+  0xC8,0xD3,0xB9,0x52,0x0F,0x4E,0x8D,0x98,0x7B,0x9B,0xE2,0x3B,
+  0x3B,0xE6,0xF1,0x1B,0x65,0x1B,0x78,0x46,0x3E,0x97,0x48,0x17,
+  0x94,0x64,0xAA,0x54,0x80,0x80,0x09,0xBE,0x9E,0xE6,0x6B,0x8F,
+  0x98,0xF5,0x34,0x98,0xB2,0xFB,0x5F,0x66,0xF3,0x7B,0x2B,0xB2,
+  0x20,0x55,0x55,0x50,0xEB,0x57,0x29,0x07,0x18,0x9D,0x84,0x4D,
+  0x6F,0x6D,0x54,0x7E,0xBB,0x8D,0x30,0xF7,0x80,0xDA,0x72,0xF7,
+  0x12,0xA4,0x79,0xCB,0x90,0x99,0x79,0x3E,0x37,0x2F,0xF2,0x13,
+  0x7F,0x7E,0x90,0x13,0x73,0xE5,0x25,0x7B,0xF9,0x6E,0x12,0xF5,
+  0x4F,0x7E,0x4B,0xAD,0x81,0x0E,0xAF,0x51,0x35,0x90,0xCE,0xA3,
+  0x1A,0x28,0xB6,0x6E,0x29,0xCB,0x34,0x66,0x3D,0x19,0x38,0x9B,
+  0x10,0xBD,0x71,0x6A,0x5A,0x35,0xCD,0x7D,0x6A,0x0C,0x46,0x5F,
+  0xC4,0xB5,0x81,0x38,0xD2,0x3B,0x6C,0x84,0xB8,0xD7,0xEF,0x9C,
+  0x47,0xF5,0x4C,0xD2,0xFA,0x54,0x8F,0x33,0x59,0xD7,0x53,0x9E,
+  0x82,0x8E,0x5B,0xAA,0xD2,0x86,0x8F,0x90,0x7E,0x91,0xF8,0x52,
+  0x15,0xD5,0xE6,0xE4,0x32,0xA8,0xC2,0x51,0x7A,0x3D,0x78,0x77,
+  0x4F,0x38,0xE7,0x57,0xD8,0xF4,0x07,0x60,0xB3,0x1F,0x11,0x89,
+  0x3C,0xC6,0x50,0x0D,0x87,0x73,0x6C,0xA8,0x64,0x01,0xBE,0x0D,
+  0x34,0x5E,0x45,0x8D,0x12,0x78,0x1C,0x5B,0xBE,0xB3,0x1D,0xE3,
+  0x06,0xD1,0x08,0xC5,0xB4,0x6F,0xAC,0x99,0x34,0x0E,0x0F,0xB9,
+  0x7A,0x01,0x8C,0x75,0x49,0x04,0x48,0xE6,0xF8,0xA0,0xAA,0xB6,
+  0x9A,0xDF,0x3A,0xA2,0xDA,0xB8,0xE3,0x99,0x7F,0x05,0xEF,0xD9,
+  0xA0,0x50,0x35,0x15,0x0D,0xCA,0x26,0xA3,0x6B,0xF0,0xDC,0x51,
+  0xDA,0x63,0xD9,0x9C,0xA5,0x4A,0xAA,0x57,0xD8,0xA8,0xB9,0xB4,
+  0xD1,0xD5,0x83,0xFC,0xD8,0xD5,0x8D,0xC2,0xC8,0x41,0x50,0xA3,
+  0x9A,0xFC,0xDF,0x51,0xE3,0xEA,0x48,0xFD,0x27,0x75,0x82,0x56,
+  0xD2,0x8A,0xA0,0x09,0xAA,0x15,0x4E,0x0B,0xE4,0x78,0x25,0xAA,
+  0xD6,0x65,0xE5,0x96,0x9F,0x0E,0x4A,0xB2,0xB0,0xE0,0x22,0xD0,
+  0x53,0xA5,0xF7,0x4F,0xFE,0xC6,0x80,0x07,0x7B,0xB6,0x5C,0xF1,
+  0x50,0x97,0x4F,0x87,0x91,0xFA,0x1B,0xE0,0x31,0x35,0x03,0x57,
+  0xAB,0x58,0x20,0x42,0x46,0x89,0x7B,0x57,0x4C,0xEA,0x86,0x0F,
+  0xC2,0x68,0x03,0xFC,0x72,0x03,0x8D,0x64,0x13,0x45,0x1D,0x26,
+  0x1A,0x73,0xFE,0xDE,0xF1,0x8B,0x5B,0xA5,0xF4,0x59,0x88,0x88,
+  0xB1,0xB9,0x3E,0x9E,0x68,0x75,0x42,0x9A,0x7D,0xB2,0x72,0xB9,
+  0x0E,0x4B,0xE7,0x99,0xE5,0x50,0x94,0x4A,0x71,0xB2,0xC2,0x09,
+  0x46,0xE6,0x87,0x5A,0x38,0x4E,0x83,0x6B,0x3F,0x3E,0xD9,0x9B,
+  0x8D,0xC9,0x7A,0x75,0x68,0xD7,0x91,0xF7,0x24,0x77,0xBF,0x84,
+  0xB8,0xD3,0x59,0x84,0xCD,0xF8,0x3D,0xE4,0x02,0x61,0xB9,0xB3,
+  0x68,0x4A,0x3F,0x49,0xC1,0x36,0xAE,0xE1,0xA7,0x9B,0x80,0x2D,
+  0x29,0xE9,0xA4,0x0A,0x0C,0xFE,0x0F,0x56,0xC3,0x0F,0x4B,0x25,
+  0xF3,0xFE,0x0F,0xB0,0x14,0x28,0x41,0x3D,0x75,0xD4,0x0B,0xCC,
+  0x67,0xF0,0xD7,0x64,0x8A,0xC1,0xA2,0x5F,0x19,0xB9,0x84,0xFF,
+  0x1B,0xF3,0xBB,0xF4,0x3A,0x7E,0x0A,0x00,0x00,
+};
+const unsigned int src_www_build_apple_touch_icon_png_gz_len = 2721;
+
+const unsigned char src_www_build_logs_js_gz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x08,0xA3,0x04,0xD5,0x6A,0x02,0xFF,0x6C,0x6F,
+  0x67,0x73,0x2E,0x6A,0x73,0x00,0xE5,0x59,0x6F,0x6F,0xDB,0x36,
+  0x13,0x7F,0x9F,0x4F,0xC1,0x09,0xDB,0x2C,0x45,0xB2,0x6C,0x07,
+  0x59,0x51,0x58,0x95,0x8B,0x36,0x0D,0xB0,0xED,0xE9,0xBA,0xA1,
+  0x4E,0x9E,0x37,0x69,0x1E,0x44,0x96,0x68,0x9B,0x89,0x2C,0x7A,
+  0x24,0xE5,0xD4,0xF0,0xFC,0xDD,0x9F,0x3B,0x92,0x92,0xFF,0xD4,
+  0x75,0x9C,0x2D,0x01,0x36,0xCC,0x2F,0x22,0x91,0x3A,0xDE,0xFD,
+  0xEE,0x8E,0x77,0x3C,0x5E,0x5A,0xC7,0x4F,0xF3,0x3B,0x22,0xC7,
+  0x64,0xCC,0x27,0xF4,0x8E,0xA9,0xA6,0x48,0xD4,0x28,0xE3,0x24,
+  0xE7,0xA3,0x11,0x15,0xE4,0x9E,0x0E,0xC8,0x34,0x19,0x51,0x72,
+  0x9B,0xCC,0x12,0x99,0x0A,0x36,0x55,0x64,0x58,0x16,0xA9,0x62,
+  0xBC,0x90,0xB0,0x0C,0x57,0x9E,0xF1,0xE9,0x5C,0xB0,0xD1,0x58,
+  0x11,0x37,0xF5,0xC8,0x49,0xFB,0xE4,0x94,0xBC,0x4B,0x66,0x2C,
+  0x23,0xFF,0xA1,0x42,0x04,0x64,0xAC,0xD4,0x54,0x76,0x5B,0xAD,
+  0x11,0x53,0xE3,0x72,0x10,0xA6,0x7C,0xD2,0xCA,0xEE,0xE0,0xCB,
+  0x8B,0x53,0xB3,0xBE,0x75,0x74,0x34,0x4B,0x04,0xA1,0x33,0xD5,
+  0xE7,0xA5,0x48,0x69,0x5C,0x16,0x19,0x1D,0xB2,0x82,0x66,0x11,
+  0xCE,0x4F,0xE4,0xE8,0x67,0xC9,0x8B,0xB5,0xD9,0x14,0x44,0x2B,
+  0x92,0xE6,0x8C,0x16,0xEA,0xF2,0xF2,0xA7,0x77,0x71,0x59,0xB2,
+  0x6C,0x76,0xEA,0x7A,0x51,0x85,0x8C,0x00,0x61,0xD6,0x57,0x89,
+  0x50,0x17,0x6C,0x42,0x5D,0x45,0x3F,0x2B,0x6F,0x61,0x96,0x09,
+  0x3A,0xA2,0x9F,0xE3,0xD6,0xD5,0x27,0xF9,0x49,0x7C,0x2A,0xAE,
+  0x5B,0x51,0x4E,0x15,0x91,0x54,0xCC,0xA8,0x40,0xDA,0x35,0x31,
+  0xF8,0xA1,0x9C,0xEE,0x98,0x1C,0x70,0xAE,0xB6,0xA6,0x6B,0xC1,
+  0x92,0x26,0x22,0x1D,0xBB,0x52,0x09,0x56,0x8C,0x02,0x2D,0x6C,
+  0x1A,0x0C,0x05,0x9F,0xC4,0xED,0x0A,0x01,0x40,0x03,0x04,0x86,
+  0x22,0x94,0x39,0x4B,0xA9,0x8B,0x04,0x5E,0x68,0xD7,0x9A,0x45,
+  0x5E,0x24,0xA8,0x2A,0x45,0x61,0xC9,0xE3,0xB8,0xD9,0x79,0xDD,
+  0xEC,0x74,0xF5,0xC8,0x47,0xFA,0x68,0x79,0x84,0x60,0x58,0x8C,
+  0xDA,0x85,0x7A,0xFE,0xD7,0xA1,0xDB,0xE8,0x36,0x82,0xCD,0x89,
+  0xBE,0xD6,0x0D,0x34,0x51,0x00,0xB9,0xE1,0x79,0xFE,0x89,0x56,
+  0xE2,0x36,0xB6,0xE2,0x90,0xDA,0x00,0x0D,0x98,0x17,0x59,0x85,
+  0x3F,0x94,0x93,0x01,0x15,0xFA,0x5B,0x28,0xCB,0x81,0x01,0xEB,
+  0xB2,0xE0,0xD6,0xF3,0xA2,0x6D,0x89,0x56,0x80,0x61,0x1F,0xB1,
+  0xA1,0xCB,0x7A,0xA8,0xEC,0x0E,0x60,0xEC,0x01,0xE1,0x6B,0x6E,
+  0xD8,0x03,0xE0,0xB8,0xD3,0x6E,0xB7,0xA3,0xDA,0x09,0xAB,0x45,
+  0x4D,0x03,0x1E,0x0C,0x63,0x4C,0xB7,0x58,0x7D,0xEA,0xAE,0x5E,
+  0x03,0x43,0xD5,0x35,0x8F,0xA0,0xE2,0xD3,0xAD,0x5E,0x96,0xB0,
+  0xBE,0x76,0x27,0x2B,0x60,0xA1,0x9E,0x86,0xDD,0x34,0x99,0x1A,
+  0xBC,0xB2,0xDA,0x58,0xA0,0xE4,0xD0,0x5D,0x1B,0x19,0x7F,0xB4,
+  0xB5,0x8A,0x59,0xA2,0x68,0x5C,0xD0,0x7B,0x08,0x05,0x45,0x61,
+  0x6B,0xDE,0x8F,0x59,0x4E,0x5D,0x77,0xDB,0x2A,0xBD,0x5E,0x8F,
+  0x5C,0x69,0xCB,0x74,0xBC,0x5E,0xDB,0xB0,0xB8,0xDD,0xA2,0xB9,
+  0xC6,0xEF,0x9A,0x29,0x04,0xE5,0x3E,0xEB,0xF8,0xA7,0xDA,0x41,
+  0x28,0x1A,0x36,0x93,0xD9,0xFB,0x35,0x3C,0xDF,0x2E,0xF6,0x22,
+  0x5C,0x16,0x6F,0xAD,0x6D,0x07,0xAC,0xD9,0xF1,0xFC,0xC6,0x55,
+  0xC3,0xD7,0xCB,0x15,0xFF,0xB9,0xFF,0xEB,0x07,0xD7,0xF3,0xB7,
+  0xE8,0x6E,0xBD,0x68,0x59,0xD9,0x97,0xE0,0xB7,0x75,0x6B,0x4D,
+  0xE4,0x05,0xD7,0x42,0xB3,0x12,0xB2,0x08,0xCC,0x18,0x7D,0x24,
+  0x85,0x8D,0x9F,0xC9,0xF8,0x97,0x44,0x8D,0xC3,0x61,0xCE,0xB9,
+  0x70,0x6B,0x8A,0x16,0x3A,0xD3,0xFB,0xEE,0x45,0xDB,0x0B,0x26,
+  0xAC,0x28,0x15,0xFD,0x0A,0x99,0x8B,0x74,0xC7,0x40,0x66,0x68,
+  0xC7,0x90,0x29,0x1E,0xA0,0x34,0xC4,0x27,0xA7,0x5E,0x90,0x25,
+  0xF3,0x87,0x69,0x8F,0x81,0x12,0x6C,0x67,0x18,0xBB,0xFA,0xF1,
+  0xAA,0xD3,0xF6,0x5E,0x3B,0x6D,0xC7,0xD7,0xA3,0xAE,0xFE,0x1B,
+  0x55,0x28,0x5D,0xFB,0x52,0x13,0xD9,0x71,0xD7,0x3E,0xA3,0x4A,
+  0x6B,0xD7,0xBE,0xD4,0x84,0x76,0xDC,0xB5,0xCF,0x2A,0xCE,0x11,
+  0xA5,0xEF,0xE8,0x07,0xB1,0x22,0x61,0x38,0x16,0x38,0xB2,0x3C,
+  0x61,0x0C,0x6F,0x38,0x61,0xD7,0xC2,0x04,0xBC,0x49,0x67,0xDD,
+  0x09,0x7C,0x4A,0x8B,0x8B,0x64,0xE0,0x42,0x3E,0x0D,0x54,0x32,
+  0xF8,0x90,0xE0,0xCE,0xC4,0x44,0xCA,0x70,0x08,0xCB,0x14,0xA4,
+  0x4D,0x7C,0xCD,0x59,0x71,0x27,0xA3,0xD5,0x5C,0x9C,0xF1,0xB4,
+  0x9C,0xC0,0x4B,0x38,0xA2,0xEA,0x3C,0xA7,0xF8,0x2A,0xDF,0xCE,
+  0xCF,0xF2,0x44,0x4A,0xE4,0xE2,0x3A,0x2B,0x5A,0x07,0x72,0x2D,
+  0x58,0x12,0x37,0x3B,0x7B,0xB5,0x9A,0x0E,0x73,0x5A,0x8C,0xD4,
+  0x38,0x62,0xBE,0xEF,0x2D,0x56,0xD3,0x57,0xEC,0x3A,0x94,0x6A,
+  0x9E,0xD3,0x30,0x63,0x72,0x9A,0x27,0xF3,0xD8,0x29,0x78,0x41,
+  0x11,0xF6,0x0E,0x99,0x6F,0xE7,0x3F,0x65,0xAE,0x93,0xE6,0x90,
+  0x21,0xDE,0xAA,0xC2,0xF1,0x76,0x2F,0xAD,0x14,0x38,0x08,0xB5,
+  0xA6,0xDC,0xC6,0xAC,0x27,0xB7,0x11,0xEB,0x49,0xC4,0x9B,0x56,
+  0x0C,0xE2,0x9D,0xB3,0xA1,0xA0,0x80,0x06,0x52,0xB7,0x43,0x12,
+  0xB0,0xFB,0x8C,0x3A,0x81,0x03,0x02,0xBE,0xAE,0x50,0xE5,0x8A,
+  0x6D,0x6D,0x06,0x39,0x4F,0xEF,0x9C,0x08,0xBC,0x15,0xA6,0xA5,
+  0x10,0x40,0x7E,0x91,0x08,0x58,0xBB,0x12,0xE5,0xC7,0xB5,0x0C,
+  0xCC,0xAE,0x96,0x11,0x9C,0x08,0x4E,0x2A,0x12,0x39,0x06,0x5F,
+  0x3B,0x3A,0x11,0xD9,0x83,0xF2,0x75,0xA8,0xA7,0xCF,0x78,0x59,
+  0x28,0xCC,0x28,0x7F,0xC2,0xC2,0xAC,0x00,0x85,0x69,0xD3,0x42,
+  0x5B,0x2E,0x69,0x2E,0x29,0xD9,0x14,0x0D,0x69,0x45,0x95,0xD2,
+  0xC8,0xCE,0x79,0x92,0x51,0x81,0xBC,0x2D,0xA3,0x19,0x93,0x6C,
+  0xC0,0x72,0xA6,0x80,0x97,0x7E,0xCF,0x01,0xFA,0x57,0x71,0x18,
+  0x56,0xB7,0x00,0x1D,0x90,0xB0,0xA2,0x80,0x34,0x8D,0x09,0xCA,
+  0x71,0xA2,0x21,0x55,0x70,0x46,0x58,0x82,0xD0,0x50,0x1C,0x85,
+  0x6A,0x4C,0x0B,0x17,0x4E,0x49,0x39,0x85,0xE3,0x94,0x7A,0x71,
+  0x0F,0x95,0xFF,0xA6,0x1A,0x87,0xFC,0xEE,0x8F,0x3F,0xEA,0x81,
+  0x59,0xFA,0x4D,0x1C,0x9F,0x40,0x96,0x59,0x08,0x7A,0x4B,0x53,
+  0xE5,0xDE,0x9C,0x0B,0xC1,0x05,0x54,0x02,0xBF,0x97,0x52,0x41,
+  0x52,0x23,0x6B,0x02,0x02,0xF2,0xF1,0xAC,0x4B,0xBE,0x5D,0x6C,
+  0x71,0x58,0xDE,0x80,0x6F,0xD1,0x0C,0x0B,0x1B,0xAD,0xF5,0x77,
+  0xCC,0x81,0x2E,0x26,0xC5,0x1A,0x99,0xAE,0x36,0x00,0x55,0x55,
+  0xB8,0x60,0x22,0x0D,0xA7,0x89,0x90,0xB6,0x10,0x79,0xB4,0x25,
+  0x74,0x9A,0xDD,0x6B,0xE4,0x31,0xCB,0x32,0x5A,0x80,0xAB,0x00,
+  0x44,0x9A,0xA0,0xD1,0x28,0xAA,0x18,0xF7,0xB0,0xE2,0xE0,0x40,
+  0x7C,0x9F,0x88,0xC2,0xCC,0x79,0x3A,0x81,0x27,0x72,0x5E,0xA4,
+  0x75,0x21,0x47,0x90,0xF9,0x7B,0x3E,0x92,0x6E,0x95,0xB0,0xF1,
+  0xB0,0x7C,0xFB,0x65,0x99,0x73,0x98,0xA7,0x2B,0xA1,0x70,0xE0,
+  0xB8,0x8E,0xAE,0xC2,0xB4,0x00,0x6D,0x69,0x53,0x2B,0xC0,0x17,
+  0x49,0x92,0x22,0xB3,0x96,0x87,0xC0,0xF9,0x0D,0x2A,0x1A,0x06,
+  0xE6,0x4C,0xF2,0xBC,0x4F,0x95,0xCA,0x69,0xE6,0x5E,0xFD,0xDB,
+  0xDC,0x9F,0xD1,0x19,0x14,0x83,0x18,0x61,0x95,0xFB,0x7F,0xBC,
+  0xF8,0xE5,0x7D,0x6C,0x19,0x85,0xAB,0xCF,0x90,0xF6,0xD1,0x5B,
+  0x6B,0x31,0xA5,0x18,0x98,0xEC,0x20,0xCA,0xC7,0xEC,0xB9,0x83,
+  0xB6,0x53,0x50,0xB9,0x69,0xCC,0xEF,0x05,0xC5,0x2A,0x0A,0xBC,
+  0xFB,0x3C,0x8E,0x32,0xEC,0xF5,0xEE,0x79,0x42,0x47,0xE9,0xAA,
+  0x7C,0xF1,0x45,0x81,0x58,0x57,0x86,0xCB,0x78,0xC7,0x6D,0xC2,
+  0x5E,0x42,0x28,0x98,0x32,0xFE,0xAA,0x6D,0xD7,0xCC,0x81,0x99,
+  0xBB,0x62,0x68,0x82,0x6C,0xBB,0x40,0xDC,0xA8,0xDA,0x6A,0xD2,
+  0x08,0x25,0x84,0xA6,0x0C,0x7D,0x93,0xDD,0xC2,0x89,0x53,0x28,
+  0xDC,0x15,0x6E,0x63,0x40,0xE1,0x34,0xA3,0x03,0x3A,0x62,0x45,
+  0x23,0xB8,0x79,0x35,0x15,0x94,0xE8,0x98,0x8C,0x9D,0x09,0x1C,
+  0x20,0xAC,0xE8,0x92,0xF6,0xF4,0x73,0x44,0x52,0x9E,0x83,0x0D,
+  0xBB,0x20,0x4E,0xDC,0x8D,0x78,0x0E,0x69,0x42,0xF0,0xCC,0xE9,
+  0xD9,0xA2,0x5D,0x57,0x87,0x34,0x23,0x89,0xEA,0x12,0xB0,0xA6,
+  0x2D,0xFD,0x2E,0x2F,0xCE,0xFA,0xA6,0xDC,0xF3,0x96,0xAF,0x5A,
+  0xC0,0xB9,0x77,0xB3,0x5D,0x55,0xD6,0xD6,0x7A,0x76,0x84,0xE3,
+  0x52,0x65,0xFC,0xBE,0xD0,0x10,0xF7,0x23,0x5C,0x1E,0x81,0x91,
+  0x8D,0xF3,0xBC,0xC5,0xF3,0xA2,0xB2,0x77,0x08,0xA2,0x7F,0xDF,
+  0x2E,0xEA,0xC2,0xD7,0x4A,0x5F,0xC7,0x64,0x81,0x54,0x81,0xB5,
+  0xF3,0x46,0xB1,0x72,0xF7,0xA3,0x42,0x4E,0x1F,0xF4,0xCF,0x16,
+  0x6D,0x9A,0xFB,0x3F,0x27,0xD8,0x2A,0x63,0x34,0xF1,0x22,0x2A,
+  0xD1,0xB6,0xF2,0xF9,0xC2,0x8E,0x16,0xD9,0xD3,0x04,0xDD,0xF3,
+  0xC4,0xDC,0x5F,0x82,0xA7,0x0D,0x79,0x10,0xBC,0xC7,0x04,0xDC,
+  0x5F,0x82,0xB4,0x1E,0x6E,0xFB,0xA3,0xED,0xC1,0xED,0xB1,0x71,
+  0xCA,0x3D,0x65,0x30,0xC2,0xE6,0x57,0x2D,0x3A,0xC3,0xEB,0x47,
+  0x0B,0xEF,0xCB,0xA9,0x60,0x03,0xFA,0x9A,0x65,0xB1,0xE3,0xAF,
+  0x5A,0x55,0xBE,0xF3,0x3D,0x60,0x88,0x3B,0x4F,0x1B,0xB1,0x23,
+  0x26,0x15,0x45,0xE7,0x10,0xB0,0x34,0xB1,0x36,0xEB,0x83,0x48,
+  0x72,0xAE,0xF1,0x3C,0x75,0xFC,0x62,0xAF,0xEE,0x52,0xE4,0xBA,
+  0x48,0xF0,0x1B,0xA8,0x63,0x63,0x4D,0xC7,0x8D,0xFA,0xEF,0xE6,
+  0xA3,0x45,0xA7,0xA1,0xD9,0xF2,0x4F,0x22,0x34,0x63,0x2A,0xD8,
+  0x65,0x00,0xCC,0xF0,0x43,0x3C,0xAB,0x2E,0x20,0xC6,0xA8,0x86,
+  0x6F,0xC6,0xAE,0xA1,0x59,0xA3,0x08,0x93,0x2C,0xD3,0x04,0xEF,
+  0x51,0x00,0xB8,0xD4,0x75,0x4C,0xD3,0xD2,0x09,0x5C,0xCD,0x1C,
+  0xF1,0xEA,0x90,0x67,0xB3,0xF3,0xBD,0xA9,0x03,0x3B,0x23,0x78,
+  0x93,0x31,0xBD,0xC0,0x54,0xF0,0x3C,0x8F,0x5D,0xBB,0x2A,0x34,
+  0xE3,0x1F,0x29,0x36,0x38,0x9B,0x9B,0x93,0x17,0x7C,0x5A,0xCF,
+  0x18,0xFD,0x0D,0x99,0x07,0x77,0xFD,0x3D,0x15,0x17,0x14,0x4A,
+  0xD5,0x46,0x5C,0x8F,0x16,0xDC,0x91,0x1B,0xD1,0xB2,0xBD,0x3B,
+  0xB5,0x52,0x21,0x04,0x64,0x12,0x6C,0x56,0xE8,0x9E,0xEF,0x7C,
+  0x2A,0x4C,0xB2,0x33,0xC0,0xBC,0x2F,0x70,0xC6,0xBB,0xD4,0x81,
+  0x0D,0xBE,0xD7,0x9C,0x7A,0x87,0xAF,0x5B,0x73,0xC3,0xB3,0xFD,
+  0xFE,0x39,0xD1,0x14,0x84,0xA7,0xFA,0xEA,0x9A,0x11,0xDD,0xE4,
+  0x02,0x97,0x2A,0x3A,0x99,0xEA,0x33,0x44,0x71,0x88,0x6C,0x08,
+  0xB7,0x54,0xE1,0xAB,0x76,0xB4,0x95,0x56,0x6E,0xF9,0x1B,0x0C,
+  0xC8,0x25,0x26,0xE4,0xA5,0xF7,0xF8,0xBA,0xF3,0xD9,0xCE,0xC0,
+  0xE7,0x38,0xFD,0x1E,0x38,0xC7,0x6A,0x7D,0xA2,0x3F,0x77,0x56,
+  0x6E,0x5D,0xDE,0x2A,0xE2,0x7F,0x42,0x01,0xFA,0xF7,0xAC,0x40,
+  0x6D,0x5B,0x46,0x37,0xB8,0xFF,0xAE,0x25,0xE8,0x61,0x35,0xE8,
+  0x97,0xD9,0x26,0x19,0x42,0x6A,0xB6,0x40,0x76,0xF7,0xBA,0x37,
+  0x13,0x8D,0x49,0x91,0x87,0x27,0xD4,0x83,0xF3,0xD0,0x01,0x01,
+  0x7F,0xBD,0x1E,0xE1,0x65,0xAE,0xA4,0xCE,0xEF,0x87,0xB4,0x45,
+  0x36,0x1A,0x12,0x6F,0xF2,0xDC,0xF4,0x1F,0xF4,0xD2,0xCC,0x31,
+  0x19,0x67,0xBB,0x23,0xA2,0x9B,0x63,0x67,0x58,0x33,0xC0,0xFD,
+  0xD9,0x3D,0xB4,0xC7,0x95,0xDC,0x27,0x4C,0x11,0x93,0x98,0x1A,
+  0x9A,0x45,0x55,0x76,0x34,0xF6,0xDC,0xFB,0x1F,0x6A,0x75,0xAE,
+  0x7A,0x7B,0x5E,0x75,0xC3,0x5F,0xB5,0xF8,0xE2,0x3D,0x27,0xCD,
+  0xCE,0x9A,0xC7,0xF9,0xC0,0x6D,0x89,0x27,0x89,0x4C,0x66,0x60,
+  0x81,0xE8,0x71,0x35,0xF5,0x66,0x8F,0xEE,0xB0,0xBE,0xD4,0xAA,
+  0x3D,0x5D,0xFD,0xAF,0xCE,0x66,0x4D,0x07,0x3B,0xF0,0xF8,0x6B,
+  0xE2,0x4B,0xF3,0x14,0xFF,0xBC,0xAC,0x86,0xD5,0xCF,0xA9,0xBB,
+  0xAD,0xAD,0xAB,0x76,0xE7,0xE5,0x75,0x6B,0x14,0xA4,0x71,0xEF,
+  0xC8,0xF5,0xD3,0xFF,0xA5,0x62,0x3E,0x55,0x1C,0x81,0x7F,0x4C,
+  0x8A,0x8C,0x4F,0xFE,0x9B,0xE4,0x25,0x95,0x2E,0xA6,0xB5,0x4B,
+  0x56,0xA8,0x97,0x6F,0x84,0x48,0xE6,0x6E,0xC7,0xF3,0xAE,0xDA,
+  0xD7,0xDF,0x77,0x7E,0xE8,0xF5,0xFC,0xB4,0x75,0xEA,0x41,0xF8,
+  0xDA,0xD8,0xED,0xBC,0xC0,0x86,0xD8,0xFF,0x01,0x45,0xB5,0x8B,
+  0x96,0x48,0x1D,0x00,0x00,
+};
+const unsigned int src_www_build_logs_js_gz_len = 1985;
+
+
+const char type_svg[]  PROGMEM = "image/svg+xml";
+const char type_bmp[]  PROGMEM = "image/bmp";
+const char type_gif[]  PROGMEM = "image/gif";
+const char type_jpeg[] PROGMEM = "image/jpeg";
+const char type_jpg[]  PROGMEM = "image/jpeg";
+const char type_png[]  PROGMEM = "image/png";
+const char type_tiff[] PROGMEM = "image/tiff";
+const char type_tif[]  PROGMEM = "image/tiff";
+const char type_txt[]  PROGMEM = "text/plain";
+const char type_[]     PROGMEM = "text/plain";
+const char type_htm[]  PROGMEM = "text/html";
+const char type_html[] PROGMEM = "text/html";
+const char type_css[]  PROGMEM = "text/css";
+const char type_js[]   PROGMEM = "text/javascript";
+const char type_mjs[]  PROGMEM = "text/javascript";
+const char type_json[] PROGMEM = "application/json";
+// Must be at least one more than max string above...
+#define MAX_MIME_TYPE_LEN 20
+
+const std::unordered_map<std::string, std::tuple<const unsigned char *, const unsigned int, const char *, std::string>> webcontent = {
+  { "/favicon.png", {src_www_build_favicon_png_gz, src_www_build_favicon_png_gz_len, type_png, "VF79rA"} },
+  { "/auth", {src_www_build_auth_gz, src_www_build_auth_gz_len, type_, "AAAAAA"} },
+  { "/style.css", {src_www_build_style_css_gz, src_www_build_style_css_gz_len, type_css, "4FAMig"} },
+  { "/functions.js", {src_www_build_functions_js_gz, src_www_build_functions_js_gz_len, type_js, "vPQGew"} },
+  { "/index.html", {src_www_build_index_html_gz, src_www_build_index_html_gz_len, type_html, "2ARwfg"} },
+  { "/logs.html", {src_www_build_logs_html_gz, src_www_build_logs_html_gz_len, type_html, "xBRHig"} },
+  { "/settings-sliders.svg", {src_www_build_settings_sliders_svg_gz, src_www_build_settings_sliders_svg_gz_len, type_svg, "LSFQfw"} },
+  { "/wifiap.html", {src_www_build_wifiap_html_gz, src_www_build_wifiap_html_gz_len, type_html, "ChIOuw"} },
+  { "/wifinets", {src_www_build_wifinets_gz, src_www_build_wifinets_gz_len, type_, "j2qqww"} },
+  { "/qrcode.svg", {src_www_build_qrcode_svg_gz, src_www_build_qrcode_svg_gz_len, type_svg, "PUEOJQ"} },
+  { "/garage-car.svg", {src_www_build_garage_car_svg_gz, src_www_build_garage_car_svg_gz_len, type_svg, "Qcbrqg"} },
+  { "/apple-touch-icon.png", {src_www_build_apple_touch_icon_png_gz, src_www_build_apple_touch_icon_png_gz_len, type_png, "OvS78w"} },
+  { "/logs.js", {src_www_build_logs_js_gz, src_www_build_logs_js_gz_len, type_js, "lou1RQ"} }
+};
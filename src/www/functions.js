@@ -127,6 +127,11 @@ function toggleSyslog() {
     }
 }
 
+// Show or hide the MQTT broker fields
+function toggleMqtt() {
+    document.getElementById("mqttTable").style.display = (this.event.target.checked) ? "table" : "none";
+}
+
 // Show or hide the static IP fields
 function toggleStaticIP() {
     document.getElementById("staticIPtable").style.display = (this.event.target.checked) ? "table" : "none";
@@ -278,6 +283,26 @@ function setElementsFromStatus(status) {
                 document.getElementById(key).checked = value;
                 document.getElementById("syslogTable").style.display = (value) ? "table" : "none";
                 break;
+            case "announceEn":
+                document.getElementById(key).checked = value;
+                break;
+            case "mqttEn":
+                document.getElementById(key).checked = value;
+                document.getElementById("mqttTable").style.display = (value) ? "table" : "none";
+                break;
+            case "webhookURL1":
+            case "webhookURL2":
+                // Only scheme and host are sent, full URL is write only
+                document.getElementById(key).placeholder = (value.length > 0) ? value + "/..." : "http://host:port/path";
+                break;
+            case "mqttServer":
+            case "mqttUser":
+            case "mqttTopic":
+                document.getElementById(key).value = value;
+                break;
+            case "mqttPort":
+                document.getElementById(key).placeholder = value;
+                break;
             case "enableNTP":
                 document.getElementById(key).checked = value;
                 document.getElementById("timeZoneTable").style.display = (value) ? "table" : "none";
@@ -824,6 +849,30 @@ async function saveSettings() {
     let syslogPort = document.getElementById("syslogPort").value.substring(0, 5);
     if (syslogPort.length == 0 || Number(syslogPort) == 0) syslogPort = serverStatus.syslogPort;
 
+    const announceEn = (document.getElementById("announceEn").checked) ? '1' : '0';
+    // Webhook URLs are never sent to the browser, only update one if user edited it (empty to remove)
+    const webhookEdited = (id) => document.getElementById(id).dataset.edited == "1";
+    const webhookURL1 = document.getElementById("webhookURL1").value.substring(0, 127).trim();
+    const webhookURL2 = document.getElementById("webhookURL2").value.substring(0, 127).trim();
+    for (const url of [webhookURL1, webhookURL2]) {
+        if (url.length > 0 && !url.startsWith("http://")) {
+            alert(`Webhook URL must start with http:// : ${url}`);
+            return;
+        }
+    }
+    const mqttEn = (document.getElementById("mqttEn").checked) ? '1' : '0';
+    const mqttServer = document.getElementById("mqttServer").value.substring(0, 63).trim();
+    let mqttPort = document.getElementById("mqttPort").value.substring(0, 5);
+    if (mqttPort.length == 0 || Number(mqttPort) == 0) mqttPort = serverStatus.mqttPort;
+    const mqttUser = document.getElementById("mqttUser").value.substring(0, 63).trim();
+    const mqttPassword = document.getElementById("mqttPassword").value.substring(0, 63);
+    let mqttTopic = document.getElementById("mqttTopic").value.substring(0, 31).trim();
+    if (mqttTopic.length == 0) mqttTopic = serverStatus.mqttTopic;
+    if (mqttEn == '1' && mqttServer.length == 0) {
+        alert("MQTT broker address required");
+        return;
+    }
+
     const staticIP = (document.getElementById("staticIP").checked) ? '1' : '0';
     let localIP = document.getElementById("IPaddress").value.substring(0, 15);
     if (localIP.length == 0) localIP = serverStatus.localIP;
@@ -866,7 +915,17 @@ async function saveSettings() {
         "timeZone", timeZone,
         "syslogEn", syslogEn,
         "syslogIP", syslogIP,
-        "syslogPort", syslogPort
+        "syslogPort", syslogPort,
+        "announceEn", announceEn,
+        ...(webhookEdited("webhookURL1") ? ["webhookURL1", webhookURL1] : []),
+        ...(webhookEdited("webhookURL2") ? ["webhookURL2", webhookURL2] : []),
+        "mqttEn", mqttEn,
+        "mqttServer", mqttServer,
+        "mqttPort", mqttPort,
+        "mqttUser", mqttUser,
+        "mqttTopic", mqttTopic,
+        // Password is never sent to the browser, only update it if user typed one
+        ...(mqttPassword.length > 0 ? ["mqttPassword", mqttPassword] : [])
     );
     if (reboot) {
         countdown(rebootSeconds, "Settings saved, RATGDO device rebooting...&nbsp;");
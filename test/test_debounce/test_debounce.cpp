@@ -0,0 +1,188 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ * Dry contact limit switch edge ring and debouncer.
+ *
+ *   pio test -e native -f test_debounce
+ */
+
+// C/C++ language includes
+#include <stdint.h>
+
+// Unity test framework
+#include <unity.h>
+
+// RATGDO project includes
+#include "Debounce.h"
+
+#define SETTLE 50
+
+void setUp(void) {}
+void tearDown(void) {}
+
+/****************************************************************************
+ * Debouncer
+ */
+void test_bounce_shorter_than_settle(void)
+{
+    Debouncer d(SETTLE, false);
+    // Contact chatters and ends up back where it started
+    TEST_ASSERT_FALSE(d.edge(true, 1000));
+    TEST_ASSERT_FALSE(d.edge(false, 1010));
+    TEST_ASSERT_FALSE(d.edge(true, 1020));
+    TEST_ASSERT_FALSE(d.edge(false, 1030));
+    TEST_ASSERT_FALSE(d.update(1030 + SETTLE - 1));
+    TEST_ASSERT_FALSE(d.update(1030 + SETTLE));
+    TEST_ASSERT_FALSE(d.update(5000));
+    TEST_ASSERT_FALSE(d.state());
+    TEST_ASSERT_EQUAL(3, d.bounces());
+
+    // Each pulse shorter than settle time, however many, is never reported
+    for (uint32_t t = 6000; t < 7000; t += 20)
+    {
+        TEST_ASSERT_FALSE(d.edge(true, t));
+        TEST_ASSERT_FALSE(d.edge(false, t + 10));
+    }
+    TEST_ASSERT_FALSE(d.update(8000));
+    TEST_ASSERT_FALSE(d.state());
+}
+
+void test_stable_edge_reported_once(void)
+{
+    Debouncer d(SETTLE, false);
+    TEST_ASSERT_FALSE(d.edge(true, 2000));
+    TEST_ASSERT_FALSE(d.edge(false, 2005));
+    TEST_ASSERT_FALSE(d.edge(true, 2010));
+    // Settled SETTLE after the last edge, not the first
+    TEST_ASSERT_FALSE(d.update(2010 + SETTLE - 1));
+    TEST_ASSERT_FALSE(d.state());
+    TEST_ASSERT_TRUE(d.update(2010 + SETTLE));
+    TEST_ASSERT_TRUE(d.state());
+    // Time of change is the first edge of the burst
+    TEST_ASSERT_EQUAL_UINT32(2000, d.changedAt());
+    TEST_ASSERT_FALSE(d.update(2010 + SETTLE + 1));
+    TEST_ASSERT_FALSE(d.update(10000));
+    TEST_ASSERT_EQUAL_UINT32(2000, d.changedAt());
+}
+
+void test_late_processing(void)
+{
+    // Edges processed long after they happened give the same result, the next
+    // edge proves the one before it had settled
+    Debouncer d(SETTLE, false);
+    TEST_ASSERT_FALSE(d.edge(true, 3000));
+    TEST_ASSERT_TRUE(d.edge(false, 3000 + SETTLE + 10));
+    TEST_ASSERT_TRUE(d.state());
+    TEST_ASSERT_EQUAL_UINT32(3000, d.changedAt());
+    TEST_ASSERT_TRUE(d.update(9000));
+    TEST_ASSERT_FALSE(d.state());
+    TEST_ASSERT_EQUAL_UINT32(3000 + SETTLE + 10, d.changedAt());
+}
+
+void test_timestamp_wrap(void)
+{
+    // Microsecond timestamps wrap every 71 minutes
+    Debouncer d(SETTLE, false);
+    TEST_ASSERT_FALSE(d.edge(true, UINT32_MAX - 20));
+    TEST_ASSERT_FALSE(d.edge(false, UINT32_MAX - 10));
+    TEST_ASSERT_FALSE(d.edge(true, 5));
+    TEST_ASSERT_EQUAL(2, d.bounces());
+    TEST_ASSERT_FALSE(d.update(5 + SETTLE - 1));
+    TEST_ASSERT_TRUE(d.update(5 + SETTLE));
+    TEST_ASSERT_TRUE(d.state());
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX - 20, d.changedAt());
+
+    // Edge just before wrap, checked just after, not yet settled
+    TEST_ASSERT_FALSE(d.edge(false, UINT32_MAX - 5));
+    TEST_ASSERT_FALSE(d.update(10));
+    TEST_ASSERT_TRUE(d.update(SETTLE - 6));
+    TEST_ASSERT_FALSE(d.state());
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX - 5, d.changedAt());
+}
+
+/****************************************************************************
+ * EdgeRing
+ */
+void test_ring_order(void)
+{
+    EdgeRing<8> ring;
+    Edge e;
+    TEST_ASSERT_FALSE(ring.pop(e));
+    // Many times round, so 8 bit head and tail wrap too
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        for (uint32_t j = 0; j < (i % 8) + 1; j++)
+            TEST_ASSERT_TRUE(ring.push(i * 10 + j, j & 1));
+        for (uint32_t j = 0; j < (i % 8) + 1; j++)
+        {
+            TEST_ASSERT_TRUE(ring.pop(e));
+            TEST_ASSERT_EQUAL_UINT32(i * 10 + j, e.at);
+            TEST_ASSERT_EQUAL(j & 1, e.level);
+        }
+        TEST_ASSERT_FALSE(ring.pop(e));
+    }
+    TEST_ASSERT_EQUAL(0, ring.overflows());
+}
+
+void test_ring_overflow(void)
+{
+    EdgeRing<8> ring;
+    Edge e;
+    for (uint32_t i = 0; i < 8; i++)
+        TEST_ASSERT_TRUE(ring.push(i, 1));
+    // Full, newest edges are dropped and counted, older ones kept
+    TEST_ASSERT_FALSE(ring.push(100, 0));
+    TEST_ASSERT_FALSE(ring.push(101, 1));
+    TEST_ASSERT_EQUAL(2, ring.overflows());
+
+    TEST_ASSERT_TRUE(ring.pop(e));
+    TEST_ASSERT_EQUAL_UINT32(0, e.at);
+    TEST_ASSERT_TRUE(ring.push(8, 0));
+    TEST_ASSERT_FALSE(ring.push(9, 0));
+    TEST_ASSERT_EQUAL(3, ring.overflows());
+    for (uint32_t i = 1; i <= 8; i++)
+    {
+        TEST_ASSERT_TRUE(ring.pop(e));
+        TEST_ASSERT_EQUAL_UINT32(i, e.at);
+    }
+    TEST_ASSERT_FALSE(ring.pop(e));
+}
+
+void test_ring_to_debouncer(void)
+{
+    // As drycontact_loop uses them, edges from ISR drained into debouncer
+    EdgeRing<16> ring;
+    Debouncer d(SETTLE, true);
+    const uint32_t edges[] = {100, 103, 110, 118, 125};
+    uint8_t level = 1;
+    for (uint32_t at : edges)
+        ring.push(at, level ^= 1);
+    Edge e;
+    uint32_t changes = 0;
+    while (ring.pop(e))
+        changes += d.edge(e.level, e.at);
+    changes += d.update(125 + SETTLE);
+    TEST_ASSERT_EQUAL(1, changes);
+    TEST_ASSERT_FALSE(d.state());
+    TEST_ASSERT_EQUAL_UINT32(100, d.changedAt());
+    TEST_ASSERT_EQUAL(4, d.bounces());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_bounce_shorter_than_settle);
+    RUN_TEST(test_stable_edge_reported_once);
+    RUN_TEST(test_late_processing);
+    RUN_TEST(test_timestamp_wrap);
+    RUN_TEST(test_ring_order);
+    RUN_TEST(test_ring_overflow);
+    RUN_TEST(test_ring_to_debouncer);
+    return UNITY_END();
+}
@@ -0,0 +1,235 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ * Dry contact toggle pulse, driven by the shim esp_timer on the virtual clock.
+ *
+ *   pio test -e native -f test_drycontact
+ */
+
+// C/C++ language includes
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// Unity test framework
+#include <unity.h>
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "config.h"
+#include "protocol.h"
+#include "log.h"
+
+// Native shims
+#include "native.h"
+
+#define PULSE_MS 500
+#define GAP_MS 1000
+
+static DryContactProtocol dc;
+
+struct pulse
+{
+    uint32_t start; // milliseconds after watch() was called
+    uint32_t end;
+};
+
+static int output()
+{
+    return native_gpio_output(UART_TX_PIN);
+}
+
+// Step the clock a millisecond at a time, recording pulses on the output. An
+// action can be run at a given time.
+static std::vector<pulse> watch(uint32_t ms, uint32_t actionAt = UINT32_MAX, void (*action)() = NULL)
+{
+    std::vector<pulse> pulses;
+    int level = output();
+    if (level)
+        pulses.push_back({0, UINT32_MAX});
+    for (uint32_t t = 1; t <= ms; t++)
+    {
+        native_clock_advance(1000);
+        if (t == actionAt)
+            action();
+        int now = output();
+        if (now && !level)
+            pulses.push_back({t, UINT32_MAX});
+        else if (!now && level)
+            pulses.back().end = t;
+        level = now;
+    }
+    return pulses;
+}
+
+// Collects the message log so tests can look for what was logged
+class stringPrint : public Print
+{
+public:
+    std::string text;
+    size_t write(uint8_t c) override
+    {
+        text += (char)c;
+        return 1;
+    }
+};
+
+static uint32_t logged(const char *msg)
+{
+    stringPrint log;
+    ratgdoLogger->printMessageLog(log);
+    uint32_t count = 0;
+    for (size_t at = log.text.find(msg); at != std::string::npos; at = log.text.find(msg, at + 1))
+        count++;
+    return count;
+}
+
+static void toggle()
+{
+    dc.door_command(DoorAction::Toggle);
+}
+
+void setUp(void)
+{
+    userConfig->set(cfg_dcPulseMs, PULSE_MS);
+    userConfig->set(cfg_dcPulseGapMs, GAP_MS);
+    // Let anything left from the last test finish
+    native_clock_advance(10 * 1000 * 1000);
+    TEST_ASSERT_EQUAL(0, output());
+}
+
+void tearDown(void) {}
+
+/****************************************************************************
+ * Pulse is timed by esp_timer, the caller does not wait for it
+ */
+void test_command_returns_immediately(void)
+{
+    uint64_t before = native_clock_us();
+    toggle();
+    TEST_ASSERT_EQUAL_UINT64(before, native_clock_us());
+    TEST_ASSERT_EQUAL(1, output());
+}
+
+/****************************************************************************
+ * IDLE, then PULSE for PULSE_MS, GUARD for GAP_MS, back to IDLE
+ */
+void test_pulse_then_guard(void)
+{
+    toggle();
+    std::vector<pulse> p = watch(PULSE_MS + GAP_MS);
+    TEST_ASSERT_EQUAL(1, p.size());
+    TEST_ASSERT_EQUAL_UINT32(0, p[0].start);
+    TEST_ASSERT_EQUAL_UINT32(PULSE_MS, p[0].end);
+
+    // Idle again, next command starts a pulse straight away
+    toggle();
+    TEST_ASSERT_EQUAL(1, output());
+    p = watch(PULSE_MS + GAP_MS);
+    TEST_ASSERT_EQUAL(1, p.size());
+    TEST_ASSERT_EQUAL_UINT32(PULSE_MS, p[0].end);
+}
+
+void test_held_during_guard(void)
+{
+    toggle();
+    // Guard time, command is held, output stays low until the guard time ends
+    std::vector<pulse> p = watch(PULSE_MS + GAP_MS + PULSE_MS + GAP_MS, PULSE_MS + 10, toggle);
+    TEST_ASSERT_EQUAL(2, p.size());
+    TEST_ASSERT_EQUAL_UINT32(PULSE_MS, p[0].end);
+    TEST_ASSERT_EQUAL_UINT32(PULSE_MS + GAP_MS, p[1].start);
+    TEST_ASSERT_EQUAL_UINT32(PULSE_MS + GAP_MS + PULSE_MS, p[1].end);
+}
+
+void test_held_during_pulse(void)
+{
+    toggle();
+    std::vector<pulse> p = watch(PULSE_MS + GAP_MS + PULSE_MS + GAP_MS, 100, toggle);
+    // Not merged into the pulse in progress, sent after its guard time
+    TEST_ASSERT_EQUAL(2, p.size());
+    TEST_ASSERT_EQUAL_UINT32(PULSE_MS, p[0].end);
+    TEST_ASSERT_EQUAL_UINT32(PULSE_MS + GAP_MS, p[1].start);
+    TEST_ASSERT_EQUAL_UINT32(PULSE_MS + GAP_MS + PULSE_MS, p[1].end);
+}
+
+/****************************************************************************
+ * Only one request is held, any more while it waits are dropped
+ */
+void test_third_request_dropped(void)
+{
+    uint32_t held = logged("next pulse held");
+    uint32_t dropped = logged("dropping door command");
+    toggle();
+    toggle();
+    TEST_ASSERT_EQUAL(held + 1, logged("next pulse held"));
+    TEST_ASSERT_EQUAL(dropped, logged("dropping door command"));
+    toggle();
+    TEST_ASSERT_EQUAL(held + 1, logged("next pulse held"));
+    TEST_ASSERT_EQUAL(dropped + 1, logged("dropping door command"));
+    // And another during the guard time, while the second still waits
+    std::vector<pulse> p = watch(3 * (PULSE_MS + GAP_MS), PULSE_MS + 10, toggle);
+    TEST_ASSERT_EQUAL(dropped + 2, logged("dropping door command"));
+    TEST_ASSERT_EQUAL(2, p.size());
+    TEST_ASSERT_EQUAL_UINT32(PULSE_MS + GAP_MS, p[1].start);
+}
+
+/****************************************************************************
+ * Pulse and guard times are read from settings when a pulse starts
+ */
+void test_settings(void)
+{
+    userConfig->set(cfg_dcPulseMs, 200);
+    userConfig->set(cfg_dcPulseGapMs, 300);
+    toggle();
+    std::vector<pulse> p = watch(1000, 1, toggle);
+    TEST_ASSERT_EQUAL(2, p.size());
+    TEST_ASSERT_EQUAL_UINT32(200, p[0].end);
+    TEST_ASSERT_EQUAL_UINT32(500, p[1].start);
+    TEST_ASSERT_EQUAL_UINT32(700, p[1].end);
+}
+
+void test_pulse_limits(void)
+{
+    // Clamped when set from the web page
+    configSetting actions = userConfig->getDetail(cfg_dcPulseMs);
+    TEST_ASSERT_TRUE(actions.fn(cfg_dcPulseMs, "60000", &actions));
+    TEST_ASSERT_EQUAL(DC_PULSE_MAX_MS, userConfig->getDCPulseMs());
+    TEST_ASSERT_TRUE(actions.fn(cfg_dcPulseMs, "1", &actions));
+    TEST_ASSERT_EQUAL(DC_PULSE_MIN_MS, userConfig->getDCPulseMs());
+
+    // Settings saved before limits were enforced are clamped when read
+    userConfig->set(cfg_dcPulseMs, 60000);
+    toggle();
+    std::vector<pulse> p = watch(DC_PULSE_MAX_MS + GAP_MS);
+    TEST_ASSERT_EQUAL(1, p.size());
+    TEST_ASSERT_EQUAL_UINT32(DC_PULSE_MAX_MS, p[0].end);
+
+    userConfig->set(cfg_dcPulseMs, 0);
+    toggle();
+    p = watch(PULSE_MS + GAP_MS);
+    TEST_ASSERT_EQUAL(1, p.size());
+    TEST_ASSERT_EQUAL_UINT32(DC_PULSE_MIN_MS, p[0].end);
+}
+
+int main(int argc, char **argv)
+{
+    native_clock_set(60ULL * 1000 * 1000);
+    userConfig->load();
+    dc.setup();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_command_returns_immediately);
+    RUN_TEST(test_pulse_then_guard);
+    RUN_TEST(test_held_during_guard);
+    RUN_TEST(test_held_during_pulse);
+    RUN_TEST(test_third_request_dropped);
+    RUN_TEST(test_settings);
+    RUN_TEST(test_pulse_limits);
+    return UNITY_END();
+}
@@ -0,0 +1,411 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ * Improv serial frame builder and parser, against frames as improv.py sends
+ * and expects them.
+ *
+ *   pio test -e native -f test_improv
+ */
+
+// C/C++ language includes
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+#include <vector>
+
+// Unity test framework
+#include <unity.h>
+
+// RATGDO project includes
+#include "Improv.h"
+
+using namespace improv;
+
+typedef std::vector<uint8_t> bytes;
+
+/*
+ * Frames as improv.py builds them, header through checksum followed by newline.
+ */
+static bytes py_frame(uint8_t type, const bytes &data)
+{
+    bytes f = {'I', 'M', 'P', 'R', 'O', 'V', IMPROV_SERIAL_VERSION, type, (uint8_t)data.size()};
+    f.insert(f.end(), data.begin(), data.end());
+    uint8_t sum = 0;
+    for (uint8_t b : f)
+        sum += b;
+    f.push_back(sum);
+    f.push_back('\n');
+    return f;
+}
+
+static bytes py_rpc(Command command, const bytes &args)
+{
+    bytes data = {command, (uint8_t)args.size()};
+    data.insert(data.end(), args.begin(), args.end());
+    return py_frame(TYPE_RPC, data);
+}
+
+static bytes py_wifi(const std::string &ssid, const std::string &password)
+{
+    bytes args = {(uint8_t)ssid.size()};
+    args.insert(args.end(), ssid.begin(), ssid.end());
+    args.push_back(password.size());
+    args.insert(args.end(), password.begin(), password.end());
+    return py_rpc(WIFI_SETTINGS, args);
+}
+
+struct parseCount
+{
+    uint32_t commands = 0;
+    uint32_t errors = 0;
+};
+
+// Feed bytes to parser, counting results
+static parseCount feed(ImprovParser &parser, const bytes &data)
+{
+    parseCount count;
+    for (uint8_t b : data)
+    {
+        ParseResult r = parser.push_byte(b);
+        if (r == PARSE_COMMAND)
+            count.commands++;
+        else if (r == PARSE_ERROR)
+            count.errors++;
+    }
+    return count;
+}
+
+static bytes frame_bytes(const ImprovFrame &f)
+{
+    return bytes(f.data(), f.data() + f.size());
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+/****************************************************************************
+ * Frames we receive, each RPC command improv.py sends
+ */
+void test_rpc_commands(void)
+{
+    const Command commands[] = {GET_CURRENT_STATE, GET_DEVICE_INFO, GET_WIFI_NETWORKS};
+    for (Command c : commands)
+    {
+        ImprovParser parser;
+        parseCount n = feed(parser, py_rpc(c, {}));
+        TEST_ASSERT_EQUAL(1, n.commands);
+        TEST_ASSERT_EQUAL(0, n.errors);
+        TEST_ASSERT_EQUAL(c, parser.command().command);
+        TEST_ASSERT_EQUAL_STRING("", parser.command().ssid);
+    }
+}
+
+void test_wifi_settings(void)
+{
+    ImprovParser parser;
+    parseCount n = feed(parser, py_wifi("MyNetwork", "secret password"));
+    TEST_ASSERT_EQUAL(1, n.commands);
+    TEST_ASSERT_EQUAL(WIFI_SETTINGS, parser.command().command);
+    TEST_ASSERT_EQUAL_STRING("MyNetwork", parser.command().ssid);
+    TEST_ASSERT_EQUAL_STRING("secret password", parser.command().password);
+
+    // Open network has an empty password
+    n = feed(parser, py_wifi("Open", ""));
+    TEST_ASSERT_EQUAL(1, n.commands);
+    TEST_ASSERT_EQUAL_STRING("Open", parser.command().ssid);
+    TEST_ASSERT_EQUAL_STRING("", parser.command().password);
+    TEST_ASSERT_EQUAL(2, parser.frames());
+    TEST_ASSERT_EQUAL(0, parser.errors());
+}
+
+/****************************************************************************
+ * Frames we send, each state, error and RPC response improv.py reads
+ */
+void test_state_frames(void)
+{
+    const State states[] = {STATE_STOPPED, STATE_AWAITING_AUTHORIZATION, STATE_AUTHORIZED,
+                            STATE_PROVISIONING, STATE_PROVISIONED};
+    for (State s : states)
+    {
+        ImprovFrame f;
+        bytes expect = py_frame(TYPE_CURRENT_STATE, {s});
+        expect.pop_back(); // no newline
+        TEST_ASSERT_EQUAL(expect.size(), f.state(s).size());
+        TEST_ASSERT_EQUAL_MEMORY(expect.data(), f.data(), expect.size());
+    }
+}
+
+void test_error_frames(void)
+{
+    const Error errors[] = {ERROR_NONE, ERROR_INVALID_RPC, ERROR_UNKNOWN_RPC, ERROR_UNABLE_TO_CONNECT,
+                            ERROR_NOT_AUTHORIZED, ERROR_UNKNOWN};
+    for (Error e : errors)
+    {
+        ImprovFrame f;
+        bytes expect = py_frame(TYPE_ERROR_STATE, {e});
+        expect.pop_back();
+        TEST_ASSERT_EQUAL(expect.size(), f.error(e).size());
+        TEST_ASSERT_EQUAL_MEMORY(expect.data(), f.data(), expect.size());
+    }
+}
+
+void test_rpc_responses(void)
+{
+    ImprovFrame f;
+    // Device info, as sent in reply to improv.py -i
+    f.rpc(GET_DEVICE_INFO, {"ratgdo32", "v3.0.0", "ESP32", "Garage Door"});
+    bytes strings = {};
+    for (const char *s : {"ratgdo32", "v3.0.0", "ESP32", "Garage Door"})
+    {
+        strings.push_back(strlen(s));
+        strings.insert(strings.end(), s, s + strlen(s));
+    }
+    bytes data = {GET_DEVICE_INFO, (uint8_t)strings.size()};
+    data.insert(data.end(), strings.begin(), strings.end());
+    bytes expect = py_frame(TYPE_RPC_RESPONSE, data);
+    expect.pop_back();
+    TEST_ASSERT_EQUAL(expect.size(), f.size());
+    TEST_ASSERT_EQUAL_MEMORY(expect.data(), f.data(), expect.size());
+    TEST_ASSERT_FALSE(f.overflow());
+
+    // End of network scan is a response with no strings
+    f.rpc(GET_WIFI_NETWORKS, {});
+    expect = py_frame(TYPE_RPC_RESPONSE, {GET_WIFI_NETWORKS, 0});
+    expect.pop_back();
+    TEST_ASSERT_EQUAL(expect.size(), f.size());
+    TEST_ASSERT_EQUAL_MEMORY(expect.data(), f.data(), expect.size());
+
+    // Our own frames pass the parser's checksum, and are not mistaken for commands
+    ImprovParser parser;
+    bytes all = frame_bytes(ImprovFrame().state(STATE_AUTHORIZED));
+    bytes more = frame_bytes(ImprovFrame().error(ERROR_UNKNOWN_RPC));
+    all.insert(all.end(), more.begin(), more.end());
+    more = frame_bytes(f);
+    all.insert(all.end(), more.begin(), more.end());
+    parseCount n = feed(parser, all);
+    TEST_ASSERT_EQUAL(0, n.commands);
+    TEST_ASSERT_EQUAL(0, n.errors);
+    TEST_ASSERT_EQUAL(3, parser.frames());
+}
+
+/****************************************************************************
+ * Malformed frames
+ */
+void test_bad_checksum(void)
+{
+    ImprovParser parser;
+    bytes f = py_rpc(GET_CURRENT_STATE, {});
+    f[f.size() - 2]++;
+    parseCount n = feed(parser, f);
+    TEST_ASSERT_EQUAL(0, n.commands);
+    TEST_ASSERT_EQUAL(1, n.errors);
+    TEST_ASSERT_EQUAL(ERROR_INVALID_RPC, parser.error());
+    TEST_ASSERT_EQUAL(1, parser.errors());
+
+    // and recovers for the next one
+    n = feed(parser, py_rpc(GET_CURRENT_STATE, {}));
+    TEST_ASSERT_EQUAL(1, n.commands);
+}
+
+void test_bad_length(void)
+{
+    ImprovParser parser;
+    // RPC data length longer than the frame holds
+    parseCount n = feed(parser, py_frame(TYPE_RPC, {GET_DEVICE_INFO, 5, 1, 2}));
+    TEST_ASSERT_EQUAL(0, n.commands);
+    TEST_ASSERT_EQUAL(1, n.errors);
+    TEST_ASSERT_EQUAL(ERROR_INVALID_RPC, parser.error());
+
+    // Too short to hold command and length
+    n = feed(parser, py_frame(TYPE_RPC, {GET_DEVICE_INFO}));
+    TEST_ASSERT_EQUAL(1, n.errors);
+    n = feed(parser, py_frame(TYPE_RPC, {}));
+    TEST_ASSERT_EQUAL(1, n.errors);
+
+    // String lengths that run past the end of the RPC data
+    n = feed(parser, py_rpc(WIFI_SETTINGS, {4, 'a', 'b'}));
+    TEST_ASSERT_EQUAL(1, n.errors);
+    n = feed(parser, py_rpc(WIFI_SETTINGS, {2, 'a', 'b', 9, 'c'}));
+    TEST_ASSERT_EQUAL(1, n.errors);
+    // Password missing altogether
+    n = feed(parser, py_rpc(WIFI_SETTINGS, {2, 'a', 'b'}));
+    TEST_ASSERT_EQUAL(1, n.errors);
+    TEST_ASSERT_EQUAL(0, n.commands);
+    TEST_ASSERT_EQUAL(6, parser.errors());
+}
+
+void test_wrong_version(void)
+{
+    ImprovParser parser;
+    bytes f = py_rpc(GET_CURRENT_STATE, {});
+    f[6] = IMPROV_SERIAL_VERSION + 1;
+    parseCount n = feed(parser, f);
+    // Not an Improv frame we understand, skipped as other traffic
+    TEST_ASSERT_EQUAL(0, n.commands);
+    TEST_ASSERT_EQUAL(0, n.errors);
+    TEST_ASSERT_EQUAL(0, parser.frames());
+
+    n = feed(parser, py_rpc(GET_CURRENT_STATE, {}));
+    TEST_ASSERT_EQUAL(1, n.commands);
+}
+
+void test_truncated(void)
+{
+    ImprovParser parser;
+    // Says 6 bytes of data but only 2 arrive, then improv.py tries again. The
+    // retry is taken as the rest of the first frame and fails its checksum, the
+    // one after that gets through.
+    bytes f = py_rpc(GET_DEVICE_INFO, {1, 2, 3, 4});
+    f.resize(IMPROV_HEADER_LEN + 2);
+    bytes retry = py_rpc(GET_DEVICE_INFO, {});
+    f.insert(f.end(), retry.begin(), retry.end());
+    f.insert(f.end(), retry.begin(), retry.end());
+    parseCount n = feed(parser, f);
+    TEST_ASSERT_EQUAL(1, n.errors);
+    TEST_ASSERT_EQUAL(1, n.commands);
+    TEST_ASSERT_EQUAL(GET_DEVICE_INFO, parser.command().command);
+
+    // Frame cut off before its data, nothing reported until more arrives
+    ImprovParser parser2;
+    bytes head = py_rpc(GET_CURRENT_STATE, {});
+    head.resize(IMPROV_HEADER_LEN);
+    n = feed(parser2, head);
+    TEST_ASSERT_EQUAL(0, n.errors);
+    TEST_ASSERT_EQUAL(0, n.commands);
+}
+
+/****************************************************************************
+ * SSID and password limits, 32 and 64 characters
+ */
+void test_long_ssid_password(void)
+{
+    ImprovParser parser;
+    std::string ssid32(32, 's');
+    std::string pass64(64, 'p');
+    parseCount n = feed(parser, py_wifi(ssid32, pass64));
+    TEST_ASSERT_EQUAL(1, n.commands);
+    TEST_ASSERT_EQUAL_STRING(ssid32.c_str(), parser.command().ssid);
+    TEST_ASSERT_EQUAL_STRING(pass64.c_str(), parser.command().password);
+
+    n = feed(parser, py_wifi(ssid32 + "s", "password"));
+    TEST_ASSERT_EQUAL(0, n.commands);
+    TEST_ASSERT_EQUAL(1, n.errors);
+    TEST_ASSERT_EQUAL(ERROR_INVALID_RPC, parser.error());
+    // Command is cleared, nothing from the rejected frame is left behind
+    TEST_ASSERT_EQUAL_STRING("", parser.command().ssid);
+
+    n = feed(parser, py_wifi("network", pass64 + "p"));
+    TEST_ASSERT_EQUAL(0, n.commands);
+    TEST_ASSERT_EQUAL(1, n.errors);
+    TEST_ASSERT_EQUAL_STRING("", parser.command().password);
+
+    // Longest that fits in a frame is still caught
+    n = feed(parser, py_wifi(std::string(200, 's'), std::string(40, 'p')));
+    TEST_ASSERT_EQUAL(1, n.errors);
+}
+
+void test_response_overflow(void)
+{
+    ImprovFrame f;
+    std::string s100(100, 'x');
+    f.rpc(GET_WIFI_NETWORKS);
+    TEST_ASSERT_TRUE(f.add(s100.c_str()));
+    TEST_ASSERT_TRUE(f.add(s100.c_str()));
+    // 2 + 2 * 101 bytes used, another 100 does not fit and is left out
+    TEST_ASSERT_FALSE(f.add(s100.c_str()));
+    TEST_ASSERT_TRUE(f.overflow());
+    TEST_ASSERT_TRUE(f.add("-50"));
+    f.finish();
+    TEST_ASSERT_EQUAL(IMPROV_HEADER_LEN + 2 + 2 * 101 + 4 + 1, f.size());
+
+    // Still a good frame
+    ImprovParser parser;
+    feed(parser, frame_bytes(f));
+    TEST_ASSERT_EQUAL(1, parser.frames());
+    TEST_ASSERT_EQUAL(0, parser.errors());
+}
+
+/****************************************************************************
+ * Frames mixed in with other serial traffic
+ */
+void test_resync_after_garbage(void)
+{
+    ImprovParser parser;
+    const std::string noise[] = {
+        "boot: ESP-IDF v5.1\r\n",
+        "IMPR",                          // partial header
+        "IIMPRO",                        // restart part way through
+        "IMPROIMPROV",                   // header restarts at mismatch
+        std::string("\xff\x00\x01I", 4), // binary
+    };
+    bytes data;
+    for (const std::string &s : noise)
+    {
+        data.insert(data.end(), s.begin(), s.end());
+        bytes f = py_wifi("net", "pass");
+        data.insert(data.end(), f.begin(), f.end());
+    }
+    parseCount n = feed(parser, data);
+    TEST_ASSERT_EQUAL(5, n.commands);
+    TEST_ASSERT_EQUAL(0, n.errors);
+    TEST_ASSERT_EQUAL_STRING("net", parser.command().ssid);
+    TEST_ASSERT_EQUAL_STRING("pass", parser.command().password);
+}
+
+/****************************************************************************
+ * Throughput, a frame and a log line at a time
+ */
+void test_throughput(void)
+{
+    ImprovParser parser;
+    bytes data;
+    const char *log = ">>> [  12345] ratgdo-comms: Door state updated: Current: 1, Target: 1\r\n";
+    data.insert(data.end(), log, log + strlen(log));
+    bytes f = py_wifi("MyNetwork", "secret password");
+    data.insert(data.end(), f.begin(), f.end());
+
+    const uint32_t rounds = 100000;
+    parseCount total;
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < rounds; i++)
+    {
+        parseCount n = feed(parser, data);
+        total.commands += n.commands;
+        total.errors += n.errors;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    TEST_ASSERT_EQUAL(rounds, total.commands);
+    TEST_ASSERT_EQUAL(0, total.errors);
+
+    double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    char msg[100];
+    snprintf(msg, sizeof(msg), "Parsed %.1f MB/s, %.0f frames/s", rounds * data.size() / seconds / 1e6, rounds / seconds);
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_rpc_commands);
+    RUN_TEST(test_wifi_settings);
+    RUN_TEST(test_state_frames);
+    RUN_TEST(test_error_frames);
+    RUN_TEST(test_rpc_responses);
+    RUN_TEST(test_bad_checksum);
+    RUN_TEST(test_bad_length);
+    RUN_TEST(test_wrong_version);
+    RUN_TEST(test_truncated);
+    RUN_TEST(test_long_ssid_password);
+    RUN_TEST(test_response_overflow);
+    RUN_TEST(test_resync_after_garbage);
+    RUN_TEST(test_throughput);
+    return UNITY_END();
+}
@@ -0,0 +1,182 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ * Security+ 1.0 protocol, driven through the shim serial port.
+ *
+ *   pio test -e native -f test_sec1
+ */
+
+// C/C++ language includes
+#include <stdint.h>
+#include <vector>
+
+// Unity test framework
+#include <unity.h>
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "config.h"
+#include "comms.h"
+#include "protocol.h"
+
+// Native shims
+#include "native.h"
+
+static SecPlus1Protocol sec1;
+
+struct sentByte
+{
+    uint8_t value;
+    uint32_t at; // milliseconds after run() was called
+};
+
+// Wall panel asks for a status and the door opener replies, two bytes on the
+// bus, the loop reads them a byte at a time
+static void opener(uint8_t key, uint8_t value)
+{
+    uint8_t msg[2] = {key, value};
+    native_serial_inject(msg, sizeof(msg));
+    sec1.loop();
+    sec1.loop();
+    native_clock_advance(1000);
+}
+
+// Step the clock a millisecond at a time with the wall panel polling door
+// status every 100ms, as it does, recording bytes we send. With a wall panel
+// present we only send in the gap after a poll.
+static std::vector<sentByte> run(uint32_t ms)
+{
+    std::vector<sentByte> sent;
+    for (uint32_t t = 0; t < ms; t++)
+    {
+        if (t % 100 == 0)
+            opener(0x38, 0x55);
+        else
+            native_clock_advance(1000);
+        sec1.loop();
+        uint8_t b[4];
+        size_t len = native_serial_sent(b, sizeof(b));
+        for (size_t i = 0; i < len; i++)
+            sent.push_back({b[i], t});
+    }
+    return sent;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+/****************************************************************************
+ * Status from the door opener
+ */
+void test_door_status_seen_twice(void)
+{
+    // Sec+1.0 openers sometimes report the wrong state, so each must be seen
+    // twice in a row
+    opener(0x38, 0x55);
+    TEST_ASSERT_EQUAL(DoorState::Unknown, doorState);
+    TEST_ASSERT_FALSE(garage_door.active);
+    opener(0x38, 0x55);
+    TEST_ASSERT_EQUAL(DoorState::Closed, doorState);
+    TEST_ASSERT_TRUE(garage_door.active);
+    TEST_ASSERT_EQUAL(CURR_CLOSED, garage_door.current_state);
+    TEST_ASSERT_EQUAL(TGT_CLOSED, garage_door.target_state);
+}
+
+void test_door_transitions(void)
+{
+    opener(0x38, 0x51);
+    opener(0x38, 0x51);
+    TEST_ASSERT_EQUAL(CURR_OPENING, garage_door.current_state);
+    TEST_ASSERT_EQUAL(TGT_OPEN, garage_door.target_state);
+    opener(0x38, 0x52);
+    opener(0x38, 0x52);
+    TEST_ASSERT_EQUAL(CURR_OPEN, garage_door.current_state);
+
+    // Single odd report is ignored
+    opener(0x38, 0x54);
+    opener(0x38, 0x52);
+    TEST_ASSERT_EQUAL(CURR_OPEN, garage_door.current_state);
+    // So is a corrupt one (upper nibble must be 0x0, 0x5 or 0xB)
+    opener(0x38, 0x24);
+    opener(0x38, 0x24);
+    TEST_ASSERT_EQUAL(CURR_OPEN, garage_door.current_state);
+
+    opener(0x38, 0x04);
+    opener(0x38, 0x04);
+    TEST_ASSERT_EQUAL(CURR_CLOSING, garage_door.current_state);
+    TEST_ASSERT_EQUAL(TGT_CLOSED, garage_door.target_state);
+    opener(0x38, 0x56);
+    opener(0x38, 0x56);
+    TEST_ASSERT_EQUAL(CURR_STOPPED, garage_door.current_state);
+    opener(0x38, 0x55);
+    opener(0x38, 0x55);
+    TEST_ASSERT_EQUAL(CURR_CLOSED, garage_door.current_state);
+}
+
+void test_light_lock_status(void)
+{
+    // Light is bit 2, lock bit 3 is clear when locked
+    opener(0x3A, 0x54);
+    TEST_ASSERT_TRUE(garage_door.light);
+    TEST_ASSERT_EQUAL(CURR_LOCKED, garage_door.current_lock);
+    TEST_ASSERT_EQUAL(TGT_LOCKED, garage_door.target_lock);
+    opener(0x3A, 0x58);
+    TEST_ASSERT_FALSE(garage_door.light);
+    TEST_ASSERT_EQUAL(CURR_UNLOCKED, garage_door.current_lock);
+    // Upper nibble must be 0x5
+    opener(0x3A, 0x44);
+    TEST_ASSERT_FALSE(garage_door.light);
+}
+
+/****************************************************************************
+ * Commands to the door opener, button presses as a wall panel sends them
+ */
+void test_door_command_encoding(void)
+{
+    sec1.door_command(DoorAction::Toggle);
+    std::vector<sentByte> sent = run(1000);
+    TEST_ASSERT_EQUAL(3, sent.size());
+    TEST_ASSERT_EQUAL_HEX8(0x30, sent[0].value); // press
+    TEST_ASSERT_EQUAL_HEX8(0x31, sent[1].value); // release, twice
+    TEST_ASSERT_EQUAL_HEX8(0x31, sent[2].value);
+    TEST_ASSERT_GREATER_THAN_UINT32(250, sent[1].at - sent[0].at);
+    TEST_ASSERT_GREATER_THAN_UINT32(40, sent[2].at - sent[1].at);
+}
+
+void test_light_command_encoding(void)
+{
+    opener(0x3A, 0x58);
+    door_state.publish(garage_door);
+    // Light is a toggle, so nothing is sent if it is already as asked
+    sec1.set_light(false);
+    TEST_ASSERT_EQUAL(0, run(500).size());
+
+    sec1.set_light(true);
+    std::vector<sentByte> sent = run(1000);
+    TEST_ASSERT_EQUAL(3, sent.size());
+    TEST_ASSERT_EQUAL_HEX8(0x32, sent[0].value);
+    TEST_ASSERT_EQUAL_HEX8(0x33, sent[1].value);
+    TEST_ASSERT_EQUAL_HEX8(0x33, sent[2].value);
+    TEST_ASSERT_GREATER_THAN_UINT32(250, sent[1].at - sent[0].at);
+}
+
+int main(int argc, char **argv)
+{
+    native_clock_set(60ULL * 1000 * 1000);
+    userConfig->load();
+    sec1.setup();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_door_status_seen_twice);
+    RUN_TEST(test_door_transitions);
+    RUN_TEST(test_light_lock_status);
+    RUN_TEST(test_door_command_encoding);
+    RUN_TEST(test_light_command_encoding);
+    return UNITY_END();
+}
@@ -0,0 +1,201 @@
+/****************************************************************************
+ * RATGDO HomeKit for ESP32
+ * https://ratcloud.llc
+ * https://github.com/PaulWieland/ratgdo
+ *
+ * Copyright (c) 2023-24 David A Kerr... https://github.com/dkerr64/
+ * All Rights Reserved.
+ * Licensed under terms of the GPL-3.0 License.
+ *
+ * Security+ 2.0 protocol, driven through the shim serial port.
+ *
+ *   pio test -e native -f test_sec2
+ */
+
+// C/C++ language includes
+#include <stdint.h>
+#include <vector>
+
+// Unity test framework
+#include <unity.h>
+
+// RATGDO project includes
+#include "ratgdo.h"
+#include "config.h"
+#include "protocol.h"
+
+// Native shims
+#include "native.h"
+
+#define ID_CODE 0x123539
+#define OPENER_ID 0x5A5A5A
+// Rolling code saved before the reboot, setup() adds 10 in case later codes were not saved
+#define SAVED_ROLLING 100
+
+static SecPlus2Protocol sec2;
+static uint32_t openerRolling = 0x1000;
+
+// Door opener sends a status packet, the loop reads it a byte at a time
+static void opener_status(DoorState door, bool light, bool lock)
+{
+    PacketData d;
+    d.type = PacketDataType::Status;
+    d.value.status = StatusCommandData(0);
+    d.value.status.door = door;
+    d.value.status.light = light;
+    d.value.status.lock = lock;
+    Packet pkt(PacketCommand::Status, d, OPENER_ID);
+    uint8_t wire[SECPLUS2_CODE_LEN];
+    TEST_ASSERT_EQUAL(0, pkt.encode(openerRolling++, wire));
+    native_serial_inject(wire, sizeof(wire));
+    for (size_t i = 0; i < sizeof(wire); i++)
+        sec2.loop();
+}
+
+// Run the loop until the packet queue is empty, decode everything sent
+static std::vector<Packet> sent()
+{
+    for (uint8_t i = 0; i <= PKT_QUEUE_LENGTH; i++)
+    {
+        sec2.loop();
+        native_clock_advance(50 * 1000);
+    }
+    uint8_t wire[SECPLUS2_CODE_LEN * (PKT_QUEUE_LENGTH + 2)];
+    size_t len = native_serial_sent(wire, sizeof(wire));
+    TEST_ASSERT_EQUAL(0, len % SECPLUS2_CODE_LEN);
+    std::vector<Packet> pkts;
+    for (size_t i = 0; i < len; i += SECPLUS2_CODE_LEN)
+        pkts.push_back(Packet(&wire[i]));
+    return pkts;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+/****************************************************************************
+ * After a reboot rolling code jumps ahead of the saved one and is synced
+ */
+void test_sync_at_setup(void)
+{
+    nvRam->write(nvram_id_code, ID_CODE);
+    nvRam->write(nvram_rolling, SAVED_ROLLING);
+    sec2.setup();
+    std::vector<Packet> setupSent = sent();
+    TEST_ASSERT_EQUAL(3, setupSent.size());
+    TEST_ASSERT_EQUAL(PacketCommand::GetOpenings, setupSent[0].m_pkt_cmd);
+    TEST_ASSERT_EQUAL(PacketCommand::GetStatus, setupSent[1].m_pkt_cmd);
+    TEST_ASSERT_EQUAL(PacketCommand::GetStatus, setupSent[2].m_pkt_cmd);
+    for (uint32_t i = 0; i < setupSent.size(); i++)
+    {
+        TEST_ASSERT_EQUAL_UINT32(ID_CODE, setupSent[i].m_remote_id);
+        TEST_ASSERT_EQUAL_UINT32(SAVED_ROLLING + 10 + i, setupSent[i].m_rolling);
+    }
+}
+
+/****************************************************************************
+ * Status packets from the door opener
+ */
+void test_decode_status(void)
+{
+    opener_status(DoorState::Open, true, false);
+    TEST_ASSERT_TRUE(garage_door.active);
+    TEST_ASSERT_EQUAL(CURR_OPEN, garage_door.current_state);
+    TEST_ASSERT_EQUAL(TGT_OPEN, garage_door.target_state);
+    TEST_ASSERT_TRUE(garage_door.light);
+    TEST_ASSERT_EQUAL(CURR_UNLOCKED, garage_door.current_lock);
+    TEST_ASSERT_TRUE(status_done);
+    TEST_ASSERT_EQUAL(0, sent().size());
+
+    opener_status(DoorState::Open, false, true);
+    TEST_ASSERT_FALSE(garage_door.light);
+    TEST_ASSERT_EQUAL(CURR_LOCKED, garage_door.current_lock);
+    TEST_ASSERT_EQUAL(TGT_LOCKED, garage_door.target_lock);
+}
+
+void test_door_transitions(void)
+{
+    opener_status(DoorState::Open, false, false);
+    opener_status(DoorState::Closing, false, false);
+    TEST_ASSERT_EQUAL(CURR_CLOSING, garage_door.current_state);
+    TEST_ASSERT_EQUAL(TGT_CLOSED, garage_door.target_state);
+    TEST_ASSERT_EQUAL(0, sent().size());
+
+    // Opener count goes up once per cycle, so is asked for once door closes
+    opener_status(DoorState::Closed, false, false);
+    TEST_ASSERT_EQUAL(CURR_CLOSED, garage_door.current_state);
+    TEST_ASSERT_EQUAL(TGT_CLOSED, garage_door.target_state);
+    std::vector<Packet> p = sent();
+    TEST_ASSERT_EQUAL(1, p.size());
+    TEST_ASSERT_EQUAL(PacketCommand::GetOpenings, p[0].m_pkt_cmd);
+
+    opener_status(DoorState::Closed, false, false);
+    TEST_ASSERT_EQUAL(0, sent().size());
+
+    opener_status(DoorState::Opening, false, false);
+    TEST_ASSERT_EQUAL(CURR_OPENING, garage_door.current_state);
+    TEST_ASSERT_EQUAL(TGT_OPEN, garage_door.target_state);
+
+    opener_status(DoorState::Stopped, false, false);
+    TEST_ASSERT_EQUAL(CURR_STOPPED, garage_door.current_state);
+    TEST_ASSERT_EQUAL(TGT_OPEN, garage_door.target_state);
+    TEST_ASSERT_EQUAL(0, sent().size());
+}
+
+/****************************************************************************
+ * Commands to the door opener
+ */
+void test_door_command_encoding(void)
+{
+    sec2.door_command(DoorAction::Toggle);
+    std::vector<Packet> p = sent();
+    TEST_ASSERT_EQUAL(3, p.size());
+
+    TEST_ASSERT_EQUAL(PacketCommand::DoorAction, p[0].m_pkt_cmd);
+    TEST_ASSERT_EQUAL(DoorAction::Toggle, p[0].m_data.value.door_action.action);
+    TEST_ASSERT_TRUE(p[0].m_data.value.door_action.pressed);
+    TEST_ASSERT_EQUAL(1, p[0].m_data.value.door_action.id);
+
+    TEST_ASSERT_EQUAL(PacketCommand::DoorAction, p[1].m_pkt_cmd);
+    TEST_ASSERT_EQUAL(DoorAction::Toggle, p[1].m_data.value.door_action.action);
+    TEST_ASSERT_FALSE(p[1].m_data.value.door_action.pressed);
+
+    TEST_ASSERT_EQUAL(PacketCommand::GetStatus, p[2].m_pkt_cmd);
+
+    // Press and release share a rolling code
+    TEST_ASSERT_EQUAL_UINT32(p[0].m_rolling, p[1].m_rolling);
+    TEST_ASSERT_EQUAL_UINT32(p[1].m_rolling + 1, p[2].m_rolling);
+    for (Packet &pkt : p)
+        TEST_ASSERT_EQUAL_UINT32(ID_CODE, pkt.m_remote_id);
+}
+
+void test_light_lock_command_encoding(void)
+{
+    sec2.set_light(true);
+    sec2.set_lock(true);
+    std::vector<Packet> p = sent();
+    TEST_ASSERT_EQUAL(4, p.size());
+    TEST_ASSERT_EQUAL(PacketCommand::Light, p[0].m_pkt_cmd);
+    TEST_ASSERT_EQUAL(LightState::On, p[0].m_data.value.light.light);
+    TEST_ASSERT_EQUAL(PacketCommand::GetStatus, p[1].m_pkt_cmd);
+    TEST_ASSERT_EQUAL(PacketCommand::Lock, p[2].m_pkt_cmd);
+    TEST_ASSERT_EQUAL(LockState::On, p[2].m_data.value.lock.lock);
+    TEST_ASSERT_EQUAL(TGT_LOCKED, garage_door.target_lock);
+    TEST_ASSERT_EQUAL(PacketCommand::GetStatus, p[3].m_pkt_cmd);
+    // Each increments the rolling code
+    for (uint32_t i = 1; i < p.size(); i++)
+        TEST_ASSERT_EQUAL_UINT32(p[i - 1].m_rolling + 1, p[i].m_rolling);
+}
+
+int main(int argc, char **argv)
+{
+    native_clock_set(60ULL * 1000 * 1000);
+    userConfig->load();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_sync_at_setup);
+    RUN_TEST(test_decode_status);
+    RUN_TEST(test_door_transitions);
+    RUN_TEST(test_door_command_encoding);
+    RUN_TEST(test_light_lock_command_encoding);
+    return UNITY_END();
+}
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+#
+# Local HTTP stand-in for a webhook target. Prints each event ratgdo POSTs, and
+# reports missing or repeated sequence numbers...
+#
+#   python3 webhook_sink.py [--port 8080] [--fail 0.2] [--delay 0.5] [--outage 30]
+#                           [--check] [--events 20]
+#
+# then set a webhook URL of http://<this-host>:8080/ on the ratgdo settings page.
+# --fail answers that fraction of requests with HTTP 503, --delay holds each
+# response for that many seconds, and --outage stops answering for that many
+# seconds after the first event, to exercise retry and backoff. Events that are
+# redelivered after a failure are counted as repeats, not errors.
+#
+# --check makes it a pass/fail test, for scripts: it exits with status 1 at the
+# first gap or repeat in seq (a repeat is allowed only if --delay is longer than
+# ratgdo's 3 second timeout, as ratgdo then sends the event again), and with
+# status 0 once --events events have been received in order. Keep an outage
+# short enough that fewer than 32 events are held, or the oldest are dropped and
+# show as a gap.
+#
+# Copyright (c) 2024 David Kerr, https://github.com/dkerr64
+#
+import argparse
+import json
+import random
+import sys
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+
+class Sink:
+    def __init__(self, args):
+        self.args = args
+        self.hosts = {}  # host -> last seq
+        self.uptimes = {}  # host -> upTime of last event
+        self.received = 0
+        self.repeats = 0
+        self.missing = 0
+        self.failed = 0
+        self.outage_until = None
+        self.result = 0
+
+    def stop(self, server, result, why):
+        if self.result == 0:
+            self.result = result
+        print(why)
+        # shutdown() waits for serve_forever() to return, so can't be called from its thread
+        threading.Thread(target=server.shutdown).start()
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"  # keep-alive, so ratgdo can reuse the connection
+
+    def log_message(self, format, *args):
+        pass
+
+    def reply(self, code):
+        self.send_response(code)
+        self.send_header("Content-Length", "0")
+        self.end_headers()
+
+    def do_POST(self):
+        sink = self.server.sink
+        body = self.rfile.read(int(self.headers.get("Content-Length", 0)))
+        now = time.monotonic()
+        if sink.args.outage and sink.outage_until is None:
+            sink.outage_until = now + sink.args.outage
+        if sink.outage_until and now < sink.outage_until:
+            # Drop connection without answering, as if host were unreachable
+            self.close_connection = True
+            return
+        if random.random() < sink.args.fail:
+            sink.failed += 1
+            self.reply(503)
+            return
+        if sink.args.delay:
+            time.sleep(sink.args.delay)
+
+        event = json.loads(body)
+        host = event.get("host", self.client_address[0])
+        last = sink.hosts.get(host)
+        note = ""
+        error = None
+        if last is not None and event["seq"] <= last and event["upTime"] < sink.uptimes[host]:
+            # Rebooted without undelivered events to keep, numbering starts again
+            note = " (restarted)"
+            last = None
+        if last is not None:
+            if event["seq"] <= last:
+                sink.repeats += 1
+                note = " (repeat)"
+                if sink.args.delay <= 3:
+                    error = "seq %d repeated" % event["seq"]
+            elif event["seq"] != last + 1:
+                sink.missing += event["seq"] - last - 1
+                note = " (%d missing)" % (event["seq"] - last - 1)
+                error = "seq %d%s missing" % (last + 1, "" if event["seq"] == last + 2 else " to %d" % (event["seq"] - 1))
+        sink.hosts[host] = max(event["seq"], last or 0)
+        sink.uptimes[host] = event["upTime"]
+        sink.received += 1
+        age = "" if not event["time"] else ", %ds old" % (time.time() - event["time"])
+        print("%s seq %d: %s %s%s%s" % (host, event["seq"], event["event"], event["value"], age, note))
+        self.reply(200)
+
+        if sink.args.check:
+            if error:
+                sink.stop(self.server, 1, "FAIL: %s %s" % (host, error))
+            elif sink.args.events and sink.received >= sink.args.events:
+                sink.stop(self.server, 0, "PASS: %d events in order" % sink.received)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="ratgdo webhook test target")
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--fail", type=float, default=0.0, help="fraction of requests to fail with 503")
+    parser.add_argument("--delay", type=float, default=0.0, help="seconds to delay each response")
+    parser.add_argument("--outage", type=float, default=0.0, help="seconds to ignore requests after first event")
+    parser.add_argument("--check", action="store_true", help="exit with status 1 on a gap or repeat in seq")
+    parser.add_argument("--events", type=int, default=0, help="with --check, exit with status 0 after this many events")
+    args = parser.parse_args()
+
+    server = ThreadingHTTPServer(("", args.port), Handler)
+    server.sink = Sink(args)
+    print("Webhook sink listening on port %d" % args.port)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    s = server.sink
+    print("Received %d, repeats %d, missing %d, failed on purpose %d" % (s.received, s.repeats, s.missing, s.failed))
+    sys.exit(s.result)
+
+
+if __name__ == "__main__":
+    main()